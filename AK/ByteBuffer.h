@@ -43,7 +43,7 @@ public:
     {
         if (this != &other) {
             if (!m_inline)
-                kfree_sized(m_outline_buffer, m_outline_capacity);
+                free_outline_buffer();
             move_from(move(other));
         }
         return *this;
@@ -78,6 +78,18 @@ public:
         return { move(buffer) };
     }
 
+    // Wraps storage that the caller owns and keeps alive, such as a reserved range of address space. The buffer starts
+    // out empty, never reallocates or frees the storage, and can't grow past its size.
+    [[nodiscard]] static ByteBuffer create_unowned(Bytes storage)
+    {
+        ByteBuffer buffer;
+        buffer.m_outline_buffer = storage.data();
+        buffer.m_outline_capacity = storage.size();
+        buffer.m_inline = false;
+        buffer.m_owns_outline_buffer = false;
+        return buffer;
+    }
+
     [[nodiscard]] static ErrorOr<ByteBuffer> copy(void const* data, size_t size)
     {
         auto buffer = TRY(create_uninitialized(size));
@@ -173,7 +185,7 @@ public:
     void clear()
     {
         if (!m_inline) {
-            kfree_sized(m_outline_buffer, m_outline_capacity);
+            free_outline_buffer();
             m_inline = true;
         }
         m_size = 0;
@@ -192,7 +204,7 @@ public:
     void trim(size_t size, bool may_discard_existing_data)
     {
         VERIFY(size <= m_size);
-        if (!m_inline && size <= inline_capacity)
+        if (!m_inline && m_owns_outline_buffer && size <= inline_capacity)
             shrink_into_inline_buffer(size, may_discard_existing_data);
         m_size = size;
     }
@@ -320,6 +332,7 @@ public:
     {
         if (m_inline)
             return {};
+        VERIFY(m_owns_outline_buffer);
 
         auto buffer = bytes();
         m_inline = true;
@@ -333,6 +346,7 @@ private:
     {
         m_size = other.m_size;
         m_inline = other.m_inline;
+        m_owns_outline_buffer = other.m_owns_outline_buffer;
         if (!other.m_inline) {
             m_outline_buffer = other.m_outline_buffer;
             m_outline_capacity = other.m_outline_capacity;
@@ -342,6 +356,14 @@ private:
         }
         other.m_size = 0;
         other.m_inline = true;
+        other.m_owns_outline_buffer = true;
+    }
+
+    void free_outline_buffer()
+    {
+        if (m_owns_outline_buffer)
+            kfree_sized(m_outline_buffer, m_outline_capacity);
+        m_owns_outline_buffer = true;
     }
 
     NEVER_INLINE void shrink_into_inline_buffer(size_t size, bool may_discard_existing_data)
@@ -357,6 +379,9 @@ private:
 
     NEVER_INLINE ErrorOr<void> try_ensure_capacity_slowpath(size_t new_capacity)
     {
+        if (!m_owns_outline_buffer)
+            return Error::from_errno(ENOMEM);
+
         // When we are asked to raise the capacity by very small amounts,
         // the caller is perhaps appending very little data in many calls.
         // To avoid copying the entire ByteBuffer every single time,
@@ -390,6 +415,7 @@ private:
     };
     size_t m_size { 0 };
     bool m_inline { true };
+    bool m_owns_outline_buffer { true };
 };
 
 }
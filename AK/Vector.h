@@ -158,6 +158,15 @@ public:
         return m_metadata.outline_buffer;
     }
 
+    // Vectors without inline capacity always store their elements in the outline buffer, so generated code may load the
+    // data pointer from this offset directly.
+    [[nodiscard]] static constexpr size_t offset_of_outline_buffer()
+    requires(inline_capacity == 0)
+    {
+        using Metadata = Detail::VectorMetadata<want_fast_last_access, StorageType>;
+        return offsetof(Vector, m_metadata) + offsetof(Metadata, outline_buffer);
+    }
+
     ALWAYS_INLINE VisibleType const& at(size_t i) const
     {
         VERIFY(i < m_size);
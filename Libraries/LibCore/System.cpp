@@ -141,6 +141,13 @@ ErrorOr<void> munmap(void* address, size_t size)
     return {};
 }
 
+ErrorOr<void> mprotect(void* address, size_t size, int protection)
+{
+    if (::mprotect(address, size, protection) < 0)
+        return Error::from_syscall("mprotect"sv, errno);
+    return {};
+}
+
 ErrorOr<int> anon_create([[maybe_unused]] size_t size, [[maybe_unused]] int options)
 {
     int fd = -1;
@@ -872,14 +879,26 @@ ErrorOr<void> set_close_on_exec(int fd, bool enabled)
 
 ErrorOr<size_t> transfer_file_through_pipe(int source_fd, int target_fd, size_t source_offset, size_t source_length)
 {
+    if (source_length == 0)
+        return 0;
+
 #if defined(AK_OS_LINUX)
     auto sent = ::splice(source_fd, reinterpret_cast<off_t*>(&source_offset), target_fd, nullptr, source_length, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
-    if (sent < 0)
+    if (sent >= 0)
+        return sent;
+
+    // Not every file system supports splicing. In that case, fall back to the copying implementation below.
+    if (errno != EINVAL && errno != ENOSYS)
         return Error::from_syscall("send_file_to_pipe"sv, errno);
-    return sent;
-#else
+#endif
+
     static auto page_size = PAGE_SIZE;
 
+    // The pipe will not accept more than its capacity in a single write, so there is no use in mapping (and faulting
+    // in) more of the source file than that.
+    static constexpr size_t maximum_transfer_size = 1 * MiB;
+    source_length = min(source_length, maximum_transfer_size);
+
     // mmap requires the offset to be page-aligned, so we must handle that here.
     auto aligned_source_offset = (source_offset / page_size) * page_size;
     auto offset_adjustment = source_offset - aligned_source_offset;
@@ -890,7 +909,6 @@ ErrorOr<size_t> transfer_file_through_pipe(int source_fd, int target_fd, size_t
     ScopeGuard guard { [&]() { (void)munmap(mapped, mapped_source_length); } };
 
     return TRY(write(target_fd, { static_cast<u8*>(mapped) + offset_adjustment, source_length }));
-#endif
 }
 
 }
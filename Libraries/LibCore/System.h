@@ -75,6 +75,7 @@ ErrorOr<struct stat> fstatat(int fd, StringView path, int flags);
 ErrorOr<int> fcntl(int fd, int command, ...);
 ErrorOr<void*> mmap(void* address, size_t, int protection, int flags, int fd, off_t, size_t alignment = 0, StringView name = {});
 ErrorOr<void> munmap(void* address, size_t);
+ErrorOr<void> mprotect(void* address, size_t, int protection);
 ErrorOr<int> anon_create(size_t size, int options);
 ErrorOr<int> open(StringView path, int options, mode_t mode = 0);
 ErrorOr<int> openat(int fd, StringView path, int options, mode_t mode = 0);
@@ -216,6 +216,13 @@ ErrorOr<void> munmap(void* address, size_t size)
     return {};
 }
 
+ErrorOr<void> mprotect(void* address, size_t size, int protection)
+{
+    if (::mprotect(address, size, protection) < 0)
+        return Error::from_syscall("mprotect"sv, errno);
+    return {};
+}
+
 int getpid()
 {
     return GetCurrentProcessId();
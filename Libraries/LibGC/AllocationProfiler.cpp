@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/QuickSort.h>
+#include <AK/Stream.h>
+#include <LibGC/AllocationProfiler.h>
+
+namespace GC {
+
+AllocationProfiler::AllocationProfiler(size_t sampling_interval_in_bytes)
+    : m_sampling_interval_in_bytes(max(sampling_interval_in_bytes, 1uz))
+    , m_bytes_until_next_sample(m_sampling_interval_in_bytes)
+{
+}
+
+void AllocationProfiler::record_sample(StringView class_name, String stack)
+{
+    ++m_sample_count;
+    auto& samples_by_class = m_samples.ensure(move(stack));
+    ++samples_by_class.ensure(class_name, [] { return 0; });
+}
+
+Vector<AllocationProfiler::AllocationSite> AllocationProfiler::allocation_sites() const
+{
+    Vector<AllocationSite> sites;
+    for (auto const& [stack, samples_by_class] : m_samples) {
+        for (auto const& [class_name, sample_count] : samples_by_class) {
+            sites.append({
+                .class_name = class_name,
+                .stack = stack,
+                .sample_count = sample_count,
+                .estimated_bytes = sample_count * m_sampling_interval_in_bytes,
+            });
+        }
+    }
+
+    quick_sort(sites, [](auto const& a, auto const& b) {
+        if (a.estimated_bytes != b.estimated_bytes)
+            return a.estimated_bytes > b.estimated_bytes;
+        return a.class_name < b.class_name;
+    });
+    return sites;
+}
+
+ErrorOr<void> AllocationProfiler::write_report(Stream& stream) const
+{
+    TRY(stream.write_formatted("Allocation profile: {} samples, one every {} bytes\n", m_sample_count, m_sampling_interval_in_bytes));
+
+    for (auto const& site : allocation_sites()) {
+        TRY(stream.write_formatted("\n{} bytes ({} samples) of {}\n", site.estimated_bytes, site.sample_count, site.class_name));
+        if (site.stack.is_empty())
+            TRY(stream.write_until_depleted("    <no stack>\n"sv));
+        else
+            TRY(stream.write_until_depleted(site.stack.bytes_as_string_view()));
+    }
+    return {};
+}
+
+}
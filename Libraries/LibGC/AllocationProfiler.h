@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Error.h>
+#include <AK/HashMap.h>
+#include <AK/Noncopyable.h>
+#include <AK/String.h>
+#include <AK/Vector.h>
+#include <LibGC/Export.h>
+
+namespace GC {
+
+// Samples one allocation every time another sampling interval worth of bytes has been allocated, and attributes it to
+// the class of the allocated cell and the stack the embedder reports for it (e.g. the JS call stack). Every sample
+// stands for roughly one sampling interval of allocated bytes.
+class GC_API AllocationProfiler {
+    AK_MAKE_NONCOPYABLE(AllocationProfiler);
+    AK_MAKE_NONMOVABLE(AllocationProfiler);
+
+public:
+    static constexpr size_t default_sampling_interval_in_bytes = 16 * KiB;
+
+    explicit AllocationProfiler(size_t sampling_interval_in_bytes);
+
+    size_t sampling_interval_in_bytes() const { return m_sampling_interval_in_bytes; }
+    size_t sample_count() const { return m_sample_count; }
+
+    ALWAYS_INLINE bool should_sample(size_t size)
+    {
+        if (size < m_bytes_until_next_sample) {
+            m_bytes_until_next_sample -= size;
+            return false;
+        }
+        m_bytes_until_next_sample = m_sampling_interval_in_bytes;
+        return true;
+    }
+
+    void record_sample(StringView class_name, String stack);
+
+    struct AllocationSite {
+        StringView class_name;
+        String stack;
+        size_t sample_count { 0 };
+        size_t estimated_bytes { 0 };
+    };
+    Vector<AllocationSite> allocation_sites() const;
+
+    // Writes every allocation site, most allocated bytes first.
+    ErrorOr<void> write_report(Stream&) const;
+
+private:
+    size_t m_sampling_interval_in_bytes { 0 };
+    size_t m_bytes_until_next_sample { 0 };
+    size_t m_sample_count { 0 };
+
+    // Sample counts by stack, then by class name.
+    HashMap<String, HashMap<StringView, size_t>> m_samples;
+};
+
+}
@@ -5,10 +5,19 @@
  */
 
 #include <LibGC/Cell.h>
+#include <LibGC/Heap.h>
 #include <LibGC/NanBoxedValue.h>
 
 namespace GC {
 
+void Cell::remember()
+{
+    static_assert(offsetof(Cell, m_mark) == offset_of_mark());
+    static_assert(offsetof(Cell, m_remembered) == offset_of_remembered());
+
+    heap().remember_cell({}, *this);
+}
+
 void GC::Cell::Visitor::visit(NanBoxedValue const& value)
 {
     if (value.is_cell())
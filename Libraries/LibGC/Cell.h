@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
 #include <AK/Badge.h>
 #include <AK/Format.h>
 #include <AK/Forward.h>
@@ -37,6 +38,13 @@ public:                                            \
     }                                              \
     friend class GC::Heap;
 
+// Declares that every store of a cell pointer into an object of exactly this class (after construction) is followed by a
+// call to write_barrier(). Only cells of such classes become old; minor collections then only have to visit the edges
+// of old cells if they were written to since the last collection, or if they point to a cell without write barriers.
+// This is not inherited, since a subclass may add fields of its own.
+#define GC_DECLARE_WRITE_BARRIERS(class_) \
+    using ClassWithWriteBarriers = class_
+
 class GC_API Cell {
     AK_MAKE_NONCOPYABLE(Cell);
     AK_MAKE_NONMOVABLE(Cell);
@@ -47,6 +55,9 @@ public:
     bool is_marked() const { return m_mark; }
     void set_marked(bool b) { m_mark = b; }
 
+    // Used when several threads are marking at once. Returns whether the cell was already marked.
+    bool test_and_set_marked() { return AK::atomic_exchange(&m_mark, true, AK::memory_order_relaxed); }
+
     enum class State : bool {
         Live,
         Dead,
@@ -55,6 +66,25 @@ public:
     State state() const { return m_state; }
     void set_state(State state) { m_state = state; }
 
+    // Cells with write barriers stay marked after surviving a collection, which makes them part of the old generation
+    // until the next full collection. Storing a pointer to a (possibly young) cell into an old cell must be followed by
+    // a write barrier, so that the next minor collection knows to visit its edges.
+    ALWAYS_INLINE void write_barrier()
+    {
+        if (m_mark && !m_remembered) [[unlikely]]
+            remember();
+    }
+
+    bool is_remembered() const { return m_remembered; }
+    void set_remembered(Badge<Heap>, bool b) { m_remembered = b; }
+
+    bool has_write_barriers() const { return m_has_write_barriers; }
+    void set_has_write_barriers(Badge<Heap>) { m_has_write_barriers = true; }
+
+    // NOTE: Generated code checks both flags at once, which relies on them being adjacent.
+    static constexpr size_t offset_of_mark() { return sizeof(void*); }
+    static constexpr size_t offset_of_remembered() { return offset_of_mark() + 1; }
+
     virtual StringView class_name() const = 0;
 
     class GC_API Visitor {
@@ -188,7 +218,11 @@ protected:
     void set_overrides_must_survive_garbage_collection(bool b) { m_overrides_must_survive_garbage_collection = b; }
 
 private:
+    void remember();
+
     bool m_mark { false };
+    bool m_remembered { false };
+    bool m_has_write_barriers { false };
     bool m_overrides_must_survive_garbage_collection { false };
     State m_state { State::Live };
 } SWIFT_UNSAFE_REFERENCE;
@@ -5,6 +5,7 @@
  */
 
 #include <AK/Badge.h>
+#include <AK/Debug.h>
 #include <LibGC/BlockAllocator.h>
 #include <LibGC/CellAllocator.h>
 #include <LibGC/Heap.h>
@@ -23,6 +24,17 @@ Cell* CellAllocator::allocate_cell(Heap& heap)
     if (!m_list_node.is_in_list())
         heap.register_cell_allocator({}, *this);
 
+    // Sweeping a block that the last collection left behind is cheaper than asking the BlockAllocator for a new one.
+    // NOTE: A block without any live cells is kept rather than released here, since it's about to be allocated from.
+    while (m_usable_blocks.is_empty() && !m_blocks_to_sweep.is_empty()) {
+        auto& block = *m_blocks_to_sweep.first();
+        (void)block.sweep();
+        if (block.is_full())
+            m_full_blocks.append(block);
+        else
+            m_usable_blocks.append(block);
+    }
+
     if (m_usable_blocks.is_empty()) {
         auto block = HeapBlock::create_with_cell_size(heap, *this, m_cell_size, m_class_name);
         auto block_ptr = reinterpret_cast<FlatPtr>(block.ptr());
@@ -41,18 +53,38 @@ Cell* CellAllocator::allocate_cell(Heap& heap)
     return cell;
 }
 
-void CellAllocator::block_did_become_empty(Badge<Heap>, HeapBlock& block)
+void CellAllocator::add_block_to_sweep(Badge<Heap>, HeapBlock& block)
 {
     block.m_list_node.remove();
-    // NOTE: HeapBlocks are managed by the BlockAllocator, so we don't want to `delete` the block here.
-    block.~HeapBlock();
-    m_block_allocator.deallocate_block(&block);
+    m_blocks_to_sweep.append(block);
 }
 
-void CellAllocator::block_did_become_usable(Badge<Heap>, HeapBlock& block)
+void CellAllocator::sweep_all_blocks(Badge<Heap>, SweepStatistics& statistics)
 {
-    VERIFY(!block.is_full());
-    m_usable_blocks.append(block);
+    while (!m_blocks_to_sweep.is_empty())
+        sweep_block(*m_blocks_to_sweep.first(), statistics);
+}
+
+void CellAllocator::sweep_block(HeapBlock& block, SweepStatistics& statistics)
+{
+    auto result = block.sweep();
+    statistics.live_cells += result.live_cells;
+    statistics.live_cell_bytes += result.live_cells * block.cell_size();
+    statistics.collected_cells += result.collected_cells;
+    statistics.collected_cell_bytes += result.collected_cells * block.cell_size();
+
+    if (result.live_cells == 0) {
+        dbgln_if(HEAP_DEBUG, " - HeapBlock empty @ {}: cell_size={}", &block, block.cell_size());
+        block.m_list_node.remove();
+        // NOTE: HeapBlocks are managed by the BlockAllocator, so we don't want to `delete` the block here.
+        block.~HeapBlock();
+        m_block_allocator.deallocate_block(&block);
+        ++statistics.freed_blocks;
+    } else if (block.is_full()) {
+        m_full_blocks.append(block);
+    } else {
+        m_usable_blocks.append(block);
+    }
 }
 
 }
@@ -41,11 +41,26 @@ public:
             if (callback(block) == IterationDecision::Break)
                 return IterationDecision::Break;
         }
+        for (auto& block : m_blocks_to_sweep) {
+            if (callback(block) == IterationDecision::Break)
+                return IterationDecision::Break;
+        }
         return IterationDecision::Continue;
     }
 
-    void block_did_become_empty(Badge<Heap>, HeapBlock&);
-    void block_did_become_usable(Badge<Heap>, HeapBlock&);
+    struct SweepStatistics {
+        size_t live_cells { 0 };
+        size_t live_cell_bytes { 0 };
+        size_t collected_cells { 0 };
+        size_t collected_cell_bytes { 0 };
+        size_t freed_blocks { 0 };
+    };
+
+    // Blocks that were collected by a garbage collection are handed to their allocator, which sweeps them when it runs
+    // out of usable blocks. Until then, the dead cells in them are still in the Live state, but unmarked.
+    void add_block_to_sweep(Badge<Heap>, HeapBlock&);
+    bool has_blocks_to_sweep() const { return !m_blocks_to_sweep.is_empty(); }
+    void sweep_all_blocks(Badge<Heap>, SweepStatistics&);
 
     IntrusiveListNode<CellAllocator> m_list_node;
     using List = IntrusiveList<&CellAllocator::m_list_node>;
@@ -55,6 +70,8 @@ public:
     FlatPtr max_block_address() const { return m_max_block_address; }
 
 private:
+    void sweep_block(HeapBlock&, SweepStatistics&);
+
     char const* const m_class_name { nullptr };
     size_t const m_cell_size;
 
@@ -63,6 +80,7 @@ private:
     using BlockList = IntrusiveList<&HeapBlock::m_list_node>;
     BlockList m_full_blocks;
     BlockList m_usable_blocks;
+    BlockList m_blocks_to_sweep;
     FlatPtr m_min_block_address { explode_byte(0xff) };
     FlatPtr m_max_block_address { 0 };
 };
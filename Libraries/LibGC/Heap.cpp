@@ -13,15 +13,18 @@
 #include <AK/JsonObject.h>
 #include <AK/Platform.h>
 #include <AK/StackInfo.h>
+#include <AK/Stream.h>
 #include <AK/TemporaryChange.h>
-#include <LibCore/ElapsedTimer.h>
 #include <LibGC/CellAllocator.h>
 #include <LibGC/Heap.h>
 #include <LibGC/HeapBlock.h>
+#include <LibGC/MarkingWorklist.h>
 #include <LibGC/NanBoxedValue.h>
 #include <LibGC/Root.h>
 #include <LibGC/Weak.h>
 #include <LibGC/WeakInlines.h>
+#include <LibThreading/HelperThreadPool.h>
+#include <LibThreading/Mutex.h>
 #include <setjmp.h>
 
 #ifdef HAS_ADDRESS_SANITIZER
@@ -51,17 +54,48 @@ Heap::~Heap()
 
 void Heap::will_allocate(size_t size)
 {
+    auto sweep_mode = m_lazy_sweeping_enabled ? SweepMode::Lazy : SweepMode::Eager;
     if (should_collect_on_every_allocation()) {
         m_allocated_bytes_since_last_gc = 0;
-        collect_garbage();
+        perform_collection(CollectionType::CollectGarbage, sweep_mode, false);
     } else if (m_allocated_bytes_since_last_gc + size > m_gc_bytes_threshold) {
         m_allocated_bytes_since_last_gc = 0;
-        collect_garbage();
+        perform_collection(collection_type_for_allocation(), sweep_mode, false);
     }
 
     m_allocated_bytes_since_last_gc += size;
 }
 
+void Heap::did_allocate_cell_while_profiling(Cell& cell, size_t size)
+{
+    // NOTE: The stack provider may allocate cells of its own, which are not sampled.
+    if (m_recording_allocation_sample || !m_allocation_profiler->should_sample(size))
+        return;
+
+    TemporaryChange recording_allocation_sample { m_recording_allocation_sample, true };
+    auto stack = m_allocation_stack_provider ? m_allocation_stack_provider() : String {};
+    m_allocation_profiler->record_sample(cell.class_name(), move(stack));
+}
+
+void Heap::start_allocation_profiling(size_t sampling_interval_in_bytes)
+{
+    m_allocation_profiler = make<AllocationProfiler>(sampling_interval_in_bytes);
+}
+
+OwnPtr<AllocationProfiler> Heap::stop_allocation_profiling()
+{
+    return move(m_allocation_profiler);
+}
+
+Heap::CollectionType Heap::collection_type_for_allocation() const
+{
+    if (!m_minor_collections_enabled)
+        return CollectionType::CollectGarbage;
+    if (m_promoted_bytes_since_last_full_gc > m_gc_bytes_threshold)
+        return CollectionType::CollectGarbage;
+    return CollectionType::CollectYoungGeneration;
+}
+
 static void add_possible_value(HashMap<FlatPtr, HeapRoot>& possible_pointers, FlatPtr data, HeapRoot origin, FlatPtr min_block_address, FlatPtr max_block_address)
 {
     if constexpr (sizeof(FlatPtr*) == sizeof(NanBoxedValue)) {
@@ -232,6 +266,8 @@ private:
 
 AK::JsonObject Heap::dump_graph()
 {
+    finish_sweeping();
+
     HashMap<Cell*, HeapRoot> roots;
     gather_roots(roots);
     GraphConstructorVisitor visitor(*this, roots);
@@ -239,29 +275,191 @@ AK::JsonObject Heap::dump_graph()
     return visitor.dump();
 }
 
+static StringView heap_root_type_name(HeapRoot::Type type)
+{
+    switch (type) {
+    case HeapRoot::Type::HeapFunctionCapturedPointer:
+        return "HeapFunctionCapturedPointer"sv;
+    case HeapRoot::Type::Root:
+        return "Root"sv;
+    case HeapRoot::Type::RootVector:
+        return "RootVector"sv;
+    case HeapRoot::Type::RootHashMap:
+        return "RootHashMap"sv;
+    case HeapRoot::Type::ConservativeVector:
+        return "ConservativeVector"sv;
+    case HeapRoot::Type::RegisterPointer:
+        return "RegisterPointer"sv;
+    case HeapRoot::Type::StackPointer:
+        return "StackPointer"sv;
+    case HeapRoot::Type::VM:
+        return "VM"sv;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+// Collects the cells that a single cell points to, for the heap snapshot.
+class HeapSnapshotEdgeVisitor final : public Cell::Visitor {
+public:
+    HeapSnapshotEdgeVisitor(HashTable<HeapBlock*> const& all_live_heap_blocks, FlatPtr min_block_address, FlatPtr max_block_address)
+        : m_all_live_heap_blocks(all_live_heap_blocks)
+        , m_min_block_address(min_block_address)
+        , m_max_block_address(max_block_address)
+    {
+    }
+
+    virtual void visit_impl(Cell& cell) override
+    {
+        m_edges.set(&cell);
+    }
+
+    virtual void visit_possible_values(ReadonlyBytes bytes) override
+    {
+        HashMap<FlatPtr, HeapRoot> possible_pointers;
+
+        auto* raw_pointer_sized_values = reinterpret_cast<FlatPtr const*>(bytes.data());
+        for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i)
+            add_possible_value(possible_pointers, raw_pointer_sized_values[i], HeapRoot { .type = HeapRoot::Type::HeapFunctionCapturedPointer }, m_min_block_address, m_max_block_address);
+
+        for_each_cell_among_possible_pointers(m_all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr) {
+            m_edges.set(cell);
+        });
+    }
+
+    HashTable<Cell*> take_edges(Cell& cell)
+    {
+        m_edges.clear_with_capacity();
+        cell.visit_edges(*this);
+        return move(m_edges);
+    }
+
+private:
+    HashTable<Cell*> m_edges;
+    HashTable<HeapBlock*> const& m_all_live_heap_blocks;
+    FlatPtr m_min_block_address;
+    FlatPtr m_max_block_address;
+};
+
+ErrorOr<void> Heap::write_heap_snapshot(Stream& stream)
+{
+    // NOTE: This sweeps every dead cell, so that all cells left in the heap are reachable.
+    collect_garbage();
+
+    HashMap<Cell*, HeapRoot> roots;
+    gather_roots(roots);
+
+    FlatPtr min_block_address = 0;
+    FlatPtr max_block_address = 0;
+    find_min_and_max_block_addresses(min_block_address, max_block_address);
+    HashTable<HeapBlock*> all_live_heap_blocks;
+    for_each_block([&](auto& block) {
+        all_live_heap_blocks.set(&block);
+        return IterationDecision::Continue;
+    });
+
+    TRY(stream.write_until_depleted("heap-snapshot 1\n"sv));
+
+    for (auto const& [cell, root] : roots) {
+        TRY(stream.write_formatted("root {:x} {}", bit_cast<FlatPtr>(cell), heap_root_type_name(root.type)));
+        if (root.location)
+            TRY(stream.write_formatted(" {}:{}", root.location->filename(), root.location->line_number()));
+        TRY(stream.write_until_depleted("\n"sv));
+    }
+
+    HashMap<StringView, size_t> class_indices;
+    HeapSnapshotEdgeVisitor visitor(all_live_heap_blocks, min_block_address, max_block_address);
+
+    auto write_cell = [&](Cell& cell, size_t cell_size) -> ErrorOr<void> {
+        auto class_name = cell.class_name();
+        auto class_index = class_indices.size();
+        if (auto it = class_indices.find(class_name); it != class_indices.end()) {
+            class_index = it->value;
+        } else {
+            class_indices.set(class_name, class_index);
+            TRY(stream.write_formatted("class {} {}\n", class_index, class_name));
+        }
+
+        TRY(stream.write_formatted("cell {:x} {} {}", bit_cast<FlatPtr>(&cell), class_index, cell_size));
+        for (auto* edge : visitor.take_edges(cell))
+            TRY(stream.write_formatted(" {:x}", bit_cast<FlatPtr>(edge)));
+        TRY(stream.write_until_depleted("\n"sv));
+        return {};
+    };
+
+    ErrorOr<void> result;
+    for_each_block([&](auto& block) {
+        block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
+            if (!result.is_error())
+                result = write_cell(*cell, block.cell_size());
+        });
+        return result.is_error() ? IterationDecision::Break : IterationDecision::Continue;
+    });
+    return result;
+}
+
 void Heap::collect_garbage(CollectionType collection_type, bool print_report)
+{
+    perform_collection(collection_type, SweepMode::Eager, print_report);
+}
+
+void Heap::perform_collection(CollectionType collection_type, SweepMode sweep_mode, bool print_report)
 {
     VERIFY(!m_collecting_garbage);
 
+    // The heap is about to be destroyed, so there's no later allocation to sweep its blocks.
+    if (collection_type == CollectionType::CollectEverything)
+        sweep_mode = SweepMode::Eager;
+
+    // Uprooted cells have to be unmarked even if they're old, which only a full collection can do.
+    if (collection_type == CollectionType::CollectYoungGeneration && !m_uprooted_cells.is_empty())
+        collection_type = CollectionType::CollectGarbage;
+
     {
         TemporaryChange change(m_collecting_garbage, true);
 
-        Core::ElapsedTimer collection_measurement_timer;
-        if (print_report)
-            collection_measurement_timer.start();
+        auto collection_start_time = MonotonicTime::now();
 
-        if (collection_type == CollectionType::CollectGarbage) {
+        if (collection_type != CollectionType::CollectEverything) {
             if (m_gc_deferrals) {
+                if (!m_should_gc_when_deferral_ends || collection_type == CollectionType::CollectGarbage)
+                    m_collection_type_when_deferral_ends = collection_type;
                 m_should_gc_when_deferral_ends = true;
                 return;
             }
+        }
+
+        // NOTE: The dead cells left by the last collection are still in the Live state, so they have to be swept before
+        //       the conservative root scan could mistake them for live ones, and before their marks are reset.
+        finish_sweeping();
+
+        CollectionStatistics statistics;
+        auto phase_start_time = MonotonicTime::now();
+        auto end_phase = [&](AK::Duration& phase_time) {
+            auto now = MonotonicTime::now();
+            phase_time = now - phase_start_time;
+            phase_start_time = now;
+        };
+
+        if (collection_type != CollectionType::CollectYoungGeneration)
+            unmark_all_cells();
+
+        if (collection_type != CollectionType::CollectEverything) {
             HashMap<Cell*, HeapRoot> roots;
             gather_roots(roots);
-            mark_live_cells(roots);
+            end_phase(statistics.root_gathering_time);
+            mark_live_cells(roots, collection_type, statistics);
+            end_phase(statistics.marking_time);
+        } else {
+            forget_remembered_cells();
         }
-        finalize_unmarked_cells();
+        finalize_unmarked_cells(collection_type);
+        end_phase(statistics.finalization_time);
         sweep_weak_blocks();
-        sweep_dead_cells(print_report, collection_measurement_timer);
+        sweep_dead_cells(collection_type, sweep_mode, statistics);
+        end_phase(statistics.sweeping_time);
+
+        if (print_report)
+            print_collection_report(collection_type, sweep_mode, statistics, MonotonicTime::now() - collection_start_time);
     }
 
     auto tasks = move(m_post_gc_tasks);
@@ -366,30 +564,56 @@ NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot
     });
 }
 
+struct LiveHeapBlocks {
+    HashTable<HeapBlock*> blocks;
+    FlatPtr min_block_address { 0 };
+    FlatPtr max_block_address { 0 };
+};
+
 class MarkingVisitor final : public Cell::Visitor {
 public:
-    explicit MarkingVisitor(Heap& heap, HashMap<Cell*, HeapRoot> const& roots)
-        : m_heap(heap)
+    // NOTE: The edges of marked cells are never visited again, so in a minor collection, where old cells stay marked,
+    //       this only traces through young cells.
+    //       Cells without write barriers never become old, so an old cell that points to one has to be visited by
+    //       every minor collection. Those are collected here while visiting edges.
+    MarkingVisitor(LiveHeapBlocks const& live_heap_blocks, MarkingWorklist* shared_worklist = nullptr)
+        : m_live_heap_blocks(live_heap_blocks)
+        , m_shared_worklist(shared_worklist)
     {
-        m_heap.find_min_and_max_block_addresses(m_min_block_address, m_max_block_address);
-        m_heap.for_each_block([&](auto& block) {
-            m_all_live_heap_blocks.set(&block);
+    }
+
+    static LiveHeapBlocks gather_live_heap_blocks(Heap& heap)
+    {
+        LiveHeapBlocks live_heap_blocks;
+        heap.find_min_and_max_block_addresses(live_heap_blocks.min_block_address, live_heap_blocks.max_block_address);
+        heap.for_each_block([&](auto& block) {
+            live_heap_blocks.blocks.set(&block);
             return IterationDecision::Continue;
         });
+        return live_heap_blocks;
+    }
 
+    void visit_roots(HashMap<Cell*, HeapRoot> const& roots)
+    {
         for (auto* root : roots.keys()) {
             visit(root);
         }
     }
 
+    void visit_edges_of(Cell& cell)
+    {
+        m_cell_with_write_barriers_being_visited = cell.has_write_barriers() ? &cell : nullptr;
+        cell.visit_edges(*this);
+        m_cell_with_write_barriers_being_visited = nullptr;
+    }
+
     virtual void visit_impl(Cell& cell) override
     {
-        if (cell.is_marked())
+        note_edge_to(cell);
+        if (!mark(cell))
             return;
         dbgln_if(HEAP_DEBUG, "  ! {}", &cell);
-
-        cell.set_marked(true);
-        m_work_queue.append(cell);
+        push(cell);
     }
 
     virtual void visit_possible_values(ReadonlyBytes bytes) override
@@ -398,53 +622,177 @@ public:
 
         auto* raw_pointer_sized_values = reinterpret_cast<FlatPtr const*>(bytes.data());
         for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i)
-            add_possible_value(possible_pointers, raw_pointer_sized_values[i], HeapRoot { .type = HeapRoot::Type::HeapFunctionCapturedPointer }, m_min_block_address, m_max_block_address);
+            add_possible_value(possible_pointers, raw_pointer_sized_values[i], HeapRoot { .type = HeapRoot::Type::HeapFunctionCapturedPointer }, m_live_heap_blocks.min_block_address, m_live_heap_blocks.max_block_address);
 
-        for_each_cell_among_possible_pointers(m_all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr) {
-            if (cell->is_marked())
-                return;
+        for_each_cell_among_possible_pointers(m_live_heap_blocks.blocks, possible_pointers, [&](Cell* cell, FlatPtr) {
             if (cell->state() != Cell::State::Live)
                 return;
-            cell->set_marked(true);
-            m_work_queue.append(*cell);
+            note_edge_to(*cell);
+            if (!mark(*cell))
+                return;
+            push(*cell);
         });
     }
 
+    size_t marked_bytes() const { return m_marked_bytes; }
+    size_t promoted_bytes() const { return m_promoted_bytes; }
+
+    Vector<Cell*> const& cells_pointing_to_young_cells() const { return m_cells_pointing_to_young_cells; }
+
+    // Parallel marking is over once the shared worklist has run dry, after which this visitor must not share any more.
+    void set_shared_worklist(MarkingWorklist* shared_worklist) { m_shared_worklist = shared_worklist; }
+
     void mark_all_live_cells()
     {
-        while (!m_work_queue.is_empty()) {
-            m_work_queue.take_last()->visit_edges(*this);
+        while (true) {
+            while (!m_work_queue.is_empty())
+                visit_edges_of(*m_work_queue.take_last());
+
+            if (!m_shared_worklist)
+                return;
+            MarkingWorklist::Segment segment;
+            if (!m_shared_worklist->take(segment))
+                return;
+            m_work_queue.extend(move(segment));
         }
     }
 
 private:
-    Heap& m_heap;
-    Vector<Ref<Cell>> m_work_queue;
-    HashTable<HeapBlock*> m_all_live_heap_blocks;
-    FlatPtr m_min_block_address;
-    FlatPtr m_max_block_address;
+    void note_edge_to(Cell& cell)
+    {
+        if (!m_cell_with_write_barriers_being_visited || cell.has_write_barriers())
+            return;
+        m_cells_pointing_to_young_cells.append(m_cell_with_write_barriers_being_visited);
+        // One edge is enough to keep the source cell remembered.
+        m_cell_with_write_barriers_being_visited = nullptr;
+    }
+
+    // Returns whether the cell was newly marked.
+    bool mark(Cell& cell)
+    {
+        if (m_shared_worklist) {
+            if (cell.test_and_set_marked())
+                return false;
+        } else {
+            if (cell.is_marked())
+                return false;
+            cell.set_marked(true);
+        }
+        auto cell_size = HeapBlock::from_cell(&cell)->cell_size();
+        m_marked_bytes += cell_size;
+        if (cell.has_write_barriers())
+            m_promoted_bytes += cell_size;
+        return true;
+    }
+
+    void push(Cell& cell)
+    {
+        m_work_queue.append(&cell);
+
+        if (m_shared_worklist && m_work_queue.size() >= 2 * MarkingWorklist::segment_size && m_shared_worklist->has_idle_markers()) {
+            MarkingWorklist::Segment segment;
+            for (size_t i = 0; i < MarkingWorklist::segment_size; ++i)
+                segment.unchecked_append(m_work_queue.take_last());
+            m_shared_worklist->publish(move(segment));
+        }
+    }
+
+    LiveHeapBlocks const& m_live_heap_blocks;
+    MarkingWorklist* m_shared_worklist { nullptr };
+    Vector<Cell*> m_work_queue;
+    Cell* m_cell_with_write_barriers_being_visited { nullptr };
+    Vector<Cell*> m_cells_pointing_to_young_cells;
+    size_t m_marked_bytes { 0 };
+    size_t m_promoted_bytes { 0 };
 };
 
-void Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots)
+void Heap::unmark_all_cells()
+{
+    for_each_block([&](auto& block) {
+        block.template for_each_cell_in_state<Cell::State::Live>([](Cell* cell) {
+            cell->set_marked(false);
+        });
+        return IterationDecision::Continue;
+    });
+}
+
+void Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots, CollectionType collection_type, CollectionStatistics& statistics)
 {
     dbgln_if(HEAP_DEBUG, "mark_live_cells:");
 
-    MarkingVisitor visitor(*this, roots);
+    auto live_heap_blocks = MarkingVisitor::gather_live_heap_blocks(*this);
+    MarkingVisitor visitor(live_heap_blocks);
+    visitor.visit_roots(roots);
 
-    visitor.mark_all_live_cells();
+    if (collection_type == CollectionType::CollectYoungGeneration) {
+        // Old cells only point to young cells if they've been written to since they became old, which the write
+        // barrier records, or if they pointed to a cell without write barriers the last time they were visited.
+        for (auto* cell : m_remembered_cells)
+            visitor.visit_edges_of(*cell);
+    }
+
+    size_t marked_bytes = 0;
+    size_t promoted_bytes = 0;
+    Vector<Cell*> cells_pointing_to_young_cells;
+    if (m_marking_thread_pool) {
+        auto marker_count = m_marking_thread_pool->helper_thread_count() + 1;
+        MarkingWorklist worklist(marker_count);
+        Atomic<size_t> marked_bytes_by_helpers { 0 };
+        Atomic<size_t> promoted_bytes_by_helpers { 0 };
+        Threading::Mutex cells_pointing_to_young_cells_mutex;
+
+        visitor.set_shared_worklist(&worklist);
+        m_marking_thread_pool->run([&](size_t thread_index) {
+            if (thread_index == 0) {
+                visitor.mark_all_live_cells();
+                return;
+            }
+            MarkingVisitor helper_visitor(live_heap_blocks, &worklist);
+            helper_visitor.mark_all_live_cells();
+            marked_bytes_by_helpers.fetch_add(helper_visitor.marked_bytes(), AK::MemoryOrder::memory_order_relaxed);
+            promoted_bytes_by_helpers.fetch_add(helper_visitor.promoted_bytes(), AK::MemoryOrder::memory_order_relaxed);
+            Threading::MutexLocker locker(cells_pointing_to_young_cells_mutex);
+            cells_pointing_to_young_cells.extend(helper_visitor.cells_pointing_to_young_cells());
+        });
+        visitor.set_shared_worklist(nullptr);
+
+        marked_bytes = marked_bytes_by_helpers.load();
+        promoted_bytes = promoted_bytes_by_helpers.load();
+        statistics.marking_thread_count = marker_count;
+    } else {
+        visitor.mark_all_live_cells();
+    }
 
     for (auto& inverse_root : m_uprooted_cells)
         inverse_root->set_marked(false);
 
-    for_each_block([&](auto& block) {
+    for_each_block_to_collect(collection_type, [&](auto& block) {
         block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
             if (!cell->is_marked() && cell_must_survive_garbage_collection(*cell))
-                cell->visit_edges(visitor);
+                visitor.visit_edges_of(*cell);
         });
         return IterationDecision::Continue;
     });
 
     m_uprooted_cells.clear();
+
+    forget_remembered_cells();
+    cells_pointing_to_young_cells.extend(visitor.cells_pointing_to_young_cells());
+    for (auto* cell : cells_pointing_to_young_cells) {
+        // NOTE: Uprooted cells were unmarked above, and won't survive this collection.
+        if (!cell->is_marked())
+            continue;
+        cell->set_remembered({}, true);
+        m_remembered_cells.set(cell);
+    }
+
+    marked_bytes += visitor.marked_bytes();
+    promoted_bytes += visitor.promoted_bytes();
+    statistics.marked_cell_bytes = marked_bytes;
+    if (collection_type == CollectionType::CollectYoungGeneration)
+        m_promoted_bytes_since_last_full_gc += promoted_bytes;
+    else
+        m_promoted_bytes_since_last_full_gc = 0;
 }
 
 bool Heap::cell_must_survive_garbage_collection(Cell const& cell)
@@ -454,9 +802,9 @@ bool Heap::cell_must_survive_garbage_collection(Cell const& cell)
     return cell.must_survive_garbage_collection();
 }
 
-void Heap::finalize_unmarked_cells()
+void Heap::finalize_unmarked_cells(CollectionType collection_type)
 {
-    for_each_block([&](auto& block) {
+    for_each_block_to_collect(collection_type, [&](auto& block) {
         block.template for_each_cell_in_state<Cell::State::Live>([](Cell* cell) {
             if (!cell->is_marked())
                 cell->finalize();
@@ -481,51 +829,28 @@ void Heap::sweep_weak_blocks()
     }
 }
 
-void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measurement_timer)
+void Heap::sweep_dead_cells(CollectionType collection_type, SweepMode sweep_mode, CollectionStatistics& statistics)
 {
     dbgln_if(HEAP_DEBUG, "sweep_dead_cells:");
-    Vector<HeapBlock*, 32> empty_blocks;
-    Vector<HeapBlock*, 32> full_blocks_that_became_usable;
-
-    size_t collected_cells = 0;
-    size_t live_cells = 0;
-    size_t collected_cell_bytes = 0;
-    size_t live_cell_bytes = 0;
-
-    for_each_block([&](auto& block) {
-        bool block_has_live_cells = false;
-        bool block_was_full = block.is_full();
-        block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
-            if (!cell->is_marked()) {
-                dbgln_if(HEAP_DEBUG, "  ~ {}", cell);
-                block.deallocate(cell);
-                ++collected_cells;
-                collected_cell_bytes += block.cell_size();
-            } else {
-                cell->set_marked(false);
-                block_has_live_cells = true;
-                ++live_cells;
-                live_cell_bytes += block.cell_size();
-            }
-        });
-        if (!block_has_live_cells)
-            empty_blocks.append(&block);
-        else if (block_was_full != block.is_full())
-            full_blocks_that_became_usable.append(&block);
-        return IterationDecision::Continue;
-    });
 
+    // NOTE: Nothing has been swept yet, so the cells that weak containers refer to are still there, and the unmarked
+    //       ones are the dead ones.
     for (auto& weak_container : m_weak_containers)
         weak_container.remove_dead_cells({});
 
-    for (auto* block : empty_blocks) {
-        dbgln_if(HEAP_DEBUG, " - HeapBlock empty @ {}: cell_size={}", block, block->cell_size());
-        block->cell_allocator().block_did_become_empty({}, *block);
-    }
+    Vector<HeapBlock*, 32> blocks_to_sweep;
+    for_each_block_to_collect(collection_type, [&](auto& block) {
+        blocks_to_sweep.append(&block);
+        return IterationDecision::Continue;
+    });
+    for (auto* block : blocks_to_sweep)
+        block->cell_allocator().add_block_to_sweep({}, *block);
 
-    for (auto* block : full_blocks_that_became_usable) {
-        dbgln_if(HEAP_DEBUG, " - HeapBlock usable again @ {}: cell_size={}", block, block->cell_size());
-        block->cell_allocator().block_did_become_usable({}, *block);
+    if (sweep_mode == SweepMode::Eager) {
+        for (auto& allocator : m_all_cell_allocators)
+            allocator.sweep_all_blocks({}, statistics.sweep);
+    } else {
+        statistics.blocks_left_to_sweep = blocks_to_sweep.size();
     }
 
     if constexpr (HEAP_DEBUG) {
@@ -535,25 +860,76 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
         });
     }
 
-    m_gc_bytes_threshold = live_cell_bytes > GC_MIN_BYTES_THRESHOLD ? live_cell_bytes : GC_MIN_BYTES_THRESHOLD;
+    // NOTE: Everything a full collection marked is live, which is known before any block is swept. A minor collection
+    //       only marks the young survivors, so it keeps the previous threshold.
+    if (collection_type != CollectionType::CollectYoungGeneration)
+        m_gc_bytes_threshold = max(statistics.marked_cell_bytes, GC_MIN_BYTES_THRESHOLD);
+}
 
-    if (print_report) {
-        AK::Duration const time_spent = measurement_timer.elapsed_time();
-        size_t live_block_count = 0;
-        for_each_block([&](auto&) {
-            ++live_block_count;
-            return IterationDecision::Continue;
-        });
+void Heap::finish_sweeping()
+{
+    CellAllocator::SweepStatistics statistics;
+    for (auto& allocator : m_all_cell_allocators) {
+        if (allocator.has_blocks_to_sweep())
+            allocator.sweep_all_blocks({}, statistics);
+    }
+}
+
+void Heap::print_collection_report(CollectionType collection_type, SweepMode sweep_mode, CollectionStatistics const& statistics, AK::Duration total_time)
+{
+    size_t live_block_count = 0;
+    for_each_block([&](auto&) {
+        ++live_block_count;
+        return IterationDecision::Continue;
+    });
+
+    dbgln("Garbage collection report");
+    dbgln("=============================================");
+    dbgln("           Kind: {}", collection_type == CollectionType::CollectYoungGeneration ? "minor"sv : "full"sv);
+    dbgln("     Time spent: {} ms", total_time.to_milliseconds());
+    dbgln(" Root gathering: {} us", statistics.root_gathering_time.to_microseconds());
+    dbgln("        Marking: {} us ({} threads)", statistics.marking_time.to_microseconds(), statistics.marking_thread_count);
+    dbgln("   Finalization: {} us", statistics.finalization_time.to_microseconds());
+    dbgln("       Sweeping: {} us", statistics.sweeping_time.to_microseconds());
+    dbgln("   Marked bytes: {}", statistics.marked_cell_bytes);
+    if (sweep_mode == SweepMode::Lazy) {
+        dbgln("Blocks to sweep: {} (swept on allocation)", statistics.blocks_left_to_sweep);
+    } else {
+        dbgln("     Live cells: {} ({} bytes){}", statistics.sweep.live_cells, statistics.sweep.live_cell_bytes, collection_type == CollectionType::CollectYoungGeneration ? " in swept blocks"sv : ""sv);
+        dbgln("Collected cells: {} ({} bytes)", statistics.sweep.collected_cells, statistics.sweep.collected_cell_bytes);
+    }
+    dbgln("    Live blocks: {} ({} bytes)", live_block_count, live_block_count * HeapBlock::block_size);
+    if (sweep_mode == SweepMode::Eager)
+        dbgln("   Freed blocks: {} ({} bytes)", statistics.sweep.freed_blocks, statistics.sweep.freed_blocks * HeapBlock::block_size);
+    dbgln("=============================================");
+}
+
+size_t Heap::marking_helper_thread_count() const
+{
+    return m_marking_thread_pool ? m_marking_thread_pool->helper_thread_count() : 0;
+}
+
+void Heap::set_marking_helper_thread_count(size_t helper_thread_count)
+{
+    VERIFY(!m_collecting_garbage);
+
+    m_marking_thread_pool = nullptr;
+    if (helper_thread_count == 0)
+        return;
 
-        dbgln("Garbage collection report");
-        dbgln("=============================================");
-        dbgln("     Time spent: {} ms", time_spent.to_milliseconds());
-        dbgln("     Live cells: {} ({} bytes)", live_cells, live_cell_bytes);
-        dbgln("Collected cells: {} ({} bytes)", collected_cells, collected_cell_bytes);
-        dbgln("    Live blocks: {} ({} bytes)", live_block_count, live_block_count * HeapBlock::block_size);
-        dbgln("   Freed blocks: {} ({} bytes)", empty_blocks.size(), empty_blocks.size() * HeapBlock::block_size);
-        dbgln("=============================================");
+    auto pool_or_error = Threading::HelperThreadPool::create(helper_thread_count, "GC marker"sv);
+    if (pool_or_error.is_error()) {
+        dbgln("Failed to create GC marking threads, marking on a single thread: {}", pool_or_error.error());
+        return;
     }
+    m_marking_thread_pool = pool_or_error.release_value();
+}
+
+void Heap::forget_remembered_cells()
+{
+    for (auto* cell : m_remembered_cells)
+        cell->set_remembered({}, false);
+    m_remembered_cells.clear();
 }
 
 void Heap::defer_gc()
@@ -567,9 +943,10 @@ void Heap::undefer_gc()
     --m_gc_deferrals;
 
     if (!m_gc_deferrals) {
-        if (m_should_gc_when_deferral_ends)
-            collect_garbage();
-        m_should_gc_when_deferral_ends = false;
+        if (m_should_gc_when_deferral_ends) {
+            m_should_gc_when_deferral_ends = false;
+            perform_collection(m_collection_type_when_deferral_ends, m_lazy_sweeping_enabled ? SweepMode::Lazy : SweepMode::Eager, false);
+        }
     }
 }
 
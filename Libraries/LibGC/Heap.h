@@ -8,14 +8,18 @@
 
 #include <AK/Badge.h>
 #include <AK/Function.h>
+#include <AK/HashTable.h>
 #include <AK/IntrusiveList.h>
 #include <AK/Noncopyable.h>
 #include <AK/NonnullOwnPtr.h>
+#include <AK/OwnPtr.h>
 #include <AK/StackInfo.h>
 #include <AK/Swift.h>
+#include <AK/Time.h>
 #include <AK/Types.h>
 #include <AK/Vector.h>
 #include <LibCore/Forward.h>
+#include <LibGC/AllocationProfiler.h>
 #include <LibGC/Cell.h>
 #include <LibGC/CellAllocator.h>
 #include <LibGC/ConservativeVector.h>
@@ -27,6 +31,7 @@
 #include <LibGC/RootVector.h>
 #include <LibGC/WeakBlock.h>
 #include <LibGC/WeakContainer.h>
+#include <LibThreading/Forward.h>
 
 namespace GC {
 
@@ -44,6 +49,10 @@ public:
         auto* memory = allocate_cell<T>();
         defer_gc();
         new (memory) T(forward<Args>(args)...);
+        if constexpr (requires { requires IsSame<typename T::ClassWithWriteBarriers, T>; })
+            memory->set_has_write_barriers({});
+        if (m_allocation_profiler) [[unlikely]]
+            did_allocate_cell_while_profiling(*memory, sizeof(T));
         undefer_gc();
         return *static_cast<T*>(memory);
     }
@@ -51,14 +60,54 @@ public:
     enum class CollectionType {
         CollectGarbage,
         CollectEverything,
+        // Only collects cells allocated since the last collection, treating every older cell as live.
+        CollectYoungGeneration,
     };
 
+    // NOTE: Explicitly requested collections sweep every dead cell before returning. Collections triggered by allocation
+    //       leave the dead cells in their blocks, which are swept on demand as memory is allocated (see CellAllocator).
     void collect_garbage(CollectionType = CollectionType::CollectGarbage, bool print_report = false);
     AK::JsonObject dump_graph();
 
+    // Collects garbage, then writes every remaining cell to the stream in a line-oriented text format:
+    //
+    //     heap-snapshot 1
+    //     root <address> <root type> [<file>:<line>]
+    //     class <index> <class name>
+    //     cell <address> <class index> <size> [<address of a cell it points to>...]
+    //
+    // Addresses are in hexadecimal. Every class line comes before the first cell line that refers to it.
+    ErrorOr<void> write_heap_snapshot(Stream&);
+
+    // While profiling, allocations are sampled at the given interval of allocated bytes (see AllocationProfiler).
+    // The stack provider reports the stack of each sampled allocation, one frame per line.
+    using AllocationStackProvider = AK::Function<String()>;
+    void set_allocation_stack_provider(AllocationStackProvider provider) { m_allocation_stack_provider = move(provider); }
+
+    bool is_allocation_profiling() const { return m_allocation_profiler.ptr(); }
+    void start_allocation_profiling(size_t sampling_interval_in_bytes = AllocationProfiler::default_sampling_interval_in_bytes);
+    OwnPtr<AllocationProfiler> stop_allocation_profiling();
+    AllocationProfiler const* allocation_profiler() const { return m_allocation_profiler.ptr(); }
+
+    // Sweeps every block left unswept by the last collection.
+    void finish_sweeping();
+
+    bool lazy_sweeping_enabled() const { return m_lazy_sweeping_enabled; }
+    void set_lazy_sweeping_enabled(bool b) { m_lazy_sweeping_enabled = b; }
+
     bool should_collect_on_every_allocation() const { return m_should_collect_on_every_allocation; }
     void set_should_collect_on_every_allocation(bool b) { m_should_collect_on_every_allocation = b; }
 
+    bool minor_collections_enabled() const { return m_minor_collections_enabled; }
+    void set_minor_collections_enabled(bool b) { m_minor_collections_enabled = b; }
+
+    void remember_cell(Badge<Cell>, Cell&);
+
+    // With helper threads, marking is done in parallel. Every visit_edges() implementation must then be safe to run
+    // concurrently with the others, i.e. not touch any state other than what it reads to find its edges.
+    size_t marking_helper_thread_count() const;
+    void set_marking_helper_thread_count(size_t);
+
     void did_create_root(Badge<RootImpl>, RootImpl&);
     void did_destroy_root(Badge<RootImpl>, RootImpl&);
 
@@ -108,14 +157,37 @@ private:
     }
 
     void will_allocate(size_t);
+    void did_allocate_cell_while_profiling(Cell&, size_t);
+    CollectionType collection_type_for_allocation() const;
 
     void find_min_and_max_block_addresses(FlatPtr& min_address, FlatPtr& max_address);
     void gather_roots(HashMap<Cell*, HeapRoot>&);
     void gather_conservative_roots(HashMap<Cell*, HeapRoot>&);
     void gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>&, FlatPtr, FlatPtr min_block_address, FlatPtr max_block_address);
-    void mark_live_cells(HashMap<Cell*, HeapRoot> const& live_cells);
-    void finalize_unmarked_cells();
-    void sweep_dead_cells(bool print_report, Core::ElapsedTimer const&);
+    struct CollectionStatistics {
+        AK::Duration root_gathering_time;
+        AK::Duration marking_time;
+        AK::Duration finalization_time;
+        AK::Duration sweeping_time;
+        size_t marking_thread_count { 1 };
+        size_t marked_cell_bytes { 0 };
+        size_t blocks_left_to_sweep { 0 };
+        CellAllocator::SweepStatistics sweep;
+    };
+
+    enum class SweepMode {
+        Eager,
+        Lazy,
+    };
+
+    void perform_collection(CollectionType, SweepMode, bool print_report);
+
+    void unmark_all_cells();
+    void mark_live_cells(HashMap<Cell*, HeapRoot> const& live_cells, CollectionType, CollectionStatistics&);
+    void finalize_unmarked_cells(CollectionType);
+    void sweep_dead_cells(CollectionType, SweepMode, CollectionStatistics&);
+    void forget_remembered_cells();
+    void print_collection_report(CollectionType, SweepMode, CollectionStatistics const&, AK::Duration total_time);
     void sweep_weak_blocks();
 
     ALWAYS_INLINE CellAllocator& allocator_for_size(size_t cell_size)
@@ -138,11 +210,37 @@ private:
         }
     }
 
+    // Young cells only live in blocks that have been allocated from since the last collection.
+    template<typename Callback>
+    void for_each_block_to_collect(CollectionType collection_type, Callback callback)
+    {
+        for_each_block([&](auto& block) {
+            if (collection_type == CollectionType::CollectYoungGeneration && !block.has_young_cells())
+                return IterationDecision::Continue;
+            return callback(block);
+        });
+    }
+
     static constexpr size_t GC_MIN_BYTES_THRESHOLD { 4 * 1024 * 1024 };
     size_t m_gc_bytes_threshold { GC_MIN_BYTES_THRESHOLD };
     size_t m_allocated_bytes_since_last_gc { 0 };
 
+    // Minor collections never free old cells, so once the old generation has grown by as much as a full collection
+    // would have been triggered by, we do a full collection instead.
+    size_t m_promoted_bytes_since_last_full_gc { 0 };
+
     bool m_should_collect_on_every_allocation { false };
+    bool m_minor_collections_enabled { true };
+    bool m_lazy_sweeping_enabled { true };
+
+    // Old cells whose edges the next minor collection has to visit.
+    HashTable<Cell*> m_remembered_cells;
+
+    OwnPtr<Threading::HelperThreadPool> m_marking_thread_pool;
+
+    OwnPtr<AllocationProfiler> m_allocation_profiler;
+    AllocationStackProvider m_allocation_stack_provider;
+    bool m_recording_allocation_sample { false };
 
     Vector<NonnullOwnPtr<CellAllocator>> m_size_based_cell_allocators;
     CellAllocator::List m_all_cell_allocators;
@@ -157,6 +255,7 @@ private:
 
     size_t m_gc_deferrals { 0 };
     bool m_should_gc_when_deferral_ends { false };
+    CollectionType m_collection_type_when_deferral_ends { CollectionType::CollectGarbage };
 
     bool m_collecting_garbage { false };
     StackInfo m_stack_info;
@@ -228,6 +327,12 @@ inline void Heap::did_destroy_weak_container(Badge<WeakContainer>, WeakContainer
     m_weak_containers.remove(set);
 }
 
+inline void Heap::remember_cell(Badge<Cell>, Cell& cell)
+{
+    cell.set_remembered({}, true);
+    m_remembered_cells.set(&cell);
+}
+
 inline void Heap::register_cell_allocator(Badge<CellAllocator>, CellAllocator& allocator)
 {
     m_all_cell_allocators.append(allocator);
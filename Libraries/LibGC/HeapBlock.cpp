@@ -5,6 +5,7 @@
  */
 
 #include <AK/Assertions.h>
+#include <AK/Debug.h>
 #include <AK/NonnullOwnPtr.h>
 #include <AK/Platform.h>
 #include <LibGC/Heap.h>
@@ -61,4 +62,25 @@ void HeapBlock::deallocate(Cell* cell)
 #endif
 }
 
+HeapBlock::SweepResult HeapBlock::sweep()
+{
+    SweepResult result;
+    bool has_cells_without_write_barriers = false;
+    for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
+        if (!cell->is_marked()) {
+            dbgln_if(HEAP_DEBUG, "  ~ {}", cell);
+            deallocate(cell);
+            ++result.collected_cells;
+        } else {
+            if (!cell->has_write_barriers()) {
+                cell->set_marked(false);
+                has_cells_without_write_barriers = true;
+            }
+            ++result.live_cells;
+        }
+    });
+    m_has_young_cells = has_cells_without_write_barriers;
+    return result;
+}
+
 }
@@ -44,12 +44,27 @@ public:
 
         if (allocated_cell) {
             ASAN_UNPOISON_MEMORY_REGION(allocated_cell, m_cell_size);
+            m_has_young_cells = true;
         }
         return allocated_cell;
     }
 
+    // Set when a cell is allocated in this block. Cleared when the block is swept, unless some surviving cell doesn't
+    // use write barriers, since such cells never become old.
+    bool has_young_cells() const { return m_has_young_cells; }
+    void set_has_young_cells(bool b) { m_has_young_cells = b; }
+
     void deallocate(Cell*);
 
+    struct SweepResult {
+        size_t live_cells { 0 };
+        size_t collected_cells { 0 };
+    };
+
+    // Destroys the unmarked cells in this block. Surviving cells with write barriers stay marked, which makes them part
+    // of the old generation. The others are unmarked again, so that the next minor collection traces through them.
+    SweepResult sweep();
+
     template<typename Callback>
     void for_each_cell(Callback callback)
     {
@@ -112,6 +127,7 @@ private:
     size_t m_cell_size { 0 };
     size_t m_next_lazy_freelist_index { 0 };
     Ptr<FreelistEntry> m_freelist;
+    bool m_has_young_cells { false };
     alignas(__BIGGEST_ALIGNMENT__) u8 m_storage[];
 
 public:
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGC/MarkingWorklist.h>
+
+namespace GC {
+
+MarkingWorklist::MarkingWorklist(size_t marker_count)
+    : m_marker_count(marker_count)
+{
+}
+
+void MarkingWorklist::publish(Segment&& segment)
+{
+    Threading::MutexLocker locker(m_mutex);
+    m_segments.append(move(segment));
+    m_condition.signal();
+}
+
+bool MarkingWorklist::take(Segment& segment)
+{
+    Threading::MutexLocker locker(m_mutex);
+    m_idle_marker_count.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+
+    while (m_segments.is_empty() && !m_done) {
+        if (m_idle_marker_count.load(AK::MemoryOrder::memory_order_relaxed) == m_marker_count) {
+            m_done = true;
+            m_condition.broadcast();
+            break;
+        }
+        m_condition.wait();
+    }
+
+    if (m_done)
+        return false;
+
+    m_idle_marker_count.fetch_sub(1, AK::MemoryOrder::memory_order_relaxed);
+    segment = m_segments.take_last();
+    return true;
+}
+
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/Noncopyable.h>
+#include <AK/Vector.h>
+#include <LibGC/Forward.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
+
+namespace GC {
+
+// Shares marking work between the threads of a parallel collection. Every marker keeps the cells whose edges it still
+// has to visit on a local stack, and hands fixed-size segments of it over to this worklist while other markers are idle.
+// Idle markers then take (steal) these segments, until all markers are idle and no segments are left.
+class MarkingWorklist {
+    AK_MAKE_NONCOPYABLE(MarkingWorklist);
+    AK_MAKE_NONMOVABLE(MarkingWorklist);
+
+public:
+    static constexpr size_t segment_size = 64;
+    using Segment = Vector<Cell*, segment_size>;
+
+    explicit MarkingWorklist(size_t marker_count);
+
+    bool has_idle_markers() const { return m_idle_marker_count.load(AK::MemoryOrder::memory_order_relaxed) > 0; }
+
+    void publish(Segment&&);
+
+    // Blocks until a segment is available, or returns false once every marker has run out of work.
+    bool take(Segment&);
+
+private:
+    Threading::Mutex m_mutex;
+    Threading::ConditionVariable m_condition { m_mutex };
+    Vector<Segment> m_segments;
+
+    size_t const m_marker_count { 0 };
+    Atomic<size_t> m_idle_marker_count { 0 };
+    bool m_done { false };
+};
+
+}
@@ -16,6 +16,7 @@ public:
     explicit WeakContainer(Heap&);
     virtual ~WeakContainer();
 
+    // Called after marking, before any dead cell has been swept. The cells that aren't marked at that point are dead.
     virtual void remove_dead_cells(Badge<Heap>) = 0;
 
 protected:
@@ -245,6 +245,17 @@ public:
         return true;
     }
 
+    [[nodiscard]] constexpr bool operator==(Matrix const& other) const
+    {
+        for (size_t i = 0; i < N; ++i) {
+            for (size_t j = 0; j < N; ++j) {
+                if ((*this)[i, j] != other[i, j])
+                    return false;
+            }
+        }
+        return true;
+    }
+
 private:
     T m_elements[N][N];
 };
@@ -8,6 +8,7 @@
 #include <LibGfx/PaintingSurface.h>
 #include <LibGfx/SkiaUtils.h>
 
+#include <core/SkCanvas.h>
 #include <core/SkColorSpace.h>
 #include <core/SkSurface.h>
 #include <gpu/GrBackendSurface.h>
@@ -173,6 +174,21 @@ void PaintingSurface::write_from_bitmap(Bitmap const& bitmap)
     m_impl->surface->writePixels(pixmap, 0, 0);
 }
 
+void PaintingSurface::copy_from(PaintingSurface const& source, IntRect const& excluded_rect)
+{
+    VERIFY(source.size() == size());
+
+    lock_context();
+    auto& canvas = this->canvas();
+    canvas.save();
+    canvas.clipRect(to_skia_rect(excluded_rect), SkClipOp::kDifference);
+    SkPaint paint;
+    paint.setBlendMode(SkBlendMode::kSrc);
+    canvas.drawImage(source.sk_image_snapshot<sk_sp<SkImage>>(), 0, 0, SkSamplingOptions(), &paint);
+    canvas.restore();
+    unlock_context();
+}
+
 IntSize PaintingSurface::size() const
 {
     return m_impl->size;
@@ -46,6 +46,9 @@ public:
     void read_into_bitmap(Bitmap&);
     void write_from_bitmap(Bitmap const&);
 
+    // Copies all pixels of a surface of the same size, except for the ones inside of the excluded rect.
+    void copy_from(PaintingSurface const&, IntRect const& excluded_rect);
+
     void notify_content_will_change();
 
     IntSize size() const;
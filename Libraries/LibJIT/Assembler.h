@@ -0,0 +1,511 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NumericLimits.h>
+#include <AK/Optional.h>
+#include <AK/Types.h>
+#include <AK/Vector.h>
+
+namespace JIT {
+
+// A minimal x86-64 assembler, supporting just the instructions needed by the baseline JITs of LibJS and LibWasm.
+class Assembler {
+public:
+    explicit Assembler(Vector<u8>& output)
+        : m_output(output)
+    {
+    }
+
+    enum class Reg {
+        RAX = 0,
+        RCX = 1,
+        RDX = 2,
+        RBX = 3,
+        RSP = 4,
+        RBP = 5,
+        RSI = 6,
+        RDI = 7,
+        R8 = 8,
+        R9 = 9,
+        R10 = 10,
+        R11 = 11,
+        R12 = 12,
+        R13 = 13,
+        R14 = 14,
+        R15 = 15,
+    };
+
+    enum class FloatReg {
+        XMM0 = 0,
+        XMM1 = 1,
+        XMM2 = 2,
+        XMM3 = 3,
+        XMM4 = 4,
+        XMM5 = 5,
+        XMM6 = 6,
+        XMM7 = 7,
+    };
+
+    enum class Condition {
+        Overflow = 0x0,
+        NotOverflow = 0x1,
+        Below = 0x2,
+        AboveOrEqual = 0x3,
+        EqualTo = 0x4,
+        NotEqualTo = 0x5,
+        BelowOrEqual = 0x6,
+        Above = 0x7,
+        Sign = 0x8,
+        NotSign = 0x9,
+        Parity = 0xA,
+        NotParity = 0xB,
+        SignedLessThan = 0xC,
+        SignedGreaterThanOrEqualTo = 0xD,
+        SignedLessThanOrEqualTo = 0xE,
+        SignedGreaterThan = 0xF,
+    };
+
+    // Shifts and rotates by the amount in CL, which the processor masks to the width of the operand.
+    enum class ShiftOperation : u8 {
+        RotateLeft = 0,
+        RotateRight = 1,
+        ShiftLeft = 4,
+        LogicalShiftRight = 5,
+        ArithmeticShiftRight = 7,
+    };
+
+    // Scalar SSE operations, with the destination register as the left-hand side and a memory operand as the right-hand side.
+    enum class FloatOperation : u8 {
+        SquareRoot = 0x51,
+        Add = 0x58,
+        Multiply = 0x59,
+        // cvtss2sd or cvtsd2ss, depending on the precision of the operation.
+        ConvertPrecision = 0x5A,
+        Subtract = 0x5C,
+        Divide = 0x5E,
+    };
+
+    struct Label {
+        Optional<size_t> offset_of_label;
+        Vector<size_t> jump_slot_offsets;
+
+        void add_jump(Assembler& assembler, size_t jump_slot_offset)
+        {
+            if (offset_of_label.has_value())
+                assembler.patch_jump_slot(jump_slot_offset, *offset_of_label);
+            else
+                jump_slot_offsets.append(jump_slot_offset);
+        }
+
+        void link(Assembler& assembler)
+        {
+            link_to(assembler, assembler.m_output.size());
+        }
+
+        void link_to(Assembler& assembler, size_t offset)
+        {
+            VERIFY(!offset_of_label.has_value());
+            offset_of_label = offset;
+            for (auto jump_slot_offset : jump_slot_offsets)
+                assembler.patch_jump_slot(jump_slot_offset, offset);
+            jump_slot_offsets.clear();
+        }
+    };
+
+    [[nodiscard]] Label make_label() { return {}; }
+
+    size_t current_offset() const { return m_output.size(); }
+
+    // Patches the rel32 operand ending at `jump_slot_offset + 4` to point at `target_offset`.
+    void patch_jump_slot(size_t jump_slot_offset, size_t target_offset)
+    {
+        i32 relative_offset = static_cast<i32>(static_cast<i64>(target_offset) - static_cast<i64>(jump_slot_offset + 4));
+        for (size_t i = 0; i < 4; ++i)
+            m_output[jump_slot_offset + i] = static_cast<u8>(relative_offset >> (i * 8));
+    }
+
+    // mov dst, [base + offset]
+    void load64(Reg dst, Reg base, i32 offset) { emit_memory_operation(true, 0x8B, dst, base, offset); }
+
+    // mov dst32, [base + offset]
+    void load32(Reg dst, Reg base, i32 offset) { emit_memory_operation(false, 0x8B, dst, base, offset); }
+
+    // movzx dst32, word [base + offset]
+    void load16(Reg dst, Reg base, i32 offset) { emit_extended_memory_operation(false, 0xB7, dst, base, offset); }
+
+    // movzx dst32, byte [base + offset]
+    void load8(Reg dst, Reg base, i32 offset) { emit_extended_memory_operation(false, 0xB6, dst, base, offset); }
+
+    // movsxd dst, [base + offset]
+    void load32_sign_extended64(Reg dst, Reg base, i32 offset) { emit_memory_operation(true, 0x63, dst, base, offset); }
+
+    // movsx dst, word [base + offset]
+    void load16_sign_extended(bool is_64bit, Reg dst, Reg base, i32 offset) { emit_extended_memory_operation(is_64bit, 0xBF, dst, base, offset); }
+
+    // movsx dst, byte [base + offset]
+    void load8_sign_extended(bool is_64bit, Reg dst, Reg base, i32 offset) { emit_extended_memory_operation(is_64bit, 0xBE, dst, base, offset); }
+
+    // mov [base + offset], src
+    void store64(Reg base, i32 offset, Reg src) { emit_memory_operation(true, 0x89, src, base, offset); }
+    void store32(Reg base, i32 offset, Reg src) { emit_memory_operation(false, 0x89, src, base, offset); }
+
+    void store16(Reg base, i32 offset, Reg src)
+    {
+        emit8(0x66);
+        emit_memory_operation(false, 0x89, src, base, offset);
+    }
+
+    void store8(Reg base, i32 offset, Reg src)
+    {
+        emit_rex(false, src, base, is_byte_register_needing_rex(src));
+        emit8(0x88);
+        emit_memory_operand(src, base, offset);
+    }
+
+    // lea dst, [base + offset]
+    void load_effective_address(Reg dst, Reg base, i32 offset) { emit_memory_operation(true, 0x8D, dst, base, offset); }
+
+    // lea dst, [rip + label]
+    void load_effective_address(Reg dst, Label& label)
+    {
+        emit_rex(true, dst, Reg::RAX);
+        emit8(0x8D);
+        emit_modrm(0b00, to_underlying(dst), 0b101);
+        label.add_jump(*this, emit_jump_slot());
+    }
+
+    // cmp reg, [base + offset]
+    void compare64_with_memory(Reg reg, Reg base, i32 offset) { emit_memory_operation(true, 0x3B, reg, base, offset); }
+
+    // sub qword [base + offset], immediate
+    void sub64_in_memory(Reg base, i32 offset, i32 immediate)
+    {
+        emit_rex(true, Reg::RAX, base);
+        emit8(0x81);
+        emit_memory_operand(static_cast<Reg>(5), base, offset);
+        emit32(static_cast<u32>(immediate));
+    }
+
+    void mov64(Reg dst, Reg src) { emit_register_operation(true, 0x89, src, dst); }
+
+    // NOTE: This zero-extends the result into the full register.
+    void mov32(Reg dst, Reg src) { emit_register_operation(false, 0x89, src, dst); }
+
+    void mov64(Reg dst, u64 immediate)
+    {
+        if (immediate <= NumericLimits<u32>::max()) {
+            // mov dst32, imm32 (zero-extends into the full register)
+            emit_rex(false, Reg::RAX, dst);
+            emit8(0xB8 | (to_underlying(dst) & 7));
+            emit32(static_cast<u32>(immediate));
+            return;
+        }
+        emit_rex(true, Reg::RAX, dst);
+        emit8(0xB8 | (to_underlying(dst) & 7));
+        emit64(immediate);
+    }
+
+    void add32(Reg dst, Reg src) { emit_register_operation(false, 0x01, src, dst); }
+    void sub32(Reg dst, Reg src) { emit_register_operation(false, 0x29, src, dst); }
+    void and32(Reg dst, Reg src) { emit_register_operation(false, 0x21, src, dst); }
+    void or32(Reg dst, Reg src) { emit_register_operation(false, 0x09, src, dst); }
+    void xor32(Reg dst, Reg src) { emit_register_operation(false, 0x31, src, dst); }
+    void add64(Reg dst, Reg src) { emit_register_operation(true, 0x01, src, dst); }
+    void sub64(Reg dst, Reg src) { emit_register_operation(true, 0x29, src, dst); }
+    void and64(Reg dst, Reg src) { emit_register_operation(true, 0x21, src, dst); }
+    void or64(Reg dst, Reg src) { emit_register_operation(true, 0x09, src, dst); }
+    void xor64(Reg dst, Reg src) { emit_register_operation(true, 0x31, src, dst); }
+    void compare64(Reg lhs, Reg rhs) { emit_register_operation(true, 0x39, rhs, lhs); }
+    void compare32(Reg lhs, Reg rhs) { emit_register_operation(false, 0x39, rhs, lhs); }
+    void test32(Reg lhs, Reg rhs) { emit_register_operation(false, 0x85, rhs, lhs); }
+    void test64(Reg lhs, Reg rhs) { emit_register_operation(true, 0x85, rhs, lhs); }
+
+    // imul dst, src
+    void multiply32(Reg dst, Reg src) { emit_extended_register_operation(false, 0xAF, dst, src); }
+    void multiply64(Reg dst, Reg src) { emit_extended_register_operation(true, 0xAF, dst, src); }
+
+    void add32(Reg dst, i32 immediate) { emit_immediate_operation(false, 0, dst, immediate); }
+    void sub32(Reg dst, i32 immediate) { emit_immediate_operation(false, 5, dst, immediate); }
+    void and32(Reg dst, i32 immediate) { emit_immediate_operation(false, 4, dst, immediate); }
+    void xor32(Reg dst, i32 immediate) { emit_immediate_operation(false, 6, dst, immediate); }
+    void compare32(Reg lhs, i32 immediate) { emit_immediate_operation(false, 7, lhs, immediate); }
+    void add64(Reg dst, i32 immediate) { emit_immediate_operation(true, 0, dst, immediate); }
+    void sub64(Reg dst, i32 immediate) { emit_immediate_operation(true, 5, dst, immediate); }
+    void compare64(Reg lhs, i32 immediate) { emit_immediate_operation(true, 7, lhs, immediate); }
+
+    void shift_left64(Reg reg, u8 amount) { emit_shift(4, reg, amount); }
+    void shift_right64(Reg reg, u8 amount) { emit_shift(5, reg, amount); }
+    void arithmetic_shift_right64(Reg reg, u8 amount) { emit_shift(7, reg, amount); }
+
+    void shift32(ShiftOperation operation, Reg reg) { emit_shift_by_cl(false, operation, reg); }
+    void shift64(ShiftOperation operation, Reg reg) { emit_shift_by_cl(true, operation, reg); }
+
+    // Divides RDX:RAX (or EDX:EAX) by `divisor`, leaving the quotient in RAX and the remainder in RDX.
+    void unsigned_divide32(Reg divisor) { emit_group3(false, 6, divisor); }
+    void unsigned_divide64(Reg divisor) { emit_group3(true, 6, divisor); }
+    void signed_divide32(Reg divisor) { emit_group3(false, 7, divisor); }
+    void signed_divide64(Reg divisor) { emit_group3(true, 7, divisor); }
+
+    // cdq / cqo, sign-extending RAX into RDX ahead of a signed division.
+    void sign_extend_rax_into_rdx32() { emit8(0x99); }
+    void sign_extend_rax_into_rdx64()
+    {
+        emit8(0x48);
+        emit8(0x99);
+    }
+
+    // bsf / bsr, which set the zero flag and leave `dst` undefined if `src` is zero.
+    void bit_scan_forward32(Reg dst, Reg src) { emit_extended_register_operation(false, 0xBC, dst, src); }
+    void bit_scan_forward64(Reg dst, Reg src) { emit_extended_register_operation(true, 0xBC, dst, src); }
+    void bit_scan_reverse32(Reg dst, Reg src) { emit_extended_register_operation(false, 0xBD, dst, src); }
+    void bit_scan_reverse64(Reg dst, Reg src) { emit_extended_register_operation(true, 0xBD, dst, src); }
+
+    // cmovcc dst, src
+    void move_if32(Condition condition, Reg dst, Reg src) { emit_extended_register_operation(false, 0x40 | to_underlying(condition), dst, src); }
+    void move_if64(Condition condition, Reg dst, Reg src) { emit_extended_register_operation(true, 0x40 | to_underlying(condition), dst, src); }
+
+    // Sets `dst` to 1 if the condition holds, and to 0 otherwise.
+    void set_if(Condition condition, Reg dst)
+    {
+        emit_rex(false, Reg::RAX, dst, is_byte_register_needing_rex(dst));
+        emit8(0x0F);
+        emit8(0x90 | to_underlying(condition));
+        emit_modrm(0b11, 0, to_underlying(dst));
+        zero_extend8_to32(dst, dst);
+    }
+
+    // movzx / movsx / movsxd dst, src
+    void zero_extend8_to32(Reg dst, Reg src) { emit_extended_register_operation(false, 0xB6, dst, src, is_byte_register_needing_rex(src)); }
+    void zero_extend16_to32(Reg dst, Reg src) { emit_extended_register_operation(false, 0xB7, dst, src); }
+    void sign_extend8(bool is_64bit, Reg dst, Reg src) { emit_extended_register_operation(is_64bit, 0xBE, dst, src, is_byte_register_needing_rex(src)); }
+    void sign_extend16(bool is_64bit, Reg dst, Reg src) { emit_extended_register_operation(is_64bit, 0xBF, dst, src); }
+    void sign_extend32_to64(Reg dst, Reg src) { emit_register_operation(true, 0x63, dst, src); }
+
+    // movss / movsd dst, [base + offset]
+    void load_float32(FloatReg dst, Reg base, i32 offset) { emit_float_memory_operation(0xF3, false, 0x10, dst, base, offset); }
+    void load_float64(FloatReg dst, Reg base, i32 offset) { emit_float_memory_operation(0xF2, false, 0x10, dst, base, offset); }
+
+    // movss / movsd [base + offset], src
+    void store_float32(Reg base, i32 offset, FloatReg src) { emit_float_memory_operation(0xF3, false, 0x11, src, base, offset); }
+    void store_float64(Reg base, i32 offset, FloatReg src) { emit_float_memory_operation(0xF2, false, 0x11, src, base, offset); }
+
+    void float32_operation(FloatOperation operation, FloatReg dst, Reg base, i32 offset) { emit_float_memory_operation(0xF3, false, to_underlying(operation), dst, base, offset); }
+    void float64_operation(FloatOperation operation, FloatReg dst, Reg base, i32 offset) { emit_float_memory_operation(0xF2, false, to_underlying(operation), dst, base, offset); }
+
+    // ucomiss / ucomisd lhs, [base + offset], which sets the parity flag if either side is NaN.
+    void compare_float32(FloatReg lhs, Reg base, i32 offset) { emit_float_memory_operation(0, false, 0x2E, lhs, base, offset); }
+    void compare_float64(FloatReg lhs, Reg base, i32 offset) { emit_float_memory_operation(0x66, false, 0x2E, lhs, base, offset); }
+
+    // cvtsi2ss / cvtsi2sd dst, src
+    void convert_integer_to_float32(FloatReg dst, Reg src, bool source_is_64bit) { emit_float_register_operation(0xF3, source_is_64bit, 0x2A, to_underlying(dst), to_underlying(src)); }
+    void convert_integer_to_float64(FloatReg dst, Reg src, bool source_is_64bit) { emit_float_register_operation(0xF2, source_is_64bit, 0x2A, to_underlying(dst), to_underlying(src)); }
+
+    // xorps reg, reg
+    void zero_float_register(FloatReg reg) { emit_float_register_operation(0, false, 0x57, to_underlying(reg), to_underlying(reg)); }
+
+    void jump(Label& label)
+    {
+        emit8(0xE9);
+        label.add_jump(*this, emit_jump_slot());
+    }
+
+    // Emits a jump to a location that is not yet known, returning the offset of the slot to patch later.
+    [[nodiscard]] size_t jump_to_be_patched()
+    {
+        emit8(0xE9);
+        return emit_jump_slot();
+    }
+
+    void jump_if(Condition condition, Label& label)
+    {
+        emit8(0x0F);
+        emit8(0x80 | to_underlying(condition));
+        label.add_jump(*this, emit_jump_slot());
+    }
+
+    [[nodiscard]] size_t jump_if_to_be_patched(Condition condition)
+    {
+        emit8(0x0F);
+        emit8(0x80 | to_underlying(condition));
+        return emit_jump_slot();
+    }
+
+    // The size of `jump(Label&)`, for building tables of jumps that are indexed into.
+    static constexpr size_t jump_size = 5;
+
+    void jump(Reg target)
+    {
+        emit_rex(false, Reg::RAX, target);
+        emit8(0xFF);
+        emit_modrm(0b11, 4, to_underlying(target));
+    }
+
+    void call(Reg target)
+    {
+        emit_rex(false, Reg::RAX, target);
+        emit8(0xFF);
+        emit_modrm(0b11, 2, to_underlying(target));
+    }
+
+    void push(Reg reg)
+    {
+        emit_rex(false, Reg::RAX, reg);
+        emit8(0x50 | (to_underlying(reg) & 7));
+    }
+
+    void pop(Reg reg)
+    {
+        emit_rex(false, Reg::RAX, reg);
+        emit8(0x58 | (to_underlying(reg) & 7));
+    }
+
+    void ret() { emit8(0xC3); }
+
+private:
+    void emit8(u8 value) { m_output.append(value); }
+
+    void emit32(u32 value)
+    {
+        for (size_t i = 0; i < 4; ++i)
+            emit8(static_cast<u8>(value >> (i * 8)));
+    }
+
+    void emit64(u64 value)
+    {
+        for (size_t i = 0; i < 8; ++i)
+            emit8(static_cast<u8>(value >> (i * 8)));
+    }
+
+    size_t emit_jump_slot()
+    {
+        auto offset = m_output.size();
+        emit32(0);
+        return offset;
+    }
+
+    void emit_modrm(u8 mod, u8 reg, u8 rm)
+    {
+        emit8(static_cast<u8>((mod << 6) | ((reg & 7) << 3) | (rm & 7)));
+    }
+
+    // Without a REX prefix, the byte registers 4 to 7 are AH, CH, DH and BH instead of SPL, BPL, SIL and DIL.
+    static bool is_byte_register_needing_rex(Reg reg)
+    {
+        return to_underlying(reg) >= 4 && to_underlying(reg) < 8;
+    }
+
+    // Emits a REX prefix if one is needed, with `reg` in the ModRM.reg field and `rm` in the ModRM.rm (or base) field.
+    void emit_rex(bool is_64bit, Reg reg, Reg rm, bool force = false)
+    {
+        u8 rex = 0x40;
+        if (is_64bit)
+            rex |= 0x08;
+        if (to_underlying(reg) >= 8)
+            rex |= 0x04;
+        if (to_underlying(rm) >= 8)
+            rex |= 0x01;
+        if (rex != 0x40 || force)
+            emit8(rex);
+    }
+
+    void emit_register_operation(bool is_64bit, u8 opcode, Reg reg, Reg rm)
+    {
+        emit_rex(is_64bit, reg, rm);
+        emit8(opcode);
+        emit_modrm(0b11, to_underlying(reg), to_underlying(rm));
+    }
+
+    // Two-byte opcodes (0F xx) with register operands.
+    void emit_extended_register_operation(bool is_64bit, u8 opcode, Reg reg, Reg rm, bool force_rex = false)
+    {
+        emit_rex(is_64bit, reg, rm, force_rex);
+        emit8(0x0F);
+        emit8(opcode);
+        emit_modrm(0b11, to_underlying(reg), to_underlying(rm));
+    }
+
+    void emit_memory_operation(bool is_64bit, u8 opcode, Reg reg, Reg base, i32 offset)
+    {
+        emit_rex(is_64bit, reg, base);
+        emit8(opcode);
+        emit_memory_operand(reg, base, offset);
+    }
+
+    void emit_extended_memory_operation(bool is_64bit, u8 opcode, Reg reg, Reg base, i32 offset)
+    {
+        emit_rex(is_64bit, reg, base);
+        emit8(0x0F);
+        emit8(opcode);
+        emit_memory_operand(reg, base, offset);
+    }
+
+    // SSE instructions take a mandatory prefix, which has to come before the REX prefix.
+    void emit_float_memory_operation(u8 prefix, bool is_64bit, u8 opcode, FloatReg reg, Reg base, i32 offset)
+    {
+        if (prefix)
+            emit8(prefix);
+        emit_rex(is_64bit, static_cast<Reg>(reg), base);
+        emit8(0x0F);
+        emit8(opcode);
+        emit_memory_operand(static_cast<Reg>(reg), base, offset);
+    }
+
+    void emit_float_register_operation(u8 prefix, bool is_64bit, u8 opcode, u8 reg, u8 rm)
+    {
+        if (prefix)
+            emit8(prefix);
+        emit_rex(is_64bit, static_cast<Reg>(reg), static_cast<Reg>(rm));
+        emit8(0x0F);
+        emit8(opcode);
+        emit_modrm(0b11, reg, rm);
+    }
+
+    void emit_memory_operand(Reg reg, Reg base, i32 offset)
+    {
+        // NOTE: We always use a 32-bit displacement, which also sidesteps the special meaning of RBP/R13 with mod=00.
+        emit_modrm(0b10, to_underlying(reg), to_underlying(base));
+        // RSP and R12 as a base register require a SIB byte.
+        if ((to_underlying(base) & 7) == to_underlying(Reg::RSP))
+            emit8(0x24);
+        emit32(static_cast<u32>(offset));
+    }
+
+    void emit_immediate_operation(bool is_64bit, u8 extension, Reg reg, i32 immediate)
+    {
+        emit_rex(is_64bit, Reg::RAX, reg);
+        emit8(0x81);
+        emit_modrm(0b11, extension, to_underlying(reg));
+        emit32(static_cast<u32>(immediate));
+    }
+
+    void emit_shift(u8 extension, Reg reg, u8 amount)
+    {
+        emit_rex(true, Reg::RAX, reg);
+        emit8(0xC1);
+        emit_modrm(0b11, extension, to_underlying(reg));
+        emit8(amount);
+    }
+
+    void emit_shift_by_cl(bool is_64bit, ShiftOperation operation, Reg reg)
+    {
+        emit_rex(is_64bit, Reg::RAX, reg);
+        emit8(0xD3);
+        emit_modrm(0b11, to_underlying(operation), to_underlying(reg));
+    }
+
+    void emit_group3(bool is_64bit, u8 extension, Reg reg)
+    {
+        emit_rex(is_64bit, Reg::RAX, reg);
+        emit8(0xF7);
+        emit_modrm(0b11, extension, to_underlying(reg));
+    }
+
+    Vector<u8>& m_output;
+};
+
+}
@@ -863,6 +863,25 @@ RefPtr<SharedFunctionInstanceData> FunctionNode::shared_data() const
     return m_shared_data;
 }
 
+void FunctionNode::discard_body_for_lazy_parsing(Badge<Parser>, NonnullOwnPtr<LazyFunctionParseData> lazy_parse_data)
+{
+    VERIFY(!m_shared_data);
+    m_body = nullptr;
+    m_parameters = FunctionParameters::empty();
+    m_local_variables_names.clear();
+    m_lazy_parse_data = move(lazy_parse_data);
+}
+
+void FunctionNode::set_lazily_parsed_body(Badge<Parser>, NonnullRefPtr<Statement const> body, NonnullRefPtr<FunctionParameters const> parameters, FunctionParsingInsights parsing_insights, Vector<LocalVariable> local_variables_names) const
+{
+    VERIFY(is_lazily_parsed());
+    m_body = move(body);
+    m_parameters = move(parameters);
+    m_parsing_insights = parsing_insights;
+    m_local_variables_names = move(local_variables_names);
+    m_lazy_parse_data = nullptr;
+}
+
 void FunctionNode::dump(int indent, ByteString const& class_name) const
 {
     print_indent(indent);
@@ -873,6 +892,11 @@ void FunctionNode::dump(int indent, ByteString const& class_name) const
         print_indent(indent + 1);
         outln("\033[31;1m(direct eval)\033[0m");
     }
+    if (is_lazily_parsed()) {
+        print_indent(indent + 1);
+        outln("(Lazily parsed, {} code units)", m_lazy_parse_data->source_length);
+        return;
+    }
     if (!m_parameters->is_empty()) {
         print_indent(indent + 1);
         outln("(Parameters)");
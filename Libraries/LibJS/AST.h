@@ -12,6 +12,7 @@
 #include <AK/FlyString.h>
 #include <AK/OwnPtr.h>
 #include <AK/RefPtr.h>
+#include <AK/Time.h>
 #include <AK/Utf16FlyString.h>
 #include <AK/Utf16String.h>
 #include <AK/Variant.h>
@@ -47,10 +48,17 @@ class MemberExpression;
 class VariableDeclaration;
 class SharedFunctionInstanceData;
 
+JS_API extern bool g_collect_lazy_function_parsing_statistics;
+
+// The bytes taken up by all AST nodes created so far. Only counted while g_collect_lazy_function_parsing_statistics is set.
+JS_API extern u64 g_created_ast_node_size;
+
 template<class T, class... Args>
 static inline NonnullRefPtr<T>
 create_ast_node(SourceRange range, Args&&... args)
 {
+    if (g_collect_lazy_function_parsing_statistics) [[unlikely]]
+        g_created_ast_node_size += sizeof(T);
     return adopt_ref(*new T(move(range), forward<Args>(args)...));
 }
 
@@ -177,11 +185,13 @@ public:
     {
     }
 
+    // The executable generated for this statement is cached on the (otherwise immutable) AST node, so that it may be
+    // shared by every function object or script created from it.
     Bytecode::Executable* bytecode_executable() const { return m_bytecode_executable; }
-    void set_bytecode_executable(Bytecode::Executable* bytecode_executable) { m_bytecode_executable = make_root(bytecode_executable); }
+    void set_bytecode_executable(Bytecode::Executable* bytecode_executable) const { m_bytecode_executable = make_root(bytecode_executable); }
 
 private:
-    GC::Root<Bytecode::Executable> m_bytecode_executable;
+    mutable GC::Root<Bytecode::Executable> m_bytecode_executable;
 };
 
 // 14.13 Labelled Statements, https://tc39.es/ecma262/#sec-labelled-statements
@@ -780,16 +790,80 @@ struct FunctionParsingInsights {
     bool might_need_arguments_object { false };
 };
 
+// The parts of the parser state that depend on where in the program the parser currently is, rather than on what it has
+// parsed so far. The parser state extends this, so that it can be captured and restored as a whole.
+struct ParserContextFlags {
+    bool strict_mode { false };
+    bool allow_super_property_lookup { false };
+    bool allow_super_constructor_call { false };
+    bool in_function_context { false };
+    bool initiated_by_eval { false };
+    bool in_eval_function_context { false }; // This controls if we allow new.target or not. Note that eval("return") is not allowed, so we have to have a separate state variable for eval.
+    bool in_formal_parameter_context { false };
+    bool in_generator_function_context { false };
+    bool await_expression_is_valid { false };
+    bool in_arrow_function_context { false };
+    bool in_break_context { false };
+    bool in_continue_context { false };
+    bool string_legacy_octal_escape_sequence_in_scope { false };
+    bool in_class_field_initializer { false };
+    bool in_class_static_init_block { false };
+};
+
+// A nested function may be parsed lazily: its body is validated, but not kept. When the function is first instantiated,
+// it is parsed again from the original source, and the bodies of the functions nested in it are only skipped over by
+// matching braces and noting the names they reference. This holds everything needed to reproduce the state the parser
+// was in at the start of the function.
+struct LazyFunctionParseData {
+    NonnullRefPtr<SourceCode const> source_code;
+    Position start;
+    u32 source_length { 0 };
+
+    bool is_module { false };
+    bool is_function_declaration { false };
+    bool arrow_function_has_parentheses { false };
+
+    ParserContextFlags context;
+
+    // One identifier for every name that the function references but does not declare itself, or for every name that
+    // appears in its body if that was skipped over. These identifiers took part in resolving the names in the enclosing
+    // scopes, so that the same resolution can be applied to the identifiers of the re-parsed body.
+    Vector<NonnullRefPtr<Identifier const>> free_identifiers;
+
+    // Only recorded while collecting lazy function parsing statistics. While the function is being parsed, these are the
+    // values of the counters at its start. Afterwards, they are the size of the AST that was created for it, and the time
+    // that took. If its body was skipped over, that only covers skipping it.
+    u64 ast_size { 0 };
+    u64 discarded_ast_size { 0 };
+    AK::Duration parse_time;
+};
+
 class JS_API FunctionNode {
 public:
     Utf16FlyString name() const { return m_name ? m_name->string() : Utf16FlyString {}; }
     RefPtr<Identifier const> name_identifier() const { return m_name; }
     ByteString const& source_text() const { return m_source_text; }
-    Statement const& body() const { return *m_body; }
-    auto const& body_ptr() const { return m_body; }
-    auto const& parameters() const { return m_parameters; }
+    Statement const& body() const
+    {
+        VERIFY(!is_lazily_parsed());
+        return *m_body;
+    }
+    NonnullRefPtr<Statement const> body_ptr() const
+    {
+        VERIFY(!is_lazily_parsed());
+        return *m_body;
+    }
+    NonnullRefPtr<FunctionParameters const> const& parameters() const
+    {
+        VERIFY(!is_lazily_parsed());
+        return m_parameters;
+    }
     i32 function_length() const { return m_function_length; }
-    Vector<LocalVariable> const& local_variables_names() const { return m_local_variables_names; }
+    Vector<LocalVariable> const& local_variables_names() const
+    {
+        VERIFY(!is_lazily_parsed());
+        return m_local_variables_names;
+    }
     bool is_strict_mode() const { return m_is_strict_mode; }
     bool might_need_arguments_object() const { return m_parsing_insights.might_need_arguments_object; }
     bool contains_direct_call_to_eval() const { return m_parsing_insights.contains_direct_call_to_eval; }
@@ -804,6 +878,11 @@ public:
     RefPtr<SharedFunctionInstanceData> shared_data() const;
     void set_shared_data(RefPtr<SharedFunctionInstanceData>) const;
 
+    bool is_lazily_parsed() const { return m_lazy_parse_data; }
+    LazyFunctionParseData const& lazy_parse_data() const { return *m_lazy_parse_data; }
+    void discard_body_for_lazy_parsing(Badge<Parser>, NonnullOwnPtr<LazyFunctionParseData>);
+    void set_lazily_parsed_body(Badge<Parser>, NonnullRefPtr<Statement const> body, NonnullRefPtr<FunctionParameters const> parameters, FunctionParsingInsights, Vector<LocalVariable> local_variables_names) const;
+
     virtual ~FunctionNode();
 
 protected:
@@ -814,15 +893,19 @@ protected:
 
 private:
     ByteString m_source_text;
-    NonnullRefPtr<Statement const> m_body;
-    NonnullRefPtr<FunctionParameters const> m_parameters;
+
+    // These are null (or empty) while the function is lazily parsed, and filled in once it has been fully parsed.
+    mutable RefPtr<Statement const> m_body;
+    mutable NonnullRefPtr<FunctionParameters const> m_parameters;
+    mutable OwnPtr<LazyFunctionParseData> m_lazy_parse_data;
+
     i32 const m_function_length;
     FunctionKind m_kind;
     bool m_is_strict_mode : 1 { false };
     bool m_is_arrow_function : 1 { false };
-    FunctionParsingInsights m_parsing_insights;
+    mutable FunctionParsingInsights m_parsing_insights;
 
-    Vector<LocalVariable> m_local_variables_names;
+    mutable Vector<LocalVariable> m_local_variables_names;
 
     mutable RefPtr<SharedFunctionInstanceData> m_shared_data;
 };
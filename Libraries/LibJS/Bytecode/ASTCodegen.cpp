@@ -1138,10 +1138,48 @@ Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> ForStatement::generate_
     return body_result;
 }
 
+// Literals that only have data properties with distinct, non-computed names can be created with all of their
+// properties at once, once their values have been evaluated. No code can observe the object before that.
+static bool can_create_object_literal_with_properties(Vector<NonnullRefPtr<ObjectProperty>> const& properties)
+{
+    if (properties.is_empty())
+        return false;
+
+    HashTable<Utf16FlyString> keys;
+    for (auto const& property : properties) {
+        if (property->type() != ObjectProperty::Type::KeyValue || property->is_method() || !is<StringLiteral>(property->key()))
+            return false;
+        if (keys.set(static_cast<StringLiteral const&>(property->key()).value()) != HashSetResult::InsertedNewEntry)
+            return false;
+    }
+    return true;
+}
+
 Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> ObjectExpression::generate_bytecode(Bytecode::Generator& generator, [[maybe_unused]] Optional<ScopedOperand> preferred_dst) const
 {
     Bytecode::Generator::SourceLocationScope scope(generator, *this);
 
+    // OPTIMIZATION: Instead of adding the properties to an empty object one by one, which transitions its shape once per
+    //               property, the object is created with all of them in one step.
+    if (can_create_object_literal_with_properties(m_properties)) {
+        Vector<ScopedOperand> values;
+        Vector<Bytecode::Op::NewObjectWithProperties::Property> properties;
+        values.ensure_capacity(m_properties.size());
+        properties.ensure_capacity(m_properties.size());
+
+        for (auto const& property : m_properties) {
+            auto key = generator.intern_identifier(static_cast<StringLiteral const&>(property->key()).value());
+            auto value = TRY(generator.emit_named_evaluation_if_anonymous_function(property->value(), key));
+            values.append(generator.copy_if_needed_to_preserve_evaluation_order(value));
+            properties.append({ key, values.last() });
+        }
+
+        auto object = choose_dst(generator, preferred_dst);
+        generator.emit_with_extra_slots<Bytecode::Op::NewObjectWithProperties, Bytecode::Op::NewObjectWithProperties::Property>(
+            properties.size(), object, generator.next_object_literal_cache(), properties);
+        return object;
+    }
+
     auto object = choose_dst(generator, preferred_dst);
 
     generator.emit<Bytecode::Op::NewObject>(object);
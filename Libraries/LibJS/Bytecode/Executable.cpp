@@ -8,6 +8,7 @@
 #include <LibJS/Bytecode/Executable.h>
 #include <LibJS/Bytecode/Instruction.h>
 #include <LibJS/Bytecode/RegexTable.h>
+#include <LibJS/JIT/NativeExecutable.h>
 #include <LibJS/Runtime/Value.h>
 #include <LibJS/SourceCode.h>
 
@@ -24,6 +25,7 @@ Executable::Executable(
     NonnullRefPtr<SourceCode const> source_code,
     size_t number_of_property_lookup_caches,
     size_t number_of_global_variable_caches,
+    size_t number_of_object_literal_caches,
     size_t number_of_registers,
     bool is_strict_mode)
     : bytecode(move(bytecode))
@@ -37,10 +39,27 @@ Executable::Executable(
 {
     property_lookup_caches.resize(number_of_property_lookup_caches);
     global_variable_caches.resize(number_of_global_variable_caches);
+    object_literal_caches.resize(number_of_object_literal_caches);
 }
 
 Executable::~Executable() = default;
 
+PropertyLookupCache::State PropertyLookupCache::state() const
+{
+    if (is_megamorphic)
+        return State::Megamorphic;
+    size_t number_of_entries = 0;
+    for (auto const& entry : entries) {
+        if (entry.type != Entry::Type::Empty)
+            ++number_of_entries;
+    }
+    if (number_of_entries == 0)
+        return State::Uninitialized;
+    if (number_of_entries == 1)
+        return State::Monomorphic;
+    return State::Polymorphic;
+}
+
 void Executable::dump() const
 {
     warnln("\033[37;1mJS bytecode executable\033[0m \"{}\"", name);
@@ -88,6 +107,8 @@ void Executable::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(constants);
+    if (native_executable)
+        native_executable->visit_edges(visitor);
 }
 
 Optional<Executable::ExceptionHandlers const&> Executable::exception_handlers_for_offset(size_t offset) const
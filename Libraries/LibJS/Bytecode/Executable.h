@@ -46,6 +46,35 @@ struct PropertyLookupCache {
         Optional<u32> shape_dictionary_generation;
     };
     AK::Array<Entry, max_number_of_shapes_to_remember> entries;
+
+    // Makes room for a new entry at the front, evicting the least recently added one.
+    Entry& make_room_for_new_entry()
+    {
+        auto& evicted_entry = entries.last();
+        if (evicted_entry.type != Entry::Type::Empty && evicted_entry.shape)
+            is_megamorphic = true;
+        for (size_t i = entries.size() - 1; i >= 1; --i)
+            entries[i] = entries[i - 1];
+        entries[0] = {};
+        return entries[0];
+    }
+
+    enum class State {
+        Uninitialized,
+        Monomorphic,
+        Polymorphic,
+        Megamorphic,
+    };
+    State state() const;
+
+    // Set once a live entry had to be evicted to make room for another one. Megamorphic sites also consult the VM's
+    // MegamorphicCache before taking the slow path.
+    bool is_megamorphic { false };
+
+    // The number of times the slow path was taken, and the program counter of the instruction that took it last. These
+    // are only used for reporting inline cache statistics.
+    u32 miss_count { 0 };
+    u32 program_counter { 0 };
 };
 
 struct GlobalVariableCache : public PropertyLookupCache {
@@ -55,6 +84,11 @@ struct GlobalVariableCache : public PropertyLookupCache {
     bool in_module_environment { false };
 };
 
+// Remembers the shape of the objects created by one object literal, so that later objects can be created with it directly.
+struct ObjectLiteralCache {
+    GC::Weak<Shape> shape;
+};
+
 struct SourceRecord {
     u32 source_start_offset {};
     u32 source_end_offset {};
@@ -74,6 +108,7 @@ public:
         NonnullRefPtr<SourceCode const>,
         size_t number_of_property_lookup_caches,
         size_t number_of_global_variable_caches,
+        size_t number_of_object_literal_caches,
         size_t number_of_registers,
         bool is_strict_mode);
 
@@ -83,6 +118,7 @@ public:
     Vector<u8> bytecode;
     Vector<PropertyLookupCache> property_lookup_caches;
     Vector<GlobalVariableCache> global_variable_caches;
+    Vector<ObjectLiteralCache> object_literal_caches;
     NonnullOwnPtr<StringTable> string_table;
     NonnullOwnPtr<IdentifierTable> identifier_table;
     NonnullOwnPtr<RegexTable> regex_table;
@@ -110,6 +146,11 @@ public:
 
     Optional<IdentifierTableIndex> length_identifier;
 
+    // Calls and backward jumps are counted to find the executables that are worth compiling with the baseline JIT.
+    u32 jit_hotness { 0 };
+    bool did_try_jit_compilation { false };
+    OwnPtr<JIT::NativeExecutable> native_executable;
+
     Utf16String const& get_string(StringTableIndex index) const { return string_table->get(index); }
     Utf16FlyString const& get_identifier(IdentifierTableIndex index) const { return identifier_table->get(index); }
 
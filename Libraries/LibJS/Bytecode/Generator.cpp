@@ -10,6 +10,7 @@
 #include <LibJS/Bytecode/BasicBlock.h>
 #include <LibJS/Bytecode/Generator.h>
 #include <LibJS/Bytecode/Instruction.h>
+#include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Bytecode/Op.h>
 #include <LibJS/Bytecode/Register.h>
 #include <LibJS/Runtime/ECMAScriptFunctionObject.h>
@@ -452,6 +453,7 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
         node.source_code(),
         generator.m_next_property_lookup_cache,
         generator.m_next_global_variable_cache,
+        generator.m_next_object_literal_cache,
         generator.m_next_register,
         is_strict_mode);
 
@@ -479,6 +481,9 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
 
     generator.m_finished = true;
 
+    if (g_collect_inline_cache_statistics)
+        vm.bytecode_interpreter().did_create_executable(*executable);
+
     return executable;
 }
 
@@ -116,6 +116,7 @@
     O(NewClass)                        \
     O(NewFunction)                     \
     O(NewObject)                       \
+    O(NewObjectWithProperties)         \
     O(NewPrimitiveArray)               \
     O(NewRegExp)                       \
     O(NewTypeError)                    \
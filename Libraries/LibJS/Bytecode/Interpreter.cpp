@@ -7,6 +7,7 @@
 
 #include <AK/Debug.h>
 #include <AK/HashTable.h>
+#include <AK/QuickSort.h>
 #include <AK/TemporaryChange.h>
 #include <LibGC/RootHashMap.h>
 #include <LibJS/AST.h>
@@ -18,6 +19,8 @@
 #include <LibJS/Bytecode/Op.h>
 #include <LibJS/Bytecode/PropertyAccess.h>
 #include <LibJS/Export.h>
+#include <LibJS/JIT/Compiler.h>
+#include <LibJS/JIT/NativeExecutable.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Accessor.h>
 #include <LibJS/Runtime/Array.h>
@@ -46,6 +49,8 @@
 namespace JS::Bytecode {
 
 bool g_dump_bytecode = false;
+bool g_jit_enabled = false;
+bool g_collect_inline_cache_statistics = false;
 
 static ByteString format_operand(StringView name, Operand operand, Bytecode::Executable const& executable)
 {
@@ -202,6 +207,12 @@ ThrowCompletionOr<Value> Interpreter::run(Script& script_record, GC::Ptr<Environ
 
     GC::Ptr<Executable> executable;
     if (result.type() == Completion::Type::Normal) {
+        // OPTIMIZATION: The executable is cached on the script's program, which may be shared with other scripts of the
+        //               same source text through the code cache.
+        executable = script.bytecode_executable();
+    }
+
+    if (!executable && result.type() == Completion::Type::Normal) {
         auto executable_result = JS::Bytecode::Generator::generate_from_ast_node(vm, script, {});
 
         if (executable_result.is_error()) {
@@ -213,6 +224,7 @@ ThrowCompletionOr<Value> Interpreter::run(Script& script_record, GC::Ptr<Environ
                 result = vm.template throw_completion<JS::InternalError>(error_string.release_value());
         } else {
             executable = executable_result.release_value();
+            script.set_bytecode_executable(executable);
 
             if (g_dump_bytecode)
                 executable->dump();
@@ -334,6 +346,16 @@ NEVER_INLINE Interpreter::HandleExceptionResponse Interpreter::handle_exception(
     VERIFY_NOT_REACHED();
 }
 
+static void increment_jit_hotness(Executable& executable)
+{
+    if (executable.did_try_jit_compilation)
+        return;
+    if (++executable.jit_hotness < JIT::Compiler::hotness_threshold)
+        return;
+    executable.did_try_jit_compilation = true;
+    executable.native_executable = JIT::Compiler::compile(executable);
+}
+
 // FIXME: GCC takes a *long* time to compile with flattening, and it will time out our CI. :|
 #if defined(AK_COMPILER_CLANG)
 #    define FLATTEN_ON_CLANG FLATTEN
@@ -377,6 +399,17 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
 
     for (;;) {
     start:
+        if (auto* native_executable = executable.native_executable.ptr(); native_executable && native_executable->can_enter_at(program_counter)) {
+            auto exit = native_executable->run(*this, m_registers_and_constants_and_locals_arguments.data(), program_counter);
+            program_counter = exit.program_counter;
+            if (exit.reason == JIT::NativeExecutable::ExitReason::Exception) {
+                if (handle_exception(program_counter, reg(Register::exception())) == HandleExceptionResponse::ExitFromExecutable)
+                    return;
+                goto start;
+            }
+            // NOTE: Native code exits at instructions that it leaves to the interpreter, so we continue by dispatching it.
+        }
+
         for (;;) {
             goto* bytecode_dispatch_table[static_cast<size_t>((*reinterpret_cast<Instruction const*>(&bytecode[program_counter])).type())];
 
@@ -394,7 +427,10 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
 
         handle_Jump: {
             auto& instruction = *reinterpret_cast<Op::Jump const*>(&bytecode[program_counter]);
-            program_counter = instruction.target().address();
+            auto target = instruction.target().address();
+            if (g_jit_enabled && target <= program_counter) [[unlikely]]
+                increment_jit_hotness(executable);
+            program_counter = target;
             goto start;
         }
 
@@ -632,6 +668,7 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION(NewClass);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(NewFunction);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(NewObject);
+            HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(NewObjectWithProperties);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(NewPrimitiveArray);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(NewRegExp);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(NewTypeError);
@@ -744,6 +781,9 @@ Interpreter::ResultAndReturnRegister Interpreter::run_executable(Executable& exe
         registers_and_constants_and_locals_and_arguments[executable.number_of_registers + i] = executable.constants[i];
     }
 
+    if (g_jit_enabled) [[unlikely]]
+        increment_jit_hotness(executable);
+
     run_bytecode(entry_point.value_or(0));
 
     dbgln_if(JS_BYTECODE_DEBUG, "Bytecode::Interpreter did run unit {:p}", &executable);
@@ -815,6 +855,75 @@ void Interpreter::enter_object_environment(Object& object)
     running_execution_context().lexical_environment = new_object_environment(object, true, old_environment);
 }
 
+void Interpreter::did_create_executable(Executable& executable)
+{
+    m_executables_with_inline_cache_statistics.append(executable);
+}
+
+static StringView inline_cache_state_name(PropertyLookupCache::State state)
+{
+    switch (state) {
+    case PropertyLookupCache::State::Uninitialized:
+        return "uninitialized"sv;
+    case PropertyLookupCache::State::Monomorphic:
+        return "monomorphic"sv;
+    case PropertyLookupCache::State::Polymorphic:
+        return "polymorphic"sv;
+    case PropertyLookupCache::State::Megamorphic:
+        return "megamorphic"sv;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+void Interpreter::dump_inline_cache_statistics() const
+{
+    struct Site {
+        Executable const* executable;
+        PropertyLookupCache const* cache;
+    };
+    Vector<Site> sites_with_repeated_misses;
+    AK::Array<size_t, 4> number_of_sites_in_state {};
+
+    // NOTE: Executables that have been garbage collected in the meantime are not included.
+    for (auto const& weak_executable : m_executables_with_inline_cache_statistics) {
+        auto executable = weak_executable.ptr();
+        if (!executable)
+            continue;
+        for (auto const& cache : executable->property_lookup_caches) {
+            ++number_of_sites_in_state[to_underlying(cache.state())];
+            // Every site misses once to fill its cache, so only the ones that missed again are interesting.
+            if (cache.miss_count > 1)
+                sites_with_repeated_misses.append({ executable, &cache });
+        }
+    }
+
+    warnln("Inline caches: {} monomorphic, {} polymorphic, {} megamorphic, {} never used",
+        number_of_sites_in_state[to_underlying(PropertyLookupCache::State::Monomorphic)],
+        number_of_sites_in_state[to_underlying(PropertyLookupCache::State::Polymorphic)],
+        number_of_sites_in_state[to_underlying(PropertyLookupCache::State::Megamorphic)],
+        number_of_sites_in_state[to_underlying(PropertyLookupCache::State::Uninitialized)]);
+
+    auto const& megamorphic_cache_statistics = m_vm.megamorphic_cache().statistics();
+    warnln("Megamorphic cache: {} hits, {} misses", megamorphic_cache_statistics.hits, megamorphic_cache_statistics.misses);
+
+    quick_sort(sites_with_repeated_misses, [](auto const& a, auto const& b) {
+        return a.cache->miss_count > b.cache->miss_count;
+    });
+
+    for (auto const& site : sites_with_repeated_misses) {
+        ByteString location;
+        if (auto source_range = site.executable->source_range_at(site.cache->program_counter); source_range.source_code) {
+            auto realized_source_range = source_range.realize();
+            location = ByteString::formatted("{}:{}:{}", realized_source_range.filename(), realized_source_range.start.line, realized_source_range.start.column);
+        } else {
+            location = ByteString::formatted("offset {}", site.cache->program_counter);
+        }
+        if (!site.executable->name.is_empty())
+            location = ByteString::formatted("{} in {}", location, site.executable->name);
+        warnln("{:>13} {:>10} misses  {}", inline_cache_state_name(site.cache->state()), site.cache->miss_count, location);
+    }
+}
+
 ThrowCompletionOr<GC::Ref<Bytecode::Executable>> compile(VM& vm, ASTNode const& node, FunctionKind kind, Utf16FlyString const& name)
 {
     auto executable_result = Bytecode::Generator::generate_from_ast_node(vm, node, kind);
@@ -1214,19 +1323,28 @@ ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value this_value
             }
         }
 
-        CacheableSetPropertyMetadata cacheable_metadata;
-        bool succeeded = TRY(object->internal_set(name, value, this_value, &cacheable_metadata));
+        if (caches) {
+            ++caches->miss_count;
+            caches->program_counter = vm.running_execution_context().program_counter;
 
-        auto get_cache_slot = [&] -> PropertyLookupCache::Entry& {
-            for (size_t i = caches->entries.size() - 1; i >= 1; --i) {
-                caches->entries[i] = caches->entries[i - 1];
+            if (caches->is_megamorphic && name.is_string()) {
+                if (auto property_offset = vm.megamorphic_cache().own_property_offset_for_put(object->shape(), name.as_string()); property_offset.has_value()) {
+                    auto value_in_object = object->get_direct(*property_offset);
+                    if (value_in_object.is_accessor()) [[unlikely]] {
+                        (void)TRY(call(vm, value_in_object.as_accessor().setter(), this_value, value));
+                    } else {
+                        object->put_direct(*property_offset, value);
+                    }
+                    return {};
+                }
             }
-            caches->entries[0] = {};
-            return caches->entries[0];
-        };
+        }
+
+        CacheableSetPropertyMetadata cacheable_metadata;
+        bool succeeded = TRY(object->internal_set(name, value, this_value, &cacheable_metadata));
 
         if (succeeded && caches && cacheable_metadata.type == CacheableSetPropertyMetadata::Type::AddOwnProperty) {
-            auto& cache = get_cache_slot();
+            auto& cache = caches->make_room_for_new_entry();
             cache.type = PropertyLookupCache::Entry::Type::AddOwnProperty;
             cache.from_shape = from_shape;
             cache.property_offset = cacheable_metadata.property_offset.value();
@@ -1243,7 +1361,7 @@ ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value this_value
         // that collected metadata is valid, e.g. if setter in prototype chain added
         // property with the same name into the object itself.
         if (succeeded && caches && &from_shape == &object->shape()) {
-            auto& cache = get_cache_slot();
+            auto& cache = caches->make_room_for_new_entry();
             switch (cacheable_metadata.type) {
             case CacheableSetPropertyMetadata::Type::AddOwnProperty:
                 // Something went wrong if we ended up here, because cacheable addition of a new property should've changed the shape.
@@ -1257,6 +1375,9 @@ ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value this_value
                 if (cache.shape->is_dictionary()) {
                     cache.shape_dictionary_generation = cache.shape->dictionary_generation();
                 }
+
+                if (caches->is_megamorphic && name.is_string())
+                    vm.megamorphic_cache().remember_put(object->shape(), name.as_string(), *cache.property_offset);
                 break;
             case CacheableSetPropertyMetadata::Type::ChangePropertyInPrototypeChain:
                 cache.type = PropertyLookupCache::Entry::Type::ChangePropertyInPrototypeChain;
@@ -1378,6 +1499,7 @@ inline ThrowCompletionOr<void> put_by_value(VM& vm, Value base, Optional<Utf16Fl
                 auto existing_value = maybe_value->value;
                 if (!existing_value.is_accessor()) {
                     storage->put(index, value);
+                    object.write_barrier();
                     return {};
                 }
             }
@@ -1655,11 +1777,13 @@ inline ThrowCompletionOr<void> append(VM& vm, Value lhs, Value rhs, bool is_spre
         size_t i = lhs_size;
         TRY(get_iterator_values(vm, rhs, [&i, &lhs_array](Value iterator_value) -> Optional<Completion> {
             lhs_array.indexed_properties().put(i, iterator_value, default_attributes);
+            lhs_array.write_barrier();
             ++i;
             return {};
         }));
     } else {
         lhs_array.indexed_properties().put(lhs_size, rhs, default_attributes);
+        lhs_array.write_barrier();
     }
 
     return {};
@@ -2201,6 +2325,32 @@ void NewObject::execute_impl(Bytecode::Interpreter& interpreter) const
     interpreter.set(dst(), Object::create(realm, realm.intrinsics().object_prototype()));
 }
 
+void NewObjectWithProperties::execute_impl(Bytecode::Interpreter& interpreter) const
+{
+    auto& realm = interpreter.realm();
+    auto& cache = interpreter.current_executable().object_literal_caches[m_cache_index];
+
+    // NOTE: Executables may be shared between realms, but shapes are not.
+    if (auto shape = cache.shape; shape && &shape->realm() == &realm) {
+        auto object = Object::create_with_premade_shape(*shape);
+        for (size_t i = 0; i < m_property_count; ++i)
+            object->put_direct(i, interpreter.get(m_properties[i].value));
+        interpreter.set(dst(), object);
+        return;
+    }
+
+    auto object = Object::create(realm, realm.intrinsics().object_prototype());
+    for (size_t i = 0; i < m_property_count; ++i)
+        object->define_direct_property(interpreter.get_identifier(m_properties[i].key), interpreter.get(m_properties[i].value), default_attributes);
+
+    // NOTE: Numeric keys are stored as indexed properties, which the shape doesn't cover. Dictionary shapes are unique
+    //       to their object, and can't be shared.
+    if (object->shape().property_count() == m_property_count && !object->shape().is_dictionary())
+        cache.shape = object->shape();
+
+    interpreter.set(dst(), object);
+}
+
 void NewRegExp::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     interpreter.set(dst(),
@@ -3492,6 +3642,15 @@ ByteString NewObject::to_byte_string_impl(Bytecode::Executable const& executable
     return ByteString::formatted("NewObject {}", format_operand("dst"sv, dst(), executable));
 }
 
+ByteString NewObjectWithProperties::to_byte_string_impl(Bytecode::Executable const& executable) const
+{
+    StringBuilder builder;
+    builder.appendff("NewObjectWithProperties {}", format_operand("dst"sv, dst(), executable));
+    for (auto const& property : properties())
+        builder.appendff(", {}:{}", executable.identifier_table->get(property.key), format_operand("value"sv, property.value, executable));
+    return builder.to_byte_string();
+}
+
 ByteString NewRegExp::to_byte_string_impl(Bytecode::Executable const& executable) const
 {
     return ByteString::formatted("NewRegExp {}, source:\"{}\" flags:\"{}\"",
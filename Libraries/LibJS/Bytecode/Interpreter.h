@@ -88,6 +88,10 @@ public:
         return get_identifier(*index);
     }
 
+    // Executables are only tracked for the inline cache statistics report while g_collect_inline_cache_statistics is set.
+    void did_create_executable(Executable&);
+    void dump_inline_cache_statistics() const;
+
 private:
     void run_bytecode(size_t entry_point);
 
@@ -106,9 +110,12 @@ private:
     Span<Value> m_registers_and_constants_and_locals_arguments;
     ExecutionContext* m_running_execution_context { nullptr };
     ReadonlySpan<Utf16FlyString> m_identifier_table;
+    Vector<GC::Weak<Executable>> m_executables_with_inline_cache_statistics;
 };
 
 JS_API extern bool g_dump_bytecode;
+JS_API extern bool g_jit_enabled;
+JS_API extern bool g_collect_inline_cache_statistics;
 
 ThrowCompletionOr<GC::Ref<Bytecode::Executable>> compile(VM&, ASTNode const&, JS::FunctionKind kind, Utf16FlyString const& name);
 ThrowCompletionOr<GC::Ref<Bytecode::Executable>> compile(VM&, ECMAScriptFunctionObject const&);
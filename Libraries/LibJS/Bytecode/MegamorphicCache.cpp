@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashFunctions.h>
+#include <LibJS/Bytecode/MegamorphicCache.h>
+#include <LibJS/Runtime/Object.h>
+#include <LibJS/Runtime/Shape.h>
+
+namespace JS::Bytecode {
+
+static_assert(is_power_of_two(MegamorphicCache::number_of_entries));
+
+size_t MegamorphicCache::index_for(Shape const& shape, Utf16FlyString const& property_name)
+{
+    return pair_int_hash(ptr_hash(&shape), property_name.hash()) & (number_of_entries - 1);
+}
+
+Optional<Value> MegamorphicCache::get(Object const& object, Utf16FlyString const& property_name)
+{
+    auto& shape = object.shape();
+    auto& entry = m_get_entries[index_for(shape, property_name)];
+
+    if (entry.shape != &shape || entry.property_name != property_name) {
+        ++m_statistics.misses;
+        return {};
+    }
+
+    if (entry.is_in_prototype_chain) {
+        auto prototype = entry.prototype.ptr();
+        auto prototype_chain_validity = entry.prototype_chain_validity.ptr();
+        if (!prototype || !prototype_chain_validity || !prototype_chain_validity->is_valid()) {
+            ++m_statistics.misses;
+            return {};
+        }
+        ++m_statistics.hits;
+        return prototype->get_direct(entry.property_offset);
+    }
+
+    ++m_statistics.hits;
+    return object.get_direct(entry.property_offset);
+}
+
+void MegamorphicCache::remember_get(Shape& shape, Utf16FlyString const& property_name, u32 property_offset, Object const* prototype, PrototypeChainValidity const* prototype_chain_validity)
+{
+    if (shape.is_dictionary())
+        return;
+
+    auto& entry = m_get_entries[index_for(shape, property_name)];
+    entry.shape = shape;
+    entry.property_name = property_name;
+    entry.property_offset = property_offset;
+    entry.is_in_prototype_chain = prototype != nullptr;
+    entry.prototype = prototype;
+    entry.prototype_chain_validity = prototype_chain_validity;
+}
+
+Optional<u32> MegamorphicCache::own_property_offset_for_put(Shape const& shape, Utf16FlyString const& property_name)
+{
+    auto& entry = m_put_entries[index_for(shape, property_name)];
+
+    if (entry.shape != &shape || entry.property_name != property_name) {
+        ++m_statistics.misses;
+        return {};
+    }
+
+    ++m_statistics.hits;
+    return entry.property_offset;
+}
+
+void MegamorphicCache::remember_put(Shape& shape, Utf16FlyString const& property_name, u32 property_offset)
+{
+    if (shape.is_dictionary())
+        return;
+
+    auto& entry = m_put_entries[index_for(shape, property_name)];
+    entry.shape = shape;
+    entry.property_name = property_name;
+    entry.property_offset = property_offset;
+}
+
+void MegamorphicCache::clear()
+{
+    m_get_entries.fill({});
+    m_put_entries.fill({});
+}
+
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/Optional.h>
+#include <AK/Utf16FlyString.h>
+#include <LibGC/Weak.h>
+#include <LibJS/Export.h>
+#include <LibJS/Forward.h>
+#include <LibJS/Runtime/Value.h>
+
+namespace JS::Bytecode {
+
+// Property access sites that have seen more shapes than their PropertyLookupCache can remember (e.g. generic helpers
+// that are called with many kinds of objects) are megamorphic. Such sites consult this cache, which is shared by all
+// of them, before falling back to a full property lookup.
+//
+// The cache maps a (shape, property name) pair to the location of the property. It is direct-mapped, so each pair can
+// only ever be in one entry, and a colliding pair simply replaces it. Only string-keyed properties of objects that do
+// not have a dictionary shape are cached.
+class JS_API MegamorphicCache {
+public:
+    static constexpr size_t number_of_entries = 4096;
+
+    struct Statistics {
+        u64 hits { 0 };
+        u64 misses { 0 };
+    };
+
+    // Returns the value of the property (which may be an accessor) if its location is cached.
+    Optional<Value> get(Object const&, Utf16FlyString const& property_name);
+    void remember_get(Shape&, Utf16FlyString const& property_name, u32 property_offset, Object const* prototype, PrototypeChainValidity const*);
+
+    // Returns the offset of the property in the object's storage if it's a cached, writable own property.
+    Optional<u32> own_property_offset_for_put(Shape const&, Utf16FlyString const& property_name);
+    void remember_put(Shape&, Utf16FlyString const& property_name, u32 property_offset);
+
+    void clear();
+
+    Statistics const& statistics() const { return m_statistics; }
+
+private:
+    struct Entry {
+        GC::Weak<Shape> shape;
+        Utf16FlyString property_name;
+        u32 property_offset { 0 };
+
+        // Set for properties that were found in the prototype chain rather than on the object itself.
+        bool is_in_prototype_chain { false };
+        GC::Weak<Object> prototype;
+        GC::Weak<PrototypeChainValidity> prototype_chain_validity;
+    };
+
+    static size_t index_for(Shape const&, Utf16FlyString const& property_name);
+
+    AK::Array<Entry, number_of_entries> m_get_entries;
+    AK::Array<Entry, number_of_entries> m_put_entries;
+    Statistics m_statistics;
+};
+
+}
@@ -225,6 +225,53 @@ private:
     Operand m_dst;
 };
 
+// Creates an object with the given data properties, in one step. The shape of the first object created by each
+// instruction is cached, and later objects are created with that shape and all of their property storage directly.
+class NewObjectWithProperties final : public Instruction {
+public:
+    static constexpr bool IsVariableLength = true;
+
+    struct Property {
+        IdentifierTableIndex key;
+        Operand value;
+    };
+
+    NewObjectWithProperties(Operand dst, u32 cache_index, ReadonlySpan<Property> properties)
+        : Instruction(Type::NewObjectWithProperties)
+        , m_dst(dst)
+        , m_cache_index(cache_index)
+        , m_property_count(properties.size())
+    {
+        for (size_t i = 0; i < m_property_count; ++i)
+            m_properties[i] = properties[i];
+    }
+
+    void execute_impl(Bytecode::Interpreter&) const;
+    ByteString to_byte_string_impl(Bytecode::Executable const&) const;
+    void visit_operands_impl(Function<void(Operand&)> visitor)
+    {
+        visitor(m_dst);
+        for (size_t i = 0; i < m_property_count; ++i)
+            visitor(m_properties[i].value);
+    }
+
+    size_t length() const { return length_impl(); }
+    size_t length_impl() const
+    {
+        return round_up_to_power_of_two(sizeof(*this) + sizeof(Property) * m_property_count, alignof(void*));
+    }
+
+    Operand dst() const { return m_dst; }
+    u32 cache_index() const { return m_cache_index; }
+    ReadonlySpan<Property> properties() const { return { m_properties, m_property_count }; }
+
+private:
+    Operand m_dst;
+    u32 m_cache_index { 0 };
+    u32 m_property_count { 0 };
+    Property m_properties[];
+};
+
 class NewRegExp final : public Instruction {
 public:
     NewRegExp(Operand dst, StringTableIndex source_index, StringTableIndex flags_index, RegexTableIndex regex_index)
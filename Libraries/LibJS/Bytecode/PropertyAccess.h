@@ -8,6 +8,7 @@
 
 #include <LibJS/Bytecode/Executable.h>
 #include <LibJS/Bytecode/IdentifierTable.h>
+#include <LibJS/Bytecode/MegamorphicCache.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Accessor.h>
 #include <LibJS/Runtime/Completion.h>
@@ -67,6 +68,19 @@ ALWAYS_INLINE ThrowCompletionOr<GC::Ref<Object>> base_object_for_get(VM& vm, Val
     return throw_null_or_undefined_property_get(vm, base_value, get_base_identifier, get_property_name);
 }
 
+// The megamorphic cache only knows about properties with string names.
+ALWAYS_INLINE Optional<Utf16FlyString const&> megamorphic_cache_property_name(Utf16FlyString const& name)
+{
+    return name;
+}
+
+ALWAYS_INLINE Optional<Utf16FlyString const&> megamorphic_cache_property_name(PropertyKey const& key)
+{
+    if (!key.is_string())
+        return {};
+    return key.as_string();
+}
+
 template<GetByIdMode mode, typename GetBaseIdentifier, typename GetPropertyName>
 ALWAYS_INLINE ThrowCompletionOr<Value> get_by_id(VM& vm, GetBaseIdentifier get_base_identifier, GetPropertyName get_property_name, Value base_value, Value this_value, PropertyLookupCache& cache)
 {
@@ -139,6 +153,20 @@ ALWAYS_INLINE ThrowCompletionOr<Value> get_by_id(VM& vm, GetBaseIdentifier get_b
         }
     }
 
+    ++cache.miss_count;
+    cache.program_counter = vm.running_execution_context().program_counter;
+
+    if (cache.is_megamorphic) {
+        auto const& property_name = get_property_name();
+        if (auto name = megamorphic_cache_property_name(property_name); name.has_value()) {
+            if (auto value = vm.megamorphic_cache().get(base_obj, *name); value.has_value()) {
+                if (value->is_accessor())
+                    return TRY(call(vm, value->as_accessor().getter(), this_value));
+                return *value;
+            }
+        }
+    }
+
     CacheableGetPropertyMetadata cacheable_metadata;
     auto value = TRY(base_obj->internal_get(get_property_name(), this_value, &cacheable_metadata));
 
@@ -146,23 +174,24 @@ ALWAYS_INLINE ThrowCompletionOr<Value> get_by_id(VM& vm, GetBaseIdentifier get_b
     // that collected metadata is valid, e.g. if getter in prototype chain added
     // property with the same name into the object itself.
     if (&shape == &base_obj->shape()) {
-        auto get_cache_slot = [&] -> PropertyLookupCache::Entry& {
-            for (size_t i = cache.entries.size() - 1; i >= 1; --i) {
-                cache.entries[i] = cache.entries[i - 1];
-            }
-            cache.entries[0] = {};
-            return cache.entries[0];
-        };
         if (cacheable_metadata.type == CacheableGetPropertyMetadata::Type::GetOwnProperty) {
-            auto& entry = get_cache_slot();
+            auto& entry = cache.make_room_for_new_entry();
+            entry.type = PropertyLookupCache::Entry::Type::GetOwnProperty;
             entry.shape = shape;
             entry.property_offset = cacheable_metadata.property_offset.value();
 
             if (shape.is_dictionary()) {
                 entry.shape_dictionary_generation = shape.dictionary_generation();
             }
+
+            if (cache.is_megamorphic) {
+                auto const& property_name = get_property_name();
+                if (auto name = megamorphic_cache_property_name(property_name); name.has_value())
+                    vm.megamorphic_cache().remember_get(shape, *name, *entry.property_offset, nullptr, nullptr);
+            }
         } else if (cacheable_metadata.type == CacheableGetPropertyMetadata::Type::GetPropertyInPrototypeChain) {
-            auto& entry = get_cache_slot();
+            auto& entry = cache.make_room_for_new_entry();
+            entry.type = PropertyLookupCache::Entry::Type::GetPropertyInPrototypeChain;
             entry.shape = &base_obj->shape();
             entry.property_offset = cacheable_metadata.property_offset.value();
             entry.prototype = *cacheable_metadata.prototype;
@@ -171,6 +200,12 @@ ALWAYS_INLINE ThrowCompletionOr<Value> get_by_id(VM& vm, GetBaseIdentifier get_b
             if (shape.is_dictionary()) {
                 entry.shape_dictionary_generation = shape.dictionary_generation();
             }
+
+            if (cache.is_megamorphic) {
+                auto const& property_name = get_property_name();
+                if (auto name = megamorphic_cache_property_name(property_name); name.has_value())
+                    vm.megamorphic_cache().remember_get(shape, *name, *entry.property_offset, cacheable_metadata.prototype.ptr(), prototype_chain_validity.ptr());
+            }
         }
     }
 
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashFunctions.h>
+#include <LibJS/CodeCache.h>
+
+namespace JS {
+
+static u32 cache_key(StringView source_text, StringView filename, Program::Type type, size_t line_number_offset)
+{
+    auto key = pair_int_hash(source_text.hash(), filename.hash());
+    key = pair_int_hash(key, to_underlying(type));
+    return pair_int_hash(key, static_cast<u32>(line_number_offset));
+}
+
+CodeCache::CodeCache(size_t maximum_size)
+    : m_maximum_size(maximum_size)
+{
+}
+
+bool CodeCache::is_cacheable(StringView source_text) const
+{
+    return source_text.length() >= MINIMUM_SOURCE_LENGTH && estimated_size_of(source_text.length()) <= m_maximum_size;
+}
+
+RefPtr<Program> CodeCache::find(StringView source_text, StringView filename, Program::Type type, size_t line_number_offset)
+{
+    if (!is_cacheable(source_text))
+        return {};
+
+    auto key = cache_key(source_text, filename, type, line_number_offset);
+
+    auto entry = m_entries.take(key);
+    if (!entry.has_value()
+        || entry->type != type
+        || entry->line_number_offset != line_number_offset
+        || entry->filename != filename
+        || entry->source_text != source_text) {
+        // NOTE: On a hash collision, the colliding entry is dropped rather than re-inserted, as it is about to be
+        //       replaced by the program for this source anyways.
+        if (entry.has_value())
+            m_size -= entry->size;
+
+        ++m_statistics.misses;
+        return {};
+    }
+
+    ++m_statistics.hits;
+
+    // Re-insert the entry to mark it as the most recently used entry.
+    auto program = entry->program;
+    m_entries.set(key, entry.release_value());
+    return program;
+}
+
+void CodeCache::add(StringView source_text, StringView filename, Program::Type type, size_t line_number_offset, NonnullRefPtr<Program> program)
+{
+    if (!is_cacheable(source_text))
+        return;
+
+    auto key = cache_key(source_text, filename, type, line_number_offset);
+
+    if (auto entry = m_entries.take(key); entry.has_value())
+        m_size -= entry->size;
+
+    auto size = estimated_size_of(source_text.length());
+    m_entries.set(key, Entry { source_text, filename, type, line_number_offset, move(program), size });
+    m_size += size;
+
+    evict_entries_if_needed();
+}
+
+void CodeCache::clear()
+{
+    m_entries.clear();
+    m_size = 0;
+}
+
+void CodeCache::evict_entries_if_needed()
+{
+    while (m_size > m_maximum_size && !m_entries.is_empty()) {
+        auto entry = m_entries.take_first();
+        m_size -= entry.size;
+        ++m_statistics.evicted_programs;
+    }
+}
+
+}
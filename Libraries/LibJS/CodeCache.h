@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/RefPtr.h>
+#include <AK/StringView.h>
+#include <AK/Types.h>
+#include <LibJS/AST.h>
+#include <LibJS/Export.h>
+
+namespace JS {
+
+// The code cache holds on to the parsed programs of recently evaluated scripts and modules, keyed by their source text.
+// When the same source is evaluated again (e.g. when a page is reloaded, or when another document loads the same
+// script), the program is reused instead of being parsed again. Since the bytecode executables of a program and its
+// functions are cached on their AST nodes, a cache hit skips both parsing and bytecode generation.
+//
+// Only sources of at least MINIMUM_SOURCE_LENGTH bytes are cached, as small scripts are cheaper to parse than to look
+// up. The least recently used programs are evicted once the estimated memory retained by the cache exceeds the budget.
+//
+// Most of that memory is not the source text itself, but the AST and the bytecode executables hanging off of it, which
+// take up many times the size of the source. Since executables are generated lazily, as functions are first called,
+// their final size isn't known when a program is added. Instead, each entry is charged a fixed multiple of its source
+// length, a rough estimate of what a fully compiled program retains.
+class JS_API CodeCache {
+public:
+    static constexpr size_t DEFAULT_MAXIMUM_SIZE = 64 * MiB;
+    static constexpr size_t MINIMUM_SOURCE_LENGTH = 1 * KiB;
+    static constexpr size_t RETAINED_BYTES_PER_SOURCE_BYTE = 20;
+
+    static constexpr size_t estimated_size_of(size_t source_length) { return source_length * RETAINED_BYTES_PER_SOURCE_BYTE; }
+
+    struct Statistics {
+        u64 hits { 0 };
+        u64 misses { 0 };
+        u64 evicted_programs { 0 };
+    };
+
+    explicit CodeCache(size_t maximum_size = DEFAULT_MAXIMUM_SIZE);
+
+    RefPtr<Program> find(StringView source_text, StringView filename, Program::Type, size_t line_number_offset);
+    void add(StringView source_text, StringView filename, Program::Type, size_t line_number_offset, NonnullRefPtr<Program>);
+    void clear();
+
+    size_t size() const { return m_size; }
+    size_t maximum_size() const { return m_maximum_size; }
+    Statistics const& statistics() const { return m_statistics; }
+
+private:
+    struct Entry {
+        ByteString source_text;
+        ByteString filename;
+        Program::Type type { Program::Type::Script };
+        size_t line_number_offset { 0 };
+        NonnullRefPtr<Program> program;
+        size_t size { 0 };
+    };
+
+    bool is_cacheable(StringView source_text) const;
+    void evict_entries_if_needed();
+
+    // Entries are ordered from least to most recently used.
+    OrderedHashMap<u32, Entry> m_entries;
+
+    size_t m_size { 0 };
+    size_t m_maximum_size { DEFAULT_MAXIMUM_SIZE };
+    Statistics m_statistics;
+};
+
+}
@@ -163,6 +163,7 @@ struct CachedSourceRange;
 class Cell;
 class ClassExpression;
 struct ClassFieldDefinition;
+class CodeCache;
 class Completion;
 class Console;
 class CyclicModule;
@@ -326,6 +327,7 @@ class Executable;
 class Generator;
 class Instruction;
 class Interpreter;
+class MegamorphicCache;
 class Operand;
 struct PropertyLookupCache;
 class RegexTable;
@@ -333,4 +335,10 @@ class Register;
 
 }
 
+namespace JIT {
+
+class NativeExecutable;
+
+}
+
 }
@@ -0,0 +1,610 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Debug.h>
+#include <AK/Function.h>
+#include <AK/HashTable.h>
+#include <LibJS/Bytecode/Instruction.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/JIT/Compiler.h>
+#include <LibJS/JIT/NativeExecutable.h>
+
+#ifdef JIT_ARCH_SUPPORTED
+#    include <LibJIT/Assembler.h>
+#    include <LibJS/Runtime/Object.h>
+#    include <LibJS/Runtime/Shape.h>
+#    include <LibJS/Runtime/ValueInlines.h>
+#endif
+
+namespace JS::JIT {
+
+#ifdef JIT_ARCH_SUPPORTED
+
+using Assembler = ::JIT::Assembler;
+using Reg = Assembler::Reg;
+using Condition = Assembler::Condition;
+
+// These registers are callee-saved, and hold the same value for as long as we're in native code.
+static constexpr auto REGISTER_FILE = Reg::RBX;
+static constexpr auto INTERPRETER = Reg::R12;
+
+static Value& operand_value(Bytecode::Interpreter& interpreter, Bytecode::Operand operand)
+{
+    return interpreter.running_execution_context().registers_and_constants_and_locals_and_arguments_span()[operand.index()];
+}
+
+// Slow paths called from native code return 0 on success. On failure, they store the exception in the exception register
+// and return 1.
+template<typename OpType>
+static u64 cxx_execute(Bytecode::Interpreter& interpreter, OpType const& instruction, size_t program_counter)
+{
+    interpreter.running_execution_context().program_counter = program_counter;
+
+    if constexpr (IsSame<decltype(instruction.execute_impl(interpreter)), void>) {
+        instruction.execute_impl(interpreter);
+    } else {
+        auto result = instruction.execute_impl(interpreter);
+        if (result.is_error()) [[unlikely]] {
+            interpreter.reg(Bytecode::Register::exception()) = result.error_value();
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Lets the inline fast path handle every shape that the interpreter's cache remembers for a data property on the object
+// itself, whether the cache is monomorphic or polymorphic.
+static void refresh_property_access_cache(PropertyAccessCache& cache, Bytecode::PropertyLookupCache const& lookup_cache, Bytecode::PropertyLookupCache::Entry::Type own_property_type)
+{
+    for (size_t i = 0; i < lookup_cache.entries.size(); ++i) {
+        auto const& entry = lookup_cache.entries[i];
+        if (entry.type == own_property_type && entry.shape && !entry.shape->is_dictionary())
+            cache.entries[i] = { entry.shape.ptr(), entry.property_offset.value() };
+        else
+            cache.entries[i] = {};
+    }
+}
+
+static u64 cxx_get_by_id(Bytecode::Interpreter& interpreter, Bytecode::Op::GetById const& instruction, size_t program_counter, PropertyAccessCache& cache)
+{
+    if (auto result = cxx_execute(interpreter, instruction, program_counter); result != 0)
+        return result;
+
+    refresh_property_access_cache(cache, interpreter.current_executable().property_lookup_caches[instruction.cache_index()], Bytecode::PropertyLookupCache::Entry::Type::GetOwnProperty);
+    return 0;
+}
+
+static u64 cxx_put_by_id(Bytecode::Interpreter& interpreter, Bytecode::Op::PutNormalById const& instruction, size_t program_counter, PropertyAccessCache& cache)
+{
+    if (auto result = cxx_execute(interpreter, instruction, program_counter); result != 0)
+        return result;
+
+    refresh_property_access_cache(cache, interpreter.current_executable().property_lookup_caches[instruction.cache_index()], Bytecode::PropertyLookupCache::Entry::Type::ChangeOwnProperty);
+    return 0;
+}
+
+static u64 cxx_to_boolean(Value const* registers, u64 index)
+{
+    return registers[index].to_boolean();
+}
+
+static ThrowCompletionOr<bool> loosely_equals(VM& vm, Value lhs, Value rhs) { return is_loosely_equal(vm, lhs, rhs); }
+static ThrowCompletionOr<bool> loosely_inequals(VM& vm, Value lhs, Value rhs) { return !TRY(is_loosely_equal(vm, lhs, rhs)); }
+static ThrowCompletionOr<bool> strict_equals(VM&, Value lhs, Value rhs) { return is_strictly_equal(lhs, rhs); }
+static ThrowCompletionOr<bool> strict_inequals(VM&, Value lhs, Value rhs) { return !is_strictly_equal(lhs, rhs); }
+
+// The slow paths of conditional jumps return 0 or 1 for the outcome of the comparison, and 2 if an exception was thrown.
+#    define DEFINE_COMPARISON_SLOW_PATH(op_TitleCase, op_snake_case, numeric_operator)                                                                  \
+        static u64 cxx_jump_##op_snake_case(Bytecode::Interpreter& interpreter, Bytecode::Op::Jump##op_TitleCase const& instruction, size_t program_counter) \
+        {                                                                                                                                                 \
+            interpreter.running_execution_context().program_counter = program_counter;                                                                   \
+            auto result = op_snake_case(interpreter.vm(), operand_value(interpreter, instruction.lhs()), operand_value(interpreter, instruction.rhs()));   \
+            if (result.is_error()) [[unlikely]] {                                                                                                         \
+                interpreter.reg(Bytecode::Register::exception()) = result.error_value();                                                                  \
+                return 2;                                                                                                                                 \
+            }                                                                                                                                             \
+            return result.value() ? 1 : 0;                                                                                                                \
+        }
+JS_ENUMERATE_COMPARISON_OPS(DEFINE_COMPARISON_SLOW_PATH)
+#    undef DEFINE_COMPARISON_SLOW_PATH
+
+template<typename Function>
+static u64 function_address(Function function)
+{
+    return bit_cast<FlatPtr>(function);
+}
+
+class CodeGenerator {
+public:
+    CodeGenerator(Bytecode::Executable& executable, Vector<PropertyAccessCache>& property_access_caches)
+        : m_executable(executable)
+        , m_property_access_caches(property_access_caches)
+        , m_assembler(m_output)
+    {
+    }
+
+    void generate();
+
+    ReadonlyBytes code() const { return m_output; }
+    HashMap<size_t, size_t> take_block_offsets() { return move(m_block_offsets); }
+    size_t entry_trampoline_offset() const { return m_entry_trampoline_offset; }
+
+    template<typename OpType>
+    void compile_instruction(OpType const& instruction)
+    {
+        call_slow_path(function_address(&cxx_execute<OpType>), instruction);
+        exit_if_slow_path_threw();
+    }
+
+    void compile_instruction(Bytecode::Op::Mov const&);
+    void compile_instruction(Bytecode::Op::Jump const&);
+    void compile_instruction(Bytecode::Op::JumpIf const&);
+    void compile_instruction(Bytecode::Op::JumpTrue const&);
+    void compile_instruction(Bytecode::Op::JumpFalse const&);
+    void compile_instruction(Bytecode::Op::JumpNullish const&);
+    void compile_instruction(Bytecode::Op::JumpUndefined const&);
+    void compile_instruction(Bytecode::Op::Add const&);
+    void compile_instruction(Bytecode::Op::Sub const&);
+    void compile_instruction(Bytecode::Op::Increment const&);
+    void compile_instruction(Bytecode::Op::Decrement const&);
+    void compile_instruction(Bytecode::Op::GetById const&);
+    void compile_instruction(Bytecode::Op::PutNormalById const&);
+
+#    define DECLARE_COMPILE_COMPARISON_JUMP(op_TitleCase, op_snake_case, numeric_operator) \
+        void compile_instruction(Bytecode::Op::Jump##op_TitleCase const&);
+    JS_ENUMERATE_COMPARISON_OPS(DECLARE_COMPILE_COMPARISON_JUMP)
+#    undef DECLARE_COMPILE_COMPARISON_JUMP
+
+    // These change the interpreter's own control flow, so they are always left to the interpreter.
+    void compile_instruction(Bytecode::Op::End const&) { exit_to_interpreter(); }
+    void compile_instruction(Bytecode::Op::Return const&) { exit_to_interpreter(); }
+    void compile_instruction(Bytecode::Op::Await const&) { exit_to_interpreter(); }
+    void compile_instruction(Bytecode::Op::Yield const&) { exit_to_interpreter(); }
+    void compile_instruction(Bytecode::Op::EnterUnwindContext const&) { exit_to_interpreter(); }
+    void compile_instruction(Bytecode::Op::ContinuePendingUnwind const&) { exit_to_interpreter(); }
+    void compile_instruction(Bytecode::Op::ScheduleJump const&) { exit_to_interpreter(); }
+
+private:
+    static i32 operand_offset(Bytecode::Operand operand) { return static_cast<i32>(operand.index() * sizeof(Value)); }
+
+    void load_operand(Reg dst, Bytecode::Operand operand) { m_assembler.load64(dst, REGISTER_FILE, operand_offset(operand)); }
+    void store_operand(Bytecode::Operand operand, Reg src) { m_assembler.store64(REGISTER_FILE, operand_offset(operand), src); }
+
+    // Jumps to `label` unless the tag of the Value in `value` is `tag`. Clobbers `scratch`.
+    void branch_if_tag_is_not(Reg value, u64 tag, Reg scratch, Assembler::Label& label)
+    {
+        m_assembler.mov64(scratch, value);
+        m_assembler.shift_right64(scratch, GC::TAG_SHIFT);
+        m_assembler.compare32(scratch, static_cast<i32>(tag));
+        m_assembler.jump_if(Condition::NotEqualTo, label);
+    }
+
+    // Sign-extends the low 48 bits of `reg`, which turns the payload of a cell Value into a pointer.
+    void extract_pointer(Reg reg)
+    {
+        m_assembler.shift_left64(reg, 16);
+        m_assembler.arithmetic_shift_right64(reg, 16);
+    }
+
+    void box_int32(Reg reg, Reg scratch)
+    {
+        // NOTE: 32-bit operations clear the upper half of the register, so only the tag needs to be added.
+        m_assembler.mov64(scratch, SHIFTED_INT32_TAG);
+        m_assembler.or64(reg, scratch);
+    }
+
+    void jump_to_block(Bytecode::Label const& label)
+    {
+        m_block_jumps.append({ m_assembler.jump_to_be_patched(), label.address() });
+    }
+
+    void jump_to_block_if(Condition condition, Bytecode::Label const& label)
+    {
+        m_block_jumps.append({ m_assembler.jump_if_to_be_patched(condition), label.address() });
+    }
+
+    void exit(NativeExecutable::ExitReason reason)
+    {
+        m_assembler.mov64(Reg::RAX, NativeExecutable::encode_exit(reason, m_program_counter));
+        m_assembler.jump(m_exit_label);
+    }
+
+    void exit_to_interpreter() { exit(NativeExecutable::ExitReason::Interpret); }
+
+    template<typename OpType>
+    void call_slow_path(u64 function, OpType const& instruction, PropertyAccessCache* cache = nullptr)
+    {
+        m_assembler.mov64(Reg::RDI, INTERPRETER);
+        m_assembler.mov64(Reg::RSI, bit_cast<FlatPtr>(&instruction));
+        m_assembler.mov64(Reg::RDX, m_program_counter);
+        if (cache)
+            m_assembler.mov64(Reg::RCX, bit_cast<FlatPtr>(cache));
+        m_assembler.mov64(Reg::RAX, function);
+        m_assembler.call(Reg::RAX);
+    }
+
+    void exit_if_slow_path_threw()
+    {
+        auto did_not_throw = m_assembler.make_label();
+        m_assembler.test32(Reg::RAX, Reg::RAX);
+        m_assembler.jump_if(Condition::EqualTo, did_not_throw);
+        exit(NativeExecutable::ExitReason::Exception);
+        did_not_throw.link(m_assembler);
+    }
+
+    // Loads the property offset that `cache` remembers for the shape of the object in `object` into `dst`, trying the
+    // cached shapes in order. Jumps to `slow_case` if none of them matches. Clobbers RDX.
+    void load_cached_property_offset(Reg dst, Reg object, PropertyAccessCache& cache, Assembler::Label& slow_case)
+    {
+        auto found = m_assembler.make_label();
+        m_assembler.mov64(Reg::RDX, bit_cast<FlatPtr>(&cache));
+        for (size_t i = 0; i < cache.entries.size(); ++i) {
+            auto entry_offset = offsetof(PropertyAccessCache, entries) + i * sizeof(PropertyAccessCache::Entry);
+            auto next_entry = m_assembler.make_label();
+
+            // NOTE: Empty entries have no shape, so they never match.
+            m_assembler.load64(dst, Reg::RDX, static_cast<i32>(entry_offset + offsetof(PropertyAccessCache::Entry, shape)));
+            m_assembler.compare64_with_memory(dst, object, static_cast<i32>(Object::offset_of_shape()));
+            m_assembler.jump_if(Condition::NotEqualTo, next_entry);
+            m_assembler.load64(dst, Reg::RDX, static_cast<i32>(entry_offset + offsetof(PropertyAccessCache::Entry, property_offset)));
+            m_assembler.jump(found);
+
+            next_entry.link(m_assembler);
+        }
+        m_assembler.jump(slow_case);
+        found.link(m_assembler);
+    }
+
+    template<typename OpType>
+    void compile_int32_binary_operation(OpType const&, Function<void(Reg, Reg)> const& emit_operation);
+    template<typename OpType>
+    void compile_int32_unary_operation(OpType const&, Function<void(Reg)> const& emit_operation);
+    template<typename OpType>
+    void compile_comparison_jump(OpType const&, Condition, u64 slow_path);
+    void compile_to_boolean(Bytecode::Operand condition);
+
+    Bytecode::Executable& m_executable;
+    Vector<PropertyAccessCache>& m_property_access_caches;
+    Vector<u8> m_output;
+    Assembler m_assembler;
+    Assembler::Label m_exit_label;
+
+    size_t m_program_counter { 0 };
+    size_t m_entry_trampoline_offset { 0 };
+
+    // Bytecode offsets of the basic blocks that the interpreter may enter native code at.
+    HashMap<size_t, size_t> m_block_offsets;
+
+    // Native offsets of every instruction, used to resolve jumps between blocks once all code has been generated.
+    HashMap<size_t, size_t> m_instruction_offsets;
+
+    struct BlockJump {
+        size_t jump_slot_offset;
+        size_t target_program_counter;
+    };
+    Vector<BlockJump> m_block_jumps;
+};
+
+void CodeGenerator::generate()
+{
+    // The entry trampoline sets up a frame, loads the registers that we keep around, and jumps to the requested block.
+    m_entry_trampoline_offset = m_assembler.current_offset();
+    m_assembler.push(Reg::RBP);
+    m_assembler.mov64(Reg::RBP, Reg::RSP);
+    m_assembler.push(REGISTER_FILE);
+    m_assembler.push(INTERPRETER);
+    m_assembler.mov64(REGISTER_FILE, Reg::RDI);
+    m_assembler.mov64(INTERPRETER, Reg::RSI);
+    m_assembler.jump(Reg::RDX);
+
+    // All exits go through here, with the encoded exit state in RAX.
+    m_exit_label.link(m_assembler);
+    m_assembler.pop(INTERPRETER);
+    m_assembler.pop(REGISTER_FILE);
+    m_assembler.pop(Reg::RBP);
+    m_assembler.ret();
+
+    HashTable<size_t> block_start_offsets;
+    for (auto offset : m_executable.basic_block_start_offsets)
+        block_start_offsets.set(offset);
+
+    for (Bytecode::InstructionStreamIterator it { m_executable.bytecode }; !it.at_end(); ++it) {
+        m_program_counter = it.offset();
+        m_instruction_offsets.set(m_program_counter, m_assembler.current_offset());
+        if (block_start_offsets.contains(m_program_counter))
+            m_block_offsets.set(m_program_counter, m_assembler.current_offset());
+
+        auto const& instruction = *it;
+        switch (instruction.type()) {
+#    define CASE_BYTECODE_OP(OpTitleCase)                                                     \
+    case Bytecode::Instruction::Type::OpTitleCase:                                            \
+        compile_instruction(static_cast<Bytecode::Op::OpTitleCase const&>(instruction)); \
+        break;
+            ENUMERATE_BYTECODE_OPS(CASE_BYTECODE_OP)
+#    undef CASE_BYTECODE_OP
+        default:
+            VERIFY_NOT_REACHED();
+        }
+    }
+
+    for (auto const& jump : m_block_jumps)
+        m_assembler.patch_jump_slot(jump.jump_slot_offset, m_instruction_offsets.get(jump.target_program_counter).value());
+}
+
+void CodeGenerator::compile_instruction(Bytecode::Op::Mov const& instruction)
+{
+    load_operand(Reg::RAX, instruction.src());
+    store_operand(instruction.dst(), Reg::RAX);
+}
+
+void CodeGenerator::compile_instruction(Bytecode::Op::Jump const& instruction)
+{
+    jump_to_block(instruction.target());
+}
+
+// Sets the zero flag if the Value in the operand is falsy.
+void CodeGenerator::compile_to_boolean(Bytecode::Operand condition)
+{
+    auto slow_case = m_assembler.make_label();
+    auto fast_case = m_assembler.make_label();
+    auto done = m_assembler.make_label();
+
+    // OPTIMIZATION: Booleans and int32s are falsy exactly when their low 32 bits are zero.
+    load_operand(Reg::RAX, condition);
+    m_assembler.mov64(Reg::RCX, Reg::RAX);
+    m_assembler.shift_right64(Reg::RCX, GC::TAG_SHIFT);
+    m_assembler.compare32(Reg::RCX, static_cast<i32>(BOOLEAN_TAG));
+    m_assembler.jump_if(Condition::EqualTo, fast_case);
+    m_assembler.compare32(Reg::RCX, static_cast<i32>(INT32_TAG));
+    m_assembler.jump_if(Condition::NotEqualTo, slow_case);
+
+    fast_case.link(m_assembler);
+    m_assembler.test32(Reg::RAX, Reg::RAX);
+    m_assembler.jump(done);
+
+    slow_case.link(m_assembler);
+    m_assembler.mov64(Reg::RDI, REGISTER_FILE);
+    m_assembler.mov64(Reg::RSI, condition.index());
+    m_assembler.mov64(Reg::RAX, function_address(&cxx_to_boolean));
+    m_assembler.call(Reg::RAX);
+    m_assembler.test32(Reg::RAX, Reg::RAX);
+
+    done.link(m_assembler);
+}
+
+void CodeGenerator::compile_instruction(Bytecode::Op::JumpIf const& instruction)
+{
+    compile_to_boolean(instruction.condition());
+    jump_to_block_if(Condition::NotEqualTo, instruction.true_target());
+    jump_to_block(instruction.false_target());
+}
+
+void CodeGenerator::compile_instruction(Bytecode::Op::JumpTrue const& instruction)
+{
+    compile_to_boolean(instruction.condition());
+    jump_to_block_if(Condition::NotEqualTo, instruction.target());
+}
+
+void CodeGenerator::compile_instruction(Bytecode::Op::JumpFalse const& instruction)
+{
+    compile_to_boolean(instruction.condition());
+    jump_to_block_if(Condition::EqualTo, instruction.target());
+}
+
+void CodeGenerator::compile_instruction(Bytecode::Op::JumpNullish const& instruction)
+{
+    load_operand(Reg::RAX, instruction.condition());
+    m_assembler.shift_right64(Reg::RAX, GC::TAG_SHIFT);
+    m_assembler.and32(Reg::RAX, static_cast<i32>(IS_NULLISH_EXTRACT_PATTERN));
+    m_assembler.compare32(Reg::RAX, static_cast<i32>(IS_NULLISH_PATTERN));
+    jump_to_block_if(Condition::EqualTo, instruction.true_target());
+    jump_to_block(instruction.false_target());
+}
+
+void CodeGenerator::compile_instruction(Bytecode::Op::JumpUndefined const& instruction)
+{
+    load_operand(Reg::RAX, instruction.condition());
+    m_assembler.mov64(Reg::RCX, js_undefined().encoded());
+    m_assembler.compare64(Reg::RAX, Reg::RCX);
+    jump_to_block_if(Condition::EqualTo, instruction.true_target());
+    jump_to_block(instruction.false_target());
+}
+
+template<typename OpType>
+void CodeGenerator::compile_comparison_jump(OpType const& instruction, Condition condition, u64 slow_path)
+{
+    auto slow_case = m_assembler.make_label();
+
+    load_operand(Reg::RAX, instruction.lhs());
+    branch_if_tag_is_not(Reg::RAX, INT32_TAG, Reg::RCX, slow_case);
+    load_operand(Reg::RDX, instruction.rhs());
+    branch_if_tag_is_not(Reg::RDX, INT32_TAG, Reg::RCX, slow_case);
+    m_assembler.compare32(Reg::RAX, Reg::RDX);
+    jump_to_block_if(condition, instruction.true_target());
+    jump_to_block(instruction.false_target());
+
+    slow_case.link(m_assembler);
+    call_slow_path(slow_path, instruction);
+    m_assembler.compare32(Reg::RAX, 1);
+    jump_to_block_if(Condition::EqualTo, instruction.true_target());
+    jump_to_block_if(Condition::Below, instruction.false_target());
+    exit(NativeExecutable::ExitReason::Exception);
+}
+
+#    define COMPILE_COMPARISON_JUMP(op_TitleCase, op_snake_case, condition)                                       \
+        void CodeGenerator::compile_instruction(Bytecode::Op::Jump##op_TitleCase const& instruction)              \
+        {                                                                                                         \
+            compile_comparison_jump(instruction, Condition::condition, function_address(&cxx_jump_##op_snake_case)); \
+        }
+COMPILE_COMPARISON_JUMP(LessThan, less_than, SignedLessThan)
+COMPILE_COMPARISON_JUMP(LessThanEquals, less_than_equals, SignedLessThanOrEqualTo)
+COMPILE_COMPARISON_JUMP(GreaterThan, greater_than, SignedGreaterThan)
+COMPILE_COMPARISON_JUMP(GreaterThanEquals, greater_than_equals, SignedGreaterThanOrEqualTo)
+COMPILE_COMPARISON_JUMP(LooselyEquals, loosely_equals, EqualTo)
+COMPILE_COMPARISON_JUMP(LooselyInequals, loosely_inequals, NotEqualTo)
+COMPILE_COMPARISON_JUMP(StrictlyEquals, strict_equals, EqualTo)
+COMPILE_COMPARISON_JUMP(StrictlyInequals, strict_inequals, NotEqualTo)
+#    undef COMPILE_COMPARISON_JUMP
+
+template<typename OpType>
+void CodeGenerator::compile_int32_binary_operation(OpType const& instruction, Function<void(Reg, Reg)> const& emit_operation)
+{
+    auto slow_case = m_assembler.make_label();
+    auto done = m_assembler.make_label();
+
+    load_operand(Reg::RAX, instruction.lhs());
+    branch_if_tag_is_not(Reg::RAX, INT32_TAG, Reg::RCX, slow_case);
+    load_operand(Reg::RDX, instruction.rhs());
+    branch_if_tag_is_not(Reg::RDX, INT32_TAG, Reg::RCX, slow_case);
+    emit_operation(Reg::RAX, Reg::RDX);
+    m_assembler.jump_if(Condition::Overflow, slow_case);
+    box_int32(Reg::RAX, Reg::RCX);
+    store_operand(instruction.dst(), Reg::RAX);
+    m_assembler.jump(done);
+
+    slow_case.link(m_assembler);
+    call_slow_path(function_address(&cxx_execute<OpType>), instruction);
+    exit_if_slow_path_threw();
+
+    done.link(m_assembler);
+}
+
+template<typename OpType>
+void CodeGenerator::compile_int32_unary_operation(OpType const& instruction, Function<void(Reg)> const& emit_operation)
+{
+    auto slow_case = m_assembler.make_label();
+    auto done = m_assembler.make_label();
+
+    load_operand(Reg::RAX, instruction.dst());
+    branch_if_tag_is_not(Reg::RAX, INT32_TAG, Reg::RCX, slow_case);
+    emit_operation(Reg::RAX);
+    m_assembler.jump_if(Condition::Overflow, slow_case);
+    box_int32(Reg::RAX, Reg::RCX);
+    store_operand(instruction.dst(), Reg::RAX);
+    m_assembler.jump(done);
+
+    slow_case.link(m_assembler);
+    call_slow_path(function_address(&cxx_execute<OpType>), instruction);
+    exit_if_slow_path_threw();
+
+    done.link(m_assembler);
+}
+
+void CodeGenerator::compile_instruction(Bytecode::Op::Add const& instruction)
+{
+    compile_int32_binary_operation(instruction, [&](Reg lhs, Reg rhs) { m_assembler.add32(lhs, rhs); });
+}
+
+void CodeGenerator::compile_instruction(Bytecode::Op::Sub const& instruction)
+{
+    compile_int32_binary_operation(instruction, [&](Reg lhs, Reg rhs) { m_assembler.sub32(lhs, rhs); });
+}
+
+void CodeGenerator::compile_instruction(Bytecode::Op::Increment const& instruction)
+{
+    compile_int32_unary_operation(instruction, [&](Reg value) { m_assembler.add32(value, 1); });
+}
+
+void CodeGenerator::compile_instruction(Bytecode::Op::Decrement const& instruction)
+{
+    compile_int32_unary_operation(instruction, [&](Reg value) { m_assembler.sub32(value, 1); });
+}
+
+void CodeGenerator::compile_instruction(Bytecode::Op::GetById const& instruction)
+{
+    auto& cache = m_property_access_caches[instruction.cache_index()];
+    auto slow_case = m_assembler.make_label();
+    auto done = m_assembler.make_label();
+
+    load_operand(Reg::RAX, instruction.base());
+    branch_if_tag_is_not(Reg::RAX, OBJECT_TAG, Reg::RCX, slow_case);
+    extract_pointer(Reg::RAX);
+
+    load_cached_property_offset(Reg::RCX, Reg::RAX, cache, slow_case);
+    m_assembler.shift_left64(Reg::RCX, 3);
+    m_assembler.load64(Reg::RAX, Reg::RAX, static_cast<i32>(Object::offset_of_storage_data()));
+    m_assembler.add64(Reg::RAX, Reg::RCX);
+    m_assembler.load64(Reg::RAX, Reg::RAX, 0);
+
+    // Accessors are called by the slow path.
+    m_assembler.mov64(Reg::RCX, Reg::RAX);
+    m_assembler.shift_right64(Reg::RCX, GC::TAG_SHIFT);
+    m_assembler.compare32(Reg::RCX, static_cast<i32>(ACCESSOR_TAG));
+    m_assembler.jump_if(Condition::EqualTo, slow_case);
+
+    store_operand(instruction.dst(), Reg::RAX);
+    m_assembler.jump(done);
+
+    slow_case.link(m_assembler);
+    call_slow_path(function_address(&cxx_get_by_id), instruction, &cache);
+    exit_if_slow_path_threw();
+
+    done.link(m_assembler);
+}
+
+void CodeGenerator::compile_instruction(Bytecode::Op::PutNormalById const& instruction)
+{
+    auto& cache = m_property_access_caches[instruction.cache_index()];
+    auto slow_case = m_assembler.make_label();
+    auto done = m_assembler.make_label();
+
+    load_operand(Reg::RAX, instruction.base());
+    branch_if_tag_is_not(Reg::RAX, OBJECT_TAG, Reg::RCX, slow_case);
+    extract_pointer(Reg::RAX);
+
+    // Storing into an old object that isn't remembered yet needs a write barrier, which the slow path takes care of.
+    m_assembler.load8(Reg::RCX, Reg::RAX, static_cast<i32>(GC::Cell::offset_of_mark()));
+    m_assembler.load8(Reg::RSI, Reg::RAX, static_cast<i32>(GC::Cell::offset_of_remembered()));
+    m_assembler.compare32(Reg::RCX, Reg::RSI);
+    m_assembler.jump_if(Condition::Above, slow_case);
+
+    load_cached_property_offset(Reg::RCX, Reg::RAX, cache, slow_case);
+    m_assembler.shift_left64(Reg::RCX, 3);
+    m_assembler.load64(Reg::RAX, Reg::RAX, static_cast<i32>(Object::offset_of_storage_data()));
+    m_assembler.add64(Reg::RAX, Reg::RCX);
+
+    // Setters are called by the slow path.
+    m_assembler.load64(Reg::RCX, Reg::RAX, 0);
+    m_assembler.shift_right64(Reg::RCX, GC::TAG_SHIFT);
+    m_assembler.compare32(Reg::RCX, static_cast<i32>(ACCESSOR_TAG));
+    m_assembler.jump_if(Condition::EqualTo, slow_case);
+
+    load_operand(Reg::RCX, instruction.src());
+    m_assembler.store64(Reg::RAX, 0, Reg::RCX);
+    m_assembler.jump(done);
+
+    slow_case.link(m_assembler);
+    call_slow_path(function_address(&cxx_put_by_id), instruction, &cache);
+    exit_if_slow_path_threw();
+
+    done.link(m_assembler);
+}
+
+OwnPtr<NativeExecutable> Compiler::compile(Bytecode::Executable& executable)
+{
+    auto property_access_caches = make<Vector<PropertyAccessCache>>();
+    property_access_caches->resize(executable.property_lookup_caches.size());
+
+    CodeGenerator generator { executable, *property_access_caches };
+    generator.generate();
+
+    auto native_executable = NativeExecutable::create(generator.code(), generator.take_block_offsets(), generator.entry_trampoline_offset(), move(property_access_caches));
+    if (native_executable)
+        dbgln_if(JS_JIT_DEBUG, "JIT: Compiled {} bytes of bytecode in '{}' into {} bytes of native code", executable.bytecode.size(), executable.name, native_executable->code_size());
+    return native_executable;
+}
+
+#else
+
+OwnPtr<NativeExecutable> Compiler::compile(Bytecode::Executable&)
+{
+    return nullptr;
+}
+
+#endif
+
+}
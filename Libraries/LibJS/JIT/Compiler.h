@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/OwnPtr.h>
+#include <AK/Platform.h>
+#include <LibJS/Forward.h>
+
+#if ARCH(X86_64) && defined(AK_OS_LINUX)
+#    define JIT_ARCH_SUPPORTED 1
+#endif
+
+namespace JS::JIT {
+
+class NativeExecutable;
+
+// The baseline JIT translates the bytecode of hot executables into machine code, one instruction at a time and without
+// any optimization across instructions. This removes the dispatch and operand decoding overhead of the interpreter.
+//
+// Moves, jumps, int32 arithmetic and comparisons, and property accesses that hit an inline cache are compiled to
+// inline code. Everything else calls the same implementation that the interpreter uses. Instructions that affect the
+// interpreter's own control flow (returns, yields, awaits and unwinding) exit the native code, and are executed by the
+// interpreter, which enters native code again at the next jump.
+class Compiler {
+public:
+    // Executables are compiled once the number of calls and backward jumps in them reaches this threshold.
+    static constexpr u32 hotness_threshold = 500;
+
+    static OwnPtr<NativeExecutable> compile(Bytecode::Executable&);
+};
+
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/System.h>
+#include <LibJS/JIT/NativeExecutable.h>
+#include <LibJS/Runtime/Shape.h>
+#include <sys/mman.h>
+
+namespace JS::JIT {
+
+OwnPtr<NativeExecutable> NativeExecutable::create(ReadonlyBytes code, HashMap<size_t, size_t> block_offsets, size_t entry_trampoline_offset, NonnullOwnPtr<Vector<PropertyAccessCache>> property_access_caches)
+{
+    auto mapped_size = round_up_to_power_of_two(code.size(), PAGE_SIZE);
+
+    auto memory_or_error = Core::System::mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0, 0, "JIT code"sv);
+    if (memory_or_error.is_error()) {
+        dbgln("JIT: Failed to allocate memory for native code: {}", memory_or_error.error());
+        return nullptr;
+    }
+    auto* memory = memory_or_error.release_value();
+
+    code.copy_to({ static_cast<u8*>(memory), mapped_size });
+
+    // The code is never written to again, so we never need the mapping to be both writable and executable.
+    if (mprotect(memory, mapped_size, PROT_READ | PROT_EXEC) < 0) {
+        dbgln("JIT: Failed to make native code executable: {}", AK::Error::from_errno(errno));
+        MUST(Core::System::munmap(memory, mapped_size));
+        return nullptr;
+    }
+
+    return adopt_own(*new NativeExecutable(memory, code.size(), mapped_size, move(block_offsets), entry_trampoline_offset, move(property_access_caches)));
+}
+
+NativeExecutable::NativeExecutable(void* code, size_t code_size, size_t mapped_size, HashMap<size_t, size_t> block_offsets, size_t entry_trampoline_offset, NonnullOwnPtr<Vector<PropertyAccessCache>> property_access_caches)
+    : m_code(code)
+    , m_code_size(code_size)
+    , m_mapped_size(mapped_size)
+    , m_block_offsets(move(block_offsets))
+    , m_entry_trampoline_offset(entry_trampoline_offset)
+    , m_property_access_caches(move(property_access_caches))
+{
+}
+
+NativeExecutable::~NativeExecutable()
+{
+    MUST(Core::System::munmap(m_code, m_mapped_size));
+}
+
+NativeExecutable::ExitState NativeExecutable::run(Bytecode::Interpreter& interpreter, Value* registers, size_t program_counter) const
+{
+    auto block_offset = m_block_offsets.get(program_counter);
+    VERIFY(block_offset.has_value());
+
+    auto* code = static_cast<u8 const*>(m_code);
+    auto entry = bit_cast<EntryFunction>(code + m_entry_trampoline_offset);
+    auto exit = entry(registers, &interpreter, code + *block_offset);
+
+    return {
+        .reason = (exit & 1) ? ExitReason::Exception : ExitReason::Interpret,
+        .program_counter = static_cast<size_t>(exit >> 1),
+    };
+}
+
+void NativeExecutable::visit_edges(GC::Cell::Visitor& visitor)
+{
+    // NOTE: The shapes remembered by the inline caches are kept alive, so that a new shape can never be allocated at the
+    //       address of a stale one and be mistaken for it by the generated code.
+    for (auto& cache : *m_property_access_caches) {
+        for (auto& entry : cache.entries)
+            visitor.visit(entry.shape);
+    }
+}
+
+}
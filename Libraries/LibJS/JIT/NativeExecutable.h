@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/HashMap.h>
+#include <AK/Noncopyable.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+#include <LibGC/Cell.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Forward.h>
+
+namespace JS::JIT {
+
+// The inline fast paths for GetById and PutById check the shape of the base object against the ones remembered here, in
+// order. The entries mirror those of the executable's PropertyLookupCache, and are refreshed from it whenever the slow
+// path is taken. Entries for anything but a data property on the object itself are left empty.
+struct PropertyAccessCache {
+    struct Entry {
+        Shape* shape { nullptr };
+        u64 property_offset { 0 };
+    };
+    AK::Array<Entry, Bytecode::PropertyLookupCache::max_number_of_shapes_to_remember> entries;
+};
+
+class NativeExecutable {
+    AK_MAKE_NONCOPYABLE(NativeExecutable);
+    AK_MAKE_NONMOVABLE(NativeExecutable);
+
+public:
+    // Native code is entered with the register file, the interpreter and the address of the basic block to start at, and
+    // returns an encoded exit state once it reaches something it cannot handle.
+    using EntryFunction = u64 (*)(Value* registers, Bytecode::Interpreter*, void const* block_address);
+
+    static OwnPtr<NativeExecutable> create(ReadonlyBytes code, HashMap<size_t, size_t> block_offsets, size_t entry_trampoline_offset, NonnullOwnPtr<Vector<PropertyAccessCache>>);
+    ~NativeExecutable();
+
+    enum class ExitReason {
+        // The instruction at the program counter must be executed by the interpreter.
+        Interpret,
+        // An exception was thrown by the instruction at the program counter, and is in the exception register.
+        Exception,
+    };
+
+    static constexpr u64 encode_exit(ExitReason reason, size_t program_counter)
+    {
+        return (static_cast<u64>(program_counter) << 1) | (reason == ExitReason::Exception ? 1 : 0);
+    }
+
+    struct ExitState {
+        ExitReason reason;
+        size_t program_counter;
+    };
+
+    [[nodiscard]] bool can_enter_at(size_t program_counter) const { return m_block_offsets.contains(program_counter); }
+    ExitState run(Bytecode::Interpreter&, Value* registers, size_t program_counter) const;
+
+    void visit_edges(GC::Cell::Visitor&);
+
+    size_t code_size() const { return m_code_size; }
+
+private:
+    NativeExecutable(void* code, size_t code_size, size_t mapped_size, HashMap<size_t, size_t> block_offsets, size_t entry_trampoline_offset, NonnullOwnPtr<Vector<PropertyAccessCache>>);
+
+    void* m_code { nullptr };
+    size_t m_code_size { 0 };
+    size_t m_mapped_size { 0 };
+    HashMap<size_t, size_t> m_block_offsets;
+    size_t m_entry_trampoline_offset { 0 };
+    NonnullOwnPtr<Vector<PropertyAccessCache>> m_property_access_caches;
+};
+
+}
@@ -248,8 +248,9 @@ Lexer::Lexer(StringView source, StringView filename, size_t line_number, size_t
     // FIXME: Remove this API once all callers are ported to UTF-16.
 }
 
-Lexer::Lexer(Utf16String source, StringView filename, size_t line_number, size_t line_column)
+Lexer::Lexer(Utf16String source, StringView filename, size_t line_number, size_t line_column, size_t start_offset)
     : m_source(move(source))
+    , m_position(start_offset)
     , m_current_token(TokenType::Eof, {}, {}, {}, 0, 0, 0)
     , m_filename(String::from_utf8(filename).release_value_but_fixme_should_propagate_errors())
     , m_line_number(line_number)
@@ -11,6 +11,7 @@
 
 #include <AK/Array.h>
 #include <AK/CharacterTypes.h>
+#include <AK/GenericShorthands.h>
 #include <AK/ScopeGuard.h>
 #include <AK/StdLibExtras.h>
 #include <AK/TemporaryChange.h>
@@ -237,6 +238,43 @@ public:
     ScopePusher* parent_scope() { return m_parent_scope; }
     ScopePusher const* parent_scope() const { return m_parent_scope; }
 
+    bool is_inside_function_body() const
+    {
+        for (auto scope_ptr = this; scope_ptr; scope_ptr = scope_ptr->m_parent_scope) {
+            if (scope_ptr->m_type == ScopeType::Function && scope_ptr->m_node)
+                return true;
+        }
+        return false;
+    }
+
+    // Records an identifier for every name that leaves this scope unresolved. The recorded identifiers take part in the
+    // resolution of the enclosing scopes, so that their outcome can later be applied to a re-parsed copy of this scope.
+    void set_free_identifiers(Vector<NonnullRefPtr<Identifier const>>* free_identifiers)
+    {
+        m_free_identifiers = free_identifiers;
+    }
+
+    void apply_resolution_of_free_identifiers(Vector<NonnullRefPtr<Identifier const>> const& free_identifiers)
+    {
+        for (auto const& free_identifier : free_identifiers) {
+            auto identifier_group = m_identifier_groups.get(free_identifier->string());
+            if (!identifier_group.has_value())
+                continue;
+
+            // NOTE: The free identifier was resolved without knowing how the name is used within the function, so it
+            //       must not turn a name that may be bound by a with statement, eval or a function's own name into a global.
+            auto const& group = identifier_group.value();
+            auto may_be_global = !(group.used_inside_with_statement || group.used_inside_scope_with_eval || group.might_be_variable_in_lexical_scope_in_named_function_assignment);
+
+            for (auto& identifier : group.identifiers) {
+                if (free_identifier->is_global() && may_be_global)
+                    identifier->set_is_global();
+                if (free_identifier->declaration_kind() != DeclarationKind::None)
+                    identifier->set_declaration_kind(free_identifier->declaration_kind());
+            }
+        }
+    }
+
     [[nodiscard]] bool has_declaration(Utf16FlyString const& name) const
     {
         return m_lexical_names.contains(name) || m_var_names.contains(name) || !m_functions_to_hoist.find_if([&name](auto& function) { return function->name() == name; }).is_end();
@@ -402,6 +440,15 @@ public:
                 if (m_contains_direct_call_to_eval)
                     identifier_group.used_inside_scope_with_eval = true;
 
+                if (m_free_identifiers) {
+                    auto const& first_identifier = *identifier_group.identifiers.first();
+                    auto free_identifier = create_ast_node<Identifier>(
+                        { first_identifier.source_code(), { .offset = first_identifier.start_offset() }, { .offset = first_identifier.end_offset() } },
+                        identifier_group_name);
+                    identifier_group.identifiers.append(free_identifier);
+                    m_free_identifiers->append(move(free_identifier));
+                }
+
                 if (m_parent_scope) {
                     if (auto maybe_parent_scope_identifier_group = m_parent_scope->m_identifier_groups.get(identifier_group_name); maybe_parent_scope_identifier_group.has_value()) {
                         maybe_parent_scope_identifier_group.value().identifiers.extend(identifier_group.identifiers);
@@ -495,6 +542,8 @@ public:
         m_is_arrow_function = true;
     }
 
+    bool is_arrow_function() const { return m_is_arrow_function; }
+
     void set_is_function_declaration()
     {
         m_is_function_declaration = true;
@@ -535,6 +584,7 @@ private:
         Optional<DeclarationKind> declaration_kind;
     };
     HashMap<Utf16FlyString, IdentifierGroup> m_identifier_groups;
+    Vector<NonnullRefPtr<Identifier const>>* m_free_identifiers { nullptr };
 
     RefPtr<FunctionParameters const> m_function_parameters;
 
@@ -1035,6 +1085,10 @@ RefPtr<FunctionExpression const> Parser::try_parse_arrow_function_expression(boo
         load_state();
     };
 
+    auto lazy_parse_data = create_lazy_function_parse_data_if_eligible(rule_start.position());
+    if (lazy_parse_data)
+        lazy_parse_data->arrow_function_has_parentheses = expect_parens;
+
     auto function_kind = FunctionKind::Normal;
 
     if (is_async) {
@@ -1116,11 +1170,21 @@ RefPtr<FunctionExpression const> Parser::try_parse_arrow_function_expression(boo
         if (match(TokenType::CurlyOpen)) {
             // Parse a function body with statements
             consume(TokenType::CurlyOpen);
-            auto body = parse_function_body(parameters, function_kind, parsing_insights);
+            RefPtr<FunctionBody const> body;
+            if (lazy_parse_data) {
+                function_scope.set_free_identifiers(&lazy_parse_data->free_identifiers);
+                if (m_function_bodies_were_validated)
+                    body = try_skip_lazily_parsed_function_body(*lazy_parse_data, parameters, function_kind);
+            }
+            if (!body)
+                body = parse_function_body(parameters, function_kind, parsing_insights);
             consume(TokenType::CurlyClose);
             return body;
         }
 
+        // NOTE: Functions with a concise body are always parsed eagerly.
+        lazy_parse_data = nullptr;
+
         if (match_expression()) {
             // Parse a function body which returns a single expression
 
@@ -1168,10 +1232,12 @@ RefPtr<FunctionExpression const> Parser::try_parse_arrow_function_expression(boo
 
     auto source_text = m_state.lexer.source().substring_view(function_start_offset, function_end_offset - function_start_offset);
 
-    return create_ast_node<FunctionExpression>(
+    auto function_node = create_ast_node<FunctionExpression>(
         { m_source_code, rule_start.position(), position() }, nullptr, MUST(source_text.to_byte_string()),
         move(body), move(parameters), function_length, function_kind, body->in_strict_mode(),
         parsing_insights, move(local_variables_names), /* is_arrow_function */ true);
+    discard_function_body_if_lazily_parsed(*function_node, move(lazy_parse_data), function_end_offset - function_start_offset);
+    return function_node;
 }
 
 RefPtr<LabelledStatement const> Parser::try_parse_labelled_statement(AllowLabelledFunction allow_function)
@@ -2860,57 +2926,63 @@ NonnullRefPtr<FunctionBody const> Parser::parse_function_body(NonnullRefPtr<Func
         expected(Token::name(TokenType::CurlyClose));
 
     // If the function contains 'use strict' we need to check the parameters (again).
-    if (function_body->in_strict_mode() || function_kind != FunctionKind::Normal) {
-        Vector<Utf16View> parameter_names;
-        for (auto& parameter : parameters->parameters()) {
-            parameter.binding.visit(
-                [&](Identifier const& identifier) {
-                    auto const& parameter_name = identifier.string();
+    check_parameters_of_function_body(parameters, function_kind, function_body->in_strict_mode());
 
-                    check_identifier_name_for_assignment_validity(parameter_name, function_body->in_strict_mode());
-                    if (function_kind == FunctionKind::Generator && parameter_name == "yield"sv)
-                        syntax_error("Parameter name 'yield' not allowed in this context"_string);
+    m_state.strict_mode = previous_strict_mode;
+    VERIFY(m_state.current_scope_pusher->type() == ScopePusher::ScopeType::Function);
+    parsing_insights.contains_direct_call_to_eval = m_state.current_scope_pusher->contains_direct_call_to_eval();
+    parsing_insights.uses_this_from_environment = m_state.current_scope_pusher->uses_this_from_environment();
+    parsing_insights.uses_this = m_state.current_scope_pusher->uses_this();
+    return function_body;
+}
 
-                    if (function_kind == FunctionKind::Async && parameter_name == "await"sv)
-                        syntax_error("Parameter name 'await' not allowed in this context"_string);
+void Parser::check_parameters_of_function_body(FunctionParameters const& parameters, FunctionKind function_kind, bool in_strict_mode)
+{
+    if (!in_strict_mode && function_kind == FunctionKind::Normal)
+        return;
 
-                    for (auto& previous_name : parameter_names) {
-                        if (previous_name == parameter_name) {
-                            syntax_error(MUST(String::formatted("Duplicate parameter '{}' not allowed in strict mode", parameter_name)));
-                        }
+    Vector<Utf16View> parameter_names;
+    for (auto& parameter : parameters.parameters()) {
+        parameter.binding.visit(
+            [&](Identifier const& identifier) {
+                auto const& parameter_name = identifier.string();
+
+                check_identifier_name_for_assignment_validity(parameter_name, in_strict_mode);
+                if (function_kind == FunctionKind::Generator && parameter_name == "yield"sv)
+                    syntax_error("Parameter name 'yield' not allowed in this context"_string);
+
+                if (function_kind == FunctionKind::Async && parameter_name == "await"sv)
+                    syntax_error("Parameter name 'await' not allowed in this context"_string);
+
+                for (auto& previous_name : parameter_names) {
+                    if (previous_name == parameter_name) {
+                        syntax_error(MUST(String::formatted("Duplicate parameter '{}' not allowed in strict mode", parameter_name)));
                     }
+                }
 
-                    parameter_names.append(parameter_name);
-                },
-                [&](NonnullRefPtr<BindingPattern const> const& binding) {
-                    // NOTE: Nothing in the callback throws an exception.
-                    MUST(binding->for_each_bound_identifier([&](auto& bound_identifier) {
-                        auto const& bound_name = bound_identifier.string();
+                parameter_names.append(parameter_name);
+            },
+            [&](NonnullRefPtr<BindingPattern const> const& binding) {
+                // NOTE: Nothing in the callback throws an exception.
+                MUST(binding->for_each_bound_identifier([&](auto& bound_identifier) {
+                    auto const& bound_name = bound_identifier.string();
 
-                        if (function_kind == FunctionKind::Generator && bound_name == "yield"sv)
-                            syntax_error("Parameter name 'yield' not allowed in this context"_string);
+                    if (function_kind == FunctionKind::Generator && bound_name == "yield"sv)
+                        syntax_error("Parameter name 'yield' not allowed in this context"_string);
 
-                        if (function_kind == FunctionKind::Async && bound_name == "await"sv)
-                            syntax_error("Parameter name 'await' not allowed in this context"_string);
+                    if (function_kind == FunctionKind::Async && bound_name == "await"sv)
+                        syntax_error("Parameter name 'await' not allowed in this context"_string);
 
-                        for (auto& previous_name : parameter_names) {
-                            if (previous_name == bound_name) {
-                                syntax_error(MUST(String::formatted("Duplicate parameter '{}' not allowed in strict mode", bound_name)));
-                                break;
-                            }
+                    for (auto& previous_name : parameter_names) {
+                        if (previous_name == bound_name) {
+                            syntax_error(MUST(String::formatted("Duplicate parameter '{}' not allowed in strict mode", bound_name)));
+                            break;
                         }
-                        parameter_names.append(bound_name);
-                    }));
-                });
-        }
+                    }
+                    parameter_names.append(bound_name);
+                }));
+            });
     }
-
-    m_state.strict_mode = previous_strict_mode;
-    VERIFY(m_state.current_scope_pusher->type() == ScopePusher::ScopeType::Function);
-    parsing_insights.contains_direct_call_to_eval = m_state.current_scope_pusher->contains_direct_call_to_eval();
-    parsing_insights.uses_this_from_environment = m_state.current_scope_pusher->uses_this_from_environment();
-    parsing_insights.uses_this = m_state.current_scope_pusher->uses_this();
-    return function_body;
 }
 
 NonnullRefPtr<BlockStatement const> Parser::parse_block_statement()
@@ -2933,6 +3005,31 @@ NonnullRefPtr<FunctionNodeType> Parser::parse_function_node(u16 parse_options, O
         : push_start();
     VERIFY(!(parse_options & FunctionNodeParseOptions::IsGetterFunction && parse_options & FunctionNodeParseOptions::IsSetterFunction));
 
+    constexpr auto is_function_expression = IsSame<FunctionNodeType, FunctionExpression>;
+
+    // NOTE: Only plain function declarations and expressions are parsed lazily. Methods are always instantiated along with
+    //       their class or object literal, and function expressions that are (likely) immediately invoked would be
+    //       re-parsed right away.
+    OwnPtr<LazyFunctionParseData> lazy_parse_data;
+    if ((parse_options & FunctionNodeParseOptions::CheckForFunctionAndName) && !(parse_options & FunctionNodeParseOptions::HasDefaultExportName)) {
+        auto is_probably_immediately_invoked = [&] {
+            if (!is_function_expression)
+                return false;
+            auto const& source = m_state.lexer.source();
+            for (auto offset = rule_start.position().offset; offset > 0; --offset) {
+                auto code_unit = source.code_unit_at(offset - 1);
+                if (!is_ascii_space(code_unit))
+                    return code_unit == '(';
+            }
+            return false;
+        };
+
+        if (!is_probably_immediately_invoked())
+            lazy_parse_data = create_lazy_function_parse_data_if_eligible(rule_start.position());
+        if (lazy_parse_data)
+            lazy_parse_data->is_function_declaration = !is_function_expression;
+    }
+
     TemporaryChange super_property_access_rollback(m_state.allow_super_property_lookup, !!(parse_options & FunctionNodeParseOptions::AllowSuperPropertyLookup));
     TemporaryChange super_constructor_call_rollback(m_state.allow_super_constructor_call, !!(parse_options & FunctionNodeParseOptions::AllowSuperConstructorCall));
     TemporaryChange break_context_rollback(m_state.in_break_context, false);
@@ -2941,7 +3038,6 @@ NonnullRefPtr<FunctionNodeType> Parser::parse_function_node(u16 parse_options, O
     TemporaryChange might_need_arguments_object_rollback(m_state.function_might_need_arguments_object, false);
     TemporaryChange in_formal_parameter_context_rollback(m_state.in_formal_parameter_context, false);
 
-    constexpr auto is_function_expression = IsSame<FunctionNodeType, FunctionExpression>;
     FunctionKind function_kind;
     if ((parse_options & FunctionNodeParseOptions::IsGeneratorFunction) != 0 && (parse_options & FunctionNodeParseOptions::IsAsyncFunction) != 0)
         function_kind = FunctionKind::AsyncGenerator;
@@ -3000,6 +3096,8 @@ NonnullRefPtr<FunctionNodeType> Parser::parse_function_node(u16 parse_options, O
         ScopePusher function_scope = ScopePusher::function_scope(*this, name);
         if constexpr (IsSame<FunctionNodeType, FunctionDeclaration>)
             function_scope.set_is_function_declaration();
+        if (lazy_parse_data)
+            function_scope.set_free_identifiers(&lazy_parse_data->free_identifiers);
 
         consume(TokenType::ParenOpen);
         parameters = parse_formal_parameters(function_length, parse_options);
@@ -3017,6 +3115,11 @@ NonnullRefPtr<FunctionNodeType> Parser::parse_function_node(u16 parse_options, O
 
         consume(TokenType::CurlyOpen);
 
+        if (lazy_parse_data && m_function_bodies_were_validated) {
+            if (auto skipped_body = try_skip_lazily_parsed_function_body(*lazy_parse_data, *parameters, function_kind))
+                return skipped_body.release_nonnull();
+        }
+
         return parse_function_body(*parameters, function_kind, parsing_insights);
     }();
 
@@ -3037,11 +3140,13 @@ NonnullRefPtr<FunctionNodeType> Parser::parse_function_node(u16 parse_options, O
         parsing_insights.uses_this = true;
         parsing_insights.uses_this_from_environment = true;
     }
-    return create_ast_node<FunctionNodeType>(
+    auto function_node = create_ast_node<FunctionNodeType>(
         { m_source_code, rule_start.position(), position() },
         name, MUST(source_text.to_byte_string()), move(body), parameters.release_nonnull(), function_length,
         function_kind, has_strict_directive, parsing_insights,
         move(local_variables_names));
+    discard_function_body_if_lazily_parsed(*function_node, move(lazy_parse_data), function_end_offset - function_start_offset);
+    return function_node;
 }
 
 NonnullRefPtr<FunctionParameters const> Parser::parse_formal_parameters(int& function_length, u16 parse_options)
@@ -5243,4 +5348,324 @@ Parser Parser::parse_function_body_from_string(ByteString const& body_string, u1
     return body_parser;
 }
 
+bool g_collect_lazy_function_parsing_statistics = false;
+u64 g_created_ast_node_size = 0;
+
+static Parser::LazyFunctionParsingStatistics s_lazy_function_parsing_statistics;
+
+Parser::LazyFunctionParsingStatistics const& Parser::lazy_function_parsing_statistics()
+{
+    return s_lazy_function_parsing_statistics;
+}
+
+OwnPtr<LazyFunctionParseData> Parser::create_lazy_function_parse_data_if_eligible(Position const& function_start) const
+{
+    // Top-level functions are almost always called, so only functions nested within another function's body are
+    // candidates for lazy parsing.
+    if (!m_lazy_function_parsing_enabled || !m_state.current_scope_pusher || !m_state.current_scope_pusher->is_inside_function_body())
+        return {};
+
+    auto lazy_parse_data = adopt_own(*new LazyFunctionParseData {
+        .source_code = m_source_code,
+        .start = function_start,
+        .is_module = m_program_type == Program::Type::Module,
+        .context = m_state,
+    });
+    if (g_collect_lazy_function_parsing_statistics) {
+        lazy_parse_data->ast_size = g_created_ast_node_size;
+        lazy_parse_data->discarded_ast_size = s_lazy_function_parsing_statistics.discarded_ast_size;
+        lazy_parse_data->parse_time = AK::Duration::from_nanoseconds(MonotonicTime::now().nanoseconds());
+    }
+    return lazy_parse_data;
+}
+
+// Tokens that are keywords, but end an expression when they appear right before a slash, which is then a division.
+static bool keyword_can_end_expression(TokenType type)
+{
+    switch (type) {
+    case TokenType::Async:
+    case TokenType::BoolLiteral:
+    case TokenType::Implements:
+    case TokenType::Interface:
+    case TokenType::Let:
+    case TokenType::NullLiteral:
+    case TokenType::Package:
+    case TokenType::Private:
+    case TokenType::Protected:
+    case TokenType::Public:
+    case TokenType::Static:
+    case TokenType::Super:
+    case TokenType::This:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Tokens that may be a reference to a binding, at least outside of strict mode.
+static bool token_may_be_identifier_reference(TokenType type)
+{
+    switch (type) {
+    case TokenType::Async:
+    case TokenType::Await:
+    case TokenType::Identifier:
+    case TokenType::Implements:
+    case TokenType::Interface:
+    case TokenType::Let:
+    case TokenType::Package:
+    case TokenType::Private:
+    case TokenType::Protected:
+    case TokenType::Public:
+    case TokenType::Static:
+    case TokenType::Yield:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Skips over the body of a lazily parsed function, which has to start at the current token, up to (but not including)
+// its closing curly bracket. Instead of parsing the body, this only matches brackets and notes every name that appears
+// in it, so that the enclosing scopes can resolve their identifiers as if the body had been parsed. This finds none of
+// the body's early errors, so it may only be used for source that has been fully parsed before. If the body cannot be
+// skipped safely, the parser state is left untouched and null is returned; the body then has to be parsed normally.
+RefPtr<FunctionBody const> Parser::try_skip_lazily_parsed_function_body(LazyFunctionParseData& lazy_parse_data, NonnullRefPtr<FunctionParameters const> parameters, FunctionKind function_kind)
+{
+    VERIFY(m_function_bodies_were_validated);
+
+    // NOTE: A string literal at the start of the body may be a directive that changes how the function has to be parsed.
+    if (match(TokenType::StringLiteral))
+        return nullptr;
+
+    auto rule_start = push_start();
+    VERIFY(m_state.current_scope_pusher->type() == ScopePusher::ScopeType::Function);
+    auto& function_scope = *m_state.current_scope_pusher;
+
+    struct ReferencedName {
+        Utf16FlyString name;
+        u32 start_offset { 0 };
+        u32 end_offset { 0 };
+    };
+    Vector<ReferencedName> referenced_names;
+    HashTable<Utf16FlyString> seen_names;
+    bool uses_this_or_new_target = false;
+
+    // For every open parenthesis, whether it starts the head of an if, for, while or with statement. A slash after the
+    // closing parenthesis of such a head starts a regular expression literal, anywhere else it is a division.
+    Vector<bool> parenthesis_starts_statement_head;
+    bool previous_parenthesis_closed_statement_head = false;
+
+    auto previous_token_type = TokenType::CurlyOpen;
+    auto token_type_before_previous = TokenType::Invalid;
+    bool previous_token_was_of = false;
+    size_t curly_bracket_depth = 0;
+
+    save_state();
+    auto fail = [&] {
+        load_state();
+        return nullptr;
+    };
+
+    while (!match(TokenType::CurlyClose) || curly_bracket_depth > 0) {
+        auto const& token = m_state.current_token;
+        auto type = token.type();
+
+        switch (type) {
+        case TokenType::Eof:
+        case TokenType::Invalid:
+        case TokenType::UnterminatedRegexLiteral:
+        case TokenType::UnterminatedStringLiteral:
+        case TokenType::UnterminatedTemplateLiteral:
+        case TokenType::EscapedKeyword:
+        // NOTE: Private names have to be validated against the enclosing classes.
+        case TokenType::PrivateIdentifier:
+            return fail();
+        case TokenType::CurlyOpen:
+            ++curly_bracket_depth;
+            break;
+        case TokenType::CurlyClose:
+            --curly_bracket_depth;
+            break;
+        case TokenType::ParenOpen:
+            parenthesis_starts_statement_head.append(
+                first_is_one_of(previous_token_type, TokenType::If, TokenType::For, TokenType::While, TokenType::With)
+                || (previous_token_type == TokenType::Await && token_type_before_previous == TokenType::For));
+            break;
+        case TokenType::ParenClose:
+            if (parenthesis_starts_statement_head.is_empty())
+                return fail();
+            previous_parenthesis_closed_statement_head = parenthesis_starts_statement_head.take_last();
+            break;
+        case TokenType::Slash:
+        case TokenType::SlashEquals: {
+            // NOTE: The lexer takes a slash after any identifier name, closing bracket or literal to be a division. Without
+            //       parsing, we can't tell which one is meant after a closing curly bracket, `yield`, `await` or `of`.
+            if (first_is_one_of(previous_token_type, TokenType::CurlyClose, TokenType::Yield, TokenType::Await) || previous_token_was_of)
+                return fail();
+
+            auto starts_regex_literal = previous_token_type == TokenType::ParenClose
+                ? previous_parenthesis_closed_statement_head
+                : first_is_one_of(Token::category(previous_token_type), TokenCategory::Keyword, TokenCategory::ControlKeyword) && !keyword_can_end_expression(previous_token_type);
+            if (starts_regex_literal)
+                m_state.current_token = m_state.lexer.force_slash_as_regex();
+            break;
+        }
+        case TokenType::This:
+        case TokenType::Super:
+            uses_this_or_new_target = true;
+            break;
+        case TokenType::Period:
+            if (previous_token_type == TokenType::New)
+                uses_this_or_new_target = true;
+            break;
+        default:
+            break;
+        }
+
+        auto is_property_name = first_is_one_of(previous_token_type, TokenType::Period, TokenType::QuestionMarkPeriod);
+        if (token_may_be_identifier_reference(type) && !is_property_name) {
+            auto name = token.fly_string_value();
+
+            // NOTE: A direct call to eval may access any binding of the enclosing scopes, and arrow functions share the
+            //       arguments object of their enclosing function.
+            if (name == "eval"sv || (name == "arguments"sv && function_scope.is_arrow_function()))
+                return fail();
+
+            if (name != "arguments"sv && seen_names.set(name) == HashSetResult::InsertedNewEntry)
+                referenced_names.append({ move(name), static_cast<u32>(token.offset()), static_cast<u32>(token.offset() + token.value().length_in_code_units()) });
+        }
+
+        token_type_before_previous = previous_token_type;
+        previous_token_type = m_state.current_token.type();
+        previous_token_was_of = previous_token_type == TokenType::Identifier && !is_property_name && m_state.current_token.value() == "of"sv;
+        m_state.current_token = m_state.lexer.next();
+    }
+
+    auto function_end_offset = m_state.current_token.offset() + 1;
+    if (function_end_offset - lazy_parse_data.start.offset < MINIMUM_LAZY_FUNCTION_SOURCE_LENGTH)
+        return fail();
+
+    discard_saved_state();
+    m_state.previous_token_was_period = false;
+
+    auto function_body = create_ast_node<FunctionBody>({ m_source_code, rule_start.position(), position() });
+    if (m_state.strict_mode)
+        function_body->set_strict_mode();
+
+    function_scope.set_scope_node(function_body);
+    function_scope.set_function_parameters(parameters);
+    for (auto& referenced_name : referenced_names) {
+        function_scope.register_identifier(create_ast_node<Identifier>(
+            { m_source_code, { .offset = referenced_name.start_offset }, { .offset = referenced_name.end_offset } },
+            move(referenced_name.name)));
+    }
+    if (uses_this_or_new_target)
+        function_scope.set_uses_new_target();
+
+    check_parameters_of_function_body(parameters, function_kind, m_state.strict_mode);
+
+    if (g_collect_lazy_function_parsing_statistics) {
+        ++s_lazy_function_parsing_statistics.skipped_functions;
+        s_lazy_function_parsing_statistics.skipped_source_length += function_end_offset - lazy_parse_data.start.offset;
+    }
+    return function_body;
+}
+
+void Parser::discard_function_body_if_lazily_parsed(FunctionNode& function_node, OwnPtr<LazyFunctionParseData> lazy_parse_data, u32 source_length)
+{
+    // NOTE: Small functions are not worth the bookkeeping, and functions containing errors are never instantiated.
+    if (!lazy_parse_data || source_length < MINIMUM_LAZY_FUNCTION_SOURCE_LENGTH || has_errors())
+        return;
+
+    if (g_collect_lazy_function_parsing_statistics) {
+        auto& statistics = s_lazy_function_parsing_statistics;
+        lazy_parse_data->ast_size = g_created_ast_node_size - lazy_parse_data->ast_size;
+        lazy_parse_data->parse_time = AK::Duration::from_nanoseconds(MonotonicTime::now().nanoseconds()) - lazy_parse_data->parse_time;
+
+        // NOTE: The AST of this function includes those of the lazily parsed functions nested in it, which were already
+        //       counted as discarded.
+        statistics.discarded_ast_size = lazy_parse_data->discarded_ast_size + lazy_parse_data->ast_size;
+        ++statistics.lazily_parsed_functions;
+        statistics.lazily_parsed_source_length += source_length;
+    }
+
+    lazy_parse_data->source_length = source_length;
+    function_node.discard_body_for_lazy_parsing({}, lazy_parse_data.release_nonnull());
+}
+
+void Parser::parse_lazily_parsed_function(FunctionNode const& function_node)
+{
+    Optional<MonotonicTime> start_time;
+    auto start_ast_size = g_created_ast_node_size;
+    if (g_collect_lazy_function_parsing_statistics)
+        start_time = MonotonicTime::now();
+
+    auto const& lazy_parse_data = function_node.lazy_parse_data();
+    auto const& source_code = *lazy_parse_data.source_code;
+    auto const& start = lazy_parse_data.start;
+
+    // The lexer is placed right before the first code unit of the function, so that source positions of the re-parsed
+    // nodes match those of the original parse.
+    Lexer lexer { source_code.code(), source_code.filename().bytes_as_string_view(), start.line, start.column - 1, start.offset };
+    Parser parser { move(lexer), lazy_parse_data.is_module ? Program::Type::Module : Program::Type::Script };
+    parser.m_source_code = lazy_parse_data.source_code;
+    parser.m_lazy_function_parsing_enabled = true;
+    parser.m_function_bodies_were_validated = true;
+    static_cast<ParserContextFlags&>(parser.m_state) = lazy_parse_data.context;
+
+    // Private names were already validated against the enclosing classes during the original parse.
+    HashTable<Utf16FlyString> referenced_private_names;
+    parser.m_state.referenced_private_names = &referenced_private_names;
+
+    // NOTE: This scope stands in for all of the function's enclosing scopes. As it has no scope node, the function itself
+    //       is parsed eagerly, while functions nested within it may again be parsed lazily.
+    auto enclosing_scope = ScopePusher::function_scope(parser);
+
+    RefPtr<FunctionNode const> reparsed_function;
+    if (!function_node.is_arrow_function()) {
+        if (lazy_parse_data.is_function_declaration)
+            reparsed_function = parser.parse_function_node<FunctionDeclaration>();
+        else
+            reparsed_function = parser.parse_function_node<FunctionExpression>();
+    } else {
+        auto is_async = function_node.kind() == FunctionKind::Async;
+        if (lazy_parse_data.arrow_function_has_parentheses && !is_async) {
+            // NOTE: The caller is expected to have consumed the opening parenthesis for us.
+            auto rule_start = parser.push_start();
+            parser.consume(TokenType::ParenOpen);
+            reparsed_function = parser.try_parse_arrow_function_expression(true, false);
+        } else {
+            reparsed_function = parser.try_parse_arrow_function_expression(lazy_parse_data.arrow_function_has_parentheses, is_async);
+        }
+    }
+
+    // NOTE: All of the function's source was parsed without errors before, and skipping over nested function bodies does
+    //       not find any new ones.
+    if (!reparsed_function || parser.has_errors()) {
+        for (auto const& error : parser.errors())
+            dbgln("Error while re-parsing lazily parsed function: {}", error.to_string());
+        VERIFY_NOT_REACHED();
+    }
+
+    if (g_collect_lazy_function_parsing_statistics) {
+        auto& statistics = s_lazy_function_parsing_statistics;
+        auto ast_size = g_created_ast_node_size - start_ast_size;
+        auto time_spent = MonotonicTime::now() - *start_time;
+
+        ++statistics.reparsed_functions;
+        statistics.reparsed_source_length += lazy_parse_data.source_length;
+        statistics.reparsed_ast_size += ast_size;
+        statistics.time_spent_reparsing += time_spent;
+
+        // NOTE: What the re-parse did not create compared to the original parse is the AST of the skipped function bodies.
+        if (lazy_parse_data.ast_size > ast_size)
+            statistics.skipped_ast_size += lazy_parse_data.ast_size - ast_size;
+        if (lazy_parse_data.parse_time > time_spent)
+            statistics.time_saved_by_skipping += lazy_parse_data.parse_time - time_spent;
+    }
+
+    enclosing_scope.apply_resolution_of_free_identifiers(lazy_parse_data.free_identifiers);
+    function_node.set_lazily_parsed_body({}, reparsed_function->body_ptr(), reparsed_function->parameters(), reparsed_function->parsing_insights(), reparsed_function->local_variables_names());
+}
+
 }
@@ -11,6 +11,7 @@
 #include <AK/Assertions.h>
 #include <AK/HashTable.h>
 #include <AK/NonnullRefPtr.h>
+#include <AK/Time.h>
 #include <LibJS/AST.h>
 #include <LibJS/Export.h>
 #include <LibJS/Lexer.h>
@@ -198,6 +199,32 @@ public:
 
     static Parser parse_function_body_from_string(ByteString const& body_string, u16 parse_options, NonnullRefPtr<FunctionParameters const>, FunctionKind kind, FunctionParsingInsights&);
 
+    // When enabled, the bodies of sufficiently large functions nested inside other functions are discarded after being
+    // parsed (so that their early errors are still reported), and only parsed again when the function is first instantiated.
+    void enable_lazy_function_parsing() { m_lazy_function_parsing_enabled = true; }
+
+    static void parse_lazily_parsed_function(FunctionNode const&);
+
+    // These are only collected while g_collect_lazy_function_parsing_statistics is set. AST sizes are the bytes taken up by
+    // the AST nodes themselves, not counting the memory they own.
+    struct LazyFunctionParsingStatistics {
+        u64 lazily_parsed_functions { 0 };
+        u64 lazily_parsed_source_length { 0 };
+        u64 discarded_ast_size { 0 };
+        u64 reparsed_functions { 0 };
+        u64 reparsed_source_length { 0 };
+        u64 reparsed_ast_size { 0 };
+        AK::Duration time_spent_reparsing;
+
+        // Bodies of nested functions that were skipped over instead of being parsed while re-parsing their enclosing function,
+        // and what that saved compared to the original full parse of the enclosing function.
+        u64 skipped_functions { 0 };
+        u64 skipped_source_length { 0 };
+        u64 skipped_ast_size { 0 };
+        AK::Duration time_saved_by_skipping;
+    };
+    static LazyFunctionParsingStatistics const& lazy_function_parsing_statistics();
+
 private:
     friend class ScopePusher;
 
@@ -252,6 +279,12 @@ private:
 
     bool match_invalid_escaped_keyword() const;
 
+    static constexpr u32 MINIMUM_LAZY_FUNCTION_SOURCE_LENGTH = 128;
+    OwnPtr<LazyFunctionParseData> create_lazy_function_parse_data_if_eligible(Position const& function_start) const;
+    RefPtr<FunctionBody const> try_skip_lazily_parsed_function_body(LazyFunctionParseData&, NonnullRefPtr<FunctionParameters const>, FunctionKind);
+    void discard_function_body_if_lazily_parsed(FunctionNode&, OwnPtr<LazyFunctionParseData>, u32 source_length);
+    void check_parameters_of_function_body(FunctionParameters const&, FunctionKind, bool in_strict_mode);
+
     bool parse_directive(ScopeNode& body);
     void parse_statement_list(ScopeNode& output_node, AllowLabelledFunction allow_labelled_functions = AllowLabelledFunction::No);
 
@@ -286,7 +319,7 @@ private:
 
     [[nodiscard]] RulePosition push_start() { return { *this, position() }; }
 
-    struct ParserState {
+    struct ParserState : public ParserContextFlags {
         Lexer lexer;
         mutable Optional<Lexer> lookahead_lexer;
         Token current_token;
@@ -298,21 +331,6 @@ private:
         HashMap<size_t, Position> invalid_property_range_in_object_expression;
         HashTable<Utf16FlyString>* referenced_private_names { nullptr };
 
-        bool strict_mode { false };
-        bool allow_super_property_lookup { false };
-        bool allow_super_constructor_call { false };
-        bool in_function_context { false };
-        bool initiated_by_eval { false };
-        bool in_eval_function_context { false }; // This controls if we allow new.target or not. Note that eval("return") is not allowed, so we have to have a separate state variable for eval.
-        bool in_formal_parameter_context { false };
-        bool in_generator_function_context { false };
-        bool await_expression_is_valid { false };
-        bool in_arrow_function_context { false };
-        bool in_break_context { false };
-        bool in_continue_context { false };
-        bool string_legacy_octal_escape_sequence_in_scope { false };
-        bool in_class_field_initializer { false };
-        bool in_class_static_init_block { false };
         bool function_might_need_arguments_object { false };
 
         ParserState(Lexer, Program::Type);
@@ -326,6 +344,11 @@ private:
     Vector<ParserState> m_saved_state;
     HashMap<size_t, TokenMemoization> m_token_memoizations;
     Program::Type m_program_type;
+    bool m_lazy_function_parsing_enabled { false };
+
+    // Only set while re-parsing a lazily parsed function. All of its source was already validated by the original parse,
+    // so the bodies of functions nested in it may be skipped over instead of being parsed.
+    bool m_function_bodies_were_validated { false };
 };
 
 }
@@ -346,6 +346,7 @@ ThrowCompletionOr<bool> Array::internal_set(PropertyKey const& property_key, Val
                 attributes.set_enumerable(true);
                 attributes.set_configurable(true);
                 indexed_properties().put(index, value, attributes);
+                write_barrier();
                 return true;
             }
             if (property_descriptor->is_data_descriptor()) {
@@ -353,6 +354,7 @@ ThrowCompletionOr<bool> Array::internal_set(PropertyKey const& property_key, Val
                     return false;
                 auto attributes = property_descriptor->attributes();
                 indexed_properties().put(index, value, attributes);
+                write_barrier();
                 return true;
             }
         } else if (property_key == vm.names.length) {
@@ -404,6 +406,7 @@ ThrowCompletionOr<bool> Array::internal_define_own_property(PropertyKey const& p
             }
 
             storage->put(property_key.as_number(), property_descriptor.value.value());
+            write_barrier();
         } else {
             succeeded = MUST(Object::internal_define_own_property(property_key, property_descriptor, precomputed_get_own_property));
         }
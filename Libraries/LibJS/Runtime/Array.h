@@ -23,6 +23,7 @@ namespace JS {
 class JS_API Array : public Object {
     JS_OBJECT(Array, Object);
     GC_DECLARE_ALLOCATOR(Array);
+    GC_DECLARE_WRITE_BARRIERS(Array);
 
 public:
     static ThrowCompletionOr<GC::Ref<Array>> create(Realm&, u64 length, Object* prototype = nullptr);
@@ -9,6 +9,7 @@
 
 #include <AK/Function.h>
 #include <AK/HashTable.h>
+#include <AK/QuickSort.h>
 #include <AK/ScopeGuard.h>
 #include <AK/StringBuilder.h>
 #include <LibJS/Runtime/AbstractOperations.h>
@@ -147,6 +148,59 @@ static ThrowCompletionOr<Object*> array_species_create(VM& vm, Object& original_
     return TRY(construct(vm, constructor.as_function(), Value(length))).ptr();
 }
 
+// OPTIMIZATION: The elements of an Array that:
+// - is not a proxy target, which means get/has will not trap.
+// - has intact prototype chain, which means holes don't have to be looked up on the prototypes.
+// - has simple storage type, which means all elements are data properties with default attributes.
+// can be read from its indexed storage directly, with the same result as going through HasProperty and Get.
+static SimpleIndexedPropertyStorage const* directly_readable_elements(Object& object)
+{
+    auto* array = as_if<Array>(object);
+    if (!array || array->is_proxy_target() || !array->default_prototype_chain_intact())
+        return nullptr;
+    auto const* storage = array->indexed_properties().storage();
+    if (!storage || !storage->is_simple_storage())
+        return nullptr;
+    return static_cast<SimpleIndexedPropertyStorage const*>(storage);
+}
+
+// Performs HasProperty(O, Pk), followed by Get(O, Pk) if the property is present.
+static ThrowCompletionOr<Optional<Value>> get_element_if_present(Object& object, size_t index)
+{
+    if (auto const* elements = directly_readable_elements(object)) {
+        if (index >= elements->array_like_size())
+            return Optional<Value> {};
+        auto element = elements->inline_get(index);
+        if (!element.has_value())
+            return Optional<Value> {};
+        return element->value;
+    }
+
+    if (!TRY(object.has_property(index)))
+        return Optional<Value> {};
+    return TRY(object.get(index));
+}
+
+// Performs CreateDataPropertyOrThrow(O, Pk, value).
+static ThrowCompletionOr<void> create_data_element_or_throw(Object& object, size_t index, Value value)
+{
+    // OPTIMIZATION: An element can be put into the indexed storage of an Array directly, if it
+    // - is not a proxy target, which means define will not trap.
+    // - has simple storage type, which means an existing element at that index is configurable and can be replaced.
+    // - is extensible and has a writable length, which means a new element can always be added.
+    if (auto* array = as_if<Array>(object); array && !array->is_proxy_target() && array->length_is_writable() && index < NumericLimits<u32>::max()) {
+        auto const* storage = array->indexed_properties().storage();
+        if (storage && storage->is_simple_storage() && TRY(array->is_extensible())) {
+            array->indexed_properties().put(index, value);
+            array->write_barrier();
+            return {};
+        }
+    }
+
+    TRY(object.create_data_property_or_throw(index, value));
+    return {};
+}
+
 // 23.1.3.1 Array.prototype.at ( index ), https://tc39.es/ecma262/#sec-array.prototype.at
 JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::at)
 {
@@ -700,18 +754,14 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::for_each)
     // 5. Repeat, while k < len,
     for (size_t k = 0; k < length; ++k) {
         // a. Let Pk be ! ToString(𝔽(k)).
-        auto property_key = PropertyKey { k };
-
         // b. Let kPresent be ? HasProperty(O, Pk).
-        auto k_present = TRY(object->has_property(property_key));
-
         // c. If kPresent is true, then
-        if (k_present) {
-            // i. Let kValue be ? Get(O, Pk).
-            auto k_value = TRY(object->get(property_key));
-
+        //    i. Let kValue be ? Get(O, Pk).
+        // NOTE: The callback may change the array, so this looks at its storage again for every element.
+        auto k_value = TRY(get_element_if_present(object, k));
+        if (k_value.has_value()) {
             // ii. Perform ? Call(callbackfn, thisArg, « kValue, 𝔽(k), O »).
-            TRY(call(vm, callback_function.as_function(), this_arg, k_value, Value(k), object));
+            TRY(call(vm, callback_function.as_function(), this_arg, *k_value, Value(k), object));
         }
 
         // d. Set k to k + 1.
@@ -744,6 +794,28 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::includes)
             from_index = from_argument;
     }
     auto value_to_find = vm.argument(0);
+
+    // OPTIMIZATION: Nothing observable happens while looking for the element, so the elements of an Array whose storage
+    //               can be read directly are compared in place. Holes are read as undefined.
+    if (auto const* elements = directly_readable_elements(this_object)) {
+        auto end = min(length, elements->array_like_size());
+        auto const& values = elements->elements();
+        if (elements->has_only_numbers() && value_to_find.is_number() && !value_to_find.is_nan()) {
+            auto number_to_find = value_to_find.as_double();
+            for (auto i = from_index; i < end; ++i) {
+                if (!values[i].is_special_empty_value() && values[i].as_double() == number_to_find)
+                    return Value(true);
+            }
+            return Value(false);
+        }
+        for (auto i = from_index; i < end; ++i) {
+            auto element = values[i].is_special_empty_value() ? js_undefined() : values[i];
+            if (same_value_zero(element, value_to_find))
+                return Value(true);
+        }
+        return Value(false);
+    }
+
     for (u64 i = from_index; i < length; ++i) {
         auto element = TRY(this_object->get(i));
         if (same_value_zero(element, value_to_find))
@@ -797,6 +869,27 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::index_of)
         k = max(length + n, 0);
     }
 
+    // OPTIMIZATION: Nothing observable happens while looking for the element, so the elements of an Array whose storage
+    //               can be read directly are compared in place. If they are all numbers, they are compared as doubles,
+    //               and nothing else can be strictly equal to any of them.
+    if (auto const* elements = directly_readable_elements(object)) {
+        auto end = min(length, elements->array_like_size());
+        auto const& values = elements->elements();
+        if (!elements->has_only_numbers()) {
+            for (; k < end; ++k) {
+                if (!values[k].is_special_empty_value() && is_strictly_equal(search_element, values[k]))
+                    return Value(k);
+            }
+        } else if (search_element.is_number()) {
+            auto search_number = search_element.as_double();
+            for (; k < end; ++k) {
+                if (!values[k].is_special_empty_value() && values[k].as_double() == search_number)
+                    return Value(k);
+            }
+        }
+        return Value(-1);
+    }
+
     // 10. Repeat, while k < len,
     for (; k < length; ++k) {
         auto property_key = PropertyKey { k };
@@ -958,21 +1051,17 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::map)
     // 6. Repeat, while k < len,
     for (size_t k = 0; k < length; ++k) {
         // a. Let Pk be ! ToString(𝔽(k)).
-        auto property_key = PropertyKey { k };
-
         // b. Let kPresent be ? HasProperty(O, Pk).
-        auto k_present = TRY(object->has_property(property_key));
-
         // c. If kPresent is true, then
-        if (k_present) {
-            // i. Let kValue be ? Get(O, Pk).
-            auto k_value = TRY(object->get(property_key));
-
+        //    i. Let kValue be ? Get(O, Pk).
+        // NOTE: The callback may change either array, so this looks at their storage again for every element.
+        auto k_value = TRY(get_element_if_present(object, k));
+        if (k_value.has_value()) {
             // ii. Let mappedValue be ? Call(callbackfn, thisArg, « kValue, 𝔽(k), O »).
-            auto mapped_value = TRY(call(vm, callback_function.as_function(), this_arg, k_value, Value(k), object));
+            auto mapped_value = TRY(call(vm, callback_function.as_function(), this_arg, *k_value, Value(k), object));
 
             // iii. Perform ? CreateDataPropertyOrThrow(A, Pk, mappedValue).
-            TRY(array->create_data_property_or_throw(property_key, mapped_value));
+            TRY(create_data_element_or_throw(*array, k, mapped_value));
         }
 
         // d. Set k to k + 1.
@@ -1007,6 +1096,23 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::push)
     auto new_length = length + argument_count;
     if (new_length > MAX_ARRAY_LIKE_INDEX)
         return vm.throw_completion<TypeError>(ErrorType::ArrayMaxSize);
+
+    // OPTIMIZATION: If this object is Array that:
+    // - is not a proxy target, which means set will not trap.
+    // - has intact prototype chain, which means there are no setters for the new indices on its prototypes.
+    // - is extensible and has a writable length, which means none of the sets can fail.
+    // - has simple storage type (or no storage yet), which means the items can be appended to it.
+    // then we could take a fast path by directly appending the items to indexed storage.
+    if (auto* array = as_if<Array>(*this_object); array && !array->is_proxy_target() && array->default_prototype_chain_intact() && array->length_is_writable() && TRY(array->is_extensible())) {
+        auto& indexed_properties = array->indexed_properties();
+        if (!indexed_properties.storage() || indexed_properties.storage()->is_simple_storage()) {
+            for (size_t i = 0; i < argument_count; ++i)
+                indexed_properties.append(vm.argument(i));
+            array->write_barrier();
+            return Value(new_length);
+        }
+    }
+
     for (size_t i = 0; i < argument_count; ++i)
         TRY(this_object->set(length + i, vm.argument(i), Object::ShouldThrowExceptions::Yes));
     auto new_length_value = Value(new_length);
@@ -1410,6 +1516,57 @@ ThrowCompletionOr<void> array_merge_sort(VM& vm, Function<ThrowCompletionOr<doub
     return {};
 }
 
+// Sorts the int32 elements of an Array the same way as SortIndexedProperties with skip-holes and CompareArrayElements
+// without a comparator would, by comparing their decimal representations, but without creating any strings.
+static void sort_int32_elements_as_strings(Array& array)
+{
+    struct Element {
+        i32 value;
+        u8 length;
+        char digits[11];
+
+        StringView string() const { return { digits, length }; }
+    };
+
+    auto& indexed_properties = array.indexed_properties();
+    auto const& storage = static_cast<SimpleIndexedPropertyStorage const&>(*indexed_properties.storage());
+    VERIFY(storage.element_kind() == SimpleIndexedPropertyStorage::ElementKind::Int32);
+    auto array_size = storage.array_like_size();
+
+    Vector<Element> sorted_elements;
+    sorted_elements.ensure_capacity(array_size);
+    for (size_t i = 0; i < array_size; ++i) {
+        auto value = storage.elements()[i];
+        if (value.is_special_empty_value())
+            continue;
+
+        Element element { .value = value.as_i32(), .length = 0, .digits = {} };
+        char reversed_digits[10];
+        size_t digit_count = 0;
+        auto magnitude = element.value < 0 ? 0u - static_cast<u32>(element.value) : static_cast<u32>(element.value);
+        do {
+            reversed_digits[digit_count++] = static_cast<char>('0' + magnitude % 10);
+            magnitude /= 10;
+        } while (magnitude != 0);
+        if (element.value < 0)
+            element.digits[element.length++] = '-';
+        while (digit_count > 0)
+            element.digits[element.length++] = reversed_digits[--digit_count];
+        sorted_elements.unchecked_append(element);
+    }
+
+    // NOTE: Elements with the same string representation have the same value, so the sort doesn't have to be stable.
+    quick_sort(sorted_elements, [](Element const& a, Element const& b) { return a.string() < b.string(); });
+
+    size_t j = 0;
+    for (; j < sorted_elements.size(); ++j)
+        indexed_properties.put(j, Value(sorted_elements[j].value));
+    for (; j < array_size; ++j) {
+        if (indexed_properties.has_index(j))
+            indexed_properties.remove(j);
+    }
+}
+
 // 23.1.3.30 Array.prototype.sort ( comparefn ), https://tc39.es/ecma262/#sec-array.prototype.sort
 JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::sort)
 {
@@ -1430,6 +1587,16 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::sort)
         return TRY(compare_array_elements(vm, x, y, comparefn.is_undefined() ? nullptr : &comparefn.as_function()));
     };
 
+    // OPTIMIZATION: Without a comparator, sorting an Array whose storage can be read directly and only holds int32
+    //               elements doesn't run any user code, so it can be done in place. The Array also has to be extensible,
+    //               so that holes can be filled.
+    if (comparefn.is_undefined()) {
+        if (auto const* elements = directly_readable_elements(object); elements && elements->element_kind() == SimpleIndexedPropertyStorage::ElementKind::Int32 && TRY(object->is_extensible())) {
+            sort_int32_elements_as_strings(static_cast<Array&>(*object));
+            return object;
+        }
+    }
+
     // 5. Let sortedList be ? SortIndexedProperties(obj, len, SortCompare, skip-holes).
     auto sorted_list = TRY(sort_indexed_properties(vm, object, length, sort_compare, Holes::SkipHoles));
 
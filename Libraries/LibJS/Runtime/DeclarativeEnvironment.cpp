@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Atomic.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/DeclarativeEnvironment.h>
 #include <LibJS/Runtime/Error.h>
@@ -15,6 +16,16 @@ namespace JS {
 
 GC_DEFINE_ALLOCATOR(DeclarativeEnvironment);
 
+// NOTE: Serial numbers are unique across all environments, rather than per environment. Executables (and thus their
+//       global variable caches) may be shared between realms through the code cache, so a cache populated against one
+//       realm's global environment must never appear valid for another realm's.
+static Atomic<u64> s_next_environment_serial_number { 1 };
+
+static u64 next_environment_serial_number()
+{
+    return s_next_environment_serial_number.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+}
+
 DeclarativeEnvironment* DeclarativeEnvironment::create_for_per_iteration_bindings(Badge<ForStatement>, DeclarativeEnvironment& other, size_t bindings_size)
 {
     auto bindings = other.m_bindings.span().slice(0, bindings_size);
@@ -79,7 +90,7 @@ ThrowCompletionOr<void> DeclarativeEnvironment::create_mutable_binding(VM&, Utf1
         .initialized = false,
     });
 
-    ++m_environment_serial_number;
+    m_environment_serial_number = next_environment_serial_number();
 
     // 3. Return unused.
     return {};
@@ -102,7 +113,7 @@ ThrowCompletionOr<void> DeclarativeEnvironment::create_immutable_binding(VM&, Ut
         .initialized = false,
     });
 
-    ++m_environment_serial_number;
+    m_environment_serial_number = next_environment_serial_number();
 
     // 3. Return unused.
     return {};
@@ -212,7 +223,7 @@ ThrowCompletionOr<bool> DeclarativeEnvironment::delete_binding(VM&, Utf16FlyStri
     // NOTE: We keep the entries in m_bindings to avoid disturbing indices.
     binding_and_index->binding() = {};
 
-    ++m_environment_serial_number;
+    m_environment_serial_number = next_environment_serial_number();
 
     // 4. Return true.
     return true;
@@ -13,6 +13,7 @@
 #include <LibJS/Bytecode/BasicBlock.h>
 #include <LibJS/Bytecode/Generator.h>
 #include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Parser.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/AsyncFunctionDriverWrapper.h>
@@ -122,6 +123,9 @@ GC::Ref<ECMAScriptFunctionObject> ECMAScriptFunctionObject::create_from_function
     RefPtr<SharedFunctionInstanceData> shared_data = function_node.shared_data();
 
     if (!shared_data) {
+        if (function_node.is_lazily_parsed())
+            Parser::parse_lazily_parsed_function(function_node);
+
         shared_data = adopt_ref(*new SharedFunctionInstanceData(realm->vm(),
             function_node.kind(),
             move(name),
@@ -491,9 +495,9 @@ ThrowCompletionOr<void> ECMAScriptFunctionObject::get_stack_frame_size(size_t& r
     if (!m_bytecode_executable) {
         if (!ecmascript_code().bytecode_executable()) {
             if (is_module_wrapper()) {
-                const_cast<Statement&>(ecmascript_code()).set_bytecode_executable(TRY(Bytecode::compile(vm(), ecmascript_code(), kind(), name())));
+                ecmascript_code().set_bytecode_executable(TRY(Bytecode::compile(vm(), ecmascript_code(), kind(), name())));
             } else {
-                const_cast<Statement&>(ecmascript_code()).set_bytecode_executable(TRY(Bytecode::compile(vm(), *this)));
+                ecmascript_code().set_bytecode_executable(TRY(Bytecode::compile(vm(), *this)));
             }
         }
         m_bytecode_executable = ecmascript_code().bytecode_executable();
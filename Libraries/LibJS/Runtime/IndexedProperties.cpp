@@ -17,6 +17,11 @@ SimpleIndexedPropertyStorage::SimpleIndexedPropertyStorage(Vector<Value>&& initi
     : IndexedPropertyStorage(IsSimpleStorage::Yes, initial_values.size())
     , m_packed_elements(move(initial_values))
 {
+    for (auto value : m_packed_elements) {
+        update_element_kind(value);
+        if (value.is_special_empty_value())
+            ++m_number_of_empty_elements;
+    }
 }
 
 bool SimpleIndexedPropertyStorage::has_index(u32 index) const
@@ -59,6 +64,7 @@ void SimpleIndexedPropertyStorage::put(u32 index, Value value, PropertyAttribute
     if (value.is_special_empty_value()) {
         ++m_number_of_empty_elements;
     }
+    update_element_kind(value);
 }
 
 void SimpleIndexedPropertyStorage::remove(u32 index)
@@ -96,6 +102,8 @@ bool SimpleIndexedPropertyStorage::set_array_like_size(size_t new_size)
     auto old_size = m_array_size;
     m_array_size = new_size;
     m_packed_elements.resize_with_default_value_and_keep_capacity(new_size, js_special_empty_value());
+    if (new_size == 0)
+        m_element_kind = ElementKind::Int32;
 
     if (old_size <= m_array_size) {
         m_number_of_empty_elements += m_array_size - old_size;
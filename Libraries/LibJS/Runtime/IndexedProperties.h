@@ -62,6 +62,14 @@ private:
 
 class SimpleIndexedPropertyStorage final : public IndexedPropertyStorage {
 public:
+    // The most specific kind that every element of the storage (ignoring holes) has. Elements only ever move towards
+    // more generic kinds, until the storage is emptied. Storages of numbers don't hold any GC pointers.
+    enum class ElementKind : u8 {
+        Int32,
+        Double,
+        Generic,
+    };
+
     SimpleIndexedPropertyStorage()
         : IndexedPropertyStorage(IsSimpleStorage::Yes)
     {
@@ -95,13 +103,24 @@ public:
 
     bool has_empty_elements() const { return m_number_of_empty_elements.value() > 0; }
 
+    ElementKind element_kind() const { return m_element_kind; }
+    bool has_only_numbers() const { return m_element_kind != ElementKind::Generic; }
+
 private:
     friend GenericIndexedPropertyStorage;
 
     void grow_storage_if_needed();
 
+    void update_element_kind(Value value)
+    {
+        if (m_element_kind == ElementKind::Generic || value.is_int32() || value.is_special_empty_value())
+            return;
+        m_element_kind = value.is_number() ? ElementKind::Double : ElementKind::Generic;
+    }
+
     Checked<size_t> m_number_of_empty_elements { 0 };
     Vector<Value> m_packed_elements;
+    ElementKind m_element_kind { ElementKind::Int32 };
 };
 
 class GenericIndexedPropertyStorage final : public IndexedPropertyStorage {
@@ -180,6 +199,11 @@ public:
 
     size_t real_size() const;
 
+    bool has_only_numbers() const
+    {
+        return !m_storage || (m_storage->is_simple_storage() && static_cast<SimpleIndexedPropertyStorage const&>(*m_storage).has_only_numbers());
+    }
+
     Vector<u32> indices() const;
 
     template<typename Callback>
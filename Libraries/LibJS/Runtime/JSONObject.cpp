@@ -4,9 +4,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AllOf.h>
 #include <AK/Function.h>
-#include <AK/JsonArray.h>
-#include <AK/JsonObject.h>
 #include <AK/JsonParser.h>
 #include <AK/StringBuilder.h>
 #include <AK/TypeCasts.h>
@@ -20,6 +19,7 @@
 #include <LibJS/Runtime/FunctionObject.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/JSONObject.h>
+#include <LibJS/Runtime/JSONParser.h>
 #include <LibJS/Runtime/NumberObject.h>
 #include <LibJS/Runtime/Object.h>
 #include <LibJS/Runtime/RawJSONObject.h>
@@ -108,6 +108,14 @@ ThrowCompletionOr<Optional<String>> JSONObject::stringify_impl(VM& vm, Value val
         state.gap = String {};
     }
 
+    if (!state.replacer_function && !state.property_list.has_value() && can_serialize_json_fast(realm)) {
+        StringBuilder builder;
+        if (serialize_json_value_fast(vm, state, builder, value))
+            return builder.to_string_without_validation();
+        state.seen_objects.clear();
+        state.indent = {};
+    }
+
     auto wrapper = Object::create(realm, realm.intrinsics().object_prototype());
     MUST(wrapper->create_data_property_or_throw(Utf16String {}, value));
     return serialize_json_property(vm, state, Utf16String {}, wrapper);
@@ -359,11 +367,200 @@ ThrowCompletionOr<String> JSONObject::serialize_json_array(VM& vm, StringifyStat
     return builder.to_string_without_validation();
 }
 
+// OPTIMIZATION: Plain data objects and arrays are serialized straight from their property storage into a single
+//               StringBuilder. This only works as long as serializing them can't run any user code, so the fast path
+//               gives up on anything that could (toJSON methods, getters, proxies, wrapper objects, ...), and the
+//               caller starts over on the generic path. Nothing observable has happened by then.
+bool JSONObject::can_serialize_json_fast(Realm& realm)
+{
+    auto& vm = realm.vm();
+    auto object_prototype = realm.intrinsics().object_prototype();
+    auto array_prototype = realm.intrinsics().array_prototype();
+    if (array_prototype->shape().prototype() != object_prototype.ptr())
+        return false;
+    return !object_prototype->shape().lookup(vm.names.toJSON).has_value()
+        && !array_prototype->shape().lookup(vm.names.toJSON).has_value();
+}
+
+static bool is_plain_data_object(Object const& object, Object const& prototype)
+{
+    return object.prototype() == &prototype
+        && object.eligible_for_own_property_enumeration_fast_path()
+        && !object.is_function()
+        && !object.has_parameter_map()
+        && !object.has_intrinsic_accessors()
+        && !object.is_global_object()
+        && !object.is_raw_json_object()
+        && !object.is_number_object()
+        && !object.is_string_object()
+        && !object.is_boolean_object()
+        && !object.is_bigint_object();
+}
+
+bool JSONObject::serialize_json_value_fast(VM& vm, StringifyState& state, StringBuilder& builder, Value value)
+{
+    if (value.is_null()) {
+        builder.append("null"sv);
+        return true;
+    }
+
+    if (value.is_boolean()) {
+        builder.append(value.as_bool() ? "true"sv : "false"sv);
+        return true;
+    }
+
+    if (value.is_string()) {
+        auto& string = value.as_string();
+
+        // OPTIMIZATION: UTF-8 strings without any characters that have to be escaped can be appended as they are.
+        if (string.has_utf8_string()) {
+            auto view = string.utf8_string_view();
+            if (all_of(view.bytes(), [](u8 byte) { return byte >= 0x20 && byte != '"' && byte != '\\'; })) {
+                builder.append('"');
+                builder.append(view);
+                builder.append('"');
+                return true;
+            }
+        }
+
+        append_quoted_json_string(builder, string.utf16_string_view());
+        return true;
+    }
+
+    if (value.is_number()) {
+        if (value.is_int32())
+            builder.appendff("{}", value.as_i32());
+        else if (value.is_finite_number())
+            builder.append(number_to_string(value.as_double()));
+        else
+            builder.append("null"sv);
+        return true;
+    }
+
+    // NOTE: BigInts may have a toJSON method on their prototype, and undefined and symbols are handled by the callers.
+    if (!value.is_object())
+        return false;
+
+    auto& object = value.as_object();
+    if (state.seen_objects.contains(&object))
+        return false;
+
+    auto& intrinsics = vm.current_realm()->intrinsics();
+    if (object.is_array_exotic_object()) {
+        if (!is_plain_data_object(object, *intrinsics.array_prototype()))
+            return false;
+        return serialize_json_array_fast(vm, state, builder, object);
+    }
+
+    if (!is_plain_data_object(object, *intrinsics.object_prototype()))
+        return false;
+    return serialize_json_object_fast(vm, state, builder, object);
+}
+
+bool JSONObject::serialize_json_object_fast(VM& vm, StringifyState& state, StringBuilder& builder, Object& object)
+{
+    // NOTE: Indexed properties come before the named ones, which is more trouble than it's worth here.
+    if (object.indexed_properties().real_size() != 0)
+        return false;
+
+    state.seen_objects.set(&object);
+    String previous_indent = state.indent;
+    if (!state.gap.is_empty())
+        state.indent = MUST(String::formatted("{}{}", state.indent, state.gap));
+
+    builder.append('{');
+    bool first = true;
+    for (auto const& [key, metadata] : object.shape().property_table()) {
+        if (key == vm.names.toJSON)
+            return false;
+        if (!key.is_string() || !metadata.attributes.is_enumerable())
+            continue;
+
+        auto value = object.get_direct(metadata.offset);
+        if (value.is_accessor())
+            return false;
+        if (value.is_undefined() || value.is_symbol())
+            continue;
+
+        if (!first)
+            builder.append(',');
+        first = false;
+        if (!state.gap.is_empty()) {
+            builder.append('\n');
+            builder.append(state.indent);
+        }
+
+        append_quoted_json_string(builder, key.as_string().view());
+        builder.append(state.gap.is_empty() ? ":"sv : ": "sv);
+        if (!serialize_json_value_fast(vm, state, builder, value))
+            return false;
+    }
+    if (!first && !state.gap.is_empty()) {
+        builder.append('\n');
+        builder.append(previous_indent);
+    }
+    builder.append('}');
+
+    state.seen_objects.remove(&object);
+    state.indent = previous_indent;
+    return true;
+}
+
+bool JSONObject::serialize_json_array_fast(VM& vm, StringifyState& state, StringBuilder& builder, Object& array)
+{
+    if (array.shape().lookup(vm.names.toJSON).has_value())
+        return false;
+
+    state.seen_objects.set(&array);
+    String previous_indent = state.indent;
+    if (!state.gap.is_empty())
+        state.indent = MUST(String::formatted("{}{}", state.indent, state.gap));
+
+    auto& indexed_properties = array.indexed_properties();
+    auto length = indexed_properties.array_like_size();
+
+    builder.append('[');
+    for (size_t i = 0; i < length; ++i) {
+        // NOTE: Holes would have to be looked up on the prototype chain.
+        auto element = indexed_properties.get(i);
+        if (!element.has_value() || element->value.is_accessor())
+            return false;
+
+        if (i != 0)
+            builder.append(',');
+        if (!state.gap.is_empty()) {
+            builder.append('\n');
+            builder.append(state.indent);
+        }
+
+        auto value = element->value;
+        if (value.is_undefined() || value.is_symbol())
+            builder.append("null"sv);
+        else if (!serialize_json_value_fast(vm, state, builder, value))
+            return false;
+    }
+    if (length != 0 && !state.gap.is_empty()) {
+        builder.append('\n');
+        builder.append(previous_indent);
+    }
+    builder.append(']');
+
+    state.seen_objects.remove(&array);
+    state.indent = previous_indent;
+    return true;
+}
+
 // 25.5.2.2 QuoteJSONString ( value ), https://tc39.es/ecma262/#sec-quotejsonstring
 String JSONObject::quote_json_string(Utf16View const& string)
 {
-    // 1. Let product be the String value consisting solely of the code unit 0x0022 (QUOTATION MARK).
     StringBuilder builder;
+    append_quoted_json_string(builder, string);
+    return builder.to_string_without_validation();
+}
+
+void JSONObject::append_quoted_json_string(StringBuilder& builder, Utf16View const& string)
+{
+    // 1. Let product be the String value consisting solely of the code unit 0x0022 (QUOTATION MARK).
     builder.append('"');
 
     // 2. For each code point C of StringToCodePoints(value), do
@@ -411,7 +608,6 @@ String JSONObject::quote_json_string(Utf16View const& string)
     builder.append('"');
 
     // 4. Return product.
-    return builder.to_string_without_validation();
 }
 
 // 25.5.1 JSON.parse ( text [ , reviver ] ), https://tc39.es/ecma262/#sec-json.parse
@@ -450,18 +646,14 @@ JS_DEFINE_NATIVE_FUNCTION(JSONObject::parse)
 // 25.5.1.1 ParseJSON ( text ), https://tc39.es/ecma262/#sec-ParseJSON
 ThrowCompletionOr<Value> JSONObject::parse_json(VM& vm, StringView text)
 {
-    auto json = JsonValue::from_string(text);
-
     // 1. If StringToCodePoints(text) is not a valid JSON text as specified in ECMA-404, throw a SyntaxError exception.
-    if (json.is_error())
-        return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
-
     // 2. Let scriptString be the string-concatenation of "(", text, and ");".
     // 3. Let script be ParseText(scriptString, Script).
     // 4. NOTE: The early error rules defined in 13.2.5.1 have special handling for the above invocation of ParseText.
     // 5. Assert: script is a Parse Node.
     // 6. Let result be ! Evaluation of script.
-    auto result = JSONObject::parse_json_value(vm, json.value());
+    // NOTE: The JS values are created as the text is parsed.
+    auto result = TRY(JSONParser::parse(vm, text));
 
     // 7. NOTE: The PropertyDefinitionEvaluation semantics defined in 13.2.5.5 have special handling for the above evaluation.
     // 8. Assert: result is either a String, a Number, a Boolean, an Object that is defined by either an ArrayLiteral or an ObjectLiteral, or null.
@@ -470,44 +662,6 @@ ThrowCompletionOr<Value> JSONObject::parse_json(VM& vm, StringView text)
     return result;
 }
 
-Value JSONObject::parse_json_value(VM& vm, JsonValue const& value)
-{
-    if (value.is_object())
-        return Value(parse_json_object(vm, value.as_object()));
-    if (value.is_array())
-        return Value(parse_json_array(vm, value.as_array()));
-    if (value.is_null())
-        return js_null();
-    if (auto double_value = value.get_double_with_precision_loss(); double_value.has_value())
-        return Value(double_value.value());
-    if (value.is_string())
-        return PrimitiveString::create(vm, value.as_string());
-    if (value.is_bool())
-        return Value(value.as_bool());
-    VERIFY_NOT_REACHED();
-}
-
-Object* JSONObject::parse_json_object(VM& vm, JsonObject const& json_object)
-{
-    auto& realm = *vm.current_realm();
-    auto object = Object::create(realm, realm.intrinsics().object_prototype());
-    json_object.for_each_member([&](auto& key, auto& value) {
-        object->define_direct_property(Utf16String::from_utf8(key), parse_json_value(vm, value), default_attributes);
-    });
-    return object;
-}
-
-Array* JSONObject::parse_json_array(VM& vm, JsonArray const& json_array)
-{
-    auto& realm = *vm.current_realm();
-    auto array = MUST(Array::create(realm, 0));
-    size_t index = 0;
-    json_array.for_each([&](auto& value) {
-        array->define_direct_property(index++, parse_json_value(vm, value), default_attributes);
-    });
-    return array;
-}
-
 // 25.5.1.1 InternalizeJSONProperty ( holder, name, reviver ), https://tc39.es/ecma262/#sec-internalizejsonproperty
 ThrowCompletionOr<Value> JSONObject::internalize_json_property(VM& vm, Object* holder, PropertyKey const& name, FunctionObject& reviver)
 {
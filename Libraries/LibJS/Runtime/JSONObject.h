@@ -24,7 +24,6 @@ public:
     static ThrowCompletionOr<Optional<String>> stringify_impl(VM&, Value value, Value replacer, Value space);
 
     static ThrowCompletionOr<Value> parse_json(VM&, StringView text);
-    static Value parse_json_value(VM&, JsonValue const&);
 
 private:
     explicit JSONObject(Realm&);
@@ -42,10 +41,15 @@ private:
     static ThrowCompletionOr<String> serialize_json_object(VM&, StringifyState&, Object&);
     static ThrowCompletionOr<String> serialize_json_array(VM&, StringifyState&, Object&);
     static String quote_json_string(Utf16View const&);
+    static void append_quoted_json_string(StringBuilder&, Utf16View const&);
+
+    // Stringify fast path for plain data objects and arrays
+    static bool can_serialize_json_fast(Realm&);
+    static bool serialize_json_value_fast(VM&, StringifyState&, StringBuilder&, Value);
+    static bool serialize_json_object_fast(VM&, StringifyState&, StringBuilder&, Object&);
+    static bool serialize_json_array_fast(VM&, StringifyState&, StringBuilder&, Object&);
 
     // Parse helpers
-    static Object* parse_json_object(VM&, JsonObject const&);
-    static Array* parse_json_array(VM&, JsonArray const&);
     static ThrowCompletionOr<Value> internalize_json_property(VM&, Object* holder, PropertyKey const& name, FunctionObject& reviver);
 
     JS_DECLARE_NATIVE_FUNCTION(stringify);
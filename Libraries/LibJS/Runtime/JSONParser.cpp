@@ -0,0 +1,345 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/CharacterTypes.h>
+#include <AK/StringBuilder.h>
+#include <AK/StringConversions.h>
+#include <LibJS/Runtime/Array.h>
+#include <LibJS/Runtime/Error.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/JSONParser.h>
+#include <LibJS/Runtime/PrimitiveString.h>
+#include <LibJS/Runtime/Realm.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Runtime/ValueInlines.h>
+
+namespace JS {
+
+static constexpr bool is_json_whitespace(char ch)
+{
+    return ch == '\t' || ch == '\n' || ch == '\r' || ch == ' ';
+}
+
+// NOTE: The lexer returns a 0 byte at the end of the input, which is a control character as well.
+static constexpr bool is_literal_string_character(char ch)
+{
+    return ch != '"' && ch != '\\' && !is_ascii_c0_control(ch);
+}
+
+ThrowCompletionOr<Value> JSONParser::parse(VM& vm, StringView text)
+{
+    JSONParser parser(vm, text);
+    return parser.parse_json();
+}
+
+JSONParser::JSONParser(VM& vm, StringView text)
+    : GenericLexer(text)
+    , m_vm(vm)
+    , m_realm(*vm.current_realm())
+    , m_shape_cache(vm.heap())
+{
+}
+
+Completion JSONParser::syntax_error() const
+{
+    return m_vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+}
+
+ThrowCompletionOr<Value> JSONParser::parse_json()
+{
+    auto value = TRY(parse_value());
+    ignore_while(is_json_whitespace);
+    if (!is_eof())
+        return syntax_error();
+    return value;
+}
+
+ThrowCompletionOr<Value> JSONParser::parse_value()
+{
+    ignore_while(is_json_whitespace);
+
+    switch (peek()) {
+    case '{':
+    case '[':
+        if (m_vm.did_reach_stack_space_limit())
+            return m_vm.throw_completion<InternalError>(ErrorType::CallStackSizeExceeded);
+        return peek() == '{' ? parse_object() : parse_array();
+    case '"':
+        return parse_string();
+    case '-':
+    case '0':
+    case '1':
+    case '2':
+    case '3':
+    case '4':
+    case '5':
+    case '6':
+    case '7':
+    case '8':
+    case '9':
+        return parse_number();
+    case 't':
+        if (consume_specific("true"sv))
+            return Value(true);
+        break;
+    case 'f':
+        if (consume_specific("false"sv))
+            return Value(false);
+        break;
+    case 'n':
+        if (consume_specific("null"sv))
+            return js_null();
+        break;
+    }
+
+    return syntax_error();
+}
+
+ThrowCompletionOr<Value> JSONParser::parse_object()
+{
+    ignore(); // '{'
+
+    // NOTE: The values are kept in a conservative vector, since the object they belong to is only created once all of
+    //       them have been parsed.
+    Vector<PropertyKey, 8> keys;
+    GC::ConservativeVector<Value> values { m_vm.heap() };
+
+    ignore_while(is_json_whitespace);
+    if (!consume_specific('}')) {
+        for (;;) {
+            ignore_while(is_json_whitespace);
+            if (peek() != '"')
+                return syntax_error();
+            keys.append(TRY(parse_property_key()));
+
+            ignore_while(is_json_whitespace);
+            if (!consume_specific(':'))
+                return syntax_error();
+            values.append(TRY(parse_value()));
+
+            ignore_while(is_json_whitespace);
+            if (consume_specific('}'))
+                break;
+            if (!consume_specific(','))
+                return syntax_error();
+        }
+    }
+
+    return create_object(keys, values);
+}
+
+ThrowCompletionOr<Value> JSONParser::parse_array()
+{
+    ignore(); // '['
+
+    GC::ConservativeVector<Value> elements { m_vm.heap() };
+
+    ignore_while(is_json_whitespace);
+    if (!consume_specific(']')) {
+        for (;;) {
+            elements.append(TRY(parse_value()));
+
+            ignore_while(is_json_whitespace);
+            if (consume_specific(']'))
+                break;
+            if (!consume_specific(','))
+                return syntax_error();
+        }
+    }
+
+    auto array = MUST(Array::create(m_realm, 0));
+    array->set_indexed_property_elements(move(static_cast<Vector<Value>&>(elements)));
+    return array;
+}
+
+ThrowCompletionOr<Value> JSONParser::parse_number()
+{
+    auto start = tell();
+    auto negative = consume_specific('-');
+
+    // NOTE: Leading zeros are not allowed, so a zero is the whole integer part. Anything that follows it is rejected
+    //       by the caller as an unexpected character.
+    if (!consume_specific('0')) {
+        if (!is_ascii_digit(peek()))
+            return syntax_error();
+        ignore_while(is_ascii_digit);
+    }
+    auto integer_digits = tell() - start - (negative ? 1 : 0);
+
+    auto is_integer = true;
+    if (consume_specific('.')) {
+        if (!is_ascii_digit(peek()))
+            return syntax_error();
+        ignore_while(is_ascii_digit);
+        is_integer = false;
+    }
+    if (consume_specific('e') || consume_specific('E')) {
+        if (!consume_specific('+'))
+            consume_specific('-');
+        if (!is_ascii_digit(peek()))
+            return syntax_error();
+        ignore_while(is_ascii_digit);
+        is_integer = false;
+    }
+
+    auto number_text = m_input.substring_view(start, tell() - start);
+
+    // OPTIMIZATION: Integers with up to 15 digits are exactly representable as doubles, so they don't need to go
+    //               through the floating point parser.
+    if (is_integer && integer_digits <= 15) {
+        u64 value = 0;
+        for (auto ch : number_text.substring_view(negative ? 1 : 0))
+            value = value * 10 + parse_ascii_digit(ch);
+        auto double_value = static_cast<double>(value);
+        return Value(negative ? -double_value : double_value);
+    }
+
+    auto result = parse_first_number<double>(number_text, TrimWhitespace::No);
+    if (!result.has_value() || result->characters_parsed != number_text.length())
+        return syntax_error();
+    return Value(result->value);
+}
+
+ThrowCompletionOr<Value> JSONParser::parse_string()
+{
+    auto string = TRY(consume_string());
+    return string.visit(
+        [&](StringView view) { return PrimitiveString::create(m_vm, view); },
+        [&](Utf16String const& unescaped) { return PrimitiveString::create(m_vm, unescaped); });
+}
+
+ThrowCompletionOr<PropertyKey> JSONParser::parse_property_key()
+{
+    auto string = TRY(consume_string());
+    return string.visit(
+        [&](StringView view) -> PropertyKey {
+            if (auto it = m_property_keys.find(view); it != m_property_keys.end())
+                return it->value;
+            PropertyKey key { Utf16String::from_utf8(view) };
+            m_property_keys.set(view, key);
+            return key;
+        },
+        [&](Utf16String const& unescaped) -> PropertyKey { return unescaped; });
+}
+
+ThrowCompletionOr<Variant<StringView, Utf16String>> JSONParser::consume_string()
+{
+    ignore(); // '"'
+
+    // OPTIMIZATION: Most strings don't contain any escape sequences, and can be referred to in the input directly.
+    auto start = tell();
+    ignore_while(is_literal_string_character);
+    if (peek() == '"') {
+        auto string = m_input.substring_view(start, tell() - start);
+        ignore();
+        return string;
+    }
+
+    StringBuilder builder(StringBuilder::Mode::UTF16);
+    builder.append(m_input.substring_view(start, tell() - start));
+
+    for (;;) {
+        if (consume_specific('"'))
+            return builder.to_utf16_string();
+        if (!consume_specific('\\') || is_eof())
+            return syntax_error();
+
+        switch (auto ch = consume()) {
+        case '"':
+        case '\\':
+        case '/':
+            builder.append(ch);
+            break;
+        case 'b':
+            builder.append('\b');
+            break;
+        case 'f':
+            builder.append('\f');
+            break;
+        case 'n':
+            builder.append('\n');
+            break;
+        case 'r':
+            builder.append('\r');
+            break;
+        case 't':
+            builder.append('\t');
+            break;
+        case 'u': {
+            auto code_point = decode_single_or_paired_surrogate();
+            if (code_point.is_error())
+                return syntax_error();
+
+            // NOTE: Unpaired surrogates are valid in JSON strings, and are kept as they are.
+            if (is_unicode_surrogate(code_point.value()))
+                builder.append_code_unit(static_cast<char16_t>(code_point.value()));
+            else
+                builder.append_code_point(code_point.value());
+            break;
+        }
+        default:
+            return syntax_error();
+        }
+
+        auto literal_start = tell();
+        ignore_while(is_literal_string_character);
+        builder.append(m_input.substring_view(literal_start, tell() - literal_start));
+    }
+}
+
+GC::Ref<Object> JSONParser::create_object(ReadonlySpan<PropertyKey> keys, ReadonlySpan<Value> values)
+{
+    if (auto shape = find_shape_for_keys(keys)) {
+        auto object = Object::create_with_premade_shape(*shape);
+        for (size_t i = 0; i < values.size(); ++i)
+            object->put_direct(i, values[i]);
+        return object;
+    }
+
+    auto object = Object::create(m_realm, m_realm.intrinsics().object_prototype());
+    for (size_t i = 0; i < keys.size(); ++i)
+        object->define_direct_property(keys[i], values[i], default_attributes);
+    remember_shape(object->shape(), keys.size());
+    return object;
+}
+
+GC::Ptr<Shape> JSONParser::find_shape_for_keys(ReadonlySpan<PropertyKey> keys) const
+{
+    if (keys.is_empty())
+        return nullptr;
+
+    for (auto shape : m_shape_cache) {
+        if (shape->property_count() != keys.size())
+            continue;
+
+        // NOTE: Distinct offsets imply distinct keys, so objects with duplicate keys never match.
+        auto matches = true;
+        for (size_t i = 0; i < keys.size() && matches; ++i) {
+            auto metadata = shape->lookup(keys[i]);
+            matches = metadata.has_value() && metadata->offset == i;
+        }
+        if (matches)
+            return shape;
+    }
+    return nullptr;
+}
+
+void JSONParser::remember_shape(Shape& shape, size_t key_count)
+{
+    // NOTE: Objects with duplicate or numeric keys end up with fewer named properties than they had keys. Dictionary
+    //       shapes are unique to their object, and can't be shared.
+    if (key_count == 0 || shape.property_count() != key_count || shape.is_dictionary())
+        return;
+
+    if (m_shape_cache.size() < shape_cache_size) {
+        m_shape_cache.append(&shape);
+        return;
+    }
+    m_shape_cache[m_next_shape_cache_slot] = &shape;
+    m_next_shape_cache_slot = (m_next_shape_cache_slot + 1) % shape_cache_size;
+}
+
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/GenericLexer.h>
+#include <AK/HashMap.h>
+#include <AK/Utf16String.h>
+#include <AK/Variant.h>
+#include <LibGC/ConservativeVector.h>
+#include <LibJS/Runtime/Completion.h>
+#include <LibJS/Runtime/PropertyKey.h>
+#include <LibJS/Runtime/Shape.h>
+#include <LibJS/Runtime/Value.h>
+
+namespace JS {
+
+// Parses JSON text straight into JS values, without going through an intermediate AK::JsonValue tree.
+class JSONParser : private GenericLexer {
+public:
+    static ThrowCompletionOr<Value> parse(VM&, StringView text);
+
+private:
+    JSONParser(VM&, StringView text);
+
+    ThrowCompletionOr<Value> parse_json();
+    ThrowCompletionOr<Value> parse_value();
+    ThrowCompletionOr<Value> parse_object();
+    ThrowCompletionOr<Value> parse_array();
+    ThrowCompletionOr<Value> parse_number();
+    ThrowCompletionOr<Value> parse_string();
+    ThrowCompletionOr<PropertyKey> parse_property_key();
+
+    // Strings without escape sequences are returned as a view into the input.
+    ThrowCompletionOr<Variant<StringView, Utf16String>> consume_string();
+
+    GC::Ref<Object> create_object(ReadonlySpan<PropertyKey>, ReadonlySpan<Value>);
+    GC::Ptr<Shape> find_shape_for_keys(ReadonlySpan<PropertyKey>) const;
+    void remember_shape(Shape&, size_t key_count);
+
+    Completion syntax_error() const;
+
+    VM& m_vm;
+    Realm& m_realm;
+
+    // Keys that appear in the input without escape sequences, so that repeated keys are only converted once.
+    HashMap<StringView, PropertyKey> m_property_keys;
+
+    // Shapes of recently created objects. Objects with the same keys in the same order are created with the cached
+    // shape directly, instead of transitioning from the empty shape one property at a time.
+    static constexpr size_t shape_cache_size = 8;
+    GC::ConservativeVector<GC::Ptr<Shape>> m_shape_cache;
+    size_t m_next_shape_cache_slot { 0 };
+};
+
+}
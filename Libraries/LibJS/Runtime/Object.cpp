@@ -105,6 +105,7 @@ void Object::unsafe_set_shape(Shape& shape)
 {
     m_shape = shape;
     m_storage.resize(shape.property_count());
+    write_barrier();
 }
 
 // 7.2 Testing and Comparison Operations, https://tc39.es/ecma262/#sec-testing-and-comparison-operations
@@ -564,6 +565,7 @@ ThrowCompletionOr<void> Object::private_field_add(PrivateName const& name, Value
 
     // 4. Append PrivateElement { [[Key]]: P, [[Kind]]: field, [[Value]]: value } to O.[[PrivateElements]].
     m_private_elements->empend(name, PrivateElement::Kind::Field, value);
+    write_barrier();
 
     // 5. Return unused.
     return {};
@@ -592,6 +594,7 @@ ThrowCompletionOr<void> Object::private_method_or_accessor_add(PrivateElement el
 
     // 5. Append method to O.[[PrivateElements]].
     m_private_elements->append(move(element));
+    write_barrier();
 
     // 6. Return unused.
     return {};
@@ -647,6 +650,7 @@ ThrowCompletionOr<void> Object::private_set(PrivateName const& name, Value value
     if (entry->kind == PrivateElement::Kind::Field) {
         // a. Set entry.[[Value]] to value.
         entry->value = value;
+        write_barrier();
         return {};
     }
     // 4. Else if entry.[[Kind]] is method, then
@@ -1227,8 +1231,10 @@ Optional<ValueAndAttributes> Object::storage_get(PropertyKey const& property_key
             return {};
 
         if (m_has_intrinsic_accessors) {
-            if (auto accessor = find_intrinsic_accessor(this, property_key); accessor.has_value())
+            if (auto accessor = find_intrinsic_accessor(this, property_key); accessor.has_value()) {
                 const_cast<Object&>(*this).m_storage[metadata->offset] = (*accessor)(shape().realm());
+                const_cast<Object&>(*this).write_barrier();
+            }
         }
 
         value = m_storage[metadata->offset];
@@ -1253,6 +1259,7 @@ Optional<u32> Object::storage_set(PropertyKey const& property_key, ValueAndAttri
     if (property_key.is_number()) {
         auto index = property_key.as_number();
         m_indexed_properties.put(index, value, attributes);
+        write_barrier();
         return {};
     }
 
@@ -1273,6 +1280,7 @@ Optional<u32> Object::storage_set(PropertyKey const& property_key, ValueAndAttri
         else
             set_shape(*m_shape->create_put_transition(property_key, attributes));
         m_storage.append(value);
+        write_barrier();
         return m_storage.size() - 1;
     }
 
@@ -1284,6 +1292,7 @@ Optional<u32> Object::storage_set(PropertyKey const& property_key, ValueAndAttri
     }
 
     m_storage[metadata->offset] = value;
+    write_barrier();
     return metadata->offset;
 }
 
@@ -1304,6 +1313,7 @@ void Object::storage_delete(PropertyKey const& property_key)
 
     if (m_shape->is_cacheable_dictionary()) {
         m_shape = m_shape->create_uncacheable_dictionary_transition();
+        write_barrier();
     }
     if (m_shape->is_uncacheable_dictionary()) {
         m_shape->remove_property_without_transition(property_key, metadata->offset);
@@ -1312,6 +1322,7 @@ void Object::storage_delete(PropertyKey const& property_key)
     }
     m_shape = m_shape->create_delete_transition(property_key);
     m_storage.remove(metadata->offset);
+    write_barrier();
 }
 
 void Object::set_prototype(Object* new_prototype)
@@ -1319,6 +1330,7 @@ void Object::set_prototype(Object* new_prototype)
     if (prototype() == new_prototype)
         return;
     m_shape = shape().create_prototype_transition(new_prototype);
+    write_barrier();
 }
 
 void Object::define_native_accessor(Realm& realm, PropertyKey const& property_key, Function<ThrowCompletionOr<Value>(VM&)> getter, Function<ThrowCompletionOr<Value>(VM&)> setter, PropertyAttributes attribute)
@@ -1519,9 +1531,12 @@ void Object::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_shape);
     visitor.visit(m_storage);
 
-    m_indexed_properties.for_each_value([&visitor](auto& value) {
-        visitor.visit(value);
-    });
+    // OPTIMIZATION: Elements that are all numbers don't have to be visited.
+    if (!m_indexed_properties.has_only_numbers()) {
+        m_indexed_properties.for_each_value([&visitor](auto& value) {
+            visitor.visit(value);
+        });
+    }
 
     if (m_private_elements) {
         for (auto& private_element : *m_private_elements)
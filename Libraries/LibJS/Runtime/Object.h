@@ -67,6 +67,7 @@ struct CacheableSetPropertyMetadata {
 class JS_API Object : public Cell {
     GC_CELL(Object, Cell);
     GC_DECLARE_ALLOCATOR(Object);
+    GC_DECLARE_WRITE_BARRIERS(Object);
 
 public:
     static GC::Ref<Object> create_prototype(Realm&, Object* prototype);
@@ -246,14 +247,28 @@ public:
     bool has_parameter_map() const { return m_has_parameter_map; }
     void set_has_parameter_map() { m_has_parameter_map = true; }
 
+    bool has_intrinsic_accessors() const { return m_has_intrinsic_accessors; }
+
     virtual void visit_edges(Cell::Visitor&) override;
 
     Value get_direct(size_t index) const { return m_storage[index]; }
-    void put_direct(size_t index, Value value) { m_storage[index] = value; }
+    void put_direct(size_t index, Value value)
+    {
+        m_storage[index] = value;
+        write_barrier();
+    }
+
+    // Used by the JIT to access the shape and the property storage of objects from generated code.
+    [[nodiscard]] static constexpr size_t offset_of_shape() { return offsetof(Object, m_shape); }
+    [[nodiscard]] static constexpr size_t offset_of_storage_data() { return offsetof(Object, m_storage) + Vector<Value>::offset_of_outline_buffer(); }
 
     IndexedProperties const& indexed_properties() const { return m_indexed_properties; }
     IndexedProperties& indexed_properties() { return m_indexed_properties; }
-    void set_indexed_property_elements(Vector<Value>&& values) { m_indexed_properties = IndexedProperties(move(values)); }
+    void set_indexed_property_elements(Vector<Value>&& values)
+    {
+        m_indexed_properties = IndexedProperties(move(values));
+        write_barrier();
+    }
 
     Shape& shape() { return *m_shape; }
     Shape const& shape() const { return *m_shape; }
@@ -295,7 +310,11 @@ protected:
     bool m_is_typed_array { false };
 
 private:
-    void set_shape(Shape& shape) { m_shape = &shape; }
+    void set_shape(Shape& shape)
+    {
+        m_shape = &shape;
+        write_barrier();
+    }
 
     Object* prototype() { return shape().prototype(); }
 
@@ -110,7 +110,20 @@ GC::Ref<PrimitiveString> PrimitiveString::create(VM& vm, PrimitiveString& lhs, P
     if (rhs_empty)
         return lhs;
 
-    return vm.heap().allocate<RopeString>(lhs, rhs);
+    if (auto const* lhs_rope = as_if<RopeString>(lhs)) {
+        if (auto result = lhs_rope->try_append(vm, rhs))
+            return *result;
+    }
+
+    if (max(lhs.rope_depth(), rhs.rope_depth()) >= RopeString::max_depth) {
+        if (lhs.rope_depth() >= rhs.rope_depth())
+            lhs.resolve_rope_if_needed(EncodingPreference::UTF8);
+        else
+            rhs.resolve_rope_if_needed(EncodingPreference::UTF8);
+    }
+
+    auto depth = max(lhs.rope_depth(), rhs.rope_depth()) + 1;
+    return vm.heap().allocate<RopeString>(lhs, rhs, depth);
 }
 
 PrimitiveString::PrimitiveString(Utf16String string)
@@ -185,6 +198,11 @@ Utf16View PrimitiveString::utf16_string_view() const
 
 size_t PrimitiveString::length_in_utf16_code_units() const
 {
+    // OPTIMIZATION: Strings in an append buffer know their length without being flattened.
+    if (m_is_rope) {
+        if (auto const& rope_string = static_cast<RopeString const&>(*this); rope_string.m_append_buffer)
+            return rope_string.m_append_buffer_length;
+    }
     return utf16_string_view().length_in_code_units();
 }
 
@@ -230,14 +248,53 @@ void PrimitiveString::resolve_rope_if_needed(EncodingPreference preference) cons
     rope_string.resolve(preference);
 }
 
+u32 PrimitiveString::rope_depth() const
+{
+    if (!m_is_rope)
+        return 0;
+    return static_cast<RopeString const&>(*this).m_depth;
+}
+
+GC::Ptr<RopeString> RopeString::try_append(VM& vm, PrimitiveString const& rhs) const
+{
+    if (!m_append_buffer) {
+        if (!m_is_rope || m_depth < append_buffer_depth_threshold)
+            return nullptr;
+
+        // NOTE: This rope has to be flattened into the buffer once. It keeps the flattened string as well, since
+        //       it's likely to be read at some point anyway.
+        resolve(EncodingPreference::UTF16);
+        m_append_buffer = adopt_ref(*new AppendBuffer);
+        m_append_buffer->builder.append(*m_utf16_string);
+        m_append_buffer_length = m_utf16_string->length_in_code_units();
+    }
+
+    auto& builder = m_append_buffer->builder;
+    if (builder.utf16_string_view().length_in_code_units() != m_append_buffer_length)
+        return nullptr;
+
+    if (rhs.m_is_rope || rhs.has_utf16_string())
+        builder.append(rhs.utf16_string_view());
+    else
+        builder.append(rhs.utf8_string_view());
+
+    return vm.heap().allocate<RopeString>(*m_append_buffer, builder.utf16_string_view().length_in_code_units());
+}
+
 void RopeString::resolve(EncodingPreference preference) const
 {
+    if (m_append_buffer) {
+        // NOTE: The buffer is kept around after this, so that appending to this string can continue in it.
+        m_utf16_string = Utf16String::from_utf16(m_append_buffer->builder.utf16_string_view().substring_view(0, m_append_buffer_length));
+        m_is_rope = false;
+        return;
+    }
 
     // This vector will hold all the pieces of the rope that need to be assembled
     // into the resolved string.
     Vector<PrimitiveString const*, 2> pieces;
     size_t approximate_length = 0;
-    size_t length_in_utf16_code_units = 0;
+    size_t approximate_length_in_utf16_code_units = 0;
 
     // NOTE: We traverse the rope tree without using recursion, since we'd run out of
     //       stack space quickly when handling a long sequence of unresolved concatenations.
@@ -248,22 +305,34 @@ void RopeString::resolve(EncodingPreference preference) const
         auto const* current = stack.take_last();
         if (current->m_is_rope) {
             auto& current_rope_string = static_cast<RopeString const&>(*current);
-            stack.append(current_rope_string.m_rhs);
-            stack.append(current_rope_string.m_lhs);
-            continue;
+            // NOTE: A string that was appended to in a shared buffer has no children, and is a piece of its own.
+            if (current_rope_string.m_append_buffer) {
+                current_rope_string.resolve(EncodingPreference::UTF16);
+            } else {
+                stack.append(current_rope_string.m_rhs);
+                stack.append(current_rope_string.m_lhs);
+                continue;
+            }
         }
 
-        if (current->has_utf8_string())
-            approximate_length += current->utf8_string_view().length();
-        if (preference == EncodingPreference::UTF16)
-            length_in_utf16_code_units += current->length_in_utf16_code_units();
+        // NOTE: A code point never takes fewer bytes in UTF-8 than code units in UTF-16, and at most three times as
+        //       many, so the result can be sized without converting any of the pieces first.
+        if (current->has_utf8_string()) {
+            auto length = current->utf8_string_view().length();
+            approximate_length += length;
+            approximate_length_in_utf16_code_units += length;
+        } else {
+            auto length = current->utf16_string_view().length_in_code_units();
+            approximate_length += length * 3;
+            approximate_length_in_utf16_code_units += length;
+        }
         pieces.append(current);
     }
 
     if (preference == EncodingPreference::UTF16) {
         // The caller wants a UTF-16 string, so we can simply concatenate all the pieces
         // into a UTF-16 code unit buffer and create a Utf16String from it.
-        StringBuilder builder(StringBuilder::Mode::UTF16, length_in_utf16_code_units);
+        StringBuilder builder(StringBuilder::Mode::UTF16, approximate_length_in_utf16_code_units);
 
         for (auto const* current : pieces) {
             if (current->has_utf16_string())
@@ -347,10 +416,18 @@ void RopeString::resolve(EncodingPreference preference) const
     m_rhs = nullptr;
 }
 
-RopeString::RopeString(GC::Ref<PrimitiveString> lhs, GC::Ref<PrimitiveString> rhs)
+RopeString::RopeString(GC::Ref<PrimitiveString> lhs, GC::Ref<PrimitiveString> rhs, u32 depth)
     : PrimitiveString(RopeTag::Rope)
     , m_lhs(lhs)
     , m_rhs(rhs)
+    , m_depth(depth)
+{
+}
+
+RopeString::RopeString(NonnullRefPtr<AppendBuffer> append_buffer, size_t length_in_code_units)
+    : PrimitiveString(RopeTag::Rope)
+    , m_append_buffer(move(append_buffer))
+    , m_append_buffer_length(length_in_code_units)
 {
 }
 
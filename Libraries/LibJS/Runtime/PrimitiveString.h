@@ -8,7 +8,10 @@
 #pragma once
 
 #include <AK/Optional.h>
+#include <AK/RefCounted.h>
+#include <AK/RefPtr.h>
 #include <AK/String.h>
+#include <AK/StringBuilder.h>
 #include <AK/StringView.h>
 #include <AK/Utf16String.h>
 #include <LibGC/CellAllocator.h>
@@ -23,6 +26,7 @@ namespace JS {
 class JS_API PrimitiveString : public Cell {
     GC_CELL(PrimitiveString, Cell);
     GC_DECLARE_ALLOCATOR(PrimitiveString);
+    GC_DECLARE_WRITE_BARRIERS(PrimitiveString);
 
 public:
     [[nodiscard]] static GC::Ref<PrimitiveString> create(VM&, Utf16String const&);
@@ -82,26 +86,49 @@ private:
     explicit PrimitiveString(String);
 
     void resolve_rope_if_needed(EncodingPreference) const;
+    u32 rope_depth() const;
 };
 
 class RopeString final : public PrimitiveString {
     GC_CELL(RopeString, PrimitiveString);
     GC_DECLARE_ALLOCATOR(RopeString);
+    GC_DECLARE_WRITE_BARRIERS(RopeString);
 
 public:
     virtual ~RopeString() override;
 
+    // Ropes are never deeper than this. The deeper side of a concatenation is flattened first, so that flattening a
+    // rope never has to walk an unbounded number of nodes.
+    static constexpr u32 max_depth = 1024;
+
+    // A string that keeps growing on the right (like `string += piece` in a loop) continues in an append buffer once
+    // its rope is this deep.
+    static constexpr u32 append_buffer_depth_threshold = 16;
+
 private:
     friend class PrimitiveString;
 
-    explicit RopeString(GC::Ref<PrimitiveString>, GC::Ref<PrimitiveString>);
+    // Strings that are created by appending to the same string over and over share an append-only buffer. Each of them
+    // is a prefix of the buffer, and only the longest one can append to it.
+    struct AppendBuffer : public RefCounted<AppendBuffer> {
+        StringBuilder builder { StringBuilder::Mode::UTF16 };
+    };
+
+    RopeString(GC::Ref<PrimitiveString>, GC::Ref<PrimitiveString>, u32 depth);
+    RopeString(NonnullRefPtr<AppendBuffer>, size_t length_in_code_units);
 
     virtual void visit_edges(Visitor&) override;
 
+    GC::Ptr<RopeString> try_append(VM&, PrimitiveString const&) const;
+
     void resolve(EncodingPreference) const;
 
     mutable GC::Ptr<PrimitiveString> m_lhs;
     mutable GC::Ptr<PrimitiveString> m_rhs;
+    u32 m_depth { 0 };
+
+    mutable RefPtr<AppendBuffer> m_append_buffer;
+    mutable size_t m_append_buffer_length { 0 };
 };
 
 }
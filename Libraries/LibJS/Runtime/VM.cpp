@@ -16,6 +16,8 @@
 #include <LibFileSystem/FileSystem.h>
 #include <LibJS/AST.h>
 #include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Bytecode/MegamorphicCache.h>
+#include <LibJS/CodeCache.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
@@ -70,6 +72,10 @@ VM::VM(ErrorMessages error_messages)
     , m_error_messages(move(error_messages))
 {
     m_bytecode_interpreter = make<Bytecode::Interpreter>(*this);
+    m_code_cache = make<CodeCache>();
+    m_megamorphic_cache = make<Bytecode::MegamorphicCache>();
+
+    m_heap.set_allocation_stack_provider([this] { return allocation_stack(); });
 
     m_empty_string = m_heap.allocate<PrimitiveString>(String {});
 
@@ -782,4 +788,24 @@ Vector<StackTraceElement> VM::stack_trace() const
     return stack_trace;
 }
 
+String VM::allocation_stack() const
+{
+    StringBuilder builder;
+    for (auto& element : stack_trace()) {
+        auto* context = element.execution_context;
+        TracebackFrame frame {
+            .function_name = context->function_name ? context->function_name->utf8_string() : ""_string,
+            .cached_source_range = element.source_range,
+        };
+
+        auto function_name = frame.function_name.is_empty() ? "<unknown>"sv : frame.function_name.bytes_as_string_view();
+        auto const& source_range = frame.source_range();
+        if (source_range.filename().is_empty())
+            builder.appendff("    at {}\n", function_name);
+        else
+            builder.appendff("    at {} ({}:{}:{})\n", function_name, source_range.filename(), source_range.start.line, source_range.start.column);
+    }
+    return builder.to_string_without_validation();
+}
+
 }
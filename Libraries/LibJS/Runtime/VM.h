@@ -63,6 +63,10 @@ public:
 
     Bytecode::Interpreter& bytecode_interpreter() { return *m_bytecode_interpreter; }
 
+    CodeCache& code_cache() { return *m_code_cache; }
+
+    Bytecode::MegamorphicCache& megamorphic_cache() { return *m_megamorphic_cache; }
+
     void dump_backtrace() const;
 
     void gather_roots(HashMap<GC::Cell*, GC::HeapRoot>&);
@@ -305,6 +309,9 @@ public:
     Vector<StackTraceElement> stack_trace() const;
 
 private:
+    // The JS stack reported to the heap for each allocation that the allocation profiler samples.
+    String allocation_stack() const;
+
     using ErrorMessages = AK::Array<Utf16String, to_underlying(ErrorMessage::__Count)>;
 
     struct WellKnownSymbols {
@@ -368,6 +375,9 @@ private:
 
     OwnPtr<Bytecode::Interpreter> m_bytecode_interpreter;
 
+    OwnPtr<CodeCache> m_code_cache;
+    OwnPtr<Bytecode::MegamorphicCache> m_megamorphic_cache;
+
     bool m_dynamic_imports_allowed { false };
 };
 
@@ -38,7 +38,7 @@ WeakRef::WeakRef(Symbol& value, Object& prototype)
 
 void WeakRef::remove_dead_cells(Badge<GC::Heap>)
 {
-    if (m_value.visit([](Cell* cell) -> bool { return cell->state() == Cell::State::Live; }, [](Empty) -> bool { VERIFY_NOT_REACHED(); }))
+    if (m_value.visit([](Cell* cell) -> bool { return cell->is_marked(); }, [](Empty) -> bool { VERIFY_NOT_REACHED(); }))
         return;
 
     m_value = Empty {};
@@ -5,6 +5,7 @@
  */
 
 #include <LibJS/AST.h>
+#include <LibJS/CodeCache.h>
 #include <LibJS/Lexer.h>
 #include <LibJS/Parser.h>
 #include <LibJS/Runtime/VM.h>
@@ -17,14 +18,24 @@ GC_DEFINE_ALLOCATOR(Script);
 // 16.1.5 ParseScript ( sourceText, realm, hostDefined ), https://tc39.es/ecma262/#sec-parse-script
 Result<GC::Ref<Script>, Vector<ParserError>> Script::parse(StringView source_text, Realm& realm, StringView filename, HostDefined* host_defined, size_t line_number_offset)
 {
+    auto& code_cache = realm.vm().code_cache();
+
+    // OPTIMIZATION: Reuse the program of a previous parse of the same source text, if there is one. Programs which
+    //               failed to parse are never cached, so a cache hit is always a successfully parsed script.
+    if (auto script = code_cache.find(source_text, filename, Program::Type::Script, line_number_offset))
+        return realm.heap().allocate<Script>(realm, filename, script.release_nonnull(), host_defined);
+
     // 1. Let script be ParseText(sourceText, Script).
     auto parser = Parser(Lexer(source_text, filename, line_number_offset));
+    parser.enable_lazy_function_parsing();
     auto script = parser.parse_program();
 
     // 2. If script is a List of errors, return body.
     if (parser.has_errors())
         return parser.errors();
 
+    code_cache.add(source_text, filename, Program::Type::Script, line_number_offset, script);
+
     // 3. Return Script Record { [[Realm]]: realm, [[ECMAScriptCode]]: script, [[HostDefined]]: hostDefined }.
     return realm.heap().allocate<Script>(realm, filename, move(script), host_defined);
 }
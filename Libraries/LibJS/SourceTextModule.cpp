@@ -8,6 +8,7 @@
 #include <AK/Debug.h>
 #include <AK/QuickSort.h>
 #include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/CodeCache.h>
 #include <LibJS/Parser.h>
 #include <LibJS/Runtime/AsyncFunctionDriverWrapper.h>
 #include <LibJS/Runtime/ECMAScriptFunctionObject.h>
@@ -131,13 +132,24 @@ void SourceTextModule::visit_edges(Cell::Visitor& visitor)
 // 16.2.1.7.1 ParseModule ( sourceText, realm, hostDefined ), https://tc39.es/ecma262/#sec-parsemodule
 Result<GC::Ref<SourceTextModule>, Vector<ParserError>> SourceTextModule::parse(StringView source_text, Realm& realm, StringView filename, Script::HostDefined* host_defined)
 {
-    // 1. Let body be ParseText(sourceText, Module).
-    auto parser = Parser(Lexer(source_text, filename), Program::Type::Module);
-    auto body = parser.parse_program();
+    auto& code_cache = realm.vm().code_cache();
 
-    // 2. If body is a List of errors, return body.
-    if (parser.has_errors())
-        return parser.errors();
+    // OPTIMIZATION: Reuse the program of a previous parse of the same source text, if there is one. Programs which
+    //               failed to parse are never cached, so a cache hit is always a successfully parsed module.
+    RefPtr<Program> body = code_cache.find(source_text, filename, Program::Type::Module, 1);
+
+    if (!body) {
+        // 1. Let body be ParseText(sourceText, Module).
+        auto parser = Parser(Lexer(source_text, filename), Program::Type::Module);
+        parser.enable_lazy_function_parsing();
+        body = parser.parse_program();
+
+        // 2. If body is a List of errors, return body.
+        if (parser.has_errors())
+            return parser.errors();
+
+        code_cache.add(source_text, filename, Program::Type::Module, 1, *body);
+    }
 
     // 3. Let requestedModules be the ModuleRequests of body.
     auto requested_modules = module_requests(*body);
@@ -252,7 +264,7 @@ Result<GC::Ref<SourceTextModule>, Vector<ParserError>> SourceTextModule::parse(S
         filename,
         host_defined,
         async,
-        move(body),
+        body.release_nonnull(),
         move(requested_modules),
         move(import_entries),
         move(local_export_entries),
@@ -687,17 +699,24 @@ ThrowCompletionOr<void> SourceTextModule::execute_module(VM& vm, GC::Ptr<Promise
 
     GC::Ptr<Bytecode::Executable> executable;
     if (!m_has_top_level_await) {
-        Completion result;
+        // OPTIMIZATION: The executable is cached on the module's program, which may be shared with other modules of
+        //               the same source text through the code cache.
+        executable = m_ecmascript_code->bytecode_executable();
+
+        if (!executable) {
+            Completion result;
+
+            auto maybe_executable = Bytecode::compile(vm, m_ecmascript_code, FunctionKind::Normal, "ShadowRealmEval"_utf16_fly_string);
+            if (maybe_executable.is_error()) {
+                result = maybe_executable.release_error();
+            } else {
+                executable = maybe_executable.release_value();
+                m_ecmascript_code->set_bytecode_executable(executable);
+            }
 
-        auto maybe_executable = Bytecode::compile(vm, m_ecmascript_code, FunctionKind::Normal, "ShadowRealmEval"_utf16_fly_string);
-        if (maybe_executable.is_error()) {
-            result = maybe_executable.release_error();
-        } else {
-            executable = maybe_executable.release_value();
+            if (result.is_error())
+                return result.release_error();
         }
-
-        if (result.is_error())
-            return result.release_error();
     }
 
     u32 registers_and_constants_and_locals_count = 0;
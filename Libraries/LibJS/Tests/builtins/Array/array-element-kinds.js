@@ -0,0 +1,97 @@
+describe("arrays of numbers", () => {
+    test("sort without a comparator compares decimal representations", () => {
+        const array = [10, 9, -1, 2147483647, -2147483648, 0, 100, -10, 1];
+        expect(array.sort()).toBe(array);
+        expect(array).toEqual([-1, -10, -2147483648, 0, 1, 10, 100, 2147483647, 9]);
+    });
+
+    test("sort moves holes to the end", () => {
+        const array = [3, , 1, , 2];
+        array.sort();
+        expect(array).toHaveLength(5);
+        expect(array.slice(0, 3)).toEqual([1, 2, 3]);
+        expect(3 in array).toBeFalse();
+        expect(4 in array).toBeFalse();
+    });
+
+    test("sort of doubles and mixed elements", () => {
+        expect([1.5, 10, -0.5, 2].sort()).toEqual([-0.5, 1.5, 10, 2]);
+        expect([3, "b", 1, "a"].sort()).toEqual([1, 3, "a", "b"]);
+    });
+
+    test("indexOf and includes", () => {
+        const array = [1, 2.5, -0, 3, NaN];
+        expect(array.indexOf(2.5)).toBe(1);
+        expect(array.indexOf(0)).toBe(2);
+        expect(array.indexOf(NaN)).toBe(-1);
+        expect(array.indexOf("3")).toBe(-1);
+        expect(array.indexOf(3, 4)).toBe(-1);
+        expect(array.includes(NaN)).toBeTrue();
+        expect(array.includes(+0)).toBeTrue();
+        expect(array.includes(undefined)).toBeFalse();
+        expect([1, , 3].includes(undefined)).toBeTrue();
+        expect([1, , 3].indexOf(undefined)).toBe(-1);
+    });
+
+    test("holes are looked up on the prototype", () => {
+        const array = [1, , 3];
+        Array.prototype[1] = 2;
+        try {
+            expect(array.indexOf(2)).toBe(1);
+            expect(array.includes(2)).toBeTrue();
+            expect(array.map(x => x * 2)).toEqual([2, 4, 6]);
+        } finally {
+            delete Array.prototype[1];
+        }
+    });
+
+    test("push after a heterogeneous write", () => {
+        const array = [1, 2, 3];
+        expect(array.push(4.5)).toBe(4);
+        expect(array.push({ a: 1 }, "x")).toBe(6);
+        gc();
+        expect(array[4].a).toBe(1);
+        expect(array.indexOf("x")).toBe(5);
+        array.length = 0;
+        expect(array.push(7)).toBe(1);
+        expect(array).toEqual([7]);
+    });
+
+    test("push fails on arrays that can't be extended", () => {
+        const frozen = Object.freeze([1, 2]);
+        expect(() => frozen.push(3)).toThrow(TypeError);
+
+        const non_extensible = Object.preventExtensions([1, 2]);
+        expect(() => non_extensible.push(3)).toThrow(TypeError);
+        expect(non_extensible).toHaveLength(2);
+
+        const fixed_length = [1, 2];
+        Object.defineProperty(fixed_length, "length", { writable: false });
+        expect(() => fixed_length.push(3)).toThrow(TypeError);
+    });
+});
+
+describe("callbacks that change the array", () => {
+    test("forEach sees elements that were changed or removed", () => {
+        const array = [1, 2, 3, 4];
+        const seen = [];
+        array.forEach((value, index) => {
+            seen.push(value);
+            if (index === 0) {
+                array[1] = "two";
+                array.length = 3;
+            }
+        });
+        expect(seen).toEqual([1, "two", 3]);
+    });
+
+    test("map writes through to a species-created array", () => {
+        const array = [1, 2, 3];
+        const mapped = array.map((value, index) => {
+            if (index === 0) array[2] = { value: 30 };
+            return typeof value === "object" ? value.value : value * 10;
+        });
+        gc();
+        expect(mapped).toEqual([10, 20, 30]);
+    });
+});
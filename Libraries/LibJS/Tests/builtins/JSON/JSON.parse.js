@@ -74,3 +74,58 @@ test("does not truncate large integers", () => {
     expect(JSON.parse("18446744073709551616")).toEqual(18446744073709551616);
     expect(JSON.parse("18446744073709551617")).toEqual(18446744073709551617);
 });
+
+test("escape sequences", () => {
+    expect(JSON.parse('"\\"\\\\\\/\\b\\f\\n\\r\\t"')).toBe('"\\/\b\f\n\r\t');
+    expect(JSON.parse('"a\\u0062c"')).toBe("abc");
+    expect(JSON.parse('"\\uD834\\uDD1E"')).toBe("𝄞");
+    expect(JSON.parse('"caf\\u00e9 ☕"')).toBe("café ☕");
+
+    const loneSurrogate = JSON.parse('"\\uD800x"');
+    expect(loneSurrogate).toHaveLength(2);
+    expect(loneSurrogate.charCodeAt(0)).toBe(0xd800);
+
+    expect(JSON.parse('{"\\u0066oo":1}')).toEqual({ foo: 1 });
+    ['"\\x"', '"\\u12"', '"\n"', '"abc'].forEach(text => {
+        expect(() => JSON.parse(text)).toThrow(SyntaxError);
+    });
+});
+
+test("duplicate keys", () => {
+    const object = JSON.parse('{"a":1,"b":2,"a":3}');
+    expect(Object.keys(object)).toEqual(["a", "b"]);
+    expect(object.a).toBe(3);
+});
+
+test("objects with the same keys", () => {
+    const objects = JSON.parse('[{"x":1,"y":2},{"x":3,"y":4},{"y":5,"x":6},{"x":7},{"x":8,"y":9,"z":10},{"1":1,"x":2}]');
+    expect(objects[0]).toEqual({ x: 1, y: 2 });
+    expect(objects[1]).toEqual({ x: 3, y: 4 });
+    expect(Object.keys(objects[2])).toEqual(["y", "x"]);
+    expect(objects[2].x).toBe(6);
+    expect(objects[3]).toEqual({ x: 7 });
+    expect(objects[4]).toEqual({ x: 8, y: 9, z: 10 });
+    expect(objects[5]).toEqual({ 1: 1, x: 2 });
+
+    // Objects that start out with the same shape must still be independent.
+    objects[1].z = 5;
+    expect(objects[0].z).toBeUndefined();
+    delete objects[0].x;
+    expect(objects[1].x).toBe(3);
+});
+
+test("numbers", () => {
+    expect(JSON.parse("[0, -1, 123456789012345, 1.5, -2.5e3, 1E2, 1e-2]")).toEqual([
+        0, -1, 123456789012345, 1.5, -2500, 100, 0.01,
+    ]);
+    ["01", "-", "1.", ".5", "1e", "1e+", "+1", "0x10"].forEach(text => {
+        expect(() => JSON.parse(text)).toThrow(SyntaxError);
+    });
+});
+
+test("deeply nested arrays", () => {
+    const depth = 1000;
+    let value = JSON.parse("[".repeat(depth) + "]".repeat(depth));
+    for (let i = 1; i < depth; ++i) value = value[0];
+    expect(value).toEqual([]);
+});
@@ -97,3 +97,61 @@ describe("errors", () => {
         });
     });
 });
+
+describe("plain data objects", () => {
+    const data = {
+        id: 1,
+        name: "plain \"quoted\" name\n",
+        score: -2.5,
+        huge: 1e21,
+        nothing: null,
+        missing: undefined,
+        flags: [true, false, undefined, NaN, Symbol("s")],
+        nested: { empty: {}, list: [], deeper: [{ a: "ä" }] },
+    };
+
+    test("are serialized like any other object", () => {
+        const allKeys = ["id", "name", "score", "huge", "nothing", "missing", "flags", "nested", "empty", "list", "deeper", "a"];
+        for (const space of [undefined, 2, "--"]) {
+            expect(JSON.stringify(data, null, space)).toBe(JSON.stringify(data, allKeys, space));
+        }
+        expect(JSON.stringify(data)).toBe(
+            '{"id":1,"name":"plain \\"quoted\\" name\\n","score":-2.5,"huge":1e+21,"nothing":null,' +
+                '"flags":[true,false,null,null,null],"nested":{"empty":{},"list":[],"deeper":[{"a":"ä"}]}}'
+        );
+    });
+
+    test("getters, toJSON methods and holes are still observed", () => {
+        let getterCalls = 0;
+        const withGetter = {
+            a: 1,
+            get b() {
+                ++getterCalls;
+                return 2;
+            },
+        };
+        expect(JSON.stringify({ x: [withGetter] })).toBe('{"x":[{"a":1,"b":2}]}');
+        expect(getterCalls).toBe(1);
+
+        expect(JSON.stringify({ a: { toJSON: () => "own" } })).toBe('{"a":"own"}');
+
+        Object.prototype.toJSON = function () {
+            return "inherited";
+        };
+        try {
+            expect(JSON.stringify({ a: 1 })).toBe('"inherited"');
+        } finally {
+            delete Object.prototype.toJSON;
+        }
+
+        Array.prototype[1] = "from prototype";
+        try {
+            expect(JSON.stringify([0, , 2])).toBe('[0,"from prototype",2]');
+        } finally {
+            delete Array.prototype[1];
+        }
+
+        expect(JSON.stringify({ 1: "one", a: "a" })).toBe('{"1":"one","a":"a"}');
+        expect(JSON.stringify({ date: new Date(0) })).toBe('{"date":"1970-01-01T00:00:00.000Z"}');
+    });
+});
@@ -0,0 +1,194 @@
+// NOTE: Functions nested inside another function's body whose source is at least 128 code units long are parsed lazily:
+//       their bodies are discarded after being validated, and parsed again when the function is first instantiated. The
+//       bodies of the functions below are padded with comments to exceed that length.
+
+var globalValue = "global";
+
+test("lazily parsed functions can access variables of enclosing scopes", () => {
+    let captured = 1;
+    function outer(parameter) {
+        const local = 2;
+        function inner() {
+            // Padding to make this function large enough to be parsed lazily......................................
+            captured += 10;
+            return captured + parameter + local + globalValue;
+        }
+        return inner();
+    }
+    expect(outer(3)).toBe("16global");
+    expect(captured).toBe(11);
+});
+
+test("lazily parsed function expressions and arrow functions", () => {
+    function outer() {
+        const values = [1, 2, 3];
+        const mapped = values.map(value => {
+            // Padding to make this function large enough to be parsed lazily......................................
+            return value * 2;
+        });
+        const reduce = function sum(array, index = 0) {
+            // Padding to make this function large enough to be parsed lazily......................................
+            return index < array.length ? array[index] + sum(array, index + 1) : 0;
+        };
+        return reduce(mapped);
+    }
+    expect(outer()).toBe(12);
+});
+
+test("arrow functions use the arguments and this of their enclosing function", () => {
+    function outer() {
+        const arrow = (offset) => {
+            // Padding to make this function large enough to be parsed lazily......................................
+            return this.value + arguments[0] + offset;
+        };
+        return arrow(100);
+    }
+    expect(outer.call({ value: 1 }, 10)).toBe(111);
+});
+
+test("lazily parsed async functions and generators", async () => {
+    function outer() {
+        async function asyncFunction(value) {
+            // Padding to make this function large enough to be parsed lazily......................................
+            return (await value) + 1;
+        }
+        function* generator() {
+            // Padding to make this function large enough to be parsed lazily......................................
+            yield 1;
+            yield* [2, 3];
+        }
+        const asyncArrow = async x => {
+            // Padding to make this function large enough to be parsed lazily......................................
+            return await asyncFunction(x);
+        };
+        return [asyncArrow, generator];
+    }
+    const [asyncArrow, generator] = outer();
+    expect([...generator()]).toEqual([1, 2, 3]);
+    expect(await asyncArrow(Promise.resolve(41))).toBe(42);
+});
+
+test("functions nested in lazily parsed functions", () => {
+    function outer(a) {
+        function middle(b) {
+            // Padding to make this function large enough to be parsed lazily......................................
+            function inner(c) {
+                // Padding to make this function large enough to be parsed lazily..................................
+                return a + b + c;
+            }
+            return inner;
+        }
+        return middle;
+    }
+    expect(outer(1)(2)(3)).toBe(6);
+});
+
+test("strict mode is inherited by lazily parsed functions", () => {
+    function outer() {
+        "use strict";
+        function inner() {
+            // Padding to make this function large enough to be parsed lazily......................................
+            return this;
+        }
+        return inner();
+    }
+    expect(outer()).toBeUndefined();
+});
+
+test("source text and length of lazily parsed functions", () => {
+    function outer() {
+        return function lazy(a, b, c = 1) {
+            // Padding to make this function large enough to be parsed lazily......................................
+        };
+    }
+    const lazy = outer();
+    expect(lazy.length).toBe(2);
+    expect(lazy.name).toBe("lazy");
+    expect(lazy.toString()).toContain("function lazy(a, b, c = 1) {");
+});
+
+test("arrow functions that use this are parsed lazily", () => {
+    function outer() {
+        const arrow = offset => {
+            // Padding to make this function large enough to be parsed lazily......................................
+            return this.value + offset;
+        };
+        return arrow(100);
+    }
+    expect(outer.call({ value: 1 })).toBe(101);
+});
+
+test("regular expression literals and divisions in lazily parsed functions", () => {
+    function outer(a) {
+        function inner(b) {
+            // Padding to make this function large enough to be parsed lazily......................................
+            if (b) /}/.test("}");
+            const quotient = (a + b) / 2 / 1;
+            const matches = "a{b}".match(/[{}]/g);
+            return typeof /{/ === "object" ? `${quotient}${matches.length}${{ x: 1 }.x}` : "";
+        }
+        return inner(3);
+    }
+    expect(outer(1)).toBe("221");
+});
+
+test("functions containing a direct call to eval are parsed eagerly", () => {
+    function outer(value) {
+        function inner() {
+            // Padding to make this function large enough to be parsed lazily......................................
+            return eval("value");
+        }
+        return inner();
+    }
+    expect(outer(42)).toBe(42);
+});
+
+test("syntax errors in lazily parsed functions are reported up front", () => {
+    expect(`
+        function outer() {
+            function inner() {
+                // Padding to make this function large enough to be parsed lazily......................................
+                return "unterminated;
+            }
+        }
+    `).not.toEval();
+
+    expect(`
+        function outer() {
+            function inner() {
+                // Padding to make this function large enough to be parsed lazily......................................
+                return await 1;
+            }
+        }
+    `).not.toEval();
+});
+
+test("early errors in functions nested inside lazily parsed functions are reported up front", () => {
+    expect(`
+        function outer() {
+            function inner() {
+                // Padding to make this function large enough to be parsed lazily......................................
+                function innermost() {
+                    // Padding to make this function large enough to be parsed lazily..................................
+                    let x;
+                    let x;
+                }
+            }
+        }
+    `).not.toEval();
+});
+
+test("functions nested inside lazily parsed functions are skipped over when those are first called", () => {
+    function outer(value) {
+        function inner() {
+            // Padding to make this function large enough to be parsed lazily......................................
+            function innermost(suffix) {
+                // Padding to make this function large enough to be parsed lazily..................................
+                return value + suffix;
+            }
+            return innermost("!");
+        }
+        return inner();
+    }
+    expect(outer("skipped")).toBe("skipped!");
+});
@@ -0,0 +1,107 @@
+// NOTE: These loops run often enough to be compiled by the baseline JIT when it's enabled (e.g. with `test-js --jit`),
+//       and check that the inline fast paths bail out correctly when their assumptions stop holding.
+
+test("int32 arithmetic overflowing into doubles", () => {
+    let value = 2147483000;
+    for (let i = 0; i < 2000; ++i) value += 1;
+    expect(value).toBe(2147485000);
+
+    let negative = -2147483000;
+    for (let i = 0; i < 2000; i++) negative = negative - 1;
+    expect(negative).toBe(-2147485000);
+});
+
+test("comparisons of mixed types in loop conditions", () => {
+    let count = 0;
+    for (let i = 0; i < "3000"; ++i) ++count;
+    expect(count).toBe(3000);
+
+    count = 0;
+    for (let i = 0.5; i < 3000; ++i) ++count;
+    expect(count).toBe(3000);
+
+    count = 0;
+    for (let i = 0; i != 3000n; ++i) ++count;
+    expect(count).toBe(3000);
+});
+
+test("property accesses whose shape changes during a hot loop", () => {
+    const objects = [];
+    for (let i = 0; i < 3000; ++i) objects.push(i < 1500 ? { x: i, y: 1 } : { y: 1, x: i });
+
+    let sum = 0;
+    for (const object of objects) {
+        sum += object.x;
+        object.y = object.x;
+    }
+    expect(sum).toBe(4498500);
+    expect(objects[2999].y).toBe(2999);
+});
+
+test("property accesses that see several shapes in turn during a hot loop", () => {
+    const objects = [];
+    for (let i = 0; i < 3000; ++i) {
+        if (i % 3 === 0) objects.push({ x: i, y: 1 });
+        else if (i % 3 === 1) objects.push({ y: 1, x: i });
+        else objects.push({ z: 0, y: 1, x: i });
+    }
+
+    let sum = 0;
+    for (const object of objects) {
+        sum += object.x;
+        object.y = object.x;
+    }
+    expect(sum).toBe(4498500);
+    expect(objects[2997].y).toBe(2997);
+    expect(objects[2998].y).toBe(2998);
+    expect(objects[2999].y).toBe(2999);
+});
+
+test("getters and setters installed on an object with a cached shape", () => {
+    const object = { value: 0 };
+    let getterCalls = 0;
+    let setterCalls = 0;
+    for (let i = 0; i < 3000; ++i) {
+        object.value = object.value + 1;
+        if (i === 2000) {
+            Object.defineProperty(object, "value", {
+                get() {
+                    ++getterCalls;
+                    return 0;
+                },
+                set(value) {
+                    ++setterCalls;
+                },
+            });
+        }
+    }
+    expect(getterCalls).toBe(999);
+    expect(setterCalls).toBe(999);
+});
+
+test("exceptions thrown and caught inside a hot loop", () => {
+    let caught = 0;
+    for (let i = 0; i < 3000; ++i) {
+        try {
+            if (i % 3 === 0) null.property;
+            else if (i % 3 === 1) throw i;
+        } catch {
+            ++caught;
+        }
+    }
+    expect(caught).toBe(2000);
+});
+
+test("hot functions returning from inside loops", () => {
+    function findIndex(array, value) {
+        for (let i = 0; i < array.length; ++i) {
+            if (array[i] === value) return i;
+        }
+        return -1;
+    }
+    const array = Array.from({ length: 100 }, (_, i) => i * 2);
+    let total = 0;
+    for (let i = 0; i < 1000; ++i) total += findIndex(array, (i % 100) * 2);
+    expect(total).toBe(49500);
+    expect(findIndex(array, 1)).toBe(-1);
+});
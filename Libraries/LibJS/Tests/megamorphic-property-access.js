@@ -0,0 +1,78 @@
+// NOTE: These property accesses see more shapes than an inline cache can remember, and go through the megamorphic cache.
+
+function makeObjects(count) {
+    const objects = [];
+    for (let i = 0; i < count; ++i) {
+        const object = {};
+        object[`unique${i}`] = i;
+        object.value = i;
+        objects.push(object);
+    }
+    return objects;
+}
+
+test("getting and setting own properties", () => {
+    const objects = makeObjects(20);
+    const getValue = object => object.value;
+    const setValue = (object, value) => {
+        object.value = value;
+    };
+
+    for (let round = 0; round < 3; ++round) {
+        for (let i = 0; i < objects.length; ++i) {
+            expect(getValue(objects[i])).toBe(i + round);
+            setValue(objects[i], i + round + 1);
+        }
+    }
+});
+
+test("getting properties from the prototype chain", () => {
+    const prototype = { inherited: "from prototype" };
+    const objects = makeObjects(20).map(object => Object.setPrototypeOf(object, prototype));
+    const getInherited = object => object.inherited;
+
+    for (const object of objects) expect(getInherited(object)).toBe("from prototype");
+
+    prototype.inherited = "changed";
+    for (const object of objects) expect(getInherited(object)).toBe("changed");
+
+    Object.defineProperty(prototype, "inherited", { get: () => "getter" });
+    for (const object of objects) expect(getInherited(object)).toBe("getter");
+
+    Object.setPrototypeOf(objects[3], { inherited: "other prototype" });
+    for (let i = 0; i < objects.length; ++i) expect(getInherited(objects[i])).toBe(i === 3 ? "other prototype" : "getter");
+});
+
+test("properties that become accessors or read-only", () => {
+    const objects = makeObjects(20);
+    const getValue = object => object.value;
+    const setValue = (object, value) => {
+        object.value = value;
+    };
+
+    for (const object of objects) setValue(object, getValue(object));
+
+    let setterCalls = 0;
+    Object.defineProperty(objects[5], "value", {
+        get: () => "getter",
+        set: () => ++setterCalls,
+    });
+    Object.defineProperty(objects[6], "value", { value: "read-only", writable: false });
+
+    for (const object of objects) setValue(object, "written");
+    expect(setterCalls).toBe(1);
+    for (let i = 0; i < objects.length; ++i) {
+        if (i === 5) expect(getValue(objects[i])).toBe("getter");
+        else if (i === 6) expect(getValue(objects[i])).toBe("read-only");
+        else expect(getValue(objects[i])).toBe("written");
+    }
+});
+
+test("deleted properties", () => {
+    const objects = makeObjects(20);
+    const getValue = object => object.value;
+
+    for (const object of objects) getValue(object);
+    for (const object of objects) delete object.value;
+    for (const object of objects) expect(getValue(object)).toBeUndefined();
+});
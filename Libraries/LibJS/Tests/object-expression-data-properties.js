@@ -0,0 +1,83 @@
+describe("object literals with only data properties", () => {
+    test("properties are defined in order", () => {
+        const make = value => ({ a: value, b: value + 1, "c d": value + 2 });
+        for (let i = 0; i < 3; ++i) {
+            const o = make(i);
+            expect(Object.getOwnPropertyNames(o)).toEqual(["a", "b", "c d"]);
+            expect(o.a).toBe(i);
+            expect(o.b).toBe(i + 1);
+            expect(o["c d"]).toBe(i + 2);
+        }
+    });
+
+    test("objects created by the same literal are independent", () => {
+        const make = () => ({ x: 1, y: 2 });
+        const first = make();
+        const second = make();
+        first.x = 3;
+        delete first.y;
+        expect(second.x).toBe(1);
+        expect(second.y).toBe(2);
+        expect(Object.getOwnPropertyNames(first)).toEqual(["x"]);
+    });
+
+    test("values are evaluated in order before the object is created", () => {
+        let x = 1;
+        const o = { a: x, b: (x = 2), c: x };
+        expect(o).toEqual({ a: 1, b: 2, c: 2 });
+
+        const calls = [];
+        const log = value => {
+            calls.push(value);
+            return value;
+        };
+        expect({ a: log(1), b: log(2), c: log(3) }).toEqual({ a: 1, b: 2, c: 3 });
+        expect(calls).toEqual([1, 2, 3]);
+    });
+
+    test("a throwing value expression leaves nothing behind", () => {
+        let o = "unchanged";
+        expect(() => {
+            o = {
+                a: 1,
+                b: (() => {
+                    throw new Error();
+                })(),
+            };
+        }).toThrow(Error);
+        expect(o).toBe("unchanged");
+    });
+
+    test("numeric string keys", () => {
+        const make = value => ({ b: value, "1": value, a: value }); // prettier-ignore
+        for (let i = 0; i < 3; ++i) {
+            const o = make(i);
+            expect(Object.getOwnPropertyNames(o)).toEqual(["1", "b", "a"]);
+            expect(o[1]).toBe(i);
+        }
+    });
+
+    test("anonymous functions are named after their key", () => {
+        const o = { f: function () {}, g: () => {}, h: class {} };
+        expect(o.f.name).toBe("f");
+        expect(o.g.name).toBe("g");
+        expect(o.h.name).toBe("h");
+    });
+
+    test("shorthand __proto__ is an own property", () => {
+        const __proto__ = 1;
+        const o = { __proto__, a: 2 };
+        expect(Object.getPrototypeOf(o)).toBe(Object.prototype);
+        expect(Object.getOwnPropertyNames(o)).toEqual(["__proto__", "a"]);
+    });
+
+    test("literals with many properties", () => {
+        const source = "({" + Array.from({ length: 100 }, (_, i) => `p${i}: ${i}`).join(",") + "})";
+        const make = new Function("return " + source);
+        for (let i = 0; i < 3; ++i) {
+            const o = make();
+            expect(Object.keys(o).length).toBe(100);
+            expect(o.p99).toBe(99);
+        }
+    });
+});
@@ -28,3 +28,65 @@ test("adding strings with dangling surrogates", () => {
     expect("\ud834a" + "\udf06").toBe("\ud834a\udf06");
     expect("\ud834" + "a\udf06").toBe("\ud834a\udf06");
 });
+
+describe("strings built by repeated concatenation", () => {
+    test("appending in a loop", () => {
+        let string = "";
+        for (let i = 0; i < 1000; ++i) string += i % 10;
+        expect(string).toHaveLength(1000);
+        expect(string.slice(0, 12)).toBe("012345678901");
+        expect(string.endsWith("6789")).toBeTrue();
+    });
+
+    test("strings that were appended to keep their value", () => {
+        let string = "";
+        const prefixes = [];
+        for (let i = 0; i < 100; ++i) {
+            string += "ab";
+            prefixes.push(string);
+        }
+        const branch = prefixes[50] + "!";
+        string += "c";
+        expect(prefixes[0]).toBe("ab");
+        expect(prefixes[50]).toBe("ab".repeat(51));
+        expect(branch).toBe("ab".repeat(51) + "!");
+        expect(prefixes[99] + "d").toBe("ab".repeat(100) + "d");
+        expect(string).toBe("ab".repeat(100) + "c");
+    });
+
+    test("concatenating strings that were appended to", () => {
+        let string = "";
+        const prefixes = [];
+        for (let i = 0; i < 100; ++i) {
+            string += "ab";
+            prefixes.push(string);
+        }
+        // None of these have been read before, so they're still unresolved when they become part of another string.
+        expect("x" + prefixes[10]).toBe("x" + "ab".repeat(11));
+        expect(prefixes[20] + "y" + prefixes[30]).toBe("ab".repeat(21) + "y" + "ab".repeat(31));
+        expect(("z" + prefixes[40]).length).toBe(83);
+        expect(string).toBe("ab".repeat(100));
+    });
+
+    test("reading the string while appending to it", () => {
+        let string = "";
+        while (string.length < 500) string += "xyz"[string.length % 3];
+        expect(string).toBe("xyz".repeat(167).slice(0, 500));
+    });
+
+    test("surrogate pairs split across appended pieces", () => {
+        let string = "";
+        for (let i = 0; i < 50; ++i) string += "a";
+        string += "\ud834";
+        string += "\udf06";
+        expect(string).toBe("a".repeat(50) + "𝌆");
+        expect(string.codePointAt(50)).toBe(0x1d306);
+    });
+
+    test("prepending in a loop", () => {
+        let string = "";
+        for (let i = 0; i < 5000; ++i) string = (i % 10) + string;
+        expect(string).toHaveLength(5000);
+        expect(string.slice(0, 10)).toBe("9876543210");
+    });
+});
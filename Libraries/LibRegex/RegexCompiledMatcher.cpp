@@ -0,0 +1,698 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/AnyOf.h>
+#include <AK/CharacterTypes.h>
+#include <AK/HashMap.h>
+#include <AK/StringBuilder.h>
+#include <LibRegex/RegexCompiledMatcher.h>
+
+namespace regex {
+
+constexpr static u32 const LineSeparator { 0x2028 };
+constexpr static u32 const ParagraphSeparator { 0x2029 };
+
+// Matches that backtrack more often than this hand over to the interpreter, which deduplicates the states it explores.
+static constexpr size_t backtracks_per_code_unit = 64;
+static constexpr size_t minimum_backtrack_limit = 16 * KiB;
+
+static constexpr u32 no_instruction = NumericLimits<u32>::max();
+
+static bool is_line_terminator(u32 code_unit)
+{
+    return code_unit == '\r' || code_unit == '\n' || code_unit == LineSeparator || code_unit == ParagraphSeparator;
+}
+
+ALWAYS_INLINE bool CompiledMatcher::CharacterSet::matches(u32 code_unit, bool dot_matches_line_terminators, bool ecma262_dot_semantics) const
+{
+    bool matched;
+    if (code_unit < 128) {
+        matched = (ascii_bitmap[code_unit / 64] >> (code_unit % 64)) & 1;
+    } else {
+        matched = any_of(ranges, [&](CharRange range) { return code_unit >= range.from && code_unit <= range.to; })
+            || any_of(classes, [&](CharClass character_class) { return OpCode_Compare::matches_character_class(character_class, code_unit, false); });
+    }
+
+    if (!matched && any_character) {
+        auto is_equivalent_to_newline = code_unit == '\n'
+            || (ecma262_dot_semantics && (code_unit == '\r' || code_unit == LineSeparator || code_unit == ParagraphSeparator));
+        matched = !is_equivalent_to_newline || dot_matches_line_terminators;
+    }
+
+    return matched != inverse;
+}
+
+OwnPtr<CompiledMatcher> CompiledMatcher::compile(ByteCode const& bytecode, size_t capture_group_count)
+{
+    auto matcher = adopt_own(*new CompiledMatcher(capture_group_count));
+    if (!matcher->translate(bytecode))
+        return nullptr;
+    return matcher;
+}
+
+Optional<CompiledMatcher::CharacterSet> CompiledMatcher::translate_character_set(ReadonlySpan<ByteCodeValueType> arguments, size_t argument_count) const
+{
+    CharacterSet set;
+
+    auto add_range = [&](u32 from, u32 to) {
+        for (auto code_unit = from; code_unit <= min(to, 127u); ++code_unit)
+            set.ascii_bitmap[code_unit / 64] |= 1ull << (code_unit % 64);
+        if (to >= 128)
+            set.ranges.append({ max(from, 128u), to });
+    };
+
+    size_t offset = 0;
+    bool has_seen_compare = false;
+    for (size_t i = 0; i < argument_count; ++i) {
+        if (offset >= arguments.size())
+            return {};
+
+        switch (static_cast<CharacterCompareType>(arguments[offset++])) {
+        case CharacterCompareType::Inverse:
+            // The interpreter applies an inversion to all the compares that follow it, so only whole sets can be inverted here.
+            if (has_seen_compare)
+                return {};
+            set.inverse = !set.inverse;
+            continue;
+        case CharacterCompareType::Char: {
+            auto code_point = static_cast<u32>(arguments[offset++]);
+            add_range(code_point, code_point);
+            break;
+        }
+        case CharacterCompareType::AnyChar:
+            set.any_character = true;
+            break;
+        case CharacterCompareType::CharClass: {
+            auto character_class = static_cast<CharClass>(arguments[offset++]);
+            for (u32 code_unit = 0; code_unit < 128; ++code_unit) {
+                if (OpCode_Compare::matches_character_class(character_class, code_unit, false))
+                    set.ascii_bitmap[code_unit / 64] |= 1ull << (code_unit % 64);
+            }
+            set.classes.append(character_class);
+            break;
+        }
+        case CharacterCompareType::CharRange: {
+            CharRange range { arguments[offset++] };
+            add_range(range.from, range.to);
+            break;
+        }
+        case CharacterCompareType::LookupTable: {
+            auto sensitive_range_count = arguments[offset++];
+            auto insensitive_range_count = arguments[offset++];
+            if (offset + sensitive_range_count + insensitive_range_count > arguments.size())
+                return {};
+            for (size_t j = 0; j < sensitive_range_count; ++j) {
+                CharRange range { arguments[offset++] };
+                add_range(range.from, range.to);
+            }
+            // Case-insensitive matches always run on the interpreter.
+            offset += insensitive_range_count;
+            break;
+        }
+        default:
+            return {};
+        }
+
+        has_seen_compare = true;
+    }
+
+    return set;
+}
+
+bool CompiledMatcher::translate_compare(ReadonlySpan<ByteCodeValueType> arguments, size_t argument_count)
+{
+    if (argument_count == 1 && !arguments.is_empty()) {
+        switch (static_cast<CharacterCompareType>(arguments[0])) {
+        case CharacterCompareType::Char:
+            m_instructions.append({ .op = Op::MatchCharacter, .argument = static_cast<u32>(arguments[1]) });
+            return true;
+        case CharacterCompareType::String: {
+            auto length = arguments[1];
+            if (length == 0 || 2 + length > arguments.size())
+                return false;
+
+            // Strings are compared code unit by code unit, which is only equivalent to the interpreter for ASCII.
+            StringBuilder builder;
+            for (size_t i = 0; i < length; ++i) {
+                auto code_point = arguments[2 + i];
+                if (!is_ascii(code_point))
+                    return false;
+                builder.append(static_cast<char>(code_point));
+            }
+            m_instructions.append({ .op = Op::MatchString, .argument = static_cast<u32>(m_strings.size()) });
+            m_strings.append(builder.to_byte_string());
+            return true;
+        }
+        default:
+            break;
+        }
+    }
+
+    auto set = translate_character_set(arguments, argument_count);
+    if (!set.has_value())
+        return false;
+
+    m_instructions.append({ .op = Op::MatchSet, .argument = static_cast<u32>(m_character_sets.size()) });
+    m_character_sets.append(set.release_value());
+    return true;
+}
+
+bool CompiledMatcher::translate(ByteCode const& bytecode)
+{
+    auto const bytecode_size = bytecode.size();
+    if (bytecode_size >= no_instruction)
+        return false;
+
+    auto const data = bytecode.flat_data();
+
+    Vector<size_t> opcode_positions;
+    auto state = MatchState::only_for_enumeration();
+    for (state.instruction_position = 0; state.instruction_position < bytecode_size;) {
+        opcode_positions.append(state.instruction_position);
+        state.instruction_position += bytecode.get_opcode(state).size();
+    }
+
+    // Jump targets are resolved to instruction indices once everything has been translated. Positions that don't
+    // start an instruction (e.g. the inside of a fused loop) can't be jumped to.
+    Vector<u32> instruction_at_position;
+    instruction_at_position.resize_with_default_value(bytecode_size + 1, no_instruction);
+
+    auto resolve_jump = [&](size_t position, size_t opcode_size, ssize_t offset) -> Optional<u32> {
+        auto target = static_cast<ssize_t>(position + opcode_size) + offset;
+        if (target < 0)
+            return {};
+        // Running off the end of the bytecode is an implicit Exit, which succeeds.
+        return static_cast<u32>(min(static_cast<size_t>(target), bytecode_size));
+    };
+
+    HashMap<ByteCodeValueType, u32> checkpoint_registers;
+    HashMap<ByteCodeValueType, u32> repeat_registers;
+    auto register_for = [this](HashMap<ByteCodeValueType, u32>& registers, ByteCodeValueType id) {
+        return registers.ensure(id, [this] { return static_cast<u32>(m_register_count++); });
+    };
+
+    auto opcode_id_at = [&](size_t index) {
+        return static_cast<OpCodeId>(data[opcode_positions[index]]);
+    };
+
+    // Greedy loops over a single character set, `x*` and `x+`, as emitted by transform_bytecode_repetition_any() and
+    // transform_bytecode_repetition_min_one() respectively:
+    //     _START: ForkStay _END; Checkpoint _C; Compare x; JumpNonEmpty _START _C Jump; _END:
+    //     _START: Checkpoint _C; Compare x; JumpNonEmpty _START _C ForkJump
+    // The ForkReplace variants are loops that the optimizer turned into atomic groups; those never give anything back.
+    // Returns the number of opcodes that were fused.
+    auto translate_loop = [&](size_t index) -> size_t {
+        auto start = opcode_positions[index];
+        auto is_loop_over_set = [&](size_t checkpoint_index, OpCodeId form) -> Optional<CharacterSet> {
+            if (checkpoint_index + 2 >= opcode_positions.size())
+                return {};
+            if (opcode_id_at(checkpoint_index) != OpCodeId::Checkpoint
+                || opcode_id_at(checkpoint_index + 1) != OpCodeId::Compare
+                || opcode_id_at(checkpoint_index + 2) != OpCodeId::JumpNonEmpty)
+                return {};
+
+            auto checkpoint = opcode_positions[checkpoint_index];
+            auto compare = opcode_positions[checkpoint_index + 1];
+            auto jump = opcode_positions[checkpoint_index + 2];
+            if (data[jump + 2] != data[checkpoint + 1] || static_cast<OpCodeId>(data[jump + 3]) != form)
+                return {};
+            if (resolve_jump(jump, 4, static_cast<ssize_t>(data[jump + 1])) != start)
+                return {};
+            return translate_character_set(data.slice(compare + 3, data[compare + 2]), data[compare + 1]);
+        };
+
+        switch (opcode_id_at(index)) {
+        case OpCodeId::ForkStay:
+        case OpCodeId::ForkReplaceStay: {
+            auto set = is_loop_over_set(index + 1, OpCodeId::Jump);
+            if (!set.has_value())
+                return 0;
+            auto end = opcode_positions[index + 3] + 4;
+            if (resolve_jump(start, 2, static_cast<ssize_t>(data[start + 1])) != end)
+                return 0;
+
+            auto op = opcode_id_at(index) == OpCodeId::ForkStay ? Op::GreedyLoop : Op::PossessiveLoop;
+            m_instructions.append({ .op = op, .argument = static_cast<u32>(m_character_sets.size()) });
+            m_character_sets.append(set.release_value());
+            return 4;
+        }
+        case OpCodeId::Checkpoint: {
+            auto form = static_cast<OpCodeId>(index + 2 < opcode_positions.size() ? data[opcode_positions[index + 2] + 3] : 0);
+            if (form != OpCodeId::ForkJump && form != OpCodeId::ForkReplaceJump)
+                return 0;
+            auto set = is_loop_over_set(index, form);
+            if (!set.has_value())
+                return 0;
+
+            // The first iteration is mandatory.
+            auto op = form == OpCodeId::ForkJump ? Op::GreedyLoop : Op::PossessiveLoop;
+            m_instructions.append({ .op = Op::MatchSet, .argument = static_cast<u32>(m_character_sets.size()) });
+            m_instructions.append({ .op = op, .argument = static_cast<u32>(m_character_sets.size()) });
+            m_character_sets.append(set.release_value());
+            return 3;
+        }
+        default:
+            return 0;
+        }
+    };
+
+    for (size_t index = 0; index < opcode_positions.size();) {
+        auto position = opcode_positions[index];
+        instruction_at_position[position] = m_instructions.size();
+
+        if (auto fused_opcode_count = translate_loop(index); fused_opcode_count != 0) {
+            index += fused_opcode_count;
+            continue;
+        }
+
+        auto argument = [&](size_t offset) { return data[position + 1 + offset]; };
+        auto append_jump = [&](Op op, size_t opcode_size, ssize_t offset, u32 argument = 0, u64 extra = 0) {
+            auto target = resolve_jump(position, opcode_size, offset);
+            if (!target.has_value())
+                return false;
+            m_instructions.append({ .op = op, .argument = argument, .target = *target, .extra = extra });
+            return true;
+        };
+        auto capture_group_id = [&](ByteCodeValueType id) -> Optional<u32> {
+            if (id == 0 || id > m_capture_group_count)
+                return {};
+            m_tracks_captures = true;
+            return static_cast<u32>(id);
+        };
+
+        switch (static_cast<OpCodeId>(data[position])) {
+        case OpCodeId::Compare:
+            if (!translate_compare(data.slice(position + 3, argument(1)), argument(0)))
+                return false;
+            break;
+        case OpCodeId::Jump:
+            if (!append_jump(Op::Jump, 2, static_cast<ssize_t>(argument(0))))
+                return false;
+            break;
+        case OpCodeId::ForkJump:
+            if (!append_jump(Op::ForkJump, 2, static_cast<ssize_t>(argument(0))))
+                return false;
+            break;
+        case OpCodeId::ForkStay:
+            if (!append_jump(Op::ForkStay, 2, static_cast<ssize_t>(argument(0))))
+                return false;
+            break;
+        case OpCodeId::ForkReplaceJump:
+            if (!append_jump(Op::ForkReplaceJump, 2, static_cast<ssize_t>(argument(0))))
+                return false;
+            break;
+        case OpCodeId::ForkReplaceStay:
+            if (!append_jump(Op::ForkReplaceStay, 2, static_cast<ssize_t>(argument(0))))
+                return false;
+            break;
+        case OpCodeId::JumpNonEmpty: {
+            auto form = static_cast<OpCodeId>(argument(2));
+            if (form != OpCodeId::Jump && form != OpCodeId::ForkJump && form != OpCodeId::ForkStay && form != OpCodeId::ForkReplaceJump && form != OpCodeId::ForkReplaceStay)
+                return false;
+            if (!append_jump(Op::JumpNonEmpty, 4, static_cast<ssize_t>(argument(0)), register_for(checkpoint_registers, argument(1)), argument(2)))
+                return false;
+            break;
+        }
+        case OpCodeId::Checkpoint:
+            m_instructions.append({ .op = Op::Checkpoint, .argument = register_for(checkpoint_registers, argument(0)) });
+            break;
+        case OpCodeId::Repeat: {
+            auto count = argument(1);
+            if (count == 0)
+                return false;
+            // Repeat jumps back by its offset, measured from its own position.
+            if (!append_jump(Op::Repeat, 0, -static_cast<ssize_t>(argument(0)), register_for(repeat_registers, argument(2)), count))
+                return false;
+            break;
+        }
+        case OpCodeId::ResetRepeat:
+            m_instructions.append({ .op = Op::ResetRepeat, .argument = register_for(repeat_registers, argument(0)) });
+            break;
+        case OpCodeId::CheckBegin:
+            m_instructions.append({ .op = Op::CheckBegin });
+            break;
+        case OpCodeId::CheckEnd:
+            m_instructions.append({ .op = Op::CheckEnd });
+            break;
+        case OpCodeId::CheckBoundary:
+            m_instructions.append({ .op = Op::CheckBoundary, .argument = static_cast<u32>(argument(0)) });
+            break;
+        case OpCodeId::SaveLeftCaptureGroup:
+        case OpCodeId::SaveRightCaptureGroup:
+        case OpCodeId::ClearCaptureGroup: {
+            auto id = capture_group_id(argument(0));
+            if (!id.has_value())
+                return false;
+            auto opcode_id = static_cast<OpCodeId>(data[position]);
+            auto op = opcode_id == OpCodeId::SaveLeftCaptureGroup ? Op::SaveLeftCaptureGroup
+                : opcode_id == OpCodeId::SaveRightCaptureGroup    ? Op::SaveRightCaptureGroup
+                                                                  : Op::ClearCaptureGroup;
+            m_instructions.append({ .op = op, .argument = *id });
+            break;
+        }
+        case OpCodeId::SaveRightNamedCaptureGroup: {
+            auto id = capture_group_id(argument(1));
+            if (!id.has_value())
+                return false;
+            m_instructions.append({ .op = Op::SaveRightNamedCaptureGroup, .argument = *id, .extra = argument(0) });
+            break;
+        }
+        case OpCodeId::Exit:
+            // An explicit Exit only succeeds past the end of the input, which can't happen here.
+            m_instructions.append({ .op = Op::Fail });
+            break;
+        default:
+            // Lookaround and FailForks need the interpreter's saved positions and fork bookkeeping.
+            return false;
+        }
+
+        ++index;
+    }
+
+    instruction_at_position[bytecode_size] = m_instructions.size();
+    m_instructions.append({ .op = Op::Succeed });
+
+    for (auto& instruction : m_instructions) {
+        switch (instruction.op) {
+        case Op::Jump:
+        case Op::ForkJump:
+        case Op::ForkStay:
+        case Op::ForkReplaceJump:
+        case Op::ForkReplaceStay:
+        case Op::JumpNonEmpty:
+        case Op::Repeat:
+            instruction.target = instruction_at_position[instruction.target];
+            if (instruction.target == no_instruction)
+                return false;
+            break;
+        default:
+            break;
+        }
+    }
+
+    return true;
+}
+
+CompiledMatcher::Result CompiledMatcher::execute(MatchInput const& input, MatchState& state, size_t& operations) const
+{
+    // Matching by code point or ignoring case is left to the interpreter.
+    if (input.view.unicode() || input.regex_options.has_flag_set(AllFlags::Insensitive))
+        return Result::Unsupported;
+
+    return input.view.visit_code_units([&](auto subject) {
+        return run(subject, input, state, operations);
+    });
+}
+
+template<typename CodeUnit>
+CompiledMatcher::Result CompiledMatcher::run(ReadonlySpan<CodeUnit> subject, MatchInput const& input, MatchState& state, size_t& operations) const
+{
+    auto const length = subject.size();
+    auto const& options = input.regex_options;
+    auto const dot_matches_line_terminators = options.has_flag_set(AllFlags::SingleLine) && options.has_flag_set(AllFlags::Internal_ConsiderNewline);
+    auto const ecma262_dot_semantics = options.has_flag_set(AllFlags::Internal_ECMA262DotSemantics);
+    auto const newlines_separate_lines = options.has_flag_set(AllFlags::Multiline) && options.has_flag_set(AllFlags::Internal_ConsiderNewline);
+    auto const match_not_begin_of_line = options.has_flag_set(AllFlags::MatchNotBeginOfLine);
+    auto const match_not_end_of_line = options.has_flag_set(AllFlags::MatchNotEndOfLine);
+
+    size_t position = state.string_position;
+    u32 instruction_index = 0;
+
+    // The capture groups of the current match, starting from whatever the interpreter would have seen.
+    auto const capture_slot_count = m_tracks_captures ? m_capture_group_count : 0;
+    Vector<Match, 4> captures;
+    bool captures_allocated = false;
+    if (capture_slot_count != 0) {
+        if (input.match_index < state.capture_group_matches_size()) {
+            captures.append(state.capture_group_matches(input.match_index).data(), capture_slot_count);
+            captures_allocated = true;
+        } else {
+            captures.resize(capture_slot_count);
+        }
+    }
+
+    // Checkpoints and repetition counters, which are part of the state that backtracking restores.
+    Vector<u64, 8> registers;
+    registers.resize(m_register_count);
+
+    // A frame is a point to resume from once the current path fails. The captures and registers it restores are kept
+    // in separate arrays, at the frame's index. Loop frames resume at each position of a greedy run, from last to first.
+    struct Frame {
+        u32 instruction_index { 0 };
+        u32 initiating_fork { no_instruction };
+        size_t position { 0 };
+        size_t loop_start { 0 };
+        bool is_loop { false };
+        bool captures_allocated { false };
+    };
+    Vector<Frame, 16> frames;
+    Vector<Match> capture_snapshots;
+    Vector<u64> register_snapshots;
+
+    auto push_frame = [&](Frame frame) {
+        frames.append(frame);
+        capture_snapshots.append(captures.data(), capture_slot_count);
+        register_snapshots.append(registers.data(), m_register_count);
+    };
+
+    auto fork = [&](u32 resume_at, u32 initiating_fork, bool replace) {
+        Frame frame { .instruction_index = resume_at, .initiating_fork = initiating_fork, .position = position, .loop_start = position, .captures_allocated = captures_allocated };
+        if (replace) {
+            // Same as the interpreter: overwrite the latest frame created by this fork, if it's still around.
+            for (size_t i = frames.size(); i-- > 0;) {
+                if (frames[i].initiating_fork != initiating_fork)
+                    continue;
+                frames[i] = frame;
+                for (size_t j = 0; j < capture_slot_count; ++j)
+                    capture_snapshots[i * capture_slot_count + j] = captures[j];
+                for (size_t j = 0; j < m_register_count; ++j)
+                    register_snapshots[i * m_register_count + j] = registers[j];
+                return;
+            }
+        }
+        push_frame(frame);
+    };
+
+    auto write_back = [&] {
+        state.string_position = position;
+        state.string_position_in_code_units = position;
+        if (!captures_allocated)
+            return;
+        if (input.match_index >= state.capture_group_matches_size()) {
+            state.flat_capture_group_matches.ensure_capacity((input.match_index + 1) * state.capture_group_count);
+            for (size_t i = state.capture_group_matches_size(); i <= input.match_index; ++i)
+                for (size_t j = 0; j < state.capture_group_count; ++j)
+                    state.flat_capture_group_matches.append({});
+        }
+        auto groups = state.mutable_capture_group_matches(input.match_index);
+        for (size_t i = 0; i < capture_slot_count; ++i)
+            groups[i] = captures[i];
+    };
+
+    auto const backtrack_limit = max(length * backtracks_per_code_unit, minimum_backtrack_limit);
+    size_t backtrack_count = 0;
+
+    for (;;) {
+        auto const& instruction = m_instructions[instruction_index];
+        ++operations;
+
+        switch (instruction.op) {
+        case Op::Succeed:
+            write_back();
+            return Result::Matched;
+        case Op::Fail:
+            break;
+        case Op::MatchCharacter:
+            if (position >= length || subject[position] != instruction.argument)
+                break;
+            ++position;
+            ++instruction_index;
+            continue;
+        case Op::MatchSet:
+            if (position >= length || !m_character_sets[instruction.argument].matches(subject[position], dot_matches_line_terminators, ecma262_dot_semantics))
+                break;
+            ++position;
+            ++instruction_index;
+            continue;
+        case Op::MatchString: {
+            auto string = m_strings[instruction.argument].bytes();
+            if (length - min(position, length) < string.size())
+                break;
+            bool equal = true;
+            for (size_t i = 0; i < string.size() && equal; ++i)
+                equal = subject[position + i] == string[i];
+            if (!equal)
+                break;
+            position += string.size();
+            ++instruction_index;
+            continue;
+        }
+        case Op::GreedyLoop:
+        case Op::PossessiveLoop: {
+            auto const& set = m_character_sets[instruction.argument];
+            auto const* code_units = subject.data();
+            auto loop_start = position;
+            while (position < length && set.matches(code_units[position], dot_matches_line_terminators, ecma262_dot_semantics))
+                ++position;
+            ++instruction_index;
+            if (instruction.op == Op::GreedyLoop && position > loop_start)
+                push_frame({ .instruction_index = instruction_index, .position = position - 1, .loop_start = loop_start, .is_loop = true, .captures_allocated = captures_allocated });
+            continue;
+        }
+        case Op::Jump:
+            instruction_index = instruction.target;
+            continue;
+        case Op::ForkJump:
+        case Op::ForkReplaceJump:
+            fork(instruction_index + 1, instruction_index, instruction.op == Op::ForkReplaceJump);
+            instruction_index = instruction.target;
+            continue;
+        case Op::ForkStay:
+        case Op::ForkReplaceStay:
+            fork(instruction.target, instruction_index, instruction.op == Op::ForkReplaceStay);
+            ++instruction_index;
+            continue;
+        case Op::JumpNonEmpty: {
+            auto form = static_cast<OpCodeId>(instruction.extra);
+            auto checkpoint = registers[instruction.argument];
+            if (checkpoint != 0 && checkpoint != position + 1) {
+                switch (form) {
+                case OpCodeId::Jump:
+                    instruction_index = instruction.target;
+                    break;
+                case OpCodeId::ForkJump:
+                case OpCodeId::ForkReplaceJump:
+                    fork(instruction_index + 1, instruction_index, form == OpCodeId::ForkReplaceJump);
+                    instruction_index = instruction.target;
+                    break;
+                case OpCodeId::ForkStay:
+                case OpCodeId::ForkReplaceStay:
+                    fork(instruction.target, instruction_index, form == OpCodeId::ForkReplaceStay);
+                    ++instruction_index;
+                    break;
+                default:
+                    VERIFY_NOT_REACHED();
+                }
+                continue;
+            }
+            if (form == OpCodeId::Jump && position < length)
+                break;
+            ++instruction_index;
+            continue;
+        }
+        case Op::Checkpoint:
+            registers[instruction.argument] = position + 1;
+            ++instruction_index;
+            continue;
+        case Op::Repeat: {
+            auto& repetition_mark = registers[instruction.argument];
+            if (repetition_mark == instruction.extra - 1) {
+                repetition_mark = 0;
+                ++instruction_index;
+            } else {
+                ++repetition_mark;
+                instruction_index = instruction.target;
+            }
+            continue;
+        }
+        case Op::ResetRepeat:
+            registers[instruction.argument] = 0;
+            ++instruction_index;
+            continue;
+        case Op::CheckBegin: {
+            auto is_at_line_boundary = position == 0 || (newlines_separate_lines && is_line_terminator(subject[position - 1]));
+            if (is_at_line_boundary == match_not_begin_of_line)
+                break;
+            ++instruction_index;
+            continue;
+        }
+        case Op::CheckEnd: {
+            auto is_at_line_boundary = position == length || (newlines_separate_lines && is_line_terminator(subject[position]));
+            if (is_at_line_boundary ? match_not_end_of_line : !(match_not_end_of_line || match_not_begin_of_line))
+                break;
+            ++instruction_index;
+            continue;
+        }
+        case Op::CheckBoundary: {
+            auto is_word = [](u32 code_unit) { return is_ascii_alphanumeric(code_unit) || code_unit == '_'; };
+            bool is_word_boundary;
+            if (position == length)
+                is_word_boundary = position > 0 && is_word(subject[position - 1]);
+            else if (position == 0)
+                is_word_boundary = is_word(subject[0]);
+            else
+                is_word_boundary = is_word(subject[position]) != is_word(subject[position - 1]);
+            if (is_word_boundary != (static_cast<BoundaryCheckType>(instruction.argument) == BoundaryCheckType::Word))
+                break;
+            ++instruction_index;
+            continue;
+        }
+        case Op::SaveLeftCaptureGroup:
+            captures_allocated = true;
+            captures[instruction.argument - 1].left_column = position;
+            ++instruction_index;
+            continue;
+        case Op::SaveRightCaptureGroup:
+        case Op::SaveRightNamedCaptureGroup: {
+            // This mirrors OpCode_SaveRightCaptureGroup::execute(), including its handling of empty iterations.
+            auto& match = captures[instruction.argument - 1];
+            auto start_position = match.left_column;
+            if (position < start_position)
+                break;
+            ++instruction_index;
+
+            auto capture_length = position - start_position;
+            if (start_position < match.column)
+                continue;
+            if (capture_length == 0 && !match.view.is_null() && match.view.length() > 0) {
+                auto existing_end_position = match.global_offset - input.global_offset + match.view.length();
+                if (existing_end_position == position)
+                    continue;
+            }
+
+            auto captured_text = input.view.substring_view(start_position, capture_length);
+            if (instruction.op == Op::SaveRightNamedCaptureGroup)
+                match = { captured_text, static_cast<size_t>(instruction.extra), input.line, start_position, input.global_offset + start_position };
+            else
+                match = { captured_text, input.line, start_position, input.global_offset + start_position };
+            continue;
+        }
+        case Op::ClearCaptureGroup:
+            if (captures_allocated)
+                captures[instruction.argument - 1].reset();
+            ++instruction_index;
+            continue;
+        }
+
+        // The current path failed, resume from the most recent frame.
+        if (frames.is_empty()) {
+            write_back();
+            return Result::DidNotMatch;
+        }
+        if (++backtrack_count > backtrack_limit)
+            return Result::Unsupported;
+
+        auto frame_index = frames.size() - 1;
+        auto& frame = frames[frame_index];
+        position = frame.position;
+        instruction_index = frame.instruction_index;
+        captures_allocated = frame.captures_allocated;
+        for (size_t j = 0; j < capture_slot_count; ++j)
+            captures[j] = capture_snapshots[frame_index * capture_slot_count + j];
+        for (size_t j = 0; j < m_register_count; ++j)
+            registers[j] = register_snapshots[frame_index * m_register_count + j];
+
+        if (frame.is_loop && frame.position > frame.loop_start) {
+            --frame.position;
+        } else {
+            frames.take_last();
+            capture_snapshots.shrink(frame_index * capture_slot_count, true);
+            register_snapshots.shrink(frame_index * m_register_count, true);
+        }
+    }
+}
+
+}
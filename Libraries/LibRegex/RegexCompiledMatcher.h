@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include "RegexByteCode.h"
+#include "RegexMatch.h"
+
+#include <AK/ByteString.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/OwnPtr.h>
+#include <AK/Span.h>
+#include <AK/Types.h>
+#include <AK/Vector.h>
+
+namespace regex {
+
+// A second execution tier for the subset of bytecode that most real-world patterns compile to: literal runs,
+// character sets, greedy and counted loops, anchors and capture groups.
+//
+// The bytecode is translated once into a flat instruction array that is run by a single switch, and backtracking
+// points are small frames instead of copies of the whole MatchState. A greedy loop over a single character set
+// becomes one instruction that consumes the whole run, then gives it back one code unit at a time.
+//
+// Patterns outside of that subset (lookaround, backreferences, Unicode properties...) and inputs that need
+// case-insensitive or Unicode-aware matching keep running on the bytecode interpreter. So do matches that
+// backtrack excessively, as the interpreter can prune states it has already explored.
+class CompiledMatcher {
+public:
+    static OwnPtr<CompiledMatcher> compile(ByteCode const&, size_t capture_group_count);
+
+    enum class Result : u8 {
+        Matched,
+        DidNotMatch,
+        Unsupported,
+    };
+
+    Result execute(MatchInput const&, MatchState&, size_t& operations) const;
+
+private:
+    CompiledMatcher(size_t capture_group_count)
+        : m_capture_group_count(capture_group_count)
+    {
+    }
+
+    enum class Op : u8 {
+        Succeed,
+        Fail,
+        MatchCharacter,
+        MatchSet,
+        MatchString,
+        GreedyLoop,
+        PossessiveLoop,
+        Jump,
+        ForkJump,
+        ForkStay,
+        ForkReplaceJump,
+        ForkReplaceStay,
+        JumpNonEmpty,
+        Checkpoint,
+        Repeat,
+        ResetRepeat,
+        CheckBegin,
+        CheckEnd,
+        CheckBoundary,
+        SaveLeftCaptureGroup,
+        SaveRightCaptureGroup,
+        SaveRightNamedCaptureGroup,
+        ClearCaptureGroup,
+    };
+
+    struct Instruction {
+        Op op;
+        u32 argument { 0 }; // Code unit, set, string, register or capture group, depending on the op.
+        u32 target { 0 };   // Instruction index for jumps, forks and repeats.
+        u64 extra { 0 };    // Repeat count, JumpNonEmpty form or capture group name.
+    };
+
+    struct CharacterSet {
+        bool matches(u32 code_unit, bool dot_matches_line_terminators, bool ecma262_dot_semantics) const;
+
+        u64 ascii_bitmap[2] {};
+        Vector<CharRange> ranges;
+        Vector<CharClass> classes;
+        bool any_character { false };
+        bool inverse { false };
+    };
+
+    bool translate(ByteCode const&);
+    Optional<CharacterSet> translate_character_set(ReadonlySpan<ByteCodeValueType> arguments, size_t argument_count) const;
+    bool translate_compare(ReadonlySpan<ByteCodeValueType> arguments, size_t argument_count);
+
+    template<typename CodeUnit>
+    Result run(ReadonlySpan<CodeUnit> subject, MatchInput const&, MatchState&, size_t& operations) const;
+
+    Vector<Instruction> m_instructions;
+    Vector<CharacterSet> m_character_sets;
+    Vector<ByteString> m_strings;
+    size_t m_capture_group_count { 0 };
+    size_t m_register_count { 0 };
+    bool m_tracks_captures { false };
+};
+
+}
@@ -32,23 +32,24 @@ enum __Regex_Error {
 };
 
 enum __RegexAllFlags {
-    __Regex_Global = 1,                                          // All matches (don't return after first match)
-    __Regex_Insensitive = __Regex_Global << 1,                   // Case insensitive match (ignores case of [a-zA-Z])
-    __Regex_Ungreedy = __Regex_Global << 2,                      // The match becomes lazy by default. Now a ? following a quantifier makes it greedy
-    __Regex_Unicode = __Regex_Global << 3,                       // Enable all unicode features and interpret all unicode escape sequences as such
-    __Regex_Extended = __Regex_Global << 4,                      // Ignore whitespaces. Spaces and text after a # in the pattern are ignored
-    __Regex_Extra = __Regex_Global << 5,                         // Disallow meaningless escapes. A \ followed by a letter with no special meaning is faulted
-    __Regex_MatchNotBeginOfLine = __Regex_Global << 6,           // Pattern is not forced to ^ -> search in whole string!
-    __Regex_MatchNotEndOfLine = __Regex_Global << 7,             // Don't Force the dollar sign, $, to always match end of the string, instead of end of the line. This option is ignored if the Multiline-flag is set
-    __Regex_SkipSubExprResults = __Regex_Global << 8,            // Do not return sub expressions in the result
-    __Regex_SingleLine = __Regex_Global << 10,                   // Dot matches newline characters
-    __Regex_Sticky = __Regex_Global << 11,                       // Force the pattern to only match consecutive matches from where the previous match ended.
-    __Regex_Multiline = __Regex_Global << 12,                    // Handle newline characters. Match each line, one by one.
-    __Regex_SingleMatch = __Regex_Global << 13,                  // Stop after acquiring a single match.
-    __Regex_UnicodeSets = __Regex_Global << 14,                  // ECMA262 Parser specific: Allow set operations in char classes.
-    __Regex_Internal_Stateful = __Regex_Global << 15,            // Internal flag; enables stateful matches.
-    __Regex_Internal_BrowserExtended = __Regex_Global << 16,     // Internal flag; enable browser-specific ECMA262 extensions.
-    __Regex_Internal_ConsiderNewline = __Regex_Global << 17,     // Internal flag; allow matchers to consider newlines as line separators.
-    __Regex_Internal_ECMA262DotSemantics = __Regex_Global << 18, // Internal flag; use ECMA262 semantics for dot ('.') - disallow CR/LF/LS/PS instead of just CR.
-    __Regex_Last = __Regex_Internal_ECMA262DotSemantics,
+    __Regex_Global = 1,                                             // All matches (don't return after first match)
+    __Regex_Insensitive = __Regex_Global << 1,                      // Case insensitive match (ignores case of [a-zA-Z])
+    __Regex_Ungreedy = __Regex_Global << 2,                         // The match becomes lazy by default. Now a ? following a quantifier makes it greedy
+    __Regex_Unicode = __Regex_Global << 3,                          // Enable all unicode features and interpret all unicode escape sequences as such
+    __Regex_Extended = __Regex_Global << 4,                         // Ignore whitespaces. Spaces and text after a # in the pattern are ignored
+    __Regex_Extra = __Regex_Global << 5,                            // Disallow meaningless escapes. A \ followed by a letter with no special meaning is faulted
+    __Regex_MatchNotBeginOfLine = __Regex_Global << 6,              // Pattern is not forced to ^ -> search in whole string!
+    __Regex_MatchNotEndOfLine = __Regex_Global << 7,                // Don't Force the dollar sign, $, to always match end of the string, instead of end of the line. This option is ignored if the Multiline-flag is set
+    __Regex_SkipSubExprResults = __Regex_Global << 8,               // Do not return sub expressions in the result
+    __Regex_SingleLine = __Regex_Global << 10,                      // Dot matches newline characters
+    __Regex_Sticky = __Regex_Global << 11,                          // Force the pattern to only match consecutive matches from where the previous match ended.
+    __Regex_Multiline = __Regex_Global << 12,                       // Handle newline characters. Match each line, one by one.
+    __Regex_SingleMatch = __Regex_Global << 13,                     // Stop after acquiring a single match.
+    __Regex_UnicodeSets = __Regex_Global << 14,                     // ECMA262 Parser specific: Allow set operations in char classes.
+    __Regex_Internal_Stateful = __Regex_Global << 15,               // Internal flag; enables stateful matches.
+    __Regex_Internal_BrowserExtended = __Regex_Global << 16,        // Internal flag; enable browser-specific ECMA262 extensions.
+    __Regex_Internal_ConsiderNewline = __Regex_Global << 17,        // Internal flag; allow matchers to consider newlines as line separators.
+    __Regex_Internal_ECMA262DotSemantics = __Regex_Global << 18,    // Internal flag; use ECMA262 semantics for dot ('.') - disallow CR/LF/LS/PS instead of just CR.
+    __Regex_Internal_DisableCompiledMatcher = __Regex_Global << 19, // Internal flag; always run the bytecode interpreter, even if the pattern was compiled.
+    __Regex_Last = __Regex_Internal_DisableCompiledMatcher,
 };
@@ -297,6 +297,19 @@ public:
             [&](StringView view) { return view.starts_with(str); });
     }
 
+    // Calls the callback with the raw code units of the view: a span of bytes for UTF-8 and ASCII views, or a span of char16_t otherwise.
+    template<typename Callback>
+    decltype(auto) visit_code_units(Callback&& callback) const
+    {
+        return m_view.visit(
+            [&](StringView view) { return callback(view.bytes()); },
+            [&](Utf16View const& view) {
+                if (view.has_ascii_storage())
+                    return callback(view.bytes());
+                return callback(view.utf16_span());
+            });
+    }
+
 private:
     NO_UNIQUE_ADDRESS Variant<StringView, Utf16View> m_view { StringView {} };
     NO_UNIQUE_ADDRESS bool m_unicode { false };
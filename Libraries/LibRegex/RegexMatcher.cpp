@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <AK/BinarySearch.h>
 #include <AK/BumpAllocator.h>
 #include <AK/ByteString.h>
@@ -142,6 +143,53 @@ ByteString Regex<Parser>::error_string(Optional<ByteString> message) const
     return eb.to_byte_string();
 }
 
+// Returns the first position at or after the start where the view contains the literal, looking for candidates with
+// memchr() (or a vectorized search for UTF-16 storage) before comparing the rest of the literal.
+static Optional<size_t> find_literal(RegexStringView const& view, ReadonlySpan<u16> literal, size_t start)
+{
+    return view.visit_code_units([&](auto code_units) -> Optional<size_t> {
+        using CodeUnit = RemoveCVReference<decltype(code_units[0])>;
+
+        auto const first = literal.first();
+        if constexpr (sizeof(CodeUnit) == 1) {
+            // A byte can never be equal to a wider code unit.
+            if (any_of(literal, [](u16 code_unit) { return code_unit > 0xff; }))
+                return {};
+        }
+
+        while (start + literal.size() <= code_units.size()) {
+            Optional<size_t> candidate;
+            if constexpr (sizeof(CodeUnit) == 1) {
+                if (auto const* found = static_cast<u8 const*>(memchr(code_units.data() + start, first, code_units.size() - start)))
+                    candidate = found - code_units.data();
+            } else {
+                candidate = Utf16View { code_units.data(), code_units.size() }.find_code_unit_offset(first, start);
+            }
+
+            if (!candidate.has_value() || *candidate + literal.size() > code_units.size())
+                return {};
+
+            bool matches = true;
+            for (size_t i = 1; i < literal.size() && matches; ++i)
+                matches = code_units[*candidate + i] == literal[i];
+            if (matches)
+                return *candidate;
+
+            start = *candidate + 1;
+        }
+
+        return {};
+    });
+}
+
+template<typename Parser>
+Matcher<Parser>::Matcher(Regex<Parser> const* pattern, Optional<typename ParserTraits<Parser>::OptionsType> regex_options)
+    : m_pattern(pattern)
+    , m_regex_options(regex_options.value_or({}))
+    , m_compiled_matcher(CompiledMatcher::compile(pattern->parser_result.bytecode, pattern->parser_result.capture_groups_count))
+{
+}
+
 template<typename Parser>
 RegexResult Matcher<Parser>::match(RegexStringView view, Optional<typename ParserTraits<Parser>::OptionsType> regex_options) const
 {
@@ -211,6 +259,10 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
     auto single_match_only = input.regex_options.has_flag_set(AllFlags::SingleMatch);
     auto only_start_of_line = m_pattern->parser_result.optimization_data.only_start_of_line && !input.regex_options.has_flag_set(AllFlags::Multiline);
 
+    // Positions are code points in Unicode mode, so only code unit searches can jump straight to the literal prefix.
+    auto const& literal_prefix = m_pattern->parser_result.optimization_data.literal_prefix;
+    auto skip_to_literal_prefix = continue_search && !literal_prefix.is_empty() && !unicode && !input.regex_options.has_flag_set(AllFlags::Insensitive);
+
     auto compare_range = [insensitive = input.regex_options & AllFlags::Insensitive](auto needle, CharRange range) {
         auto upper_case_needle = needle;
         auto lower_case_needle = needle;
@@ -285,6 +337,13 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
                     break;
             }
 
+            if (skip_to_literal_prefix) {
+                auto candidate = find_literal(input.view, literal_prefix, view_index);
+                if (!candidate.has_value())
+                    break;
+                view_index = *candidate;
+            }
+
             // FIXME: More performant would be to know the remaining minimum string
             //        length needed to match from the current position onwards within
             //        the vm. Add new OpCode for MinMatchLengthFromSp with the value of
@@ -499,6 +558,18 @@ struct SufficientlyUniformValueTraits : DefaultTraits<u64> {
 template<class Parser>
 bool Matcher<Parser>::execute(MatchInput const& input, MatchState& state, size_t& operations) const
 {
+    if (m_compiled_matcher && !input.regex_options.has_flag_set(AllFlags::Internal_DisableCompiledMatcher)) {
+        // The compiled matcher leaves the state untouched when it gives up, so the interpreter can start over.
+        switch (m_compiled_matcher->execute(input, state, operations)) {
+        case CompiledMatcher::Result::Matched:
+            return true;
+        case CompiledMatcher::Result::DidNotMatch:
+            return false;
+        case CompiledMatcher::Result::Unsupported:
+            break;
+        }
+    }
+
     BumpAllocatedLinkedList<MatchState> states_to_try_next;
     HashTable<u64, SufficientlyUniformValueTraits> seen_state_hashes;
 #if REGEX_DEBUG
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "RegexByteCode.h"
+#include "RegexCompiledMatcher.h"
 #include "RegexMatch.h"
 #include "RegexOptions.h"
 #include "RegexParser.h"
@@ -50,11 +51,7 @@ template<class Parser>
 class REGEX_API Matcher final {
 
 public:
-    Matcher(Regex<Parser> const* pattern, Optional<typename ParserTraits<Parser>::OptionsType> regex_options = {})
-        : m_pattern(pattern)
-        , m_regex_options(regex_options.value_or({}))
-    {
-    }
+    Matcher(Regex<Parser> const* pattern, Optional<typename ParserTraits<Parser>::OptionsType> regex_options = {});
     ~Matcher() = default;
 
     RegexResult match(RegexStringView, Optional<typename ParserTraits<Parser>::OptionsType> = {}) const;
@@ -75,6 +72,7 @@ private:
 
     Regex<Parser> const* m_pattern;
     typename ParserTraits<Parser>::OptionsType const m_regex_options;
+    OwnPtr<CompiledMatcher> m_compiled_matcher;
 };
 
 template<class Parser>
@@ -232,6 +230,7 @@ private:
     void attempt_rewrite_loops_as_atomic_groups(BasicBlockList const&);
     bool attempt_rewrite_entire_match_as_substring_search(BasicBlockList const&);
     void fill_optimization_data(BasicBlockList const&);
+    void fill_literal_prefix(BasicBlockList const&);
 };
 
 // free standing functions for match, search and has_match
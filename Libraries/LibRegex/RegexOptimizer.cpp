@@ -31,14 +31,18 @@ void Regex<Parser>::run_optimization_passes()
     rewrite_with_useless_jumps_removed();
 
     auto blocks = split_basic_blocks(parser_result.bytecode);
-    if (attempt_rewrite_entire_match_as_substring_search(blocks))
+    if (attempt_rewrite_entire_match_as_substring_search(blocks)) {
+        fill_literal_prefix(blocks);
         return;
+    }
 
     // Rewrite fork loops as atomic groups
     // e.g. a*b -> (ATOMIC a*)b
     attempt_rewrite_loops_as_atomic_groups(blocks);
 
-    fill_optimization_data(split_basic_blocks(parser_result.bytecode));
+    blocks = split_basic_blocks(parser_result.bytecode);
+    fill_optimization_data(blocks);
+    fill_literal_prefix(blocks);
 
     parser_result.bytecode.flatten();
 }
@@ -803,6 +807,48 @@ static AtomicRewritePreconditionResult block_satisfies_atomic_rewrite_preconditi
     return AtomicRewritePreconditionResult::SatisfiedWithEmptyHeader;
 }
 
+template<class Parser>
+void Regex<Parser>::fill_literal_prefix(BasicBlockList const& blocks)
+{
+    // Every match runs through the first basic block, so the characters it compares one after another before anything
+    // else can consume input must start the match. Matcher::match() uses them to skip ahead to candidate positions.
+    if (blocks.is_empty())
+        return;
+
+    auto& bytecode = parser_result.bytecode;
+    auto& prefix = parser_result.optimization_data.literal_prefix;
+
+    auto state = MatchState::only_for_enumeration();
+    auto block = blocks.first();
+    for (state.instruction_position = block.start; state.instruction_position < block.end;) {
+        auto& opcode = bytecode.get_opcode(state);
+        switch (opcode.opcode_id()) {
+        case OpCodeId::Compare: {
+            auto& compare = static_cast<OpCode_Compare const&>(opcode);
+            // Multiple arguments are alternatives, except for a single String argument.
+            if (compare.arguments_count() != 1)
+                return;
+            for (auto& flat_compare : compare.flat_compares()) {
+                if (flat_compare.type != CharacterCompareType::Char || flat_compare.value > NumericLimits<u16>::max())
+                    return;
+                prefix.append(static_cast<u16>(flat_compare.value));
+            }
+            break;
+        }
+        case OpCodeId::Checkpoint:
+        case OpCodeId::ClearCaptureGroup:
+        case OpCodeId::SaveLeftCaptureGroup:
+        case OpCodeId::SaveRightCaptureGroup:
+        case OpCodeId::SaveRightNamedCaptureGroup:
+            // These do not 'match' anything, so look through them.
+            break;
+        default:
+            return;
+        }
+        state.instruction_position += opcode.size();
+    }
+}
+
 template<typename Parser>
 bool Regex<Parser>::attempt_rewrite_entire_match_as_substring_search(BasicBlockList const& basic_blocks)
 {
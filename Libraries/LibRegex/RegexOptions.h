@@ -16,24 +16,25 @@ using FlagsUnderlyingType = u32;
 
 enum class AllFlags {
     Default = 0,
-    Global = __Regex_Global,                                             // All matches (don't return after first match)
-    Insensitive = __Regex_Insensitive,                                   // Case insensitive match (ignores case of [a-zA-Z])
-    Ungreedy = __Regex_Ungreedy,                                         // The match becomes lazy by default. Now a ? following a quantifier makes it greedy
-    Unicode = __Regex_Unicode,                                           // Enable all unicode features and interpret all unicode escape sequences as such
-    Extended = __Regex_Extended,                                         // Ignore whitespaces. Spaces and text after a # in the pattern are ignored
-    Extra = __Regex_Extra,                                               // Disallow meaningless escapes. A \ followed by a letter with no special meaning is faulted
-    MatchNotBeginOfLine = __Regex_MatchNotBeginOfLine,                   // Pattern is not forced to ^ -> search in whole string!
-    MatchNotEndOfLine = __Regex_MatchNotEndOfLine,                       // Don't Force the dollar sign, $, to always match end of the string, instead of end of the line. This option is ignored if the Multiline-flag is set
-    SkipSubExprResults = __Regex_SkipSubExprResults,                     // Do not return sub expressions in the result
-    SingleLine = __Regex_SingleLine,                                     // Dot matches newline characters
-    Sticky = __Regex_Sticky,                                             // Force the pattern to only match consecutive matches from where the previous match ended.
-    Multiline = __Regex_Multiline,                                       // Handle newline characters. Match each line, one by one.
-    SingleMatch = __Regex_SingleMatch,                                   // Stop after acquiring a single match.
-    UnicodeSets = __Regex_UnicodeSets,                                   // Only for ECMA262, Allow set operations in character classes.
-    Internal_Stateful = __Regex_Internal_Stateful,                       // Make global matches match one result at a time, and further match() calls on the same instance continue where the previous one left off.
-    Internal_BrowserExtended = __Regex_Internal_BrowserExtended,         // Only for ECMA262, Enable the behaviors defined in section B.1.4. of the ECMA262 spec.
-    Internal_ConsiderNewline = __Regex_Internal_ConsiderNewline,         // Only for ECMA262, Allow multiline matches to consider newlines as line boundaries.
-    Internal_ECMA262DotSemantics = __Regex_Internal_ECMA262DotSemantics, // Use ECMA262 dot semantics: disallow matching CR/LF/LS/PS instead of just CR.
+    Global = __Regex_Global,                                                   // All matches (don't return after first match)
+    Insensitive = __Regex_Insensitive,                                         // Case insensitive match (ignores case of [a-zA-Z])
+    Ungreedy = __Regex_Ungreedy,                                               // The match becomes lazy by default. Now a ? following a quantifier makes it greedy
+    Unicode = __Regex_Unicode,                                                 // Enable all unicode features and interpret all unicode escape sequences as such
+    Extended = __Regex_Extended,                                               // Ignore whitespaces. Spaces and text after a # in the pattern are ignored
+    Extra = __Regex_Extra,                                                     // Disallow meaningless escapes. A \ followed by a letter with no special meaning is faulted
+    MatchNotBeginOfLine = __Regex_MatchNotBeginOfLine,                         // Pattern is not forced to ^ -> search in whole string!
+    MatchNotEndOfLine = __Regex_MatchNotEndOfLine,                             // Don't Force the dollar sign, $, to always match end of the string, instead of end of the line. This option is ignored if the Multiline-flag is set
+    SkipSubExprResults = __Regex_SkipSubExprResults,                           // Do not return sub expressions in the result
+    SingleLine = __Regex_SingleLine,                                           // Dot matches newline characters
+    Sticky = __Regex_Sticky,                                                   // Force the pattern to only match consecutive matches from where the previous match ended.
+    Multiline = __Regex_Multiline,                                             // Handle newline characters. Match each line, one by one.
+    SingleMatch = __Regex_SingleMatch,                                         // Stop after acquiring a single match.
+    UnicodeSets = __Regex_UnicodeSets,                                         // Only for ECMA262, Allow set operations in character classes.
+    Internal_Stateful = __Regex_Internal_Stateful,                             // Make global matches match one result at a time, and further match() calls on the same instance continue where the previous one left off.
+    Internal_BrowserExtended = __Regex_Internal_BrowserExtended,               // Only for ECMA262, Enable the behaviors defined in section B.1.4. of the ECMA262 spec.
+    Internal_ConsiderNewline = __Regex_Internal_ConsiderNewline,               // Only for ECMA262, Allow multiline matches to consider newlines as line boundaries.
+    Internal_ECMA262DotSemantics = __Regex_Internal_ECMA262DotSemantics,       // Use ECMA262 dot semantics: disallow matching CR/LF/LS/PS instead of just CR.
+    Internal_DisableCompiledMatcher = __Regex_Internal_DisableCompiledMatcher, // Always run the bytecode interpreter, even if the pattern was compiled.
     Last = Internal_BrowserExtended,
 };
 
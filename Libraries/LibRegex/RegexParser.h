@@ -67,6 +67,8 @@ public:
             // If populated, the pattern only accepts strings that start with a character in these ranges.
             Vector<CharRange> starting_ranges;
             Vector<CharRange> starting_ranges_insensitive;
+            // If populated, the pattern only accepts strings that start with these code units (when matched case-sensitively).
+            Vector<u16> literal_prefix;
             bool only_start_of_line = false;
         } optimization_data {};
     };
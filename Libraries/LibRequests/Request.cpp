@@ -28,6 +28,12 @@ bool Request::stop()
     return m_client->stop_request({}, *this);
 }
 
+void Request::set_priority(::RequestServer::RequestPriority priority)
+{
+    if (m_client)
+        m_client->set_request_priority({}, *this, priority);
+}
+
 void Request::set_request_fd(Badge<Requests::RequestClient>, int fd)
 {
     // If the request was stopped while this IPC was in-flight, just bail.
@@ -16,6 +16,7 @@
 #include <LibHTTP/HeaderMap.h>
 #include <LibRequests/NetworkError.h>
 #include <LibRequests/RequestTimingInfo.h>
+#include <RequestServer/RequestPriority.h>
 
 namespace Requests {
 
@@ -37,6 +38,9 @@ public:
     int fd() const { return m_fd; }
     bool stop();
 
+    // Changes the priority with which RequestServer schedules this request, e.g. when an image scrolls into view.
+    void set_priority(::RequestServer::RequestPriority);
+
     using BufferedRequestFinished = Function<void(u64 total_size, RequestTimingInfo const& timing_info, Optional<NetworkError> const& network_error, HTTP::HeaderMap const& response_headers, Optional<u32> response_code, Optional<String> reason_phrase, ReadonlyBytes payload)>;
 
     // Configure the request such that the entirety of the response data is buffered. The callback receives that data and
@@ -30,13 +30,14 @@ public:
     explicit RequestClient(NonnullOwnPtr<IPC::Transport>);
     virtual ~RequestClient() override;
 
-    RefPtr<Request> start_request(ByteString const& method, URL::URL const&, HTTP::HeaderMap const& request_headers = {}, ReadonlyBytes request_body = {}, Core::ProxyData const& = {});
+    RefPtr<Request> start_request(ByteString const& method, URL::URL const&, HTTP::HeaderMap const& request_headers = {}, ReadonlyBytes request_body = {}, Core::ProxyData const& = {}, ::RequestServer::RequestPriority = ::RequestServer::RequestPriority::Medium);
 
     RefPtr<WebSocket> websocket_connect(URL::URL const&, ByteString const& origin = {}, Vector<ByteString> const& protocols = {}, Vector<ByteString> const& extensions = {}, HTTP::HeaderMap const& request_headers = {});
 
     void ensure_connection(URL::URL const&, ::RequestServer::CacheLevel);
 
     bool stop_request(Badge<Request>, Request&);
+    void set_request_priority(Badge<Request>, Request&, ::RequestServer::RequestPriority);
     bool set_certificate(Badge<Request>, Request&, ByteString, ByteString);
 
     Function<void()> on_request_server_died;
@@ -8,6 +8,7 @@
 
 namespace Threading {
 
+class HelperThreadPool;
 class Thread;
 
 template<typename ErrorType>
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibThreading/HelperThreadPool.h>
+
+namespace Threading {
+
+ErrorOr<NonnullOwnPtr<HelperThreadPool>> HelperThreadPool::create(size_t helper_thread_count, StringView thread_name)
+{
+    auto pool = TRY(adopt_nonnull_own_or_enomem(new (nothrow) HelperThreadPool));
+
+    for (size_t i = 0; i < helper_thread_count; ++i) {
+        auto thread = TRY(Thread::try_create([&pool = *pool, thread_index = i + 1] {
+            return pool.helper_thread_loop(thread_index);
+        },
+            thread_name));
+        thread->start();
+        pool->m_threads.append(move(thread));
+    }
+
+    return pool;
+}
+
+HelperThreadPool::~HelperThreadPool()
+{
+    {
+        MutexLocker locker(m_mutex);
+        m_should_exit = true;
+        m_task_available.broadcast();
+    }
+
+    for (auto& thread : m_threads)
+        (void)thread->join();
+}
+
+void HelperThreadPool::run(AK::Function<void(size_t thread_index)> const& task)
+{
+    MutexLocker run_locker(m_run_mutex);
+
+    {
+        MutexLocker locker(m_mutex);
+        m_task = &task;
+        m_running_helper_count = m_threads.size();
+        ++m_task_generation;
+        m_task_available.broadcast();
+    }
+
+    task(0);
+
+    MutexLocker locker(m_mutex);
+    while (m_running_helper_count > 0)
+        m_task_finished.wait();
+    m_task = nullptr;
+}
+
+intptr_t HelperThreadPool::helper_thread_loop(size_t thread_index)
+{
+    u64 last_task_generation = 0;
+
+    while (true) {
+        AK::Function<void(size_t)> const* task = nullptr;
+        {
+            MutexLocker locker(m_mutex);
+            while (m_task_generation == last_task_generation && !m_should_exit)
+                m_task_available.wait();
+            if (m_should_exit)
+                return 0;
+            last_task_generation = m_task_generation;
+            task = m_task;
+        }
+
+        (*task)(thread_index);
+
+        MutexLocker locker(m_mutex);
+        if (--m_running_helper_count == 0)
+            m_task_finished.signal();
+    }
+}
+
+}
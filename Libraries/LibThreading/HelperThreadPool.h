@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Function.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Vector.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/Thread.h>
+
+namespace Threading {
+
+// A small pool of threads that help another thread with a task that it splits up between all of them, such as marking
+// the GC heap. The threads sleep between tasks.
+class HelperThreadPool {
+    AK_MAKE_NONCOPYABLE(HelperThreadPool);
+    AK_MAKE_NONMOVABLE(HelperThreadPool);
+
+public:
+    static ErrorOr<NonnullOwnPtr<HelperThreadPool>> create(size_t helper_thread_count, StringView thread_name);
+    ~HelperThreadPool();
+
+    size_t helper_thread_count() const { return m_threads.size(); }
+
+    // Runs the task on every helper thread and on the calling thread, and returns once all of them have finished.
+    // The calling thread is passed index 0, and the helper threads are numbered from 1. If another thread is already
+    // running a task, this waits for it to finish first.
+    void run(AK::Function<void(size_t thread_index)> const& task);
+
+private:
+    HelperThreadPool() = default;
+
+    intptr_t helper_thread_loop(size_t thread_index);
+
+    Vector<NonnullRefPtr<Thread>> m_threads;
+
+    Mutex m_run_mutex;
+    Mutex m_mutex;
+    ConditionVariable m_task_available { m_mutex };
+    ConditionVariable m_task_finished { m_mutex };
+    AK::Function<void(size_t)> const* m_task { nullptr };
+    u64 m_task_generation { 0 };
+    size_t m_running_helper_count { 0 };
+    bool m_should_exit { false };
+};
+
+}
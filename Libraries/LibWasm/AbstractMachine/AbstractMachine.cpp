@@ -4,7 +4,9 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Debug.h>
 #include <AK/Enumerate.h>
+#include <LibCore/System.h>
 #include <LibWasm/AbstractMachine/AbstractMachine.h>
 #include <LibWasm/AbstractMachine/BytecodeInterpreter.h>
 #include <LibWasm/AbstractMachine/Configuration.h>
@@ -12,8 +14,61 @@
 #include <LibWasm/AbstractMachine/Validator.h>
 #include <LibWasm/Types.h>
 
+#if !defined(AK_OS_WINDOWS)
+#    include <sys/mman.h>
+#endif
+
 namespace Wasm {
 
+Optional<LinearMemoryReservation> LinearMemoryReservation::create()
+{
+#if defined(AK_ARCH_64_BIT) && !defined(AK_OS_WINDOWS)
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#    if defined(MAP_NORESERVE)
+    flags |= MAP_NORESERVE;
+#    endif
+    auto base = Core::System::mmap(nullptr, addressable_size + guard_size, PROT_NONE, flags, -1, 0);
+    if (base.is_error()) {
+        // Running out of address space isn't fatal, the memory just has to be reallocated as it grows.
+        dbgln_if(WASM_TRACE_DEBUG, "LibWasm: Failed to reserve address space for a linear memory: {}", base.error());
+        return {};
+    }
+    return LinearMemoryReservation { static_cast<u8*>(base.value()) };
+#else
+    return {};
+#endif
+}
+
+LinearMemoryReservation& LinearMemoryReservation::operator=(LinearMemoryReservation&& other)
+{
+    swap(m_base, other.m_base);
+    swap(m_committed_size, other.m_committed_size);
+    return *this;
+}
+
+LinearMemoryReservation::~LinearMemoryReservation()
+{
+#if !defined(AK_OS_WINDOWS)
+    if (m_base)
+        MUST(Core::System::munmap(m_base, addressable_size + guard_size));
+#endif
+}
+
+ErrorOr<void> LinearMemoryReservation::commit(size_t size)
+{
+#if !defined(AK_OS_WINDOWS)
+    VERIFY(size <= addressable_size);
+    if (size > m_committed_size) {
+        TRY(Core::System::mprotect(m_base + m_committed_size, size - m_committed_size, PROT_READ | PROT_WRITE));
+        m_committed_size = size;
+    }
+    return {};
+#else
+    (void)size;
+    VERIFY_NOT_REACHED();
+#endif
+}
+
 Optional<FunctionAddress> Store::allocate(ModuleInstance& instance, Module const& module, CodeSection::Code const& code, TypeIndex type_index)
 {
     FunctionAddress address { m_functions.size() };
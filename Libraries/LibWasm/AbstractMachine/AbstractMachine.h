@@ -451,12 +451,54 @@ private:
     TableType m_type;
 };
 
+// Address space that a linear memory grows into without ever moving, so growing never copies the memory. Only the
+// pages in use are accessible; the guard region past the largest possible memory covers any 32-bit address plus a
+// 32-bit offset and the width of the access, so an access past the end of the memory faults instead of reaching into
+// unrelated data. Native code relies on that instead of bounds checking its accesses.
+class LinearMemoryReservation {
+    AK_MAKE_NONCOPYABLE(LinearMemoryReservation);
+
+public:
+    static constexpr u64 addressable_size = 4 * GiB;
+    static constexpr u64 guard_size = 4 * GiB + Constants::page_size;
+
+    // Returns an empty Optional if the platform can't reserve address space without committing it.
+    static Optional<LinearMemoryReservation> create();
+
+    LinearMemoryReservation(LinearMemoryReservation&& other)
+        : m_base(exchange(other.m_base, nullptr))
+        , m_committed_size(exchange(other.m_committed_size, 0))
+    {
+    }
+    LinearMemoryReservation& operator=(LinearMemoryReservation&&);
+    ~LinearMemoryReservation();
+
+    Bytes addressable_bytes() const { return { m_base, addressable_size }; }
+
+    // Makes the first `size` bytes accessible. Newly committed pages are zero-filled.
+    ErrorOr<void> commit(size_t size);
+
+private:
+    explicit LinearMemoryReservation(u8* base)
+        : m_base(base)
+    {
+    }
+
+    u8* m_base { nullptr };
+    size_t m_committed_size { 0 };
+};
+
 class MemoryInstance {
 public:
     static ErrorOr<MemoryInstance> create(MemoryType const& type)
     {
         MemoryInstance instance { type };
 
+        if (auto reservation = LinearMemoryReservation::create(); reservation.has_value()) {
+            instance.m_data = ByteBuffer::create_unowned(reservation->addressable_bytes());
+            instance.m_reservation = reservation.release_value();
+        }
+
         if (!instance.grow(type.limits().min() * Constants::page_size, GrowType::No))
             return Error::from_string_literal("Failed to grow to requested size");
 
@@ -468,6 +510,10 @@ public:
     auto& data() const { return m_data; }
     auto& data() { return m_data; }
 
+    // Whether an access with a 32-bit address and offset past the end of the memory is guaranteed to fault. The data
+    // of such a memory never moves.
+    bool has_guard_region() const { return m_reservation.has_value(); }
+
     enum class InhibitGrowCallback {
         No,
         Yes,
@@ -490,12 +536,19 @@ public:
             if (max.value() * Constants::page_size < new_size)
                 return false;
         }
-        auto previous_size = m_size;
-        if (m_data.try_resize(new_size).is_error())
-            return false;
+        if (m_reservation.has_value()) {
+            // The memory grows in place, and the pages it grows into have never been touched, so they're already zeroed.
+            if (m_reservation->commit(new_size).is_error())
+                return false;
+            m_data.set_size(new_size);
+        } else {
+            auto previous_size = m_size;
+            if (m_data.try_resize(new_size).is_error())
+                return false;
+            // The spec requires that we zero out everything on grow
+            __builtin_memset(m_data.offset_pointer(previous_size), 0, size_to_grow);
+        }
         m_size = new_size;
-        // The spec requires that we zero out everything on grow
-        __builtin_memset(m_data.offset_pointer(previous_size), 0, size_to_grow);
 
         // NOTE: This exists because wasm-js-api wants to execute code after a successful grow,
         //       See [this issue](https://github.com/WebAssembly/spec/issues/1635) for more details.
@@ -524,6 +577,7 @@ private:
     MemoryType m_type;
     size_t m_size { 0 };
     ByteBuffer m_data;
+    Optional<LinearMemoryReservation> m_reservation;
 };
 
 class GlobalInstance {
@@ -19,6 +19,8 @@
 #include <LibWasm/AbstractMachine/BytecodeInterpreter.h>
 #include <LibWasm/AbstractMachine/Configuration.h>
 #include <LibWasm/AbstractMachine/Operators.h>
+#include <LibWasm/JIT/Compiler.h>
+#include <LibWasm/JIT/NativeFunction.h>
 #include <LibWasm/Opcode.h>
 #include <LibWasm/Printer/Printer.h>
 #include <LibWasm/Types.h>
@@ -80,10 +82,34 @@ struct ConvertToRaw<double> {
         }                                                                                      \
     } while (false)
 
+bool g_jit_enabled = false;
+
+static JIT::NativeFunction const* increment_jit_hotness(Configuration& configuration, Expression const& expression)
+{
+    auto& compiled_instructions = expression.compiled_instructions;
+    if (compiled_instructions.did_try_jit_compilation)
+        return compiled_instructions.native_function.ptr();
+    if (++compiled_instructions.jit_hotness < JIT::Compiler::hotness_threshold)
+        return nullptr;
+    compiled_instructions.did_try_jit_compilation = true;
+    compiled_instructions.native_function = JIT::Compiler::compile(configuration.store(), configuration.frame().module(), expression);
+    return compiled_instructions.native_function.ptr();
+}
+
 void BytecodeInterpreter::interpret(Configuration& configuration)
 {
     m_trap = Empty {};
     auto& expression = configuration.frame().expression();
+
+    // FIXME: Functions only tier up when they are called, so a long-running loop in a function that is only called once
+    //        stays in the interpreter, as there's no way to transfer a frame into native code mid-execution.
+    if (g_jit_enabled && configuration.ip() == 0) [[unlikely]] {
+        if (auto* native_function = increment_jit_hotness(configuration, expression)) {
+            native_function->run(*this, configuration);
+            return;
+        }
+    }
+
     auto const should_limit_instruction_count = configuration.should_limit_instruction_count();
     if (!expression.compiled_instructions.dispatches.is_empty()) {
         if (expression.compiled_instructions.direct) {
@@ -3886,7 +3912,7 @@ bool BytecodeInterpreter::load_and_push(Configuration& configuration, Instructio
         return true;
     }
     dbgln_if(WASM_TRACE_DEBUG, "load({} : {}) -> stack", instance_address, sizeof(ReadType));
-    auto slice = memory->data().bytes().slice(instance_address, sizeof(ReadType));
+    ReadonlyBytes slice { memory->data().data() + instance_address, sizeof(ReadType) };
     entry = Value(static_cast<PushType>(read_value<ReadType>(slice)));
     return false;
 }
@@ -3912,7 +3938,7 @@ bool BytecodeInterpreter::load_and_push_mxn(Configuration& configuration, Instru
         return true;
     }
     dbgln_if(WASM_TRACE_DEBUG, "vec-load({} : {}) -> stack", instance_address, M * N / 8);
-    auto slice = memory->data().bytes().slice(instance_address, M * N / 8);
+    ReadonlyBytes slice { memory->data().data() + instance_address, M * N / 8 };
     using V64 = NativeVectorType<M, N, SetSign>;
     using V128 = NativeVectorType<M * 2, N, SetSign>;
 
@@ -3940,7 +3966,7 @@ bool BytecodeInterpreter::load_and_push_lane_n(Configuration& configuration, Ins
         m_trap = Trap::from_string("Memory access out of bounds");
         return true;
     }
-    auto slice = memory->data().bytes().slice(instance_address, N / 8);
+    ReadonlyBytes slice { memory->data().data() + instance_address, N / 8 };
     auto dst = bit_cast<u8*>(&vector) + memarg_and_lane.lane * N / 8;
     memcpy(dst, slice.data(), N / 8);
     configuration.push_to_destination(Value(vector), addresses.destination);
@@ -3960,7 +3986,7 @@ bool BytecodeInterpreter::load_and_push_zero_n(Configuration& configuration, Ins
         m_trap = Trap::from_string("Memory access out of bounds");
         return true;
     }
-    auto slice = memory->data().bytes().slice(instance_address, N / 8);
+    ReadonlyBytes slice { memory->data().data() + instance_address, N / 8 };
     u128 vector = 0;
     memcpy(&vector, slice.data(), N / 8);
     configuration.push_to_destination(Value(vector), addresses.destination);
@@ -3982,7 +4008,7 @@ bool BytecodeInterpreter::load_and_push_m_splat(Configuration& configuration, In
         return true;
     }
     dbgln_if(WASM_TRACE_DEBUG, "vec-splat({} : {}) -> stack", instance_address, M / 8);
-    auto slice = memory->data().bytes().slice(instance_address, M / 8);
+    ReadonlyBytes slice { memory->data().data() + instance_address, M / 8 };
     auto value = read_value<NativeIntegralType<M>>(slice);
     set_top_m_splat<M, NativeIntegralType>(configuration, value, addresses);
     return false;
@@ -4189,9 +4215,9 @@ bool BytecodeInterpreter::store_to_memory(MemoryInstance& memory, u64 address, T
 
     dbgln_if(WASM_TRACE_DEBUG, "temporary({}b) -> store({})", data_size, address);
     if constexpr (IsSame<ReadonlyBytes, T>)
-        (void)value.copy_to(memory.data().bytes().slice(address, data_size));
+        (void)value.copy_to(Bytes { memory.data().data() + address, data_size });
     else
-        memcpy(memory.data().bytes().offset_pointer(address), &value, data_size);
+        memcpy(memory.data().data() + address, &value, data_size);
     return false;
 }
 
@@ -4837,8 +4863,15 @@ CompiledInstructions try_compile_instructions(Expression const& expression, Span
             dispatch.destination = value_alloc.get(*output_id).value_or(Dispatch::RegisterOrStack::Stack);
     }
 
+    try_use_direct_threading(result);
+
+    return result;
+}
+
+void try_use_direct_threading(CompiledInstructions& compiled_instructions)
+{
     if constexpr (should_try_to_use_direct_threading) {
-        for (auto& dispatch : result.dispatches) {
+        for (auto& dispatch : compiled_instructions.dispatches) {
 #define CASE(name, ...)                                                                                                                  \
     case Instructions::name.value():                                                                                                     \
         dispatch.handler_ptr = bit_cast<FlatPtr>(&InstructionHandler<Instructions::name.value()>::template operator()<false, Continue>); \
@@ -4850,10 +4883,8 @@ CompiledInstructions try_compile_instructions(Expression const& expression, Span
                 VERIFY_NOT_REACHED();
             }
         }
-        result.direct = true;
+        compiled_instructions.direct = true;
     }
-
-    return result;
 }
 
 }
@@ -140,4 +140,6 @@ protected:
     StackInfo const& m_stack_info;
 };
 
+WASM_API extern bool g_jit_enabled;
+
 }
@@ -0,0 +1,624 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/AllOf.h>
+#include <AK/CharacterTypes.h>
+#include <AK/Debug.h>
+#include <AK/Hex.h>
+#include <AK/Memory.h>
+#include <AK/MemoryStream.h>
+#include <AK/QuickSort.h>
+#include <LibCore/Directory.h>
+#include <LibCore/File.h>
+#include <LibCore/System.h>
+#include <LibCrypto/Authentication/HMAC.h>
+#include <LibCrypto/SecureRandom.h>
+#include <LibWasm/AbstractMachine/ModuleCache.h>
+#include <LibWasm/Types.h>
+
+// This is defined by the build for this file only, see Libraries/LibWasm/CMakeLists.txt.
+#ifndef LIBWASM_MODULE_CACHE_VERSION
+#    error "LIBWASM_MODULE_CACHE_VERSION must be defined"
+#endif
+
+namespace Wasm {
+
+static constexpr auto CACHE_VERSION = LIBWASM_MODULE_CACHE_VERSION ""sv;
+static_assert(CACHE_VERSION.length() == sizeof(ModuleCacheHeader::version) * 2);
+
+static constexpr auto SECRET_FILE_NAME = "secret"sv;
+
+// The payload stores the state of every expression of the module, in the order of for_each_expression():
+//
+//     [ExpressionCount:u64]
+//     [Validated:u8] [StackUsageHint:u64] [FrameUsageHint:u64] [ExtraInstructions] [Dispatches]
+//
+// Expressions that validation skips (such as empty element initializers) only store the first field. Dispatches refer to
+// their instruction by its index in either the expression or in the extra instruction storage, and the extra instructions
+// are stored with their arguments, as they only exist in the compiled form.
+enum class InstructionSource : u8 {
+    Expression,
+    ExtraInstructionStorage,
+};
+
+// The arguments that try_compile_instructions() gives to the instructions that it creates. We refuse to store anything
+// else, which keeps this in sync with the compiler: a new kind of argument fails loudly rather than being restored wrong.
+enum class ArgumentKind : u8 {
+    None,
+    FunctionIndex,
+    LocalIndex,
+    I32,
+    MemoryArgument,
+    StructuredInstruction,
+};
+
+ErrorOr<void> ModuleCacheHeader::write_to_stream(Stream& stream) const
+{
+    TRY(stream.write_value(magic));
+    TRY(stream.write_until_depleted({ version, sizeof(version) }));
+    TRY(stream.write_until_depleted({ key, sizeof(key) }));
+    TRY(stream.write_value(payload_size));
+    TRY(stream.write_until_depleted({ payload_mac, sizeof(payload_mac) }));
+    return {};
+}
+
+ErrorOr<ModuleCacheHeader> ModuleCacheHeader::read_from_stream(Stream& stream)
+{
+    ModuleCacheHeader header;
+    header.magic = TRY(stream.read_value<u32>());
+    TRY(stream.read_until_filled({ header.version, sizeof(header.version) }));
+    TRY(stream.read_until_filled({ header.key, sizeof(header.key) }));
+    header.payload_size = TRY(stream.read_value<u64>());
+    TRY(stream.read_until_filled({ header.payload_mac, sizeof(header.payload_mac) }));
+    return header;
+}
+
+template<typename Callback>
+static void for_each_expression(Module const& module, Callback callback)
+{
+    for (auto& global : module.global_section().entries())
+        callback(global.expression());
+
+    for (auto& segment : module.element_section().segments()) {
+        if (auto const* active = segment.mode.get_pointer<ElementSection::Active>())
+            callback(active->expression);
+        for (auto& expression : segment.init)
+            callback(expression);
+    }
+
+    for (auto& data : module.data_section().data()) {
+        if (auto const* active = data.value().get_pointer<DataSection::Data::Active>())
+            callback(active->offset);
+    }
+
+    for (auto& code : module.code_section().functions())
+        callback(code.func().body());
+}
+
+static bool is_known_opcode(OpCode opcode)
+{
+    switch (opcode.value()) {
+#define M(name, ...)                \
+    case Instructions::name.value(): \
+        return true;
+        ENUMERATE_WASM_OPCODES(M)
+#undef M
+    default:
+        return false;
+    }
+}
+
+static ErrorOr<void> encode_block_type(Stream& stream, BlockType const& block_type)
+{
+    TRY(stream.write_value(static_cast<u8>(block_type.kind())));
+    switch (block_type.kind()) {
+    case BlockType::Empty:
+        return {};
+    case BlockType::Type:
+        return stream.write_value(static_cast<u8>(block_type.value_type().kind()));
+    case BlockType::Index:
+        return stream.write_value<u64>(block_type.type_index().value());
+    }
+    VERIFY_NOT_REACHED();
+}
+
+static ErrorOr<BlockType> decode_block_type(Stream& stream)
+{
+    switch (TRY(stream.read_value<u8>())) {
+    case BlockType::Empty:
+        return BlockType {};
+    case BlockType::Type: {
+        auto kind = TRY(stream.read_value<u8>());
+        if (kind > ValueType::UnsupportedHeapReference)
+            return Error::from_string_literal("Invalid value type");
+        return BlockType { ValueType { static_cast<ValueType::Kind>(kind) } };
+    }
+    case BlockType::Index:
+        return BlockType { TypeIndex { TRY(stream.read_value<u64>()) } };
+    default:
+        return Error::from_string_literal("Invalid block type");
+    }
+}
+
+static ErrorOr<void> encode_instruction(Stream& stream, Instruction const& instruction)
+{
+    TRY(stream.write_value<u64>(instruction.opcode().value()));
+    TRY(stream.write_value<u64>(instruction.local_index().value()));
+
+    return instruction.arguments().visit(
+        [&](u8 value) -> ErrorOr<void> {
+            VERIFY(value == 0);
+            return stream.write_value(ArgumentKind::None);
+        },
+        [&](FunctionIndex index) -> ErrorOr<void> {
+            TRY(stream.write_value(ArgumentKind::FunctionIndex));
+            return stream.write_value<u64>(index.value());
+        },
+        [&](LocalIndex index) -> ErrorOr<void> {
+            TRY(stream.write_value(ArgumentKind::LocalIndex));
+            return stream.write_value<u64>(index.value());
+        },
+        [&](i32 value) -> ErrorOr<void> {
+            TRY(stream.write_value(ArgumentKind::I32));
+            return stream.write_value(value);
+        },
+        [&](Instruction::MemoryArgument const& argument) -> ErrorOr<void> {
+            TRY(stream.write_value(ArgumentKind::MemoryArgument));
+            TRY(stream.write_value(argument.align));
+            TRY(stream.write_value(argument.offset));
+            return stream.write_value<u64>(argument.memory_index.value());
+        },
+        [&](Instruction::StructuredInstructionArgs const& arguments) -> ErrorOr<void> {
+            TRY(stream.write_value(ArgumentKind::StructuredInstruction));
+            TRY(encode_block_type(stream, arguments.block_type));
+            TRY(stream.write_value(arguments.end_ip.value()));
+            TRY(stream.write_value<u8>(arguments.else_ip.has_value()));
+            if (arguments.else_ip.has_value())
+                TRY(stream.write_value(arguments.else_ip->value()));
+            return {};
+        },
+        [&](auto const&) -> ErrorOr<void> {
+            return Error::from_string_literal("Unsupported argument for a compiled instruction");
+        });
+}
+
+static ErrorOr<Instruction> decode_instruction(Stream& stream)
+{
+    OpCode opcode { TRY(stream.read_value<u64>()) };
+    if (!is_known_opcode(opcode))
+        return Error::from_string_literal("Invalid opcode");
+    LocalIndex local_index { TRY(stream.read_value<u64>()) };
+
+    switch (TRY(stream.read_value<ArgumentKind>())) {
+    case ArgumentKind::None:
+        return Instruction { opcode, local_index, static_cast<u8>(0) };
+    case ArgumentKind::FunctionIndex:
+        return Instruction { opcode, local_index, FunctionIndex { TRY(stream.read_value<u64>()) } };
+    case ArgumentKind::LocalIndex:
+        return Instruction { opcode, local_index, LocalIndex { TRY(stream.read_value<u64>()) } };
+    case ArgumentKind::I32:
+        return Instruction { opcode, local_index, TRY(stream.read_value<i32>()) };
+    case ArgumentKind::MemoryArgument: {
+        Instruction::MemoryArgument argument {};
+        argument.align = TRY(stream.read_value<u32>());
+        argument.offset = TRY(stream.read_value<u64>());
+        argument.memory_index = MemoryIndex { TRY(stream.read_value<u64>()) };
+        return Instruction { opcode, local_index, argument };
+    }
+    case ArgumentKind::StructuredInstruction: {
+        Instruction::StructuredInstructionArgs arguments {};
+        arguments.block_type = TRY(decode_block_type(stream));
+        arguments.end_ip = TRY(stream.read_value<u64>());
+        if (TRY(stream.read_value<u8>()))
+            arguments.else_ip = InstructionPointer { TRY(stream.read_value<u64>()) };
+        return Instruction { opcode, local_index, move(arguments) };
+    }
+    }
+    return Error::from_string_literal("Invalid argument kind");
+}
+
+static ErrorOr<void> encode_expression(Stream& stream, Expression const& expression)
+{
+    auto const& compiled = expression.compiled_instructions;
+
+    TRY(stream.write_value<u8>(expression.stack_usage_hint().has_value()));
+    if (!expression.stack_usage_hint().has_value())
+        return {};
+
+    TRY(stream.write_value<u64>(*expression.stack_usage_hint()));
+    TRY(stream.write_value<u64>(expression.frame_usage_hint().value_or(0)));
+
+    TRY(stream.write_value<u64>(compiled.extra_instruction_storage.size()));
+    for (auto const& instruction : compiled.extra_instruction_storage)
+        TRY(encode_instruction(stream, instruction));
+
+    auto index_in = [](auto const& instructions, Instruction const* instruction) -> Optional<size_t> {
+        if (instructions.is_empty() || instruction < instructions.data() || instruction >= instructions.data() + instructions.size())
+            return {};
+        return instruction - instructions.data();
+    };
+
+    TRY(stream.write_value<u64>(compiled.dispatches.size()));
+    for (auto const& dispatch : compiled.dispatches) {
+        if (auto index = index_in(expression.instructions(), dispatch.instruction); index.has_value()) {
+            TRY(stream.write_value(InstructionSource::Expression));
+            TRY(stream.write_value<u64>(*index));
+        } else if (auto index = index_in(compiled.extra_instruction_storage, dispatch.instruction); index.has_value()) {
+            TRY(stream.write_value(InstructionSource::ExtraInstructionStorage));
+            TRY(stream.write_value<u64>(*index));
+        } else {
+            return Error::from_string_literal("Dispatch refers to an unknown instruction");
+        }
+        TRY(stream.write_value(dispatch.sources_and_destination));
+    }
+
+    return {};
+}
+
+struct RestoredExpression {
+    size_t stack_usage_hint { 0 };
+    size_t frame_usage_hint { 0 };
+    CompiledInstructions compiled_instructions;
+};
+
+static ErrorOr<Optional<RestoredExpression>> decode_expression(FixedMemoryStream& stream, Expression const& expression)
+{
+    if (!TRY(stream.read_value<u8>()))
+        return Optional<RestoredExpression> {};
+
+    RestoredExpression restored;
+    restored.stack_usage_hint = TRY(stream.read_value<u64>());
+    restored.frame_usage_hint = TRY(stream.read_value<u64>());
+
+    auto& compiled = restored.compiled_instructions;
+
+    // Every entry takes up more than a byte, so this rejects counts that would make us allocate more than the payload.
+    auto extra_instruction_count = TRY(stream.read_value<u64>());
+    if (extra_instruction_count > stream.remaining())
+        return Error::from_string_literal("Invalid extra instruction count");
+
+    // The dispatches point into the extra instruction storage, so it must never be reallocated after this.
+    TRY(compiled.extra_instruction_storage.try_ensure_capacity(extra_instruction_count));
+
+    for (size_t i = 0; i < extra_instruction_count; ++i)
+        compiled.extra_instruction_storage.unchecked_append(TRY(decode_instruction(stream)));
+
+    auto dispatch_count = TRY(stream.read_value<u64>());
+    if (dispatch_count > stream.remaining())
+        return Error::from_string_literal("Invalid dispatch count");
+    TRY(compiled.dispatches.try_ensure_capacity(dispatch_count));
+
+    for (size_t i = 0; i < dispatch_count; ++i) {
+        auto source = TRY(stream.read_value<InstructionSource>());
+        auto index = TRY(stream.read_value<u64>());
+
+        Instruction const* instruction = nullptr;
+        switch (source) {
+        case InstructionSource::Expression:
+            if (index < expression.instructions().size())
+                instruction = &expression.instructions()[index];
+            break;
+        case InstructionSource::ExtraInstructionStorage:
+            if (index < compiled.extra_instruction_storage.size())
+                instruction = &compiled.extra_instruction_storage[index];
+            break;
+        }
+        if (!instruction)
+            return Error::from_string_literal("Dispatch refers to an unknown instruction");
+
+        Dispatch dispatch {
+            { .instruction_opcode = instruction->opcode() },
+            instruction,
+            { .sources_and_destination = TRY(stream.read_value<u32>()) },
+        };
+        for (auto location : dispatch.sources) {
+            if (location > Dispatch::Stack)
+                return Error::from_string_literal("Invalid register");
+        }
+        if (dispatch.destination > Dispatch::Stack)
+            return Error::from_string_literal("Invalid register");
+
+        compiled.dispatches.unchecked_append(dispatch);
+    }
+
+    // Structured instructions jump to dispatches, which are only known once all of them have been decoded.
+    for (auto const& instruction : compiled.extra_instruction_storage) {
+        auto const* arguments = instruction.arguments().get_pointer<Instruction::StructuredInstructionArgs>();
+        if (!arguments)
+            continue;
+        if (arguments->end_ip.value() > dispatch_count || (arguments->else_ip.has_value() && arguments->else_ip->value() > dispatch_count))
+            return Error::from_string_literal("Instruction pointer out of bounds");
+    }
+
+    try_use_direct_threading(compiled);
+    return restored;
+}
+
+static ReadonlyBytes cache_version()
+{
+    static auto const version = MUST(decode_hex(CACHE_VERSION));
+    return version;
+}
+
+// The secret is created by whichever process uses the cache directory first. It writes it to a file of its own, and then
+// links that into place, so that other processes never see a partially written secret.
+static ErrorOr<ModuleCache::Secret> read_or_create_secret(LexicalPath const& directory)
+{
+    auto path = directory.append(SECRET_FILE_NAME).string();
+
+    auto read_secret = [&]() -> ErrorOr<ModuleCache::Secret> {
+        auto file = TRY(Core::File::open(path, Core::File::OpenMode::Read));
+        auto contents = TRY(file->read_until_eof());
+
+        ModuleCache::Secret secret;
+        if (contents.size() != secret.size())
+            return Error::from_string_literal("Module cache secret has an invalid size");
+        contents.bytes().copy_to(secret.span());
+        return secret;
+    };
+
+    if (auto secret = read_secret(); !secret.is_error() || !secret.error().is_errno() || secret.error().code() != ENOENT)
+        return secret;
+
+    ModuleCache::Secret secret;
+    Crypto::fill_with_secure_random(secret.span());
+
+    auto temporary_path = ByteString::formatted("{}.{}.tmp", path, Core::System::getpid());
+    {
+        auto file = TRY(Core::File::open(temporary_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate, 0600));
+        TRY(file->write_until_depleted(secret.span()));
+    }
+
+    auto link_result = Core::System::link(temporary_path, path);
+    (void)Core::System::unlink(temporary_path);
+
+    if (link_result.is_error()) {
+        // Another process created the secret first, so we use theirs.
+        if (link_result.error().is_errno() && link_result.error().code() == EEXIST)
+            return read_secret();
+        return link_result.release_error();
+    }
+    return secret;
+}
+
+// Entries are named after the hex encoding of their key, which tells them apart from the secret and from temporary files.
+static bool is_entry_name(StringView name)
+{
+    return name.length() == ModuleCache::Key::Size * 2 && all_of(name, [](char c) { return is_ascii_hex_digit(c); });
+}
+
+ErrorOr<NonnullOwnPtr<ModuleCache>> ModuleCache::create(LexicalPath directory, u64 maximum_size)
+{
+    TRY(Core::Directory::create(directory, Core::Directory::CreateDirectories::Yes, 0700));
+    auto secret = TRY(read_or_create_secret(directory));
+    return adopt_own(*new ModuleCache(move(directory), secret, maximum_size));
+}
+
+ModuleCache::ModuleCache(LexicalPath directory, Secret secret, u64 maximum_size)
+    : m_directory(move(directory))
+    , m_secret(secret)
+    , m_maximum_size(maximum_size)
+{
+}
+
+ModuleCache::Hash ModuleCache::hash_module(ReadonlyBytes module_bytes)
+{
+    return Crypto::Hash::SHA256::hash(module_bytes.data(), module_bytes.size());
+}
+
+ModuleCache::Key ModuleCache::key_for(StringView partition, Hash const& module_hash)
+{
+    // The partition is prefixed with its length, so that no two partitions and hashes make up the same bytes.
+    auto hash = Crypto::Hash::SHA256::create();
+    u64 partition_length = partition.length();
+    hash->update(reinterpret_cast<u8 const*>(&partition_length), sizeof(partition_length));
+    hash->update(partition.bytes());
+    hash->update(module_hash.bytes());
+    return hash->digest();
+}
+
+LexicalPath ModuleCache::path_for_key(Key const& key) const
+{
+    return m_directory.append(encode_hex(key.bytes()));
+}
+
+ByteBuffer ModuleCache::mac_for(Key const& key, ReadonlyBytes payload) const
+{
+    Crypto::Authentication::HMAC hmac { Crypto::Hash::HashKind::SHA256, m_secret.span() };
+    hmac.update(key.bytes());
+    hmac.update(payload);
+    return hmac.digest();
+}
+
+ErrorOr<ByteBuffer> ModuleCache::create_payload(Module const& module)
+{
+    VERIFY(module.validation_status() == Module::ValidationStatus::Valid);
+
+    AllocatingMemoryStream payload_stream;
+
+    size_t expression_count = 0;
+    for_each_expression(module, [&](Expression const&) { ++expression_count; });
+    TRY(payload_stream.write_value<u64>(expression_count));
+
+    ErrorOr<void> result {};
+    for_each_expression(module, [&](Expression const& expression) {
+        if (!result.is_error())
+            result = encode_expression(payload_stream, expression);
+    });
+    TRY(result);
+
+    return payload_stream.read_until_eof();
+}
+
+bool ModuleCache::try_restore(ReadonlyBytes payload, Module& module)
+{
+    VERIFY(module.validation_status() == Module::ValidationStatus::Unchecked);
+
+    auto restore = [&]() -> ErrorOr<Vector<Optional<RestoredExpression>>> {
+        FixedMemoryStream stream { payload };
+
+        size_t expression_count = 0;
+        for_each_expression(module, [&](Expression const&) { ++expression_count; });
+        if (TRY(stream.read_value<u64>()) != expression_count)
+            return Error::from_string_literal("Payload belongs to another module");
+
+        Vector<Optional<RestoredExpression>> expressions;
+        TRY(expressions.try_ensure_capacity(expression_count));
+
+        ErrorOr<void> result {};
+        for_each_expression(module, [&](Expression const& expression) {
+            if (result.is_error())
+                return;
+            auto restored = decode_expression(stream, expression);
+            if (restored.is_error())
+                result = restored.release_error();
+            else
+                expressions.unchecked_append(restored.release_value());
+        });
+        TRY(result);
+
+        if (!stream.is_eof())
+            return Error::from_string_literal("Payload has trailing data");
+
+        return expressions;
+    };
+
+    auto expressions = restore();
+    if (expressions.is_error()) {
+        dbgln_if(WASM_MODULE_CACHE_DEBUG, "Wasm: Unable to restore module from the cache: {}", expressions.error());
+        return false;
+    }
+
+    // Nothing is written into the module until the whole payload has been decoded, so a bad one can't leave it half-restored.
+    size_t index = 0;
+    for_each_expression(module, [&](Expression const& expression) {
+        auto& restored = expressions.value()[index++];
+        if (!restored.has_value())
+            return;
+        expression.set_stack_usage_hint(restored->stack_usage_hint);
+        expression.set_frame_usage_hint(restored->frame_usage_hint);
+        expression.compiled_instructions = move(restored->compiled_instructions);
+    });
+
+    module.set_restored_from_cache({});
+    return true;
+}
+
+Optional<ByteBuffer> ModuleCache::load(Key const& key) const
+{
+    auto path = path_for_key(key);
+
+    auto load_payload = [&]() -> ErrorOr<ByteBuffer> {
+        auto file = TRY(Core::File::open(path.string(), Core::File::OpenMode::Read));
+        auto contents = TRY(file->read_until_eof());
+
+        FixedMemoryStream stream { contents.bytes() };
+        auto header = TRY(ModuleCacheHeader::read_from_stream(stream));
+
+        if (header.magic != ModuleCacheHeader::CACHE_MAGIC || ReadonlyBytes { header.version, sizeof(header.version) } != cache_version())
+            return Error::from_string_literal("Cache entry was written by another version");
+        if (ReadonlyBytes { header.key, sizeof(header.key) } != key.bytes())
+            return Error::from_string_literal("Cache entry belongs to another key");
+        if (header.payload_size != stream.remaining())
+            return Error::from_string_literal("Cache entry is truncated");
+
+        // Restored dispatches are executed without any further checks, so we make sure that the payload is exactly what
+        // we wrote before handing it out.
+        auto payload = contents.bytes().slice(contents.size() - stream.remaining());
+        auto mac = mac_for(key, payload);
+        if (mac.size() != sizeof(header.payload_mac) || !timing_safe_compare(mac.data(), header.payload_mac, mac.size()))
+            return Error::from_string_literal("Cache entry failed authentication");
+
+        return ByteBuffer::copy(payload);
+    };
+
+    auto payload = load_payload();
+    if (payload.is_error()) {
+        if (!payload.error().is_errno() || payload.error().code() != ENOENT)
+            dbgln_if(WASM_MODULE_CACHE_DEBUG, "Wasm: Unable to load module cache entry: {}", payload.error());
+        return {};
+    }
+
+    // This marks the entry as recently used, so that it is evicted last. Another process may have evicted it already.
+    (void)Core::System::utimensat(AT_FDCWD, path.string(), nullptr, 0);
+
+    return payload.release_value();
+}
+
+ErrorOr<void> ModuleCache::store(Key const& key, ReadonlyBytes payload) const
+{
+    auto payload_mac = mac_for(key, payload);
+
+    ModuleCacheHeader header;
+    cache_version().copy_to({ header.version, sizeof(header.version) });
+    key.bytes().copy_to({ header.key, sizeof(header.key) });
+    header.payload_size = payload.size();
+    payload_mac.bytes().copy_to({ header.payload_mac, sizeof(header.payload_mac) });
+
+    // Several processes may store the same entry at once, so every one of them writes to a file of its own first, and
+    // then atomically moves it into place.
+    auto path = path_for_key(key);
+    auto temporary_path = ByteString::formatted("{}.{}.tmp", path.string(), Core::System::getpid());
+
+    {
+        auto file = TRY(Core::File::open(temporary_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate, 0600));
+        TRY(header.write_to_stream(*file));
+        TRY(file->write_until_depleted(payload));
+    }
+
+    if (auto rename_result = Core::System::rename(temporary_path, path.string()); rename_result.is_error()) {
+        (void)Core::System::unlink(temporary_path);
+        return rename_result.release_error();
+    }
+
+    evict_entries_if_needed();
+    return {};
+}
+
+void ModuleCache::evict_entries_if_needed() const
+{
+    struct Entry {
+        ByteString name;
+        u64 size { 0 };
+        time_t last_used { 0 };
+    };
+
+    Vector<Entry> entries;
+    u64 total_size = 0;
+
+    auto result = Core::Directory::for_each_entry(m_directory.string(), Core::DirIterator::SkipParentAndBaseDir, [&](auto const& entry, auto const& directory) -> ErrorOr<IterationDecision> {
+        if (!is_entry_name(entry.name))
+            return IterationDecision::Continue;
+
+        // Another process may have evicted the entry since we listed it.
+        auto stat = directory.stat(entry.name, AT_SYMLINK_NOFOLLOW);
+        if (stat.is_error())
+            return IterationDecision::Continue;
+
+        entries.append({ entry.name, static_cast<u64>(stat.value().st_size), stat.value().st_mtime });
+        total_size += stat.value().st_size;
+        return IterationDecision::Continue;
+    });
+    if (result.is_error()) {
+        dbgln_if(WASM_MODULE_CACHE_DEBUG, "Wasm: Unable to list the module cache entries: {}", result.error());
+        return;
+    }
+
+    if (total_size <= m_maximum_size)
+        return;
+
+    quick_sort(entries, [](auto const& a, auto const& b) { return a.last_used < b.last_used; });
+
+    for (auto const& entry : entries) {
+        if (total_size <= m_maximum_size)
+            break;
+        dbgln_if(WASM_MODULE_CACHE_DEBUG, "Wasm: Evicting module cache entry {} ({} bytes)", entry.name, entry.size);
+        (void)Core::System::unlink(m_directory.append(entry.name).string());
+        total_size -= entry.size;
+    }
+}
+
+}
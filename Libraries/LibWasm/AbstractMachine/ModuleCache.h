@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/ByteBuffer.h>
+#include <AK/Error.h>
+#include <AK/LexicalPath.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Noncopyable.h>
+#include <LibCrypto/Hash/SHA2.h>
+#include <LibWasm/Export.h>
+#include <LibWasm/Forward.h>
+
+namespace Wasm {
+
+class Module;
+
+struct [[gnu::packed]] ModuleCacheHeader {
+    static ErrorOr<ModuleCacheHeader> read_from_stream(Stream&);
+    ErrorOr<void> write_to_stream(Stream&) const;
+
+    static constexpr auto CACHE_MAGIC = 0x7761736du;
+
+    u32 magic { CACHE_MAGIC };
+
+    // The hash of the LibWasm sources that wrote the entry, as computed by the build. Entries written by any other build
+    // may have been validated or compiled differently, so they are ignored and replaced.
+    u8 version[32] {};
+
+    u8 key[32] {};
+
+    u64 payload_size { 0 };
+
+    // An HMAC-SHA256 of the key and the payload, keyed with the secret of the cache directory.
+    u8 payload_mac[32] {};
+};
+
+// An on-disk cache of what validating a module produces: the stack and frame usage hints of all of its expressions, and
+// the dispatches that they were compiled to for the interpreter. Together, these are an entry's payload.
+//
+// Restoring a module from its payload skips both validation and instruction compilation, which are the most expensive
+// parts of compiling a large module. The module still has to be parsed, as the compiled instructions point into it.
+//
+// Restored dispatches are executed without being validated again, so the processes that compile modules only ever
+// create and restore payloads. Storing and loading them is brokered by a process that they can't tamper with, which owns
+// the cache directory and the secret that authenticates its entries. Entries that were not written by this build, or
+// that were changed in any way since, are rejected.
+//
+// Entries are keyed by the hash of the module's bytes and the partition that it was compiled in, such as the top-level
+// site of the page that compiled it. One partition can neither use nor time the entries of another one.
+//
+// The total size of the entries is kept below a budget by removing the least recently used ones whenever an entry is
+// stored. An entry's modification time is updated whenever it is loaded, and serves as its last use.
+//
+// The cache holds no mutable state, so it can be used from any thread. The cache format on disk is:
+//
+//     [ModuleCacheHeader][Payload]
+class WASM_API ModuleCache {
+    AK_MAKE_NONCOPYABLE(ModuleCache);
+    AK_MAKE_NONMOVABLE(ModuleCache);
+
+public:
+    using Hash = Crypto::Hash::SHA256::DigestType;
+    using Key = Crypto::Hash::SHA256::DigestType;
+    using Secret = Array<u8, 32>;
+
+    static constexpr u64 DEFAULT_MAXIMUM_SIZE = 256 * MiB;
+
+    static Hash hash_module(ReadonlyBytes module_bytes);
+
+    // Creates the payload of a module that has been validated successfully.
+    static ErrorOr<ByteBuffer> create_payload(Module const&);
+
+    // Restores an unvalidated module from the payload of a module with the same hash, and marks it as valid. Returns false
+    // and leaves the module untouched if the payload doesn't fit the module.
+    static bool try_restore(ReadonlyBytes payload, Module&);
+
+    static ErrorOr<NonnullOwnPtr<ModuleCache>> create(LexicalPath directory, u64 maximum_size = DEFAULT_MAXIMUM_SIZE);
+    static Key key_for(StringView partition, Hash const& module_hash);
+
+    // Returns the payload of the entry, if there is a usable one.
+    Optional<ByteBuffer> load(Key const&) const;
+
+    // Stores the payload of an entry, and evicts the least recently used entries if that takes the cache over its budget.
+    ErrorOr<void> store(Key const&, ReadonlyBytes payload) const;
+
+    u64 maximum_size() const { return m_maximum_size; }
+
+private:
+    ModuleCache(LexicalPath directory, Secret, u64 maximum_size);
+
+    LexicalPath path_for_key(Key const&) const;
+    ByteBuffer mac_for(Key const&, ReadonlyBytes payload) const;
+    void evict_entries_if_needed() const;
+
+    LexicalPath m_directory;
+    Secret m_secret;
+    u64 m_maximum_size { DEFAULT_MAXIMUM_SIZE };
+};
+
+}
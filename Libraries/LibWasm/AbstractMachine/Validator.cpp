@@ -4,10 +4,14 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Atomic.h>
 #include <AK/HashTable.h>
+#include <AK/OwnPtr.h>
 #include <AK/SourceLocation.h>
 #include <AK/TemporaryChange.h>
 #include <AK/Try.h>
+#include <LibCore/System.h>
+#include <LibThreading/HelperThreadPool.h>
 #include <LibWasm/AbstractMachine/Validator.h>
 #include <LibWasm/Printer/Printer.h>
 
@@ -247,34 +251,121 @@ ErrorOr<void, ValidationError> Validator::validate(TableSection const& section)
     return {};
 }
 
+Threading::HelperThreadPool* Validator::code_validation_thread_pool()
+{
+    // The threads are shared by all modules, and sleep while there is nothing to validate. The pool is never destroyed.
+    static auto* pool = [] -> Threading::HelperThreadPool* {
+        auto thread_count = min<size_t>(Core::System::hardware_concurrency(), max_code_validation_thread_count);
+        if (thread_count <= 1)
+            return nullptr;
+        auto pool_or_error = Threading::HelperThreadPool::create(thread_count - 1, "Wasm validator"sv);
+        if (pool_or_error.is_error()) {
+            dbgln("Failed to create Wasm validation threads, validating on a single thread: {}", pool_or_error.error());
+            return nullptr;
+        }
+        return pool_or_error.release_value().leak_ptr();
+    }();
+    return pool;
+}
+
 ErrorOr<void, ValidationError> Validator::validate(CodeSection const& section)
 {
-    size_t index = m_context.imported_function_count;
-    for (auto& entry : section.functions()) {
-        auto function_index = index++;
-        TRY(validate(FunctionIndex { function_index }));
-        auto& function_type = m_context.functions[function_index];
-        auto& function = entry.func();
+    auto const& functions = section.functions();
 
+    if (functions.size() >= parallel_code_validation_threshold) {
+        if (auto* pool = code_validation_thread_pool())
+            return validate_in_parallel(section, *pool);
+    }
+
+    for (size_t i = 0; i < functions.size(); ++i) {
         auto function_validator = fork();
-        function_validator.m_context.locals = {};
-        function_validator.m_context.locals.extend(function_type.parameters());
-        for (auto& local : function.locals()) {
-            for (size_t i = 0; i < local.n(); ++i)
-                function_validator.m_context.locals.append(local.type());
-        }
+        TRY(function_validator.validate_function(m_context.imported_function_count + i, functions[i]));
+    }
 
-        function_validator.m_frames.empend(function_type, FrameKind::Function, (size_t)0);
-        function_validator.m_max_frame_size = max(function_validator.m_max_frame_size, function_validator.m_frames.size());
+    return {};
+}
+
+ErrorOr<void, ValidationError> Validator::validate_function(size_t function_index, CodeSection::Code const& entry)
+{
+    TRY(validate(FunctionIndex { function_index }));
+    auto& function_type = m_context.functions[function_index];
+    auto& function = entry.func();
 
-        auto results = TRY(function_validator.validate(function.body(), function_type.results()));
-        if (results.result_types.size() != function_type.results().size())
-            return Errors::invalid("function result"sv, function_type.results(), results.result_types);
+    m_context.locals.clear();
+    m_context.locals.extend(function_type.parameters());
+    for (auto& local : function.locals()) {
+        for (size_t i = 0; i < local.n(); ++i)
+            m_context.locals.append(local.type());
     }
 
+    m_frames.empend(function_type, FrameKind::Function, (size_t)0);
+    m_max_frame_size = max(m_max_frame_size, m_frames.size());
+
+    auto results = TRY(validate(function.body(), function_type.results()));
+    if (results.result_types.size() != function_type.results().size())
+        return Errors::invalid("function result"sv, function_type.results(), results.result_types);
+
     return {};
 }
 
+ErrorOr<void, ValidationError> Validator::validate_in_parallel(CodeSection const& section, Threading::HelperThreadPool& pool)
+{
+    auto const& functions = section.functions();
+    auto thread_count = pool.helper_thread_count() + 1;
+
+    // The context is shared between forks through non-atomic reference counts, so every thread gets its own fork up
+    // front, with locals that it doesn't share with anyone. Validating a function only reads the rest of the context.
+    Vector<NonnullOwnPtr<Validator>> validators;
+    validators.ensure_capacity(thread_count);
+    for (size_t i = 0; i < thread_count; ++i) {
+        auto validator = adopt_own(*new Validator(m_context));
+        validator->m_context.locals = {};
+        validators.unchecked_append(move(validator));
+    }
+
+    struct FunctionError {
+        size_t index;
+        ValidationError error;
+    };
+    Vector<Optional<FunctionError>> errors;
+    errors.resize(thread_count);
+
+    // Functions are handed out in order, and a thread stops at its first invalid function. Every function before the
+    // first invalid one is still validated, so we always report the same error as the sequential validator would.
+    Atomic<size_t> next_function { 0 };
+    Atomic<size_t> first_invalid_function { NumericLimits<size_t>::max() };
+
+    Function<void(size_t)> validate_functions = [&](size_t thread_index) {
+        auto& validator = *validators[thread_index];
+        while (true) {
+            auto index = next_function.fetch_add(1, AK::memory_order_relaxed);
+            if (index >= functions.size() || index > first_invalid_function.load(AK::memory_order_relaxed))
+                return;
+
+            auto result = validator.validate_function(m_context.imported_function_count + index, functions[index]);
+            if (!result.is_error())
+                continue;
+
+            errors[thread_index] = FunctionError { index, result.release_error() };
+            auto first_invalid = first_invalid_function.load(AK::memory_order_relaxed);
+            while (index < first_invalid && !first_invalid_function.compare_exchange_strong(first_invalid, index, AK::memory_order_relaxed)) { }
+            return;
+        }
+    };
+
+    pool.run(validate_functions);
+
+    auto first_invalid = first_invalid_function.load();
+    if (first_invalid == NumericLimits<size_t>::max())
+        return {};
+
+    for (auto& error : errors) {
+        if (error.has_value() && error->index == first_invalid)
+            return move(error->error);
+    }
+    VERIFY_NOT_REACHED();
+}
+
 ErrorOr<void, ValidationError> Validator::validate(TableType const& type)
 {
     Optional<u64> bound = type.limits().address_type() == AddressType::I64 ? Optional<u64> {} : (1ull << 32) - 1;
@@ -12,6 +12,7 @@
 #include <AK/SourceLocation.h>
 #include <AK/Tuple.h>
 #include <AK/Vector.h>
+#include <LibThreading/Forward.h>
 #include <LibWasm/Forward.h>
 #include <LibWasm/Types.h>
 
@@ -324,6 +325,14 @@ private:
     {
     }
 
+    // Code sections with at least this many functions have their function bodies validated on multiple threads.
+    static constexpr size_t parallel_code_validation_threshold = 64;
+    static constexpr size_t max_code_validation_thread_count = 8;
+
+    ErrorOr<void, ValidationError> validate_function(size_t function_index, CodeSection::Code const&);
+    static Threading::HelperThreadPool* code_validation_thread_pool();
+    ErrorOr<void, ValidationError> validate_in_parallel(CodeSection const&, Threading::HelperThreadPool&);
+
     struct Errors {
         static ValidationError invalid(StringView name, SourceLocation location = SourceLocation::current())
         {
@@ -9,6 +9,7 @@
 namespace Wasm {
 
 class AbstractMachine;
+class ModuleCache;
 class Validator;
 struct ValidationError;
 struct Interpreter;
@@ -0,0 +1,1365 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Debug.h>
+#include <LibWasm/AbstractMachine/AbstractMachine.h>
+#include <LibWasm/AbstractMachine/BytecodeInterpreter.h>
+#include <LibWasm/AbstractMachine/Configuration.h>
+#include <LibWasm/AbstractMachine/Operators.h>
+#include <LibWasm/JIT/Compiler.h>
+#include <LibWasm/JIT/NativeFunction.h>
+#include <LibWasm/Opcode.h>
+#include <LibWasm/Printer/Printer.h>
+
+#ifdef JIT_ARCH_SUPPORTED
+#    include <LibJIT/Assembler.h>
+#endif
+
+namespace Wasm::JIT {
+
+#ifdef JIT_ARCH_SUPPORTED
+
+using Assembler = ::JIT::Assembler;
+using Reg = Assembler::Reg;
+using FloatReg = Assembler::FloatReg;
+using Condition = Assembler::Condition;
+using ShiftOperation = Assembler::ShiftOperation;
+using FloatOperation = Assembler::FloatOperation;
+
+// These registers are callee-saved, and hold the same value for as long as we're in native code.
+static constexpr auto LOCALS = Reg::RBX;
+static constexpr auto CONTEXT = Reg::R12;
+static constexpr auto MEMORY_BASE = Reg::R13;
+static constexpr auto MEMORY_SIZE = Reg::R14;
+static constexpr auto RESULTS = Reg::R15;
+
+// The operand stack lives at the bottom of the native stack frame, with one 8-byte slot per value.
+static constexpr auto OPERAND_STACK = Reg::RSP;
+
+static bool is_supported(ValueType const& type)
+{
+    switch (type.kind()) {
+    case ValueType::I32:
+    case ValueType::I64:
+    case ValueType::F32:
+    case ValueType::F64:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool is_supported(FunctionType const& type)
+{
+    return all_of(type.parameters(), [](auto& type) { return is_supported(type); })
+        && all_of(type.results(), [](auto& type) { return is_supported(type); });
+}
+
+static bool is_32bit(ValueType const& type)
+{
+    return type.kind() == ValueType::I32 || type.kind() == ValueType::F32;
+}
+
+// Operand stack slots only hold the low 64 bits of a value, and 32-bit values may have garbage in their upper half.
+static Value to_value(u64 raw_value, ValueType const& type)
+{
+    switch (type.kind()) {
+    case ValueType::I32:
+        return Value(static_cast<i32>(raw_value));
+    case ValueType::I64:
+        return Value(static_cast<i64>(raw_value));
+    case ValueType::F32:
+        return Value(bit_cast<float>(static_cast<u32>(raw_value)));
+    case ValueType::F64:
+        return Value(bit_cast<double>(raw_value));
+    default:
+        VERIFY_NOT_REACHED();
+    }
+}
+
+// Runtime functions are called with the operand stack slot of their first operand, and store their results starting
+// at that same slot. They return a TrapReason, which is None if execution can continue.
+using RuntimeFunction = u64 (*)(RuntimeContext&, u64* operands, u64 argument);
+
+#    define TRAP_IF_NOT(x)                                        \
+        do {                                                      \
+            if (context.interpreter->trap_if_not(x, #x##sv))      \
+                return to_underlying(TrapReason::AlreadySet);     \
+        } while (false)
+
+static u64 call_function(RuntimeContext& context, u64* operands, FunctionAddress address, BytecodeInterpreter::CallAddressSource source)
+{
+    auto& configuration = *context.configuration;
+    auto const& type = configuration.store().get(address)->visit([](auto& function) -> FunctionType const& { return function.type(); });
+
+    configuration.value_stack().ensure_capacity(configuration.value_stack().size() + type.parameters().size());
+    for (size_t i = 0; i < type.parameters().size(); ++i)
+        configuration.value_stack().unchecked_append(to_value(operands[i], type.parameters()[i]));
+
+    auto outcome = context.interpreter->call_address(configuration, address, source);
+    context.refresh_memory();
+    if (outcome == Outcome::Return)
+        return to_underlying(TrapReason::AlreadySet);
+
+    auto results = configuration.value_stack().span().slice_from_end(type.results().size());
+    for (size_t i = 0; i < results.size(); ++i)
+        operands[i] = results[i].to<u64>();
+    configuration.value_stack().shrink(configuration.value_stack().size() - results.size(), true);
+    return to_underlying(TrapReason::None);
+}
+
+static u64 cxx_call(RuntimeContext& context, u64* operands, u64 function_index)
+{
+    auto address = context.configuration->frame().module().functions()[function_index];
+    return call_function(context, operands, address, BytecodeInterpreter::CallAddressSource::DirectCall);
+}
+
+// The argument holds the type index in its low half, and the table index in its high half.
+static u64 cxx_call_indirect(RuntimeContext& context, u64* operands, u64 argument)
+{
+    auto& configuration = *context.configuration;
+    auto const& module = configuration.frame().module();
+    auto const& type_expected = module.types()[argument & 0xffffffff];
+    auto table_instance = configuration.store().get(module.tables()[argument >> 32]);
+
+    auto index = static_cast<i32>(operands[type_expected.parameters().size()]);
+    TRAP_IF_NOT(index >= 0);
+    TRAP_IF_NOT(static_cast<size_t>(index) < table_instance->elements().size());
+    auto& element = table_instance->elements()[index];
+    TRAP_IF_NOT(element.ref().has<Reference::Func>());
+    auto address = element.ref().get<Reference::Func>().address;
+    auto const& type_actual = configuration.store().get(address)->visit([](auto& function) -> FunctionType const& { return function.type(); });
+    TRAP_IF_NOT(type_actual.parameters() == type_expected.parameters());
+    TRAP_IF_NOT(type_actual.results() == type_expected.results());
+
+    return call_function(context, operands, address, BytecodeInterpreter::CallAddressSource::IndirectCall);
+}
+
+static u64 cxx_global_get(RuntimeContext& context, u64* operands, u64 global_index)
+{
+    auto& configuration = *context.configuration;
+    auto global = configuration.store().get(configuration.frame().module().globals()[global_index]);
+    operands[0] = global->value().to<u64>();
+    return to_underlying(TrapReason::None);
+}
+
+static u64 cxx_global_set(RuntimeContext& context, u64* operands, u64 global_index)
+{
+    auto& configuration = *context.configuration;
+    auto global = configuration.store().get(configuration.frame().module().globals()[global_index]);
+    global->set_value(to_value(operands[0], global->type().type()));
+    return to_underlying(TrapReason::None);
+}
+
+static u64 cxx_memory_grow(RuntimeContext& context, u64* operands, u64)
+{
+    auto& configuration = *context.configuration;
+    auto instance = configuration.store().get(configuration.frame().module().memories()[0]);
+    i32 old_pages = instance->size() / Constants::page_size;
+    auto new_pages = static_cast<i32>(operands[0]);
+    if (instance->grow(new_pages * Constants::page_size))
+        operands[0] = static_cast<u32>(old_pages);
+    else
+        operands[0] = static_cast<u32>(-1);
+    context.refresh_memory();
+    return to_underlying(TrapReason::None);
+}
+
+// The operands are the destination, the value and the count.
+static u64 cxx_memory_fill(RuntimeContext& context, u64* operands, u64)
+{
+    auto const destination_offset = static_cast<u32>(operands[0]);
+    auto const value = static_cast<u8>(operands[1]);
+    auto const count = static_cast<u32>(operands[2]);
+
+    Checked<u64> checked_end = destination_offset;
+    checked_end += count;
+    TRAP_IF_NOT(!checked_end.has_overflow() && static_cast<size_t>(checked_end.value()) <= context.memory_size);
+
+    __builtin_memset(context.memory_base + destination_offset, value, count);
+    return to_underlying(TrapReason::None);
+}
+
+// The operands are the destination, the source and the count.
+static u64 cxx_memory_copy(RuntimeContext& context, u64* operands, u64)
+{
+    auto const destination_offset = static_cast<u32>(operands[0]);
+    auto const source_offset = static_cast<u32>(operands[1]);
+    auto const count = static_cast<u32>(operands[2]);
+
+    TRAP_IF_NOT(static_cast<u64>(source_offset) + count <= context.memory_size);
+    TRAP_IF_NOT(static_cast<u64>(destination_offset) + count <= context.memory_size);
+
+    __builtin_memmove(context.memory_base + destination_offset, context.memory_base + source_offset, count);
+    return to_underlying(TrapReason::None);
+}
+
+template<typename PopType, typename PushType, typename Operator>
+static u64 cxx_unary_operation(RuntimeContext& context, u64* operands, u64)
+{
+    auto value = Value(u128(operands[0], 0)).to<PopType>();
+    auto call_result = Operator {}(value);
+    PushType result;
+    if constexpr (IsSpecializationOf<decltype(call_result), AK::ErrorOr>) {
+        if (call_result.is_error()) {
+            context.interpreter->set_trap(call_result.error());
+            return to_underlying(TrapReason::AlreadySet);
+        }
+        result = call_result.release_value();
+    } else {
+        result = call_result;
+    }
+    operands[0] = Value(result).template to<u64>();
+    return to_underlying(TrapReason::None);
+}
+
+template<typename PopType, typename PushType, typename Operator>
+static u64 cxx_binary_operation(RuntimeContext&, u64* operands, u64)
+{
+    auto lhs = Value(u128(operands[0], 0)).to<PopType>();
+    auto rhs = Value(u128(operands[1], 0)).to<PopType>();
+    PushType result = Operator {}(lhs, rhs);
+    operands[0] = Value(result).template to<u64>();
+    return to_underlying(TrapReason::None);
+}
+
+#    undef TRAP_IF_NOT
+
+class CodeGenerator {
+public:
+    CodeGenerator(Store& store, ModuleInstance const& module, WasmFunction const& function)
+        : m_store(store)
+        , m_module(module)
+        , m_function(function)
+        , m_assembler(m_output)
+    {
+        m_memory_has_guard_region = !module.memories().is_empty()
+            && store.get(module.memories()[0])->has_guard_region()
+            && NativeFunction::install_memory_fault_handler();
+    }
+
+    // Returns false if the function uses something that we can't compile.
+    bool generate();
+
+    ReadonlyBytes code() const { return m_output; }
+
+    Vector<u32> take_unchecked_memory_access_offsets() { return move(m_unchecked_memory_access_offsets); }
+    u32 out_of_bounds_trap_offset() const { return m_trap_labels[to_underlying(TrapReason::MemoryAccessOutOfBounds)].offset_of_label.value_or(0); }
+
+private:
+    enum class FrameKind {
+        Function,
+        Block,
+        Loop,
+        If,
+    };
+
+    struct ControlFrame {
+        FrameKind kind;
+        size_t base_height { 0 };
+        size_t parameter_count { 0 };
+        size_t result_count { 0 };
+        // Where branches to this frame go: the start of a loop, or the end of anything else.
+        Assembler::Label label;
+        Assembler::Label else_label;
+        bool has_else { false };
+
+        size_t branch_arity() const { return kind == FrameKind::Loop ? parameter_count : result_count; }
+    };
+
+    bool compile_instruction(Instruction const&);
+
+    static i32 slot_offset(size_t index) { return static_cast<i32>(index * sizeof(u64)); }
+    static i32 local_offset(LocalIndex index) { return static_cast<i32>(index.value() * sizeof(Value)); }
+
+    // The offset of the operand that is `depth` values below the top of the stack.
+    i32 operand(size_t depth = 0) const { return slot_offset(m_stack_height - 1 - depth); }
+
+    void push()
+    {
+        ++m_stack_height;
+        m_max_stack_height = max(m_max_stack_height, m_stack_height);
+    }
+    void pop(size_t count = 1) { m_stack_height -= count; }
+
+    void set_stack_height(size_t height)
+    {
+        m_stack_height = height;
+        m_max_stack_height = max(m_max_stack_height, m_stack_height);
+    }
+
+    void jump_to_trap_if(Condition condition, TrapReason reason) { m_assembler.jump_if(condition, m_trap_labels[to_underlying(reason)]); }
+
+    void call_runtime(RuntimeFunction, size_t first_operand, u64 argument = 0);
+
+    void copy_values(size_t from, size_t to, size_t count);
+    void branch_to(size_t depth);
+    void branch_to_if_not_zero(size_t depth);
+    void return_from_function();
+
+    Optional<ControlFrame> enter_frame(FrameKind, BlockType const&);
+    void exit_frame();
+
+    void binary_operation(Function<void(Reg, Reg)> const& emit_operation);
+    void unary_operation(Function<void(Reg)> const& emit_operation);
+    void shift(bool is_64bit, ShiftOperation);
+    void division(bool is_64bit, bool is_signed, bool is_remainder);
+    void comparison(bool is_64bit, Condition);
+    void test_zero(bool is_64bit);
+    void float_binary_operation(bool is_64bit, FloatOperation);
+    void float_unary_operation(bool is_64bit, FloatOperation, bool result_is_64bit);
+    void float_comparison(bool is_64bit, OpCode);
+    void float_sign_operation(bool is_64bit, bool is_negation);
+    void convert_integer_to_float(bool is_64bit_result, bool is_64bit_source, bool is_signed);
+    void push_constant(u64);
+
+    // Leaves the address of the accessed memory in RAX. If the access isn't bounds checked, the instruction emitted next
+    // is the one that faults instead.
+    bool compute_memory_address(Instruction::MemoryArgument const&, size_t access_size, size_t address_depth);
+    bool load(Instruction::MemoryArgument const&, size_t access_size, Function<void(Reg, Reg)> const& emit_load);
+    bool store(Instruction::MemoryArgument const&, size_t access_size, Function<void(Reg, Reg)> const& emit_store);
+
+    bool is_supported_memory(MemoryIndex) const;
+
+    Store& m_store;
+    ModuleInstance const& m_module;
+    WasmFunction const& m_function;
+
+    Vector<u8> m_output;
+    Assembler m_assembler;
+    Assembler::Label m_exit_label;
+    Array<Assembler::Label, to_underlying(TrapReason::ExceededInstructionLimit) + 1> m_trap_labels;
+
+    // Accesses to a memory with a guard region rely on the fault handler of NativeFunction instead of bounds checks.
+    bool m_memory_has_guard_region { false };
+    Vector<u32> m_unchecked_memory_access_offsets;
+
+    Vector<ControlFrame> m_control_stack;
+    size_t m_stack_height { 0 };
+    size_t m_max_stack_height { 0 };
+
+    // Code following an unconditional branch is skipped up to the end of its block.
+    bool m_unreachable { false };
+    size_t m_unreachable_depth { 0 };
+};
+
+void CodeGenerator::call_runtime(RuntimeFunction function, size_t first_operand, u64 argument)
+{
+    m_assembler.mov64(Reg::RDI, CONTEXT);
+    m_assembler.load_effective_address(Reg::RSI, OPERAND_STACK, slot_offset(first_operand));
+    m_assembler.mov64(Reg::RDX, argument);
+    m_assembler.mov64(Reg::RAX, bit_cast<FlatPtr>(function));
+    m_assembler.call(Reg::RAX);
+
+    // The trap reason is already in RAX, which is what the exit code expects.
+    m_assembler.test64(Reg::RAX, Reg::RAX);
+    m_assembler.jump_if(Condition::NotEqualTo, m_exit_label);
+
+    // The memory may have been grown or moved.
+    m_assembler.load64(MEMORY_BASE, CONTEXT, offsetof(RuntimeContext, memory_base));
+    m_assembler.load64(MEMORY_SIZE, CONTEXT, offsetof(RuntimeContext, memory_size));
+}
+
+void CodeGenerator::copy_values(size_t from, size_t to, size_t count)
+{
+    if (from == to)
+        return;
+    for (size_t i = 0; i < count; ++i) {
+        m_assembler.load64(Reg::RAX, OPERAND_STACK, slot_offset(from + i));
+        m_assembler.store64(OPERAND_STACK, slot_offset(to + i), Reg::RAX);
+    }
+}
+
+void CodeGenerator::return_from_function()
+{
+    auto const& results = m_function.type().results();
+    auto first_result = m_stack_height - results.size();
+    for (size_t i = 0; i < results.size(); ++i) {
+        // Results are stored the way Wasm::Value represents them, with 32-bit values sign-extended.
+        if (is_32bit(results[i]))
+            m_assembler.load32_sign_extended64(Reg::RAX, OPERAND_STACK, slot_offset(first_result + i));
+        else
+            m_assembler.load64(Reg::RAX, OPERAND_STACK, slot_offset(first_result + i));
+        m_assembler.store64(RESULTS, slot_offset(i), Reg::RAX);
+    }
+    m_assembler.xor32(Reg::RAX, Reg::RAX);
+    m_assembler.jump(m_exit_label);
+}
+
+void CodeGenerator::branch_to(size_t depth)
+{
+    auto& frame = m_control_stack[m_control_stack.size() - 1 - depth];
+    if (frame.kind == FrameKind::Function) {
+        return_from_function();
+        return;
+    }
+    auto arity = frame.branch_arity();
+    copy_values(m_stack_height - arity, frame.base_height, arity);
+    m_assembler.jump(frame.label);
+}
+
+// Pops the condition, and branches if it is non-zero.
+void CodeGenerator::branch_to_if_not_zero(size_t depth)
+{
+    m_assembler.load32(Reg::RAX, OPERAND_STACK, operand());
+    pop();
+    m_assembler.test32(Reg::RAX, Reg::RAX);
+
+    auto& frame = m_control_stack[m_control_stack.size() - 1 - depth];
+    if (frame.kind != FrameKind::Function && m_stack_height - frame.branch_arity() == frame.base_height) {
+        // OPTIMIZATION: The values are already where the target expects them, so we can branch directly.
+        m_assembler.jump_if(Condition::NotEqualTo, frame.label);
+        return;
+    }
+
+    auto skip = m_assembler.make_label();
+    m_assembler.jump_if(Condition::EqualTo, skip);
+    branch_to(depth);
+    skip.link(m_assembler);
+}
+
+Optional<CodeGenerator::ControlFrame> CodeGenerator::enter_frame(FrameKind kind, BlockType const& block_type)
+{
+    size_t parameter_count = 0;
+    size_t result_count = 0;
+    switch (block_type.kind()) {
+    case BlockType::Empty:
+        break;
+    case BlockType::Type:
+        if (!is_supported(block_type.value_type()))
+            return {};
+        result_count = 1;
+        break;
+    case BlockType::Index: {
+        auto const& type = m_module.types()[block_type.type_index().value()];
+        if (!is_supported(type))
+            return {};
+        parameter_count = type.parameters().size();
+        result_count = type.results().size();
+        break;
+    }
+    }
+
+    return ControlFrame {
+        .kind = kind,
+        .base_height = m_stack_height - parameter_count,
+        .parameter_count = parameter_count,
+        .result_count = result_count,
+        .label = m_assembler.make_label(),
+        .else_label = m_assembler.make_label(),
+    };
+}
+
+void CodeGenerator::exit_frame()
+{
+    auto frame = m_control_stack.take_last();
+    if (frame.kind == FrameKind::If && !frame.has_else)
+        frame.else_label.link(m_assembler);
+    if (frame.kind != FrameKind::Loop)
+        frame.label.link(m_assembler);
+    set_stack_height(frame.base_height + frame.result_count);
+    m_unreachable = false;
+}
+
+// Loads the left-hand side into RAX and the right-hand side into RCX, and stores the result from RAX.
+void CodeGenerator::binary_operation(Function<void(Reg, Reg)> const& emit_operation)
+{
+    m_assembler.load64(Reg::RAX, OPERAND_STACK, operand(1));
+    m_assembler.load64(Reg::RCX, OPERAND_STACK, operand(0));
+    emit_operation(Reg::RAX, Reg::RCX);
+    pop();
+    m_assembler.store64(OPERAND_STACK, operand(), Reg::RAX);
+}
+
+void CodeGenerator::unary_operation(Function<void(Reg)> const& emit_operation)
+{
+    m_assembler.load64(Reg::RAX, OPERAND_STACK, operand());
+    emit_operation(Reg::RAX);
+    m_assembler.store64(OPERAND_STACK, operand(), Reg::RAX);
+}
+
+void CodeGenerator::shift(bool is_64bit, ShiftOperation operation)
+{
+    // NOTE: The processor masks the shift count in CL the same way that Wasm does.
+    binary_operation([&](Reg lhs, Reg) {
+        if (is_64bit)
+            m_assembler.shift64(operation, lhs);
+        else
+            m_assembler.shift32(operation, lhs);
+    });
+}
+
+void CodeGenerator::division(bool is_64bit, bool is_signed, bool is_remainder)
+{
+    m_assembler.load64(Reg::RAX, OPERAND_STACK, operand(1));
+    m_assembler.load64(Reg::RCX, OPERAND_STACK, operand(0));
+    pop();
+
+    if (is_64bit)
+        m_assembler.test64(Reg::RCX, Reg::RCX);
+    else
+        m_assembler.test32(Reg::RCX, Reg::RCX);
+    jump_to_trap_if(Condition::EqualTo, TrapReason::IntegerDivisionOverflow);
+
+    auto done = m_assembler.make_label();
+    if (is_signed) {
+        // Dividing the smallest integer by -1 overflows, which Wasm traps on for division and defines as 0 for the
+        // remainder. Either way, the processor would fault on it, so it has to be handled before dividing.
+        auto divide = m_assembler.make_label();
+        if (is_64bit)
+            m_assembler.compare64(Reg::RCX, -1);
+        else
+            m_assembler.compare32(Reg::RCX, -1);
+        m_assembler.jump_if(Condition::NotEqualTo, divide);
+        if (is_remainder) {
+            m_assembler.xor32(Reg::RDX, Reg::RDX);
+            m_assembler.jump(done);
+        } else {
+            if (is_64bit) {
+                m_assembler.mov64(Reg::RDX, bit_cast<u64>(NumericLimits<i64>::min()));
+                m_assembler.compare64(Reg::RAX, Reg::RDX);
+            } else {
+                m_assembler.compare32(Reg::RAX, NumericLimits<i32>::min());
+            }
+            jump_to_trap_if(Condition::EqualTo, TrapReason::IntegerDivisionOverflow);
+        }
+        divide.link(m_assembler);
+        if (is_64bit) {
+            m_assembler.sign_extend_rax_into_rdx64();
+            m_assembler.signed_divide64(Reg::RCX);
+        } else {
+            m_assembler.sign_extend_rax_into_rdx32();
+            m_assembler.signed_divide32(Reg::RCX);
+        }
+    } else {
+        m_assembler.xor32(Reg::RDX, Reg::RDX);
+        if (is_64bit)
+            m_assembler.unsigned_divide64(Reg::RCX);
+        else
+            m_assembler.unsigned_divide32(Reg::RCX);
+    }
+
+    done.link(m_assembler);
+    m_assembler.store64(OPERAND_STACK, operand(), is_remainder ? Reg::RDX : Reg::RAX);
+}
+
+void CodeGenerator::comparison(bool is_64bit, Condition condition)
+{
+    binary_operation([&](Reg lhs, Reg rhs) {
+        if (is_64bit)
+            m_assembler.compare64(lhs, rhs);
+        else
+            m_assembler.compare32(lhs, rhs);
+        m_assembler.set_if(condition, lhs);
+    });
+}
+
+void CodeGenerator::test_zero(bool is_64bit)
+{
+    unary_operation([&](Reg reg) {
+        if (is_64bit)
+            m_assembler.test64(reg, reg);
+        else
+            m_assembler.test32(reg, reg);
+        m_assembler.set_if(Condition::EqualTo, reg);
+    });
+}
+
+void CodeGenerator::float_binary_operation(bool is_64bit, FloatOperation operation)
+{
+    if (is_64bit) {
+        m_assembler.load_float64(FloatReg::XMM0, OPERAND_STACK, operand(1));
+        m_assembler.float64_operation(operation, FloatReg::XMM0, OPERAND_STACK, operand(0));
+    } else {
+        m_assembler.load_float32(FloatReg::XMM0, OPERAND_STACK, operand(1));
+        m_assembler.float32_operation(operation, FloatReg::XMM0, OPERAND_STACK, operand(0));
+    }
+    pop();
+    if (is_64bit)
+        m_assembler.store_float64(OPERAND_STACK, operand(), FloatReg::XMM0);
+    else
+        m_assembler.store_float32(OPERAND_STACK, operand(), FloatReg::XMM0);
+}
+
+void CodeGenerator::float_unary_operation(bool is_64bit, FloatOperation operation, bool result_is_64bit)
+{
+    if (is_64bit)
+        m_assembler.float64_operation(operation, FloatReg::XMM0, OPERAND_STACK, operand());
+    else
+        m_assembler.float32_operation(operation, FloatReg::XMM0, OPERAND_STACK, operand());
+    if (result_is_64bit)
+        m_assembler.store_float64(OPERAND_STACK, operand(), FloatReg::XMM0);
+    else
+        m_assembler.store_float32(OPERAND_STACK, operand(), FloatReg::XMM0);
+}
+
+void CodeGenerator::float_comparison(bool is_64bit, OpCode opcode)
+{
+    enum class Kind {
+        Equal,
+        NotEqual,
+        LessThan,
+        GreaterThan,
+        LessThanOrEqual,
+        GreaterThanOrEqual,
+    };
+    auto kind = static_cast<Kind>((opcode.value() - (is_64bit ? Instructions::f64_eq : Instructions::f32_eq).value()));
+
+    // NaN compares as unordered, which sets the zero, parity and carry flags. Comparing with the operands swapped where
+    // needed means that "above" and "above or equal" are false for unordered operands, as Wasm requires.
+    auto swap_operands = kind == Kind::LessThan || kind == Kind::LessThanOrEqual;
+    auto lhs = operand(swap_operands ? 0 : 1);
+    auto rhs = operand(swap_operands ? 1 : 0);
+    if (is_64bit) {
+        m_assembler.load_float64(FloatReg::XMM0, OPERAND_STACK, lhs);
+        m_assembler.compare_float64(FloatReg::XMM0, OPERAND_STACK, rhs);
+    } else {
+        m_assembler.load_float32(FloatReg::XMM0, OPERAND_STACK, lhs);
+        m_assembler.compare_float32(FloatReg::XMM0, OPERAND_STACK, rhs);
+    }
+
+    switch (kind) {
+    case Kind::Equal:
+        m_assembler.set_if(Condition::EqualTo, Reg::RAX);
+        m_assembler.set_if(Condition::NotParity, Reg::RCX);
+        m_assembler.and32(Reg::RAX, Reg::RCX);
+        break;
+    case Kind::NotEqual:
+        m_assembler.set_if(Condition::NotEqualTo, Reg::RAX);
+        m_assembler.set_if(Condition::Parity, Reg::RCX);
+        m_assembler.or32(Reg::RAX, Reg::RCX);
+        break;
+    case Kind::LessThan:
+    case Kind::GreaterThan:
+        m_assembler.set_if(Condition::Above, Reg::RAX);
+        break;
+    case Kind::LessThanOrEqual:
+    case Kind::GreaterThanOrEqual:
+        m_assembler.set_if(Condition::AboveOrEqual, Reg::RAX);
+        break;
+    }
+
+    pop();
+    m_assembler.store64(OPERAND_STACK, operand(), Reg::RAX);
+}
+
+// Negation and absolute values only touch the sign bit, so they are integer operations.
+void CodeGenerator::float_sign_operation(bool is_64bit, bool is_negation)
+{
+    unary_operation([&](Reg reg) {
+        if (is_64bit) {
+            m_assembler.mov64(Reg::RCX, is_negation ? 0x8000000000000000ull : 0x7fffffffffffffffull);
+            if (is_negation)
+                m_assembler.xor64(reg, Reg::RCX);
+            else
+                m_assembler.and64(reg, Reg::RCX);
+        } else if (is_negation) {
+            m_assembler.xor32(reg, static_cast<i32>(0x80000000u));
+        } else {
+            m_assembler.and32(reg, 0x7fffffff);
+        }
+    });
+}
+
+void CodeGenerator::convert_integer_to_float(bool is_64bit_result, bool is_64bit_source, bool is_signed)
+{
+    // NOTE: Unsigned 32-bit integers are zero-extended by the load, and converted as signed 64-bit integers.
+    if (is_64bit_source)
+        m_assembler.load64(Reg::RAX, OPERAND_STACK, operand());
+    else if (is_signed)
+        m_assembler.load32_sign_extended64(Reg::RAX, OPERAND_STACK, operand());
+    else
+        m_assembler.load32(Reg::RAX, OPERAND_STACK, operand());
+
+    if (is_64bit_result) {
+        m_assembler.convert_integer_to_float64(FloatReg::XMM0, Reg::RAX, true);
+        m_assembler.store_float64(OPERAND_STACK, operand(), FloatReg::XMM0);
+    } else {
+        m_assembler.convert_integer_to_float32(FloatReg::XMM0, Reg::RAX, true);
+        m_assembler.store_float32(OPERAND_STACK, operand(), FloatReg::XMM0);
+    }
+}
+
+void CodeGenerator::push_constant(u64 value)
+{
+    push();
+    m_assembler.mov64(Reg::RAX, value);
+    m_assembler.store64(OPERAND_STACK, operand(), Reg::RAX);
+}
+
+bool CodeGenerator::is_supported_memory(MemoryIndex index) const
+{
+    if (index.value() != 0 || m_module.memories().is_empty())
+        return false;
+    return m_store.get(m_module.memories()[0])->type().limits().address_type() == AddressType::I32;
+}
+
+bool CodeGenerator::compute_memory_address(Instruction::MemoryArgument const& argument, size_t access_size, size_t address_depth)
+{
+    if (!is_supported_memory(argument.memory_index))
+        return false;
+
+    // NOTE: The address is zero-extended by the load, and the sum can't overflow with a 32-bit address and offset.
+    m_assembler.load32(Reg::RAX, OPERAND_STACK, operand(address_depth));
+    if (argument.offset <= static_cast<u64>(NumericLimits<i32>::max())) {
+        if (argument.offset != 0)
+            m_assembler.add64(Reg::RAX, static_cast<i32>(argument.offset));
+    } else {
+        m_assembler.mov64(Reg::RCX, argument.offset);
+        m_assembler.add64(Reg::RAX, Reg::RCX);
+    }
+
+    // The guard region only covers offsets that fit in 32 bits.
+    if (m_memory_has_guard_region && argument.offset <= NumericLimits<u32>::max()) {
+        m_assembler.add64(Reg::RAX, MEMORY_BASE);
+        m_unchecked_memory_access_offsets.append(m_assembler.current_offset());
+        return true;
+    }
+
+    m_assembler.load_effective_address(Reg::RCX, Reg::RAX, static_cast<i32>(access_size));
+    m_assembler.compare64(Reg::RCX, MEMORY_SIZE);
+    jump_to_trap_if(Condition::Above, TrapReason::MemoryAccessOutOfBounds);
+    m_assembler.add64(Reg::RAX, MEMORY_BASE);
+    return true;
+}
+
+bool CodeGenerator::load(Instruction::MemoryArgument const& argument, size_t access_size, Function<void(Reg, Reg)> const& emit_load)
+{
+    if (!compute_memory_address(argument, access_size, 0))
+        return false;
+    emit_load(Reg::RAX, Reg::RAX);
+    m_assembler.store64(OPERAND_STACK, operand(), Reg::RAX);
+    return true;
+}
+
+bool CodeGenerator::store(Instruction::MemoryArgument const& argument, size_t access_size, Function<void(Reg, Reg)> const& emit_store)
+{
+    m_assembler.load64(Reg::RDX, OPERAND_STACK, operand());
+    if (!compute_memory_address(argument, access_size, 1))
+        return false;
+    emit_store(Reg::RAX, Reg::RDX);
+    pop(2);
+    return true;
+}
+
+bool CodeGenerator::generate()
+{
+    auto const& type = m_function.type();
+    if (!is_supported(type))
+        return false;
+    for (auto const& locals : m_function.code().func().locals()) {
+        if (!is_supported(locals.type()))
+            return false;
+    }
+
+    m_assembler.push(Reg::RBP);
+    m_assembler.mov64(Reg::RBP, Reg::RSP);
+    m_assembler.push(LOCALS);
+    m_assembler.push(CONTEXT);
+    m_assembler.push(MEMORY_BASE);
+    m_assembler.push(MEMORY_SIZE);
+    m_assembler.push(RESULTS);
+
+    // The size of the operand stack is only known at the end, so the immediate is patched in later.
+    m_assembler.sub64(Reg::RSP, 0);
+    auto frame_size_offset = m_assembler.current_offset() - sizeof(u32);
+
+    m_assembler.mov64(LOCALS, Reg::RDI);
+    m_assembler.mov64(CONTEXT, Reg::RSI);
+    m_assembler.mov64(RESULTS, Reg::RDX);
+    m_assembler.load64(MEMORY_BASE, CONTEXT, offsetof(RuntimeContext, memory_base));
+    m_assembler.load64(MEMORY_SIZE, CONTEXT, offsetof(RuntimeContext, memory_size));
+
+    m_control_stack.append({
+        .kind = FrameKind::Function,
+        .result_count = type.results().size(),
+        .label = m_assembler.make_label(),
+        .else_label = m_assembler.make_label(),
+    });
+
+    for (auto const& instruction : m_function.code().func().body().instructions()) {
+        if (!compile_instruction(instruction)) {
+            dbgln_if(WASM_JIT_DEBUG, "Wasm JIT: Can't compile instruction {}", instruction_name(instruction.opcode()));
+            return false;
+        }
+    }
+
+    for (size_t i = 0; i < m_trap_labels.size(); ++i) {
+        // Faulting memory accesses continue at the out-of-bounds trap without jumping there.
+        auto is_fault_target = i == to_underlying(TrapReason::MemoryAccessOutOfBounds) && !m_unchecked_memory_access_offsets.is_empty();
+        if (m_trap_labels[i].jump_slot_offsets.is_empty() && !is_fault_target)
+            continue;
+        m_trap_labels[i].link(m_assembler);
+        m_assembler.mov64(Reg::RAX, i);
+        m_assembler.jump(m_exit_label);
+    }
+
+    // All exits go through here, with the trap reason (or zero) in RAX.
+    m_exit_label.link(m_assembler);
+    m_assembler.load_effective_address(Reg::RSP, Reg::RBP, -5 * static_cast<i32>(sizeof(u64)));
+    m_assembler.pop(RESULTS);
+    m_assembler.pop(MEMORY_SIZE);
+    m_assembler.pop(MEMORY_BASE);
+    m_assembler.pop(CONTEXT);
+    m_assembler.pop(LOCALS);
+    m_assembler.pop(Reg::RBP);
+    m_assembler.ret();
+
+    // The five callee-saved registers and the return address leave the stack 8 bytes off from the 16-byte alignment
+    // that calls into the runtime need, so the frame makes up for that.
+    u32 frame_size = align_up_to(m_max_stack_height * sizeof(u64), 16) + 8;
+    for (size_t i = 0; i < sizeof(u32); ++i)
+        m_output[frame_size_offset + i] = static_cast<u8>(frame_size >> (i * 8));
+
+    return true;
+}
+
+bool CodeGenerator::compile_instruction(Instruction const& instruction)
+{
+    auto opcode = instruction.opcode();
+
+    if (m_unreachable) {
+        if (opcode == Instructions::block || opcode == Instructions::loop || opcode == Instructions::if_ || opcode == Instructions::try_table) {
+            ++m_unreachable_depth;
+            return true;
+        }
+        if (m_unreachable_depth > 0) {
+            if (opcode == Instructions::structured_end)
+                --m_unreachable_depth;
+            return true;
+        }
+        if (opcode != Instructions::structured_else && opcode != Instructions::structured_end && opcode != Instructions::synthetic_end_expression)
+            return true;
+    }
+
+    switch (opcode.value()) {
+    case Instructions::unreachable.value():
+        m_assembler.mov64(Reg::RAX, to_underlying(TrapReason::Unreachable));
+        m_assembler.jump(m_exit_label);
+        m_unreachable = true;
+        return true;
+    case Instructions::nop.value():
+        return true;
+
+    case Instructions::block.value():
+    case Instructions::loop.value():
+    case Instructions::if_.value(): {
+        auto const& args = instruction.arguments().get<Instruction::StructuredInstructionArgs>();
+        if (opcode == Instructions::if_) {
+            m_assembler.load32(Reg::RAX, OPERAND_STACK, operand());
+            pop();
+        }
+        auto kind = opcode == Instructions::block ? FrameKind::Block : opcode == Instructions::loop ? FrameKind::Loop
+                                                                                                    : FrameKind::If;
+        auto frame = enter_frame(kind, args.block_type);
+        if (!frame.has_value())
+            return false;
+        if (kind == FrameKind::If) {
+            m_assembler.test32(Reg::RAX, Reg::RAX);
+            m_assembler.jump_if(Condition::EqualTo, frame->else_label);
+        } else if (kind == FrameKind::Loop) {
+            frame->label.link(m_assembler);
+            // Every iteration of a loop uses up some fuel, so that runaway loops trap when the instruction count is limited.
+            m_assembler.sub64_in_memory(CONTEXT, offsetof(RuntimeContext, fuel), 1);
+            jump_to_trap_if(Condition::Below, TrapReason::ExceededInstructionLimit);
+        }
+        m_control_stack.append(frame.release_value());
+        return true;
+    }
+    case Instructions::structured_else.value(): {
+        auto& frame = m_control_stack.last();
+        if (!m_unreachable)
+            m_assembler.jump(frame.label);
+        frame.else_label.link(m_assembler);
+        frame.has_else = true;
+        set_stack_height(frame.base_height + frame.parameter_count);
+        m_unreachable = false;
+        return true;
+    }
+    case Instructions::structured_end.value():
+        exit_frame();
+        return true;
+    case Instructions::synthetic_end_expression.value():
+        if (!m_unreachable)
+            return_from_function();
+        return true;
+
+    case Instructions::br.value():
+        branch_to(instruction.arguments().get<LabelIndex>().value());
+        m_unreachable = true;
+        return true;
+    case Instructions::br_if.value():
+        branch_to_if_not_zero(instruction.arguments().get<LabelIndex>().value());
+        return true;
+    case Instructions::br_table.value(): {
+        auto const& args = instruction.arguments().get<Instruction::TableBranchArgs>();
+        Vector<Assembler::Label> targets;
+        targets.resize(m_control_stack.size());
+
+        m_assembler.load32(Reg::RAX, OPERAND_STACK, operand());
+        pop();
+        m_assembler.compare32(Reg::RAX, static_cast<i32>(args.labels.size()));
+        m_assembler.jump_if(Condition::AboveOrEqual, targets[args.default_.value()]);
+
+        // Jump into a table of jumps to the targets, indexed by the operand.
+        static_assert(Assembler::jump_size == 5);
+        auto table = m_assembler.make_label();
+        m_assembler.load_effective_address(Reg::RCX, table);
+        m_assembler.mov64(Reg::RDX, Reg::RAX);
+        m_assembler.shift_left64(Reg::RDX, 2);
+        m_assembler.add64(Reg::RDX, Reg::RAX);
+        m_assembler.add64(Reg::RCX, Reg::RDX);
+        m_assembler.jump(Reg::RCX);
+        table.link(m_assembler);
+        for (auto label : args.labels)
+            m_assembler.jump(targets[label.value()]);
+
+        for (size_t depth = 0; depth < targets.size(); ++depth) {
+            if (targets[depth].jump_slot_offsets.is_empty())
+                continue;
+            targets[depth].link(m_assembler);
+            branch_to(depth);
+        }
+        m_unreachable = true;
+        return true;
+    }
+    case Instructions::return_.value():
+        return_from_function();
+        m_unreachable = true;
+        return true;
+
+    case Instructions::call.value(): {
+        auto index = instruction.arguments().get<FunctionIndex>();
+        auto const& callee_type = m_store.get(m_module.functions()[index.value()])->visit([](auto& function) -> FunctionType const& { return function.type(); });
+        if (!is_supported(callee_type))
+            return false;
+        auto first_operand = m_stack_height - callee_type.parameters().size();
+        set_stack_height(first_operand + max(callee_type.parameters().size(), callee_type.results().size()));
+        call_runtime(cxx_call, first_operand, index.value());
+        set_stack_height(first_operand + callee_type.results().size());
+        return true;
+    }
+    case Instructions::call_indirect.value(): {
+        auto const& args = instruction.arguments().get<Instruction::IndirectCallArgs>();
+        auto const& callee_type = m_module.types()[args.type.value()];
+        if (!is_supported(callee_type))
+            return false;
+        auto first_operand = m_stack_height - callee_type.parameters().size() - 1;
+        set_stack_height(first_operand + max(callee_type.parameters().size() + 1, callee_type.results().size()));
+        call_runtime(cxx_call_indirect, first_operand, (static_cast<u64>(args.table.value()) << 32) | args.type.value());
+        set_stack_height(first_operand + callee_type.results().size());
+        return true;
+    }
+
+    case Instructions::drop.value():
+        pop();
+        return true;
+    case Instructions::select_typed.value(): {
+        auto const& types = instruction.arguments().get<Vector<ValueType>>();
+        if (types.size() != 1 || !is_supported(types[0]))
+            return false;
+        [[fallthrough]];
+    }
+    case Instructions::select.value():
+        m_assembler.load32(Reg::RDX, OPERAND_STACK, operand(0));
+        m_assembler.load64(Reg::RCX, OPERAND_STACK, operand(1));
+        m_assembler.load64(Reg::RAX, OPERAND_STACK, operand(2));
+        m_assembler.test32(Reg::RDX, Reg::RDX);
+        m_assembler.move_if64(Condition::EqualTo, Reg::RAX, Reg::RCX);
+        pop(2);
+        m_assembler.store64(OPERAND_STACK, operand(), Reg::RAX);
+        return true;
+
+    case Instructions::local_get.value():
+        push();
+        m_assembler.load64(Reg::RAX, LOCALS, local_offset(instruction.local_index()));
+        m_assembler.store64(OPERAND_STACK, operand(), Reg::RAX);
+        return true;
+    case Instructions::local_set.value():
+    case Instructions::local_tee.value():
+        m_assembler.load64(Reg::RAX, OPERAND_STACK, operand());
+        m_assembler.store64(LOCALS, local_offset(instruction.local_index()), Reg::RAX);
+        if (opcode == Instructions::local_set)
+            pop();
+        return true;
+    case Instructions::global_get.value():
+    case Instructions::global_set.value(): {
+        auto index = instruction.arguments().get<GlobalIndex>();
+        if (!is_supported(m_store.get(m_module.globals()[index.value()])->type().type()))
+            return false;
+        if (opcode == Instructions::global_get) {
+            push();
+            call_runtime(cxx_global_get, m_stack_height - 1, index.value());
+        } else {
+            call_runtime(cxx_global_set, m_stack_height - 1, index.value());
+            pop();
+        }
+        return true;
+    }
+
+#    define LOAD(name, size, ...)                                                                                          \
+    case Instructions::name.value():                                                                                     \
+        return load(instruction.arguments().get<Instruction::MemoryArgument>(), size, [&](Reg dst, Reg base) { __VA_ARGS__; });
+#    define STORE(name, size, ...)                                                                                         \
+    case Instructions::name.value():                                                                                     \
+        return store(instruction.arguments().get<Instruction::MemoryArgument>(), size, [&](Reg base, Reg src) { __VA_ARGS__; });
+
+        LOAD(i32_load, 4, m_assembler.load32(dst, base, 0))
+        LOAD(i64_load, 8, m_assembler.load64(dst, base, 0))
+        LOAD(f32_load, 4, m_assembler.load32(dst, base, 0))
+        LOAD(f64_load, 8, m_assembler.load64(dst, base, 0))
+        LOAD(i32_load8_s, 1, m_assembler.load8_sign_extended(false, dst, base, 0))
+        LOAD(i32_load8_u, 1, m_assembler.load8(dst, base, 0))
+        LOAD(i32_load16_s, 2, m_assembler.load16_sign_extended(false, dst, base, 0))
+        LOAD(i32_load16_u, 2, m_assembler.load16(dst, base, 0))
+        LOAD(i64_load8_s, 1, m_assembler.load8_sign_extended(true, dst, base, 0))
+        LOAD(i64_load8_u, 1, m_assembler.load8(dst, base, 0))
+        LOAD(i64_load16_s, 2, m_assembler.load16_sign_extended(true, dst, base, 0))
+        LOAD(i64_load16_u, 2, m_assembler.load16(dst, base, 0))
+        LOAD(i64_load32_s, 4, m_assembler.load32_sign_extended64(dst, base, 0))
+        LOAD(i64_load32_u, 4, m_assembler.load32(dst, base, 0))
+        STORE(i32_store, 4, m_assembler.store32(base, 0, src))
+        STORE(i64_store, 8, m_assembler.store64(base, 0, src))
+        STORE(f32_store, 4, m_assembler.store32(base, 0, src))
+        STORE(f64_store, 8, m_assembler.store64(base, 0, src))
+        STORE(i32_store8, 1, m_assembler.store8(base, 0, src))
+        STORE(i32_store16, 2, m_assembler.store16(base, 0, src))
+        STORE(i64_store8, 1, m_assembler.store8(base, 0, src))
+        STORE(i64_store16, 2, m_assembler.store16(base, 0, src))
+        STORE(i64_store32, 4, m_assembler.store32(base, 0, src))
+
+#    undef LOAD
+#    undef STORE
+
+    case Instructions::memory_size.value(): {
+        if (!is_supported_memory(instruction.arguments().get<Instruction::MemoryIndexArgument>().memory_index))
+            return false;
+        static_assert(Constants::page_size == 64 * KiB);
+        push();
+        m_assembler.mov64(Reg::RAX, MEMORY_SIZE);
+        m_assembler.shift_right64(Reg::RAX, 16);
+        m_assembler.store64(OPERAND_STACK, operand(), Reg::RAX);
+        return true;
+    }
+    case Instructions::memory_grow.value():
+        if (!is_supported_memory(instruction.arguments().get<Instruction::MemoryIndexArgument>().memory_index))
+            return false;
+        call_runtime(cxx_memory_grow, m_stack_height - 1);
+        return true;
+    case Instructions::memory_fill.value():
+        if (!is_supported_memory(instruction.arguments().get<Instruction::MemoryIndexArgument>().memory_index))
+            return false;
+        call_runtime(cxx_memory_fill, m_stack_height - 3);
+        pop(3);
+        return true;
+    case Instructions::memory_copy.value(): {
+        auto const& args = instruction.arguments().get<Instruction::MemoryCopyArgs>();
+        if (!is_supported_memory(args.src_index) || !is_supported_memory(args.dst_index))
+            return false;
+        call_runtime(cxx_memory_copy, m_stack_height - 3);
+        pop(3);
+        return true;
+    }
+
+    case Instructions::i32_const.value():
+        push_constant(bit_cast<u32>(instruction.arguments().get<i32>()));
+        return true;
+    case Instructions::i64_const.value():
+        push_constant(bit_cast<u64>(instruction.arguments().get<i64>()));
+        return true;
+    case Instructions::f32_const.value():
+        push_constant(bit_cast<u32>(instruction.arguments().get<float>()));
+        return true;
+    case Instructions::f64_const.value():
+        push_constant(bit_cast<u64>(instruction.arguments().get<double>()));
+        return true;
+
+    case Instructions::i32_eqz.value():
+        test_zero(false);
+        return true;
+    case Instructions::i64_eqz.value():
+        test_zero(true);
+        return true;
+
+#    define COMPARISON(type, is_64bit)                                        \
+    case Instructions::type##_eq.value():                                     \
+        comparison(is_64bit, Condition::EqualTo);                             \
+        return true;                                                          \
+    case Instructions::type##_ne.value():                                     \
+        comparison(is_64bit, Condition::NotEqualTo);                          \
+        return true;                                                          \
+    case Instructions::type##_lts.value():                                    \
+        comparison(is_64bit, Condition::SignedLessThan);                      \
+        return true;                                                          \
+    case Instructions::type##_ltu.value():                                    \
+        comparison(is_64bit, Condition::Below);                               \
+        return true;                                                          \
+    case Instructions::type##_gts.value():                                    \
+        comparison(is_64bit, Condition::SignedGreaterThan);                   \
+        return true;                                                          \
+    case Instructions::type##_gtu.value():                                    \
+        comparison(is_64bit, Condition::Above);                               \
+        return true;                                                          \
+    case Instructions::type##_les.value():                                    \
+        comparison(is_64bit, Condition::SignedLessThanOrEqualTo);             \
+        return true;                                                          \
+    case Instructions::type##_leu.value():                                    \
+        comparison(is_64bit, Condition::BelowOrEqual);                        \
+        return true;                                                          \
+    case Instructions::type##_ges.value():                                    \
+        comparison(is_64bit, Condition::SignedGreaterThanOrEqualTo);          \
+        return true;                                                          \
+    case Instructions::type##_geu.value():                                    \
+        comparison(is_64bit, Condition::AboveOrEqual);                        \
+        return true;
+
+        COMPARISON(i32, false)
+        COMPARISON(i64, true)
+
+#    undef COMPARISON
+
+    case Instructions::f32_eq.value():
+    case Instructions::f32_ne.value():
+    case Instructions::f32_lt.value():
+    case Instructions::f32_gt.value():
+    case Instructions::f32_le.value():
+    case Instructions::f32_ge.value():
+        float_comparison(false, opcode);
+        return true;
+    case Instructions::f64_eq.value():
+    case Instructions::f64_ne.value():
+    case Instructions::f64_lt.value():
+    case Instructions::f64_gt.value():
+    case Instructions::f64_le.value():
+    case Instructions::f64_ge.value():
+        float_comparison(true, opcode);
+        return true;
+
+#    define INTEGER_ARITHMETIC(type, is_64bit)                                                                       \
+    case Instructions::type##_add.value():                                                                           \
+        binary_operation([&](Reg lhs, Reg rhs) { is_64bit ? m_assembler.add64(lhs, rhs) : m_assembler.add32(lhs, rhs); }); \
+        return true;                                                                                                 \
+    case Instructions::type##_sub.value():                                                                           \
+        binary_operation([&](Reg lhs, Reg rhs) { is_64bit ? m_assembler.sub64(lhs, rhs) : m_assembler.sub32(lhs, rhs); }); \
+        return true;                                                                                                 \
+    case Instructions::type##_mul.value():                                                                           \
+        binary_operation([&](Reg lhs, Reg rhs) { is_64bit ? m_assembler.multiply64(lhs, rhs) : m_assembler.multiply32(lhs, rhs); }); \
+        return true;                                                                                                 \
+    case Instructions::type##_and.value():                                                                           \
+        binary_operation([&](Reg lhs, Reg rhs) { is_64bit ? m_assembler.and64(lhs, rhs) : m_assembler.and32(lhs, rhs); }); \
+        return true;                                                                                                 \
+    case Instructions::type##_or.value():                                                                            \
+        binary_operation([&](Reg lhs, Reg rhs) { is_64bit ? m_assembler.or64(lhs, rhs) : m_assembler.or32(lhs, rhs); }); \
+        return true;                                                                                                 \
+    case Instructions::type##_xor.value():                                                                           \
+        binary_operation([&](Reg lhs, Reg rhs) { is_64bit ? m_assembler.xor64(lhs, rhs) : m_assembler.xor32(lhs, rhs); }); \
+        return true;                                                                                                 \
+    case Instructions::type##_divs.value():                                                                          \
+        division(is_64bit, true, false);                                                                             \
+        return true;                                                                                                 \
+    case Instructions::type##_divu.value():                                                                          \
+        division(is_64bit, false, false);                                                                            \
+        return true;                                                                                                 \
+    case Instructions::type##_rems.value():                                                                          \
+        division(is_64bit, true, true);                                                                              \
+        return true;                                                                                                 \
+    case Instructions::type##_remu.value():                                                                          \
+        division(is_64bit, false, true);                                                                             \
+        return true;                                                                                                 \
+    case Instructions::type##_shl.value():                                                                           \
+        shift(is_64bit, ShiftOperation::ShiftLeft);                                                                  \
+        return true;                                                                                                 \
+    case Instructions::type##_shrs.value():                                                                          \
+        shift(is_64bit, ShiftOperation::ArithmeticShiftRight);                                                       \
+        return true;                                                                                                 \
+    case Instructions::type##_shru.value():                                                                          \
+        shift(is_64bit, ShiftOperation::LogicalShiftRight);                                                          \
+        return true;                                                                                                 \
+    case Instructions::type##_rotl.value():                                                                          \
+        shift(is_64bit, ShiftOperation::RotateLeft);                                                                 \
+        return true;                                                                                                 \
+    case Instructions::type##_rotr.value():                                                                          \
+        shift(is_64bit, ShiftOperation::RotateRight);                                                                \
+        return true;
+
+        INTEGER_ARITHMETIC(i32, false)
+        INTEGER_ARITHMETIC(i64, true)
+
+#    undef INTEGER_ARITHMETIC
+
+#    define FLOAT_ARITHMETIC(type, is_64bit)                          \
+    case Instructions::type##_add.value():                            \
+        float_binary_operation(is_64bit, FloatOperation::Add);        \
+        return true;                                                  \
+    case Instructions::type##_sub.value():                            \
+        float_binary_operation(is_64bit, FloatOperation::Subtract);   \
+        return true;                                                  \
+    case Instructions::type##_mul.value():                            \
+        float_binary_operation(is_64bit, FloatOperation::Multiply);   \
+        return true;                                                  \
+    case Instructions::type##_div.value():                            \
+        float_binary_operation(is_64bit, FloatOperation::Divide);     \
+        return true;                                                  \
+    case Instructions::type##_sqrt.value():                           \
+        float_unary_operation(is_64bit, FloatOperation::SquareRoot, is_64bit); \
+        return true;                                                  \
+    case Instructions::type##_neg.value():                            \
+        float_sign_operation(is_64bit, true);                         \
+        return true;                                                  \
+    case Instructions::type##_abs.value():                            \
+        float_sign_operation(is_64bit, false);                        \
+        return true;
+
+        FLOAT_ARITHMETIC(f32, false)
+        FLOAT_ARITHMETIC(f64, true)
+
+#    undef FLOAT_ARITHMETIC
+
+    case Instructions::f64_promote_f32.value():
+        float_unary_operation(false, FloatOperation::ConvertPrecision, true);
+        return true;
+    case Instructions::f32_demote_f64.value():
+        float_unary_operation(true, FloatOperation::ConvertPrecision, false);
+        return true;
+
+    case Instructions::f32_convert_si32.value():
+        convert_integer_to_float(false, false, true);
+        return true;
+    case Instructions::f32_convert_ui32.value():
+        convert_integer_to_float(false, false, false);
+        return true;
+    case Instructions::f32_convert_si64.value():
+        convert_integer_to_float(false, true, true);
+        return true;
+    case Instructions::f64_convert_si32.value():
+        convert_integer_to_float(true, false, true);
+        return true;
+    case Instructions::f64_convert_ui32.value():
+        convert_integer_to_float(true, false, false);
+        return true;
+    case Instructions::f64_convert_si64.value():
+        convert_integer_to_float(true, true, true);
+        return true;
+
+    // NOTE: Consumers of 32-bit values only look at the low half of their slot, so these don't need any code.
+    case Instructions::i32_wrap_i64.value():
+    case Instructions::i32_reinterpret_f32.value():
+    case Instructions::i64_reinterpret_f64.value():
+    case Instructions::f32_reinterpret_i32.value():
+    case Instructions::f64_reinterpret_i64.value():
+        return true;
+
+    case Instructions::i64_extend_si32.value():
+    case Instructions::i64_extend32_s.value():
+        unary_operation([&](Reg reg) { m_assembler.sign_extend32_to64(reg, reg); });
+        return true;
+    case Instructions::i64_extend_ui32.value():
+        unary_operation([&](Reg reg) { m_assembler.mov32(reg, reg); });
+        return true;
+    case Instructions::i32_extend8_s.value():
+        unary_operation([&](Reg reg) { m_assembler.sign_extend8(false, reg, reg); });
+        return true;
+    case Instructions::i32_extend16_s.value():
+        unary_operation([&](Reg reg) { m_assembler.sign_extend16(false, reg, reg); });
+        return true;
+    case Instructions::i64_extend8_s.value():
+        unary_operation([&](Reg reg) { m_assembler.sign_extend8(true, reg, reg); });
+        return true;
+    case Instructions::i64_extend16_s.value():
+        unary_operation([&](Reg reg) { m_assembler.sign_extend16(true, reg, reg); });
+        return true;
+
+#    define RUNTIME_UNARY_OPERATION(name, PopType, PushType, ...)                                 \
+    case Instructions::name.value():                                                              \
+        call_runtime(cxx_unary_operation<PopType, PushType, __VA_ARGS__>, m_stack_height - 1);    \
+        return true;
+#    define RUNTIME_BINARY_OPERATION(name, PopType, PushType, ...)                                \
+    case Instructions::name.value():                                                              \
+        call_runtime(cxx_binary_operation<PopType, PushType, __VA_ARGS__>, m_stack_height - 2);   \
+        pop();                                                                                    \
+        return true;
+
+        RUNTIME_UNARY_OPERATION(i32_clz, i32, i32, Operators::CountLeadingZeros)
+        RUNTIME_UNARY_OPERATION(i32_ctz, i32, i32, Operators::CountTrailingZeros)
+        RUNTIME_UNARY_OPERATION(i32_popcnt, i32, i32, Operators::PopCount)
+        RUNTIME_UNARY_OPERATION(i64_clz, i64, i64, Operators::CountLeadingZeros)
+        RUNTIME_UNARY_OPERATION(i64_ctz, i64, i64, Operators::CountTrailingZeros)
+        RUNTIME_UNARY_OPERATION(i64_popcnt, i64, i64, Operators::PopCount)
+        RUNTIME_UNARY_OPERATION(f32_ceil, float, float, Operators::Ceil)
+        RUNTIME_UNARY_OPERATION(f32_floor, float, float, Operators::Floor)
+        RUNTIME_UNARY_OPERATION(f32_trunc, float, float, Operators::Truncate)
+        RUNTIME_UNARY_OPERATION(f32_nearest, float, float, Operators::NearbyIntegral)
+        RUNTIME_UNARY_OPERATION(f64_ceil, double, double, Operators::Ceil)
+        RUNTIME_UNARY_OPERATION(f64_floor, double, double, Operators::Floor)
+        RUNTIME_UNARY_OPERATION(f64_trunc, double, double, Operators::Truncate)
+        RUNTIME_UNARY_OPERATION(f64_nearest, double, double, Operators::NearbyIntegral)
+        RUNTIME_BINARY_OPERATION(f32_min, float, float, Operators::Minimum)
+        RUNTIME_BINARY_OPERATION(f32_max, float, float, Operators::Maximum)
+        RUNTIME_BINARY_OPERATION(f32_copysign, float, float, Operators::CopySign)
+        RUNTIME_BINARY_OPERATION(f64_min, double, double, Operators::Minimum)
+        RUNTIME_BINARY_OPERATION(f64_max, double, double, Operators::Maximum)
+        RUNTIME_BINARY_OPERATION(f64_copysign, double, double, Operators::CopySign)
+        RUNTIME_UNARY_OPERATION(i32_trunc_sf32, float, i32, Operators::CheckedTruncate<i32>)
+        RUNTIME_UNARY_OPERATION(i32_trunc_uf32, float, i32, Operators::CheckedTruncate<u32>)
+        RUNTIME_UNARY_OPERATION(i32_trunc_sf64, double, i32, Operators::CheckedTruncate<i32>)
+        RUNTIME_UNARY_OPERATION(i32_trunc_uf64, double, i32, Operators::CheckedTruncate<u32>)
+        RUNTIME_UNARY_OPERATION(i64_trunc_sf32, float, i64, Operators::CheckedTruncate<i64>)
+        RUNTIME_UNARY_OPERATION(i64_trunc_uf32, float, i64, Operators::CheckedTruncate<u64>)
+        RUNTIME_UNARY_OPERATION(i64_trunc_sf64, double, i64, Operators::CheckedTruncate<i64>)
+        RUNTIME_UNARY_OPERATION(i64_trunc_uf64, double, i64, Operators::CheckedTruncate<u64>)
+        RUNTIME_UNARY_OPERATION(i32_trunc_sat_f32_s, float, i32, Operators::SaturatingTruncate<i32>)
+        RUNTIME_UNARY_OPERATION(i32_trunc_sat_f32_u, float, i32, Operators::SaturatingTruncate<u32>)
+        RUNTIME_UNARY_OPERATION(i32_trunc_sat_f64_s, double, i32, Operators::SaturatingTruncate<i32>)
+        RUNTIME_UNARY_OPERATION(i32_trunc_sat_f64_u, double, i32, Operators::SaturatingTruncate<u32>)
+        RUNTIME_UNARY_OPERATION(i64_trunc_sat_f32_s, float, i64, Operators::SaturatingTruncate<i64>)
+        RUNTIME_UNARY_OPERATION(i64_trunc_sat_f32_u, float, i64, Operators::SaturatingTruncate<u64>)
+        RUNTIME_UNARY_OPERATION(i64_trunc_sat_f64_s, double, i64, Operators::SaturatingTruncate<i64>)
+        RUNTIME_UNARY_OPERATION(i64_trunc_sat_f64_u, double, i64, Operators::SaturatingTruncate<u64>)
+        RUNTIME_UNARY_OPERATION(f32_convert_ui64, u64, float, Operators::Convert<float>)
+        RUNTIME_UNARY_OPERATION(f64_convert_ui64, u64, double, Operators::Convert<double>)
+
+#    undef RUNTIME_UNARY_OPERATION
+#    undef RUNTIME_BINARY_OPERATION
+
+    default:
+        return false;
+    }
+}
+
+RefPtr<NativeFunction> Compiler::compile(Store& store, ModuleInstance const& module, Expression const& expression)
+{
+    // Constant expressions don't belong to a function, and are only ever evaluated once anyway.
+    WasmFunction const* function = nullptr;
+    for (auto address : module.functions()) {
+        auto* wasm_function = store.get(address)->get_pointer<WasmFunction>();
+        if (wasm_function && &wasm_function->code().func().body() == &expression) {
+            function = wasm_function;
+            break;
+        }
+    }
+    if (!function)
+        return nullptr;
+
+    CodeGenerator generator { store, module, *function };
+    if (!generator.generate())
+        return nullptr;
+
+    auto native_function = NativeFunction::create(generator.code(), function->type().results().size(), generator.take_unchecked_memory_access_offsets(), generator.out_of_bounds_trap_offset());
+    if (native_function)
+        dbgln_if(WASM_JIT_DEBUG, "Wasm JIT: Compiled {} instructions into {} bytes of native code", expression.instructions().size(), native_function->code_size());
+    return native_function;
+}
+
+#else
+
+RefPtr<NativeFunction> Compiler::compile(Store&, ModuleInstance const&, Expression const&)
+{
+    return nullptr;
+}
+
+#endif
+
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Platform.h>
+#include <AK/RefPtr.h>
+
+#if ARCH(X86_64) && defined(AK_OS_LINUX)
+#    define JIT_ARCH_SUPPORTED 1
+#endif
+
+namespace Wasm {
+
+class Expression;
+class ModuleInstance;
+class Store;
+
+}
+
+namespace Wasm::JIT {
+
+class NativeFunction;
+
+// The baseline compiler translates hot functions into machine code in a single pass over their instructions, without
+// any register allocation: the operand stack lives in the native stack frame, and every instruction loads its operands
+// from there and stores its result back.
+//
+// Control flow, locals, memory accesses and most integer and floating-point arithmetic are compiled to inline code.
+// Calls, globals and the remaining numeric operations call into the runtime, which uses the same implementation as the
+// interpreter. Functions that use anything else (reference types, SIMD, tables, exceptions, tail calls or memories
+// other than a single 32-bit one) are left to the interpreter.
+class Compiler {
+public:
+    // Functions are compiled once they have been called this many times.
+    static constexpr u32 hotness_threshold = 100;
+
+    static RefPtr<NativeFunction> compile(Store&, ModuleInstance const&, Expression const&);
+};
+
+}
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/BinarySearch.h>
+#include <AK/ScopeGuard.h>
+#include <LibCore/System.h>
+#include <LibWasm/AbstractMachine/AbstractMachine.h>
+#include <LibWasm/AbstractMachine/BytecodeInterpreter.h>
+#include <LibWasm/AbstractMachine/Configuration.h>
+#include <LibWasm/JIT/NativeFunction.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+
+namespace Wasm::JIT {
+
+// The native function that was entered most recently on this thread, if any. Native code never calls other native code
+// directly, so a fault in native code can only be in this function.
+static thread_local NativeFunction const* s_running_function;
+
+static struct sigaction s_previous_fault_action;
+
+static void handle_fault(int signal, siginfo_t* info, void* context)
+{
+    auto& registers = static_cast<ucontext_t*>(context)->uc_mcontext;
+    if (auto const* function = s_running_function) {
+        if (auto address = function->address_to_continue_after_fault(static_cast<FlatPtr>(registers.gregs[REG_RIP]))) {
+            registers.gregs[REG_RIP] = static_cast<greg_t>(address);
+            return;
+        }
+    }
+
+    // Any other fault is a crash, which is left to whoever handled it before.
+    if (s_previous_fault_action.sa_flags & SA_SIGINFO) {
+        s_previous_fault_action.sa_sigaction(signal, info, context);
+    } else if (s_previous_fault_action.sa_handler != SIG_DFL && s_previous_fault_action.sa_handler != SIG_IGN) {
+        s_previous_fault_action.sa_handler(signal);
+    } else {
+        // Returning runs the faulting instruction again, which now crashes the process as usual.
+        struct sigaction default_action {};
+        default_action.sa_handler = SIG_DFL;
+        ::sigaction(signal, &default_action, nullptr);
+    }
+}
+
+bool NativeFunction::install_memory_fault_handler()
+{
+    static bool const is_installed = [] {
+        struct sigaction action {};
+        action.sa_sigaction = handle_fault;
+        action.sa_flags = SA_SIGINFO;
+        sigemptyset(&action.sa_mask);
+        if (auto result = Core::System::sigaction(SIGSEGV, &action, &s_previous_fault_action); result.is_error()) {
+            dbgln("Wasm JIT: Failed to install the memory fault handler: {}", result.error());
+            return false;
+        }
+        return true;
+    }();
+    return is_installed;
+}
+
+void RuntimeContext::refresh_memory()
+{
+    auto const& memories = configuration->frame().module().memories();
+    if (memories.is_empty())
+        return;
+    auto& memory = *configuration->store().get(memories[0]);
+    memory_base = memory.data().data();
+    memory_size = memory.size();
+}
+
+RefPtr<NativeFunction> NativeFunction::create(ReadonlyBytes code, size_t result_count, Vector<u32> unchecked_memory_access_offsets, u32 out_of_bounds_trap_offset)
+{
+    VERIFY(unchecked_memory_access_offsets.is_empty() || install_memory_fault_handler());
+
+    auto mapped_size = round_up_to_power_of_two(code.size(), PAGE_SIZE);
+
+    auto memory_or_error = Core::System::mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0, 0, "Wasm JIT code"sv);
+    if (memory_or_error.is_error()) {
+        dbgln("Wasm JIT: Failed to allocate memory for native code: {}", memory_or_error.error());
+        return nullptr;
+    }
+    auto* memory = memory_or_error.release_value();
+
+    code.copy_to({ static_cast<u8*>(memory), mapped_size });
+
+    // The code is never written to again, so we never need the mapping to be both writable and executable.
+    if (mprotect(memory, mapped_size, PROT_READ | PROT_EXEC) < 0) {
+        dbgln("Wasm JIT: Failed to make native code executable: {}", AK::Error::from_errno(errno));
+        MUST(Core::System::munmap(memory, mapped_size));
+        return nullptr;
+    }
+
+    return adopt_ref(*new NativeFunction(memory, code.size(), mapped_size, result_count, move(unchecked_memory_access_offsets), out_of_bounds_trap_offset));
+}
+
+NativeFunction::NativeFunction(void* code, size_t code_size, size_t mapped_size, size_t result_count, Vector<u32> unchecked_memory_access_offsets, u32 out_of_bounds_trap_offset)
+    : m_code(code)
+    , m_code_size(code_size)
+    , m_mapped_size(mapped_size)
+    , m_result_count(result_count)
+    , m_unchecked_memory_access_offsets(move(unchecked_memory_access_offsets))
+    , m_out_of_bounds_trap_offset(out_of_bounds_trap_offset)
+{
+}
+
+NativeFunction::~NativeFunction()
+{
+    MUST(Core::System::munmap(m_code, m_mapped_size));
+}
+
+FlatPtr NativeFunction::address_to_continue_after_fault(FlatPtr instruction_address) const
+{
+    auto code = bit_cast<FlatPtr>(m_code);
+    if (instruction_address < code || instruction_address >= code + m_code_size)
+        return 0;
+    if (!binary_search(m_unchecked_memory_access_offsets.span(), static_cast<u32>(instruction_address - code)))
+        return 0;
+    return code + m_out_of_bounds_trap_offset;
+}
+
+void NativeFunction::run(BytecodeInterpreter& interpreter, Configuration& configuration) const
+{
+    RuntimeContext context {
+        .fuel = configuration.should_limit_instruction_count() ? Constants::max_allowed_executed_instructions_per_call : NumericLimits<u64>::max(),
+        .interpreter = &interpreter,
+        .configuration = &configuration,
+    };
+    context.refresh_memory();
+
+    Vector<u64, 8> results;
+    results.resize(m_result_count);
+
+    // Runtime functions may call back into other native functions, so the function that was running before is restored
+    // once this one returns.
+    auto* previous_running_function = exchange(s_running_function, this);
+    ScopeGuard restore_running_function = [&] { s_running_function = previous_running_function; };
+
+    auto entry = bit_cast<EntryFunction>(m_code);
+    auto reason = static_cast<TrapReason>(entry(configuration.frame().locals().data(), &context, results.data()));
+
+    switch (reason) {
+    case TrapReason::None:
+        configuration.value_stack().ensure_capacity(configuration.value_stack().size() + results.size());
+        for (auto result : results)
+            configuration.value_stack().unchecked_append(Value(u128(result, 0)));
+        return;
+    case TrapReason::AlreadySet:
+        VERIFY(interpreter.did_trap());
+        return;
+    case TrapReason::Unreachable:
+        interpreter.set_trap("Unreachable"sv);
+        return;
+    case TrapReason::MemoryAccessOutOfBounds:
+        interpreter.set_trap("Memory access out of bounds"sv);
+        return;
+    case TrapReason::IntegerDivisionOverflow:
+        interpreter.set_trap("Integer division overflow"sv);
+        return;
+    case TrapReason::ExceededInstructionLimit:
+        interpreter.set_trap("Exceeded maximum allowed number of instructions"sv);
+        return;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+}
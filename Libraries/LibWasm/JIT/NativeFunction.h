@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Noncopyable.h>
+#include <AK/RefCounted.h>
+#include <AK/RefPtr.h>
+#include <AK/Span.h>
+#include <AK/Types.h>
+#include <AK/Vector.h>
+
+namespace Wasm {
+
+class Configuration;
+class Value;
+struct BytecodeInterpreter;
+
+}
+
+namespace Wasm::JIT {
+
+// The state that native code and the runtime functions it calls share. This lives on the stack for the duration of a
+// call into native code.
+struct RuntimeContext {
+    // The base and size of memory 0, which runtime functions update whenever the memory may have been grown.
+    u8* memory_base { nullptr };
+    u64 memory_size { 0 };
+    // Decremented on every backward branch. Native code traps once this runs out.
+    u64 fuel { 0 };
+    BytecodeInterpreter* interpreter { nullptr };
+    Configuration* configuration { nullptr };
+
+    void refresh_memory();
+};
+
+// Native code and runtime functions return one of these, with zero meaning that execution should continue.
+enum class TrapReason : u64 {
+    None = 0,
+    // A runtime function has already stored the trap in the interpreter.
+    AlreadySet,
+    Unreachable,
+    MemoryAccessOutOfBounds,
+    IntegerDivisionOverflow,
+    ExceededInstructionLimit,
+};
+
+class NativeFunction : public RefCounted<NativeFunction> {
+    AK_MAKE_NONCOPYABLE(NativeFunction);
+    AK_MAKE_NONMOVABLE(NativeFunction);
+
+public:
+    // Native code is entered with the locals of the current frame and a buffer to store the results in. i32 and f32
+    // results are stored sign-extended to 64 bits, matching the representation used by Wasm::Value.
+    using EntryFunction = u64 (*)(Value* locals, RuntimeContext*, u64* results);
+
+    // Loads and stores of a memory with a guard region aren't bounds checked. Instead, a fault at any of the given
+    // offsets into the code continues at the code that traps with TrapReason::MemoryAccessOutOfBounds.
+    static RefPtr<NativeFunction> create(ReadonlyBytes code, size_t result_count, Vector<u32> unchecked_memory_access_offsets = {}, u32 out_of_bounds_trap_offset = 0);
+    ~NativeFunction();
+
+    // Installs the handler that turns faults of unchecked memory accesses into traps, once per process. Returns false if
+    // that isn't possible, in which case all memory accesses have to be bounds checked.
+    static bool install_memory_fault_handler();
+
+    // Runs the function in the current frame of the configuration, and pushes its results to the value stack.
+    void run(BytecodeInterpreter&, Configuration&) const;
+
+    size_t code_size() const { return m_code_size; }
+
+    // Returns where to continue after a fault at the given instruction, or zero if the fault isn't caused by one of the
+    // unchecked memory accesses of this function. This is called from a signal handler.
+    FlatPtr address_to_continue_after_fault(FlatPtr instruction_address) const;
+
+private:
+    NativeFunction(void* code, size_t code_size, size_t mapped_size, size_t result_count, Vector<u32> unchecked_memory_access_offsets, u32 out_of_bounds_trap_offset);
+
+    void* m_code { nullptr };
+    size_t m_code_size { 0 };
+    size_t m_mapped_size { 0 };
+    size_t m_result_count { 0 };
+    // Sorted, since they're recorded as the code is emitted.
+    Vector<u32> m_unchecked_memory_access_offsets;
+    u32 m_out_of_bounds_trap_offset { 0 };
+};
+
+}
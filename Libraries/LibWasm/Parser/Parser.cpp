@@ -1395,6 +1395,66 @@ ParseResult<SectionId> SectionId::parse(Stream& stream)
     }
 }
 
+static ParseResult<void> parse_section(Module& module, SectionId section_id, ConstrainedStream& section_stream, SectionId::SectionIdKind& last_section_id)
+{
+    if (section_id.kind() != SectionId::SectionIdKind::Custom && section_id.kind() == last_section_id)
+        return ParseError::DuplicateSection;
+
+    switch (section_id.kind()) {
+    case SectionId::SectionIdKind::Custom:
+        module.custom_sections().append(TRY(CustomSection::parse(section_stream)));
+        break;
+    case SectionId::SectionIdKind::Type:
+        module.type_section() = TRY(TypeSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Import:
+        module.import_section() = TRY(ImportSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Function:
+        module.function_section() = TRY(FunctionSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Table:
+        module.table_section() = TRY(TableSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Memory:
+        module.memory_section() = TRY(MemorySection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Global:
+        module.global_section() = TRY(GlobalSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Export:
+        module.export_section() = TRY(ExportSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Start:
+        module.start_section() = TRY(StartSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Element:
+        module.element_section() = TRY(ElementSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Code:
+        module.code_section() = TRY(CodeSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Data:
+        module.data_section() = TRY(DataSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::DataCount:
+        module.data_count_section() = TRY(DataCountSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Tag:
+        module.tag_section() = TRY(TagSection::parse(section_stream));
+        break;
+    default:
+        return ParseError::InvalidIndex;
+    }
+    if (!section_id.can_appear_after(last_section_id))
+        return ParseError::SectionOutOfOrder;
+    last_section_id = section_id.kind();
+    if (section_stream.remaining() != 0)
+        return ParseError::SectionSizeMismatch;
+
+    return {};
+}
+
 ParseResult<NonnullRefPtr<Module>> Module::parse(Stream& stream)
 {
     ScopeLogger<WASM_BINPARSER_DEBUG> logger("Module"sv);
@@ -1418,63 +1478,79 @@ ParseResult<NonnullRefPtr<Module>> Module::parse(Stream& stream)
         size_t section_size = TRY_READ(stream, LEB128<u32>, ParseError::ExpectedSize);
         auto section_stream = ConstrainedStream { MaybeOwned<Stream>(stream), section_size };
 
-        if (section_id.kind() != SectionId::SectionIdKind::Custom && section_id.kind() == last_section_id)
-            return ParseError::DuplicateSection;
+        TRY(parse_section(module, section_id, section_stream, last_section_id));
+    }
 
-        switch (section_id.kind()) {
-        case SectionId::SectionIdKind::Custom:
-            module.custom_sections().append(TRY(CustomSection::parse(section_stream)));
-            break;
-        case SectionId::SectionIdKind::Type:
-            module.type_section() = TRY(TypeSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Import:
-            module.import_section() = TRY(ImportSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Function:
-            module.function_section() = TRY(FunctionSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Table:
-            module.table_section() = TRY(TableSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Memory:
-            module.memory_section() = TRY(MemorySection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Global:
-            module.global_section() = TRY(GlobalSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Export:
-            module.export_section() = TRY(ExportSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Start:
-            module.start_section() = TRY(StartSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Element:
-            module.element_section() = TRY(ElementSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Code:
-            module.code_section() = TRY(CodeSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Data:
-            module.data_section() = TRY(DataSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::DataCount:
-            module.data_count_section() = TRY(DataCountSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Tag:
-            module.tag_section() = TRY(TagSection::parse(section_stream));
-            break;
-        default:
-            return ParseError::InvalidIndex;
+    return module_ptr;
+}
+
+StreamingModuleParser::StreamingModuleParser()
+    : m_module(make_ref_counted<Module>())
+{
+}
+
+ParseResult<void> StreamingModuleParser::append(ReadonlyBytes bytes)
+{
+    if (m_buffer.try_append(bytes).is_error())
+        return ParseError::OutOfMemory;
+    return parse_available_sections();
+}
+
+ParseResult<void> StreamingModuleParser::parse_available_sections()
+{
+    ScopeLogger<WASM_BINPARSER_DEBUG> logger("StreamingModule"sv);
+    auto bytes = m_buffer.bytes();
+    size_t offset = 0;
+
+    if (!m_did_parse_header) {
+        if (bytes.size() < 8)
+            return {};
+        if (bytes.slice(0, 4) != Module::wasm_magic.span())
+            return ParseError::InvalidModuleMagic;
+        if (bytes.slice(4, 4) != Module::wasm_version.span())
+            return ParseError::InvalidModuleVersion;
+        m_did_parse_header = true;
+        offset = 8;
+    }
+
+    while (offset < bytes.size()) {
+        auto remaining_bytes = bytes.slice(offset);
+        FixedMemoryStream stream { remaining_bytes };
+
+        // A section starts with a one-byte id followed by its size, which is encoded in at most 5 bytes.
+        auto section_id = TRY(SectionId::parse(stream));
+        auto section_size_or_error = stream.read_value<LEB128<u32>>();
+        if (section_size_or_error.is_error()) {
+            if (remaining_bytes.size() < 6)
+                break;
+            return ParseError::ExpectedSize;
         }
-        if (!section_id.can_appear_after(last_section_id))
-            return ParseError::SectionOutOfOrder;
-        last_section_id = section_id.kind();
-        if (section_stream.remaining() != 0)
-            return ParseError::SectionSizeMismatch;
+        size_t section_size = section_size_or_error.release_value();
+        auto header_size = remaining_bytes.size() - stream.remaining();
+        if (stream.remaining() < section_size)
+            break;
+
+        auto section_stream = ConstrainedStream { MaybeOwned<Stream>(stream), section_size };
+        TRY(parse_section(*m_module, section_id, section_stream, m_last_section_id));
+        offset += header_size + section_size;
     }
 
-    return module_ptr;
+    // Only keep the bytes of the section that hasn't been received in full yet.
+    if (offset != 0) {
+        auto unparsed_bytes = ByteBuffer::copy(bytes.slice(offset));
+        if (unparsed_bytes.is_error())
+            return ParseError::OutOfMemory;
+        m_buffer = unparsed_bytes.release_value();
+    }
+
+    return {};
+}
+
+ParseResult<NonnullRefPtr<Module>> StreamingModuleParser::finish()
+{
+    if (!m_did_parse_header || !m_buffer.is_empty())
+        return ParseError::UnexpectedEof;
+    return m_module.release_nonnull();
 }
 
 ByteString parse_error_to_byte_string(ParseError error)
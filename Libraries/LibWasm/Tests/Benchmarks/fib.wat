@@ -0,0 +1,20 @@
+;; Recursive Fibonacci, which is dominated by the cost of calls.
+;; wasm --execute run fib.wasm --arg i32.const:30
+(module
+  (func $fib (export "run") (param $n i32) (result i32)
+    local.get $n
+    i32.const 2
+    i32.lt_u
+    if (result i32)
+      local.get $n
+    else
+      local.get $n
+      i32.const 1
+      i32.sub
+      call $fib
+      local.get $n
+      i32.const 2
+      i32.sub
+      call $fib
+      i32.add
+    end))
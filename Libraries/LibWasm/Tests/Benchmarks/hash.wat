@@ -0,0 +1,46 @@
+;; Hashes a counter with the SplitMix64 finalizer, which is dominated by 64-bit integer arithmetic and small calls.
+;; wasm --execute run hash.wasm --arg i32.const:10000000
+(module
+  (func $mix (param $x i64) (result i64)
+    local.get $x
+    local.get $x
+    i64.const 30
+    i64.shr_u
+    i64.xor
+    i64.const 0xbf58476d1ce4e5b9
+    i64.mul
+    local.tee $x
+    local.get $x
+    i64.const 27
+    i64.shr_u
+    i64.xor
+    i64.const 0x94d049bb133111eb
+    i64.mul
+    local.tee $x
+    local.get $x
+    i64.const 31
+    i64.shr_u
+    i64.xor)
+
+  (func (export "run") (param $iterations i32) (result i64) (local $state i64) (local $hash i64)
+    block $done
+      loop $next
+        local.get $iterations
+        i32.eqz
+        br_if $done
+        local.get $state
+        i64.const 0x9e3779b97f4a7c15
+        i64.add
+        local.tee $state
+        call $mix
+        local.get $hash
+        i64.xor
+        local.set $hash
+        local.get $iterations
+        i32.const 1
+        i32.sub
+        local.set $iterations
+        br $next
+      end
+    end
+    local.get $hash))
@@ -0,0 +1,161 @@
+;; Multiplies two 64x64 matrices of f64s, which is dominated by floating-point arithmetic and 64-bit memory accesses.
+;; Returns the sum of the elements of the product.
+;; wasm --execute run matmul.wasm --arg i32.const:200
+(module
+  (memory 2)
+
+  ;; Fills in A[k] = k % 7 and B[k] = k % 5. A starts at address 0, and B right after it.
+  (func $init (param $n i32) (local $i i32) (local $count i32)
+    local.get $n
+    local.get $n
+    i32.mul
+    local.set $count
+    block $done
+      loop $next
+        local.get $i
+        local.get $count
+        i32.ge_u
+        br_if $done
+        local.get $i
+        i32.const 3
+        i32.shl
+        local.get $i
+        i32.const 7
+        i32.rem_u
+        f64.convert_i32_s
+        f64.store
+        local.get $i
+        local.get $count
+        i32.add
+        i32.const 3
+        i32.shl
+        local.get $i
+        i32.const 5
+        i32.rem_u
+        f64.convert_i32_s
+        f64.store
+        local.get $i
+        i32.const 1
+        i32.add
+        local.set $i
+        br $next
+      end
+    end)
+
+  ;; Computes C = A * B, where C comes right after B.
+  (func $multiply (param $n i32) (result f64)
+    (local $i i32) (local $j i32) (local $k i32) (local $b i32) (local $c i32) (local $sum f64) (local $checksum f64)
+    local.get $n
+    local.get $n
+    i32.mul
+    local.tee $b
+    i32.const 1
+    i32.shl
+    local.set $c
+    block $rows_done
+      loop $rows
+        local.get $i
+        local.get $n
+        i32.ge_u
+        br_if $rows_done
+        i32.const 0
+        local.set $j
+        block $columns_done
+          loop $columns
+            local.get $j
+            local.get $n
+            i32.ge_u
+            br_if $columns_done
+            f64.const 0
+            local.set $sum
+            i32.const 0
+            local.set $k
+            block $products_done
+              loop $products
+                local.get $k
+                local.get $n
+                i32.ge_u
+                br_if $products_done
+                ;; A[i * n + k]
+                local.get $i
+                local.get $n
+                i32.mul
+                local.get $k
+                i32.add
+                i32.const 3
+                i32.shl
+                f64.load
+                ;; B[k * n + j]
+                local.get $k
+                local.get $n
+                i32.mul
+                local.get $j
+                i32.add
+                local.get $b
+                i32.add
+                i32.const 3
+                i32.shl
+                f64.load
+                f64.mul
+                local.get $sum
+                f64.add
+                local.set $sum
+                local.get $k
+                i32.const 1
+                i32.add
+                local.set $k
+                br $products
+              end
+            end
+            ;; C[i * n + j]
+            local.get $i
+            local.get $n
+            i32.mul
+            local.get $j
+            i32.add
+            local.get $c
+            i32.add
+            i32.const 3
+            i32.shl
+            local.get $sum
+            f64.store
+            local.get $checksum
+            local.get $sum
+            f64.add
+            local.set $checksum
+            local.get $j
+            i32.const 1
+            i32.add
+            local.set $j
+            br $columns
+          end
+        end
+        local.get $i
+        i32.const 1
+        i32.add
+        local.set $i
+        br $rows
+      end
+    end
+    local.get $checksum)
+
+  ;; The multiplication is run in a function of its own, so that it is called often enough to be compiled with --jit.
+  (func (export "run") (param $rounds i32) (result f64) (local $result f64)
+    i32.const 64
+    call $init
+    block $done
+      loop $next
+        local.get $rounds
+        i32.eqz
+        br_if $done
+        i32.const 64
+        call $multiply
+        local.set $result
+        local.get $rounds
+        i32.const 1
+        i32.sub
+        local.set $rounds
+        br $next
+      end
+    end
+    local.get $result))
@@ -0,0 +1,33 @@
+#!/usr/bin/env bash
+
+# Runs every benchmark in this directory with the interpreter, and again with the baseline compiler, and prints how
+# long each run took. The .wasm files are built from the .wat files next to them.
+#
+# Usage: run.sh <path to the wasm utility>
+
+set -eo pipefail
+
+if [ $# -ne 1 ]; then
+    echo "Usage: $0 <path to the wasm utility>"
+    exit 1
+fi
+
+wasm="$1"
+script_path=$(cd -P -- "$(dirname -- "$0")" && pwd -P)
+TIMEFORMAT="%3R s"
+
+run_benchmark() {
+    local name="$1"
+    local argument="$2"
+
+    for flags in "" "--jit"; do
+        printf '%-8s %-15s' "${name}" "${flags:-(interpreter)}"
+        # shellcheck disable=SC2086
+        time "${wasm}" ${flags} --execute run "${script_path}/${name}.wasm" --arg "${argument}" > /dev/null 2>&1
+    done
+}
+
+run_benchmark fib i32.const:30
+run_benchmark sieve i32.const:500
+run_benchmark matmul i32.const:200
+run_benchmark hash i32.const:10000000
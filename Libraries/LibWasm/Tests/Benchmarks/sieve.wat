@@ -0,0 +1,88 @@
+;; Sieve of Eratosthenes over a byte array in linear memory, which is dominated by loops and 8-bit memory accesses.
+;; Returns the number of primes below 100000 (9592).
+;; wasm --execute run sieve.wasm --arg i32.const:500
+(module
+  (memory 2)
+
+  (func $sieve (param $limit i32) (result i32) (local $i i32) (local $j i32) (local $count i32)
+    block $cleared
+      loop $clear
+        local.get $i
+        local.get $limit
+        i32.ge_u
+        br_if $cleared
+        local.get $i
+        i32.const 0
+        i32.store8
+        local.get $i
+        i32.const 1
+        i32.add
+        local.set $i
+        br $clear
+      end
+    end
+
+    i32.const 2
+    local.set $i
+    block $done
+      loop $next
+        local.get $i
+        local.get $limit
+        i32.ge_u
+        br_if $done
+        local.get $i
+        i32.load8_u
+        i32.eqz
+        if
+          local.get $count
+          i32.const 1
+          i32.add
+          local.set $count
+          local.get $i
+          local.get $i
+          i32.add
+          local.set $j
+          block $marked
+            loop $mark
+              local.get $j
+              local.get $limit
+              i32.ge_u
+              br_if $marked
+              local.get $j
+              i32.const 1
+              i32.store8
+              local.get $j
+              local.get $i
+              i32.add
+              local.set $j
+              br $mark
+            end
+          end
+        end
+        local.get $i
+        i32.const 1
+        i32.add
+        local.set $i
+        br $next
+      end
+    end
+    local.get $count)
+
+  ;; The sieve is run in a function of its own, so that it is called often enough to be compiled with --jit.
+  (func (export "run") (param $rounds i32) (result i32) (local $result i32)
+    block $done
+      loop $next
+        local.get $rounds
+        i32.eqz
+        br_if $done
+        i32.const 100000
+        call $sieve
+        local.set $result
+        local.get $rounds
+        i32.const 1
+        i32.sub
+        local.set $rounds
+        br $next
+      end
+    end
+    local.get $result))
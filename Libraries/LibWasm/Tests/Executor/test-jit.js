@@ -0,0 +1,68 @@
+// These functions are called often enough to be compiled to native code when the JIT is enabled (--wasm-jit), so
+// results before and after tiering up should be the same.
+const iterations = 250;
+
+const bin = readBinaryWasmFile("Fixtures/Modules/jit.wasm");
+const module = parseWebAssemblyModule(bin);
+
+test("loops with 64-bit locals", () => {
+    const fib = module.getExport("fib");
+    for (let i = 0; i < iterations; ++i) {
+        expect(module.invoke(fib, 0)).toBe(0n);
+        expect(module.invoke(fib, 10)).toBe(55n);
+        expect(module.invoke(fib, 90)).toBe(2880067194370816120n);
+    }
+});
+
+test("recursive calls", () => {
+    const factorial = module.getExport("factorial");
+    for (let i = 0; i < iterations; ++i) {
+        expect(module.invoke(factorial, 1n)).toBe(1n);
+        expect(module.invoke(factorial, 20n)).toBe(2432902008176640000n);
+    }
+});
+
+test("memory accesses", () => {
+    const store = module.getExport("store");
+    const sum = module.getExport("sum");
+    for (let i = 0; i < iterations; ++i) module.invoke(store, i, i * 3);
+
+    let expected = 0;
+    for (let i = 0; i < iterations; ++i) {
+        expected += i * 3;
+        expect(module.invoke(sum, i + 1)).toBe(expected);
+    }
+
+    expect(() => module.invoke(store, 16384, 1)).toThrowWithMessage(TypeError, "Memory access out of bounds");
+});
+
+test("memory accesses at the end of the address space", () => {
+    const store = module.getExport("store");
+    const sum = module.getExport("sum");
+    for (let i = 0; i < iterations; ++i) module.invoke(store, 16383, 0);
+
+    // Accesses aren't bounds checked when the memory has a guard region, so these fault and trap instead.
+    expect(() => module.invoke(store, 16384, 1)).toThrowWithMessage(TypeError, "Memory access out of bounds");
+    expect(() => module.invoke(store, 0x3fffffff, 1)).toThrowWithMessage(TypeError, "Memory access out of bounds");
+    expect(() => module.invoke(sum, 0x40000000)).toThrowWithMessage(TypeError, "Memory access out of bounds");
+
+    // The memory is still usable after a trap.
+    module.invoke(store, 0, 5);
+    expect(module.invoke(sum, 1)).toBe(5);
+});
+
+test("traps", () => {
+    const divide = module.getExport("divide");
+    for (let i = 0; i < iterations; ++i) {
+        expect(module.invoke(divide, 7, 2)).toBe(3);
+        expect(module.invoke(divide, -7, 2)).toBe(-3);
+    }
+    expect(() => module.invoke(divide, 1, 0)).toThrowWithMessage(TypeError, "Integer division overflow");
+    expect(() => module.invoke(divide, -2147483648, -1)).toThrowWithMessage(TypeError, "Integer division overflow");
+});
+
+test("floating-point arithmetic", () => {
+    const hypot = module.getExport("hypot");
+    // f64 results are returned as their bit pattern.
+    for (let i = 0; i < iterations; ++i) expect(module.invoke(hypot, 3, 4)).toBe(0x4014000000000000n);
+});
@@ -0,0 +1,91 @@
+;; Source of jit.wasm, which is used by Executor/test-jit.js.
+;; The functions cover what the baseline compiler emits inline: loops, 64-bit locals, calls, memory accesses, traps and
+;; floating-point arithmetic.
+(module
+  (memory 1)
+
+  ;; Returns the nth Fibonacci number.
+  (func $fib (export "fib") (param $n i32) (result i64) (local $a i64) (local $b i64)
+    i64.const 0
+    local.set $a
+    i64.const 1
+    local.set $b
+    block $done
+      loop $next
+        local.get $n
+        i32.eqz
+        br_if $done
+        local.get $a
+        local.get $b
+        i64.add
+        local.get $b
+        local.set $a
+        local.set $b
+        local.get $n
+        i32.const 1
+        i32.sub
+        local.set $n
+        br $next
+      end
+    end
+    local.get $a)
+
+  (func $factorial (export "factorial") (param $n i64) (result i64)
+    local.get $n
+    i64.const 1
+    i64.le_s
+    if (result i64)
+      i64.const 1
+    else
+      local.get $n
+      local.get $n
+      i64.const 1
+      i64.sub
+      call $factorial
+      i64.mul
+    end)
+
+  ;; Stores a value into the given element of an array of i32s at address 0.
+  (func $store (export "store") (param $index i32) (param $value i32)
+    local.get $index
+    i32.const 2
+    i32.shl
+    local.get $value
+    i32.store align=1)
+
+  ;; Returns the sum of the first count elements of the array.
+  (func $sum (export "sum") (param $count i32) (result i32) (local $sum i32)
+    block $done
+      loop $next
+        local.get $count
+        i32.eqz
+        br_if $done
+        local.get $count
+        i32.const 1
+        i32.sub
+        local.tee $count
+        i32.const 2
+        i32.shl
+        i32.load align=1
+        local.get $sum
+        i32.add
+        local.set $sum
+        br $next
+      end
+    end
+    local.get $sum)
+
+  (func $divide (export "divide") (param $a i32) (param $b i32) (result i32)
+    local.get $a
+    local.get $b
+    i32.div_s)
+
+  (func $hypot (export "hypot") (param $x f64) (param $y f64) (result f64)
+    local.get $x
+    local.get $x
+    f64.mul
+    local.get $y
+    local.get $y
+    f64.mul
+    f64.add
+    f64.sqrt))
@@ -18,6 +18,7 @@
 #include <LibWasm/Constants.h>
 #include <LibWasm/Export.h>
 #include <LibWasm/Forward.h>
+#include <LibWasm/JIT/NativeFunction.h>
 #include <LibWasm/Opcode.h>
 
 namespace Wasm {
@@ -633,6 +634,11 @@ struct CompiledInstructions {
     Vector<Dispatch> dispatches;
     Vector<Instruction, 0, FastLastAccess::Yes> extra_instruction_storage;
     bool direct = false; // true if all dispatches contain handler_ptr, otherwise false and all contain instruction_opcode.
+
+    // Counts calls until the function is hot enough to be compiled to native code.
+    u32 jit_hotness { 0 };
+    bool did_try_jit_compilation { false };
+    RefPtr<JIT::NativeFunction> native_function;
 };
 
 template<Enum auto... Vs>
@@ -1248,6 +1254,7 @@ public:
     auto& tag_section() const { return m_tag_section; }
 
     void set_validation_status(ValidationStatus status, Badge<Validator>) { set_validation_status(status); }
+    void set_restored_from_cache(Badge<ModuleCache>) { set_validation_status(ValidationStatus::Valid); }
     ValidationStatus validation_status() const { return m_validation_status; }
     StringView validation_error() const LIFETIME_BOUND { return *m_validation_error; }
     void set_validation_error(ByteString error) { m_validation_error = move(error); }
@@ -1276,6 +1283,30 @@ private:
     Optional<ByteString> m_validation_error;
 };
 
+// Parses a module whose bytes arrive in chunks, e.g. while it is still being downloaded. Every section is parsed as soon as
+// all of its bytes have arrived, so only the section that is currently being received is buffered. Once any call has
+// returned an error, or once the module has been taken out of it with finish(), the parser must not be used anymore.
+class WASM_API StreamingModuleParser {
+    AK_MAKE_NONCOPYABLE(StreamingModuleParser);
+    AK_MAKE_NONMOVABLE(StreamingModuleParser);
+
+public:
+    StreamingModuleParser();
+
+    ParseResult<void> append(ReadonlyBytes);
+    ParseResult<NonnullRefPtr<Module>> finish();
+
+private:
+    ParseResult<void> parse_available_sections();
+
+    ByteBuffer m_buffer;
+    bool m_did_parse_header { false };
+    SectionId::SectionIdKind m_last_section_id { SectionId::SectionIdKind::Custom };
+    RefPtr<Module> m_module;
+};
+
 CompiledInstructions try_compile_instructions(Expression const&, Span<FunctionType const> functions);
+// Replaces the opcodes of all dispatches with pointers to their handlers, if the interpreter uses direct threading.
+void try_use_direct_threading(CompiledInstructions&);
 
 }
@@ -1755,6 +1755,9 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> http_network_or_cache_fetch(JS::Re
             new_http_fetch_params->set_cross_origin_isolated_capability(fetch_params.cross_origin_isolated_capability());
             new_http_fetch_params->set_preloaded_response_candidate(fetch_params.preloaded_response_candidate());
             http_fetch_params = new_http_fetch_params;
+
+            // AD-HOC: Let priority changes made through fetchParams's controller reach the network request.
+            fetch_params.controller()->set_http_fetch_controller(new_http_fetch_params->controller());
         }
 
         // 3. Let includeCredentials be true if one of
@@ -2291,6 +2294,44 @@ static void log_response(auto const& status_code, auto const& headers, auto cons
 }
 #endif
 
+// Maps a request to the priority with which RequestServer schedules its transfer, relative to the page's other requests.
+RequestServer::RequestPriority request_server_priority(Infrastructure::Request const& request)
+{
+    if (request.initiator() == Infrastructure::Request::Initiator::Prefetch)
+        return RequestServer::RequestPriority::Idle;
+
+    if (request.render_blocking())
+        return RequestServer::RequestPriority::High;
+
+    switch (request.priority()) {
+    case Infrastructure::Request::Priority::High:
+        return RequestServer::RequestPriority::High;
+    case Infrastructure::Request::Priority::Low:
+        return RequestServer::RequestPriority::Low;
+    case Infrastructure::Request::Priority::Auto:
+        break;
+    }
+
+    if (!request.destination().has_value())
+        return RequestServer::RequestPriority::Medium;
+
+    switch (*request.destination()) {
+    case Infrastructure::Request::Destination::Document:
+    case Infrastructure::Request::Destination::Frame:
+    case Infrastructure::Request::Destination::IFrame:
+    case Infrastructure::Request::Destination::Script:
+    case Infrastructure::Request::Destination::Style:
+        return RequestServer::RequestPriority::High;
+    case Infrastructure::Request::Destination::Audio:
+    case Infrastructure::Request::Destination::Image:
+    case Infrastructure::Request::Destination::Track:
+    case Infrastructure::Request::Destination::Video:
+        return RequestServer::RequestPriority::Low;
+    default:
+        return RequestServer::RequestPriority::Medium;
+    }
+}
+
 // https://fetch.spec.whatwg.org/#concept-http-network-fetch
 // Drop-in replacement for 'HTTP-network fetch', but obviously non-standard :^)
 // It also handles file:// URLs since those can also go through ResourceLoader.
@@ -2317,6 +2358,7 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> nonstandard_resource_loader_file_o
     load_request.set_page(page);
     load_request.set_method(ByteString::copy(request->method()));
     load_request.set_store_set_cookie_headers(include_credentials == IncludeCredentials::Yes);
+    load_request.set_priority(request_server_priority(*request));
 
     for (auto const& header : *request->header_list())
         load_request.set_header(ByteString::copy(header.name), ByteString::copy(header.value));
@@ -2432,8 +2474,9 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> nonstandard_resource_loader_file_o
             }
         });
 
-        auto on_complete = GC::create_function(vm.heap(), [&vm, &realm, pending_response, stream](bool success, Requests::RequestTimingInfo const&, Optional<StringView> error_message) {
+        auto on_complete = GC::create_function(vm.heap(), [&vm, &realm, pending_response, stream, controller = fetch_params.controller()](bool success, Requests::RequestTimingInfo const&, Optional<StringView> error_message) {
             dbgln("FIXME: Implement on_complete timing info for unbuffered requests");
+            controller->set_network_request(nullptr);
             HTML::TemporaryExecutionContext execution_context { realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
 
             // 16.1.1.2. Otherwise, if the bytes transmission for response’s message body is done normally and stream is readable,
@@ -2454,10 +2497,11 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> nonstandard_resource_loader_file_o
             }
         });
 
-        ResourceLoader::the().load_unbuffered(load_request, on_headers_received, on_data_received, on_complete);
+        fetch_params.controller()->set_network_request(ResourceLoader::the().load_unbuffered(load_request, on_headers_received, on_data_received, on_complete));
     } else {
-        auto on_load_success = GC::create_function(vm.heap(), [&realm, &vm, request, pending_response, fetch_timing_info, cross_origin_isolated_capability](ReadonlyBytes data, Requests::RequestTimingInfo const& timing_info, HTTP::HeaderMap const& response_headers, Optional<u32> status_code, Optional<String> const& reason_phrase) {
+        auto on_load_success = GC::create_function(vm.heap(), [&realm, &vm, request, pending_response, fetch_timing_info, cross_origin_isolated_capability, controller = fetch_params.controller()](ReadonlyBytes data, Requests::RequestTimingInfo const& timing_info, HTTP::HeaderMap const& response_headers, Optional<u32> status_code, Optional<String> const& reason_phrase) {
             (void)request;
+            controller->set_network_request(nullptr);
             dbgln_if(WEB_FETCH_DEBUG, "Fetch: ResourceLoader load for '{}' complete", request->url());
             if constexpr (WEB_FETCH_DEBUG)
                 log_response(status_code, response_headers, data);
@@ -2482,8 +2526,9 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> nonstandard_resource_loader_file_o
             pending_response->resolve(response);
         });
 
-        auto on_load_error = GC::create_function(vm.heap(), [&realm, &vm, request, pending_response, fetch_timing_info, cross_origin_isolated_capability](ByteString const& error, Requests::RequestTimingInfo const& timing_info, Optional<u32> status_code, Optional<String> const& reason_phrase, ReadonlyBytes data, HTTP::HeaderMap const& response_headers) {
+        auto on_load_error = GC::create_function(vm.heap(), [&realm, &vm, request, pending_response, fetch_timing_info, cross_origin_isolated_capability, controller = fetch_params.controller()](ByteString const& error, Requests::RequestTimingInfo const& timing_info, Optional<u32> status_code, Optional<String> const& reason_phrase, ReadonlyBytes data, HTTP::HeaderMap const& response_headers) {
             (void)request;
+            controller->set_network_request(nullptr);
             dbgln_if(WEB_FETCH_DEBUG, "Fetch: ResourceLoader load for '{}' failed: {} (status {})", request->url(), error, status_code.value_or(0));
             if constexpr (WEB_FETCH_DEBUG)
                 log_response(status_code, response_headers, data);
@@ -2514,7 +2559,7 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> nonstandard_resource_loader_file_o
             pending_response->resolve(response);
         });
 
-        ResourceLoader::the().load(load_request, on_load_success, on_load_error);
+        fetch_params.controller()->set_network_request(ResourceLoader::the().load(load_request, on_load_success, on_load_error));
     }
 
     return pending_response;
@@ -12,6 +12,7 @@
 #include <LibJS/Forward.h>
 #include <LibWeb/Export.h>
 #include <LibWeb/Forward.h>
+#include <RequestServer/RequestPriority.h>
 
 namespace Web::Fetch::Fetching {
 
@@ -54,6 +55,7 @@ void set_sec_fetch_mode_header(Infrastructure::Request&);
 void set_sec_fetch_site_header(Infrastructure::Request&);
 void set_sec_fetch_user_header(Infrastructure::Request&);
 void append_fetch_metadata_headers_for_request(Infrastructure::Request&);
+RequestServer::RequestPriority request_server_priority(Infrastructure::Request const&);
 
 WEB_API void set_http_cache_enabled(bool enabled);
 
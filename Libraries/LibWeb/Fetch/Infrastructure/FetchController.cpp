@@ -6,6 +6,7 @@
 
 #include <LibGC/Heap.h>
 #include <LibJS/Runtime/VM.h>
+#include <LibWeb/Fetch/Fetching/Fetching.h>
 #include <LibWeb/Fetch/Infrastructure/FetchAlgorithms.h>
 #include <LibWeb/Fetch/Infrastructure/FetchController.h>
 #include <LibWeb/Fetch/Infrastructure/FetchParams.h>
@@ -31,6 +32,7 @@ void FetchController::visit_edges(JS::Cell::Visitor& visitor)
     visitor.visit(m_report_timing_steps);
     visitor.visit(m_next_manual_redirect_steps);
     visitor.visit(m_fetch_params);
+    visitor.visit(m_http_fetch_controller);
 }
 
 void FetchController::set_report_timing_steps(Function<void(JS::Object&)> report_timing_steps)
@@ -148,6 +150,24 @@ void FetchController::stop_fetch()
     }
 }
 
+// AD-HOC: Changes the priority of the fetch's request after it has been started, e.g. when an image that is still loading
+//         scrolls into view. If the request is already waiting in RequestServer, it is rescheduled there.
+void FetchController::set_request_priority(Request::Priority priority)
+{
+    if (m_state != State::Ongoing || !m_fetch_params)
+        return;
+
+    auto request = m_fetch_params->request();
+    if (request->priority() == priority)
+        return;
+    request->set_priority(priority);
+
+    if (m_http_fetch_controller)
+        m_http_fetch_controller->set_request_priority(priority);
+    if (m_network_request)
+        m_network_request->set_priority(Fetching::request_server_priority(*request));
+}
+
 void FetchController::fetch_task_queued(u64 fetch_task_id, HTML::TaskID event_id)
 {
     m_ongoing_fetch_tasks.set(fetch_task_id, event_id);
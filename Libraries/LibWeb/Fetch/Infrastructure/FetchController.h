@@ -13,8 +13,10 @@
 #include <LibJS/Forward.h>
 #include <LibJS/Heap/Cell.h>
 #include <LibJS/Runtime/VM.h>
+#include <LibRequests/Request.h>
 #include <LibWeb/Export.h>
 #include <LibWeb/Fetch/Infrastructure/FetchTimingInfo.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/HTML/EventLoop/Task.h>
 #include <LibWeb/HTML/StructuredSerializeTypes.h>
@@ -52,6 +54,10 @@ public:
 
     void stop_fetch();
 
+    void set_request_priority(Request::Priority);
+    void set_http_fetch_controller(GC::Ref<FetchController> http_fetch_controller) { m_http_fetch_controller = http_fetch_controller; }
+    void set_network_request(RefPtr<Requests::Request> network_request) { m_network_request = move(network_request); }
+
     u64 next_fetch_task_id() { return m_next_fetch_task_id++; }
     void fetch_task_queued(u64 fetch_task_id, HTML::TaskID event_id);
     void fetch_task_complete(u64 fetch_task_id);
@@ -88,6 +94,13 @@ private:
 
     GC::Ptr<FetchParams> m_fetch_params;
 
+    // AD-HOC: HTTP-network-or-cache fetch may carry out the network part of this fetch with a copy of its fetch params,
+    //         which has its own controller. Priority changes are forwarded to it.
+    GC::Ptr<FetchController> m_http_fetch_controller;
+
+    // AD-HOC: The RequestServer request that is in flight for this fetch, if any.
+    RefPtr<Requests::Request> m_network_request;
+
     HashMap<u64, HTML::TaskID> m_ongoing_fetch_tasks;
     u64 m_next_fetch_task_id { 0 };
 };
@@ -37,6 +37,7 @@ AK_TYPEDEF_DISTINCT_NUMERIC_GENERAL(i64, UniqueNodeID, Comparison, Increment, Ca
 namespace Web::Painting {
 
 class BackingStore;
+class DamageTracker;
 class DevicePixelConverter;
 class DisplayList;
 class DisplayListPlayerSkia;
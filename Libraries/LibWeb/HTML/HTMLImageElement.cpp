@@ -145,6 +145,14 @@ void HTMLImageElement::form_associated_element_attribute_changed(FlyString const
         update_the_image_data(true);
     }
 
+    // AD-HOC: Let a change of the fetchpriority attribute reach a fetch that is still in progress.
+    if (name == HTML::AttributeNames::fetchpriority) {
+        if (m_current_request)
+            m_current_request->set_fetch_priority(fetch_priority());
+        if (m_pending_request)
+            m_pending_request->set_fetch_priority(fetch_priority());
+    }
+
     if (name == HTML::AttributeNames::alt) {
         if (layout_node())
             did_update_alt_text(as<Layout::ImageBox>(*layout_node()));
@@ -213,9 +221,21 @@ RefPtr<Gfx::ImmutableBitmap> HTMLImageElement::current_image_bitmap_sized(Gfx::I
     return nullptr;
 }
 
-void HTMLImageElement::set_visible_in_viewport(bool)
+void HTMLImageElement::set_visible_in_viewport(bool visible_in_viewport)
 {
     // FIXME: Loosen grip on image data when it's not visible, e.g via volatile memory.
+
+    // AD-HOC: An image that is still loading when it scrolls into view is fetched ahead of the page's other images, unless
+    //         its fetchpriority attribute asks for a specific priority.
+    if (!visible_in_viewport || !m_current_request)
+        return;
+    if (fetch_priority() == Fetch::Infrastructure::Request::Priority::Auto)
+        m_current_request->set_fetch_priority(Fetch::Infrastructure::Request::Priority::High);
+}
+
+Fetch::Infrastructure::Request::Priority HTMLImageElement::fetch_priority() const
+{
+    return Fetch::Infrastructure::request_priority_from_string(get_attribute_value(HTML::AttributeNames::fetchpriority)).value_or(Fetch::Infrastructure::Request::Priority::Auto);
 }
 
 // https://html.spec.whatwg.org/multipage/embedded-content.html#dom-img-width
@@ -760,7 +780,7 @@ after_step_7:
         request->set_referrer_policy(ReferrerPolicy::from_string(get_attribute_value(HTML::AttributeNames::referrerpolicy)).value_or(ReferrerPolicy::ReferrerPolicy::EmptyString));
 
         // 23. Set request's priority to the current state of the element's fetchpriority attribute.
-        request->set_priority(Fetch::Infrastructure::request_priority_from_string(get_attribute_value(HTML::AttributeNames::fetchpriority)).value_or(Fetch::Infrastructure::Request::Priority::Auto));
+        request->set_priority(fetch_priority());
 
         // 25. If the will lazy load element steps given the img return true, then:
         if (will_lazy_load_element()) {
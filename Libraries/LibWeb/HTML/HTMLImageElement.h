@@ -14,6 +14,7 @@
 #include <LibGfx/ImmutableBitmap.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/DocumentLoadEventDelayer.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
 #include <LibWeb/HTML/BrowsingContext.h>
 #include <LibWeb/HTML/CORSSettingAttribute.h>
 #include <LibWeb/HTML/FormAssociatedElement.h>
@@ -138,6 +139,8 @@ private:
     void handle_failed_fetch();
     void add_callbacks_to_image_request(GC::Ref<ImageRequest>, bool maybe_omit_events, String const& url_string, String const& previous_url);
 
+    Fetch::Infrastructure::Request::Priority fetch_priority() const;
+
     void animate();
 
     RefPtr<Core::Timer> m_animation_timer;
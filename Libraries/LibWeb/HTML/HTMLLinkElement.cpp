@@ -104,6 +104,11 @@ void HTMLLinkElement::inserted()
         if (auto maybe_href = document().encoding_parse_url(get_attribute_value(HTML::AttributeNames::href)); maybe_href.has_value()) {
             ResourceLoader::the().preconnect(maybe_href.value());
         }
+    } else if (m_relationship & Relationship::Prefetch) {
+        // https://html.spec.whatwg.org/multipage/links.html#link-type-prefetch
+        if (auto prefetch_url = document().encoding_parse_url(get_attribute_value(HTML::AttributeNames::href)); prefetch_url.has_value()) {
+            ResourceLoader::the().prefetch(prefetch_url.value(), document().page());
+        }
     } else if (m_relationship & Relationship::Icon) {
         if (auto favicon_url = document().encoding_parse_url(href()); favicon_url.has_value()) {
             auto favicon_request = LoadRequest::create_for_url_on_page(favicon_url.value(), &document().page());
@@ -194,6 +199,8 @@ void HTMLLinkElement::attribute_changed(FlyString const& name, Optional<String>
                 m_relationship |= Relationship::DNSPrefetch;
             else if (part == "preconnect"sv)
                 m_relationship |= Relationship::Preconnect;
+            else if (part == "prefetch"sv)
+                m_relationship |= Relationship::Prefetch;
             else if (part == "icon"sv)
                 m_relationship |= Relationship::Icon;
         }
@@ -235,6 +242,10 @@ void HTMLLinkElement::attribute_changed(FlyString const& name, Optional<String>
         if (name == HTML::AttributeNames::media && m_loaded_style_sheet) {
             m_loaded_style_sheet->set_media(value.value_or(String {}));
         }
+
+        // AD-HOC: Let a change of the fetchpriority attribute reach a fetch that is still in progress.
+        if (name == HTML::AttributeNames::fetchpriority && m_fetch_controller)
+            m_fetch_controller->set_request_priority(Fetch::Infrastructure::request_priority_from_string(value.value_or(String {})).value_or(Fetch::Infrastructure::Request::Priority::Auto));
     }
 }
 
@@ -149,6 +149,7 @@ private:
             DNSPrefetch = 1 << 3,
             Preconnect = 1 << 4,
             Icon = 1 << 5,
+            Prefetch = 1 << 6,
         };
     };
 
@@ -6,7 +6,11 @@
  */
 
 #include <AK/Debug.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
 #include <AK/StringBuilder.h>
+#include <LibURL/Parser.h>
 #include <LibTextCodec/Decoder.h>
 #include <LibWeb/Bindings/HTMLScriptElementPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
@@ -23,6 +27,7 @@
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/Infra/CharacterTypes.h>
 #include <LibWeb/Infra/Strings.h>
+#include <LibWeb/Loader/ResourceLoader.h>
 #include <LibWeb/MimeSniff/MimeType.h>
 #include <LibWeb/TrustedTypes/RequireTrustedTypesForDirective.h>
 #include <LibWeb/TrustedTypes/TrustedTypePolicy.h>
@@ -167,6 +172,55 @@ void HTMLScriptElement::execute_script()
         dispatch_event(DOM::Event::create(realm(), HTML::EventNames::load));
 }
 
+// https://html.spec.whatwg.org/multipage/speculative-loading.html#parse-a-speculation-rule-set-string
+static void prefetch_urls_from_speculation_rules(StringView source_text, DOM::Document& document, URL::URL const& base_url)
+{
+    auto parsed = JsonValue::from_string(source_text);
+    if (parsed.is_error() || !parsed.value().is_object()) {
+        dbgln("HTMLScriptElement: Ignoring speculation rules which are not a JSON object.");
+        return;
+    }
+
+    auto prefetch_rules = parsed.value().as_object().get_array("prefetch"sv);
+    if (!prefetch_rules.has_value())
+        return;
+
+    prefetch_rules->for_each([&](JsonValue const& rule_value) {
+        if (!rule_value.is_object())
+            return;
+        auto const& rule = rule_value.as_object();
+
+        // FIXME: Support document rules, which select links in the document to prefetch.
+        auto urls = rule.get_array("urls"sv);
+        if (!urls.has_value())
+            return;
+
+        // FIXME: Support the "moderate" and "conservative" eagerness levels, which defer the prefetch until the user
+        //        hovers or presses on a link.
+        if (auto eagerness = rule.get_string("eagerness"sv); eagerness.has_value() && !eagerness->is_one_of("immediate"sv, "eager"sv))
+            return;
+
+        // We cannot honor any requirements of the rule, such as anonymizing the client's IP address.
+        if (rule.has("requires"sv))
+            return;
+
+        urls->for_each([&](JsonValue const& url_value) {
+            if (!url_value.is_string())
+                return;
+
+            auto url = URL::Parser::basic_parse(url_value.as_string(), base_url);
+            if (!url.has_value())
+                return;
+
+            // FIXME: Cross-origin prefetches must be made without credentials, which we do not yet support.
+            if (!url->origin().is_same_origin(document.origin()))
+                return;
+
+            ResourceLoader::the().prefetch(*url, document.page());
+        });
+    });
+}
+
 // https://html.spec.whatwg.org/multipage/scripting.html#prepare-a-script
 // https://whatpr.org/html/9893/scripting.html#prepare-a-script
 void HTMLScriptElement::prepare_script()
@@ -242,7 +296,11 @@ void HTMLScriptElement::prepare_script()
         // then set el's type to "importmap".
         m_script_type = ScriptType::ImportMap;
     }
-    // FIXME: 12. Otherwise, if the script block's type string is an ASCII case-insensitive match for the string "speculationrules", then set el's type to "speculationrules".
+    // 12. Otherwise, if the script block's type string is an ASCII case-insensitive match for the string "speculationrules",
+    else if (script_block_type.equals_ignoring_ascii_case("speculationrules"sv)) {
+        // then set el's type to "speculationrules".
+        m_script_type = ScriptType::SpeculationRules;
+    }
     // 13. Otherwise, return. (No script is executed, and el's type is left as null.)
     else {
         VERIFY(m_script_type == ScriptType::Null);
@@ -377,8 +435,7 @@ void HTMLScriptElement::prepare_script()
     // 33. If el has a src content attribute, then:
     if (has_attribute(HTML::AttributeNames::src)) {
         // 1. If el's type is "importmap" or "speculationrules", then:
-        // FIXME: Add "speculationrules" support.
-        if (m_script_type == ScriptType::ImportMap) {
+        if (m_script_type == ScriptType::ImportMap || m_script_type == ScriptType::SpeculationRules) {
             // then queue an element task on the DOM manipulation task source given el to fire an event named error at el, and return.
             queue_an_element_task(HTML::Task::Source::DOMManipulation, [this] {
                 dispatch_event(DOM::Event::create(realm(), HTML::EventNames::error));
@@ -492,7 +549,17 @@ void HTMLScriptElement::prepare_script()
             // 2. Mark as ready el given result.
             mark_as_ready(Result(move(result)));
         }
-        // FIXME: -> "speculationrules"
+        // -> "speculationrules"
+        else if (m_script_type == ScriptType::SpeculationRules) {
+            // 1. Let result be the result of parsing a speculation rule set given source text, el's node document, and
+            //    base URL.
+            // FIXME: Implement speculation rule sets properly. For now, we only support immediate prefetches of list
+            //        rules, which are handed to the resource loader as soon as the rules are parsed.
+            prefetch_urls_from_speculation_rules(source_text_utf8, document(), base_url);
+
+            // 2. Return.
+            return;
+        }
     }
 
     // 35. If el's type is "classic" and el has a src attribute, or el's type is "module":
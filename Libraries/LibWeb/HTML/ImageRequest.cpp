@@ -58,6 +58,14 @@ bool ImageRequest::is_fetching() const
     return m_shared_resource_request && m_shared_resource_request->is_fetching();
 }
 
+void ImageRequest::set_fetch_priority(Fetch::Infrastructure::Request::Priority priority)
+{
+    if (!is_fetching())
+        return;
+    if (auto fetch_controller = m_shared_resource_request->fetch_controller())
+        fetch_controller->set_request_priority(priority);
+}
+
 ImageRequest::State ImageRequest::state() const
 {
     return m_state;
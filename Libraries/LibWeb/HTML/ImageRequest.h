@@ -11,6 +11,7 @@
 #include <LibGC/Root.h>
 #include <LibGfx/Size.h>
 #include <LibURL/URL.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
 #include <LibWeb/Forward.h>
 
 namespace Web::HTML {
@@ -57,6 +58,9 @@ public:
     void fetch_image(JS::Realm&, GC::Ref<Fetch::Infrastructure::Request>);
     void add_callbacks(Function<void()> on_finish, Function<void()> on_fail);
 
+    // AD-HOC: Changes the priority of the image's fetch while it is still in progress.
+    void set_fetch_priority(Fetch::Infrastructure::Request::Priority);
+
     GC::Ptr<SharedResourceRequest const> shared_resource_request() const { return m_shared_resource_request; }
 
     virtual void visit_edges(JS::Cell::Visitor&) override;
@@ -2639,7 +2639,7 @@ void Navigable::paint_next_frame()
     if (!is_top_level_traversable())
         return;
 
-    auto [backing_store_id, painting_surface] = m_backing_store_manager->acquire_store_for_next_frame();
+    auto [backing_store_id, painting_surface, previous_frame_surface] = m_backing_store_manager->acquire_store_for_next_frame();
     if (!painting_surface)
         return;
 
@@ -2649,14 +2649,15 @@ void Navigable::paint_next_frame()
     auto viewport_rect = page().css_to_device_rect(this->viewport_rect()).to_type<int>();
     PaintConfig paint_config { .paint_overlay = true, .should_show_line_box_borders = m_should_show_line_box_borders, .canvas_fill_rect = Gfx::IntRect { {}, viewport_rect.size() } };
     auto page_client = &page().top_level_traversable()->page().client();
-    start_display_list_rendering(*painting_surface, paint_config, [page_client, viewport_rect, backing_store_id] {
+    auto callback = [page_client, viewport_rect, backing_store_id] {
         if (!page_client)
             return;
         page_client->page_did_paint(viewport_rect, backing_store_id);
-    });
+    };
+    start_display_list_rendering(*painting_surface, paint_config, move(callback), move(previous_frame_surface));
 }
 
-void Navigable::start_display_list_rendering(Gfx::PaintingSurface& painting_surface, PaintConfig paint_config, Function<void()>&& callback)
+void Navigable::start_display_list_rendering(Gfx::PaintingSurface& painting_surface, PaintConfig paint_config, Function<void()>&& callback, RefPtr<Gfx::PaintingSurface> previous_frame_surface)
 {
     m_needs_repaint = false;
     auto document = active_document();
@@ -2692,7 +2693,7 @@ void Navigable::start_display_list_rendering(Gfx::PaintingSurface& painting_surf
         return TraversalDecision::Continue;
     });
 
-    m_rendering_thread.enqueue_rendering_task(*display_list, move(scroll_state_snapshot_by_display_list), painting_surface, move(callback));
+    m_rendering_thread.enqueue_rendering_task(*display_list, move(scroll_state_snapshot_by_display_list), painting_surface, move(previous_frame_surface), move(callback));
 }
 
 RefPtr<Gfx::SkiaBackendContext> Navigable::skia_backend_context() const
@@ -198,7 +198,9 @@ public:
     bool is_ready_to_paint() const;
     void ready_to_paint();
     void paint_next_frame();
-    void start_display_list_rendering(Gfx::PaintingSurface&, PaintConfig, Function<void()>&& callback);
+    // If the surface that the previous frame was painted into is given, only the parts of the frame that changed since are
+    // painted, and the rest is copied over from it.
+    void start_display_list_rendering(Gfx::PaintingSurface&, PaintConfig, Function<void()>&& callback, RefPtr<Gfx::PaintingSurface> previous_frame_surface = {});
 
     bool needs_repaint() const { return m_needs_repaint; }
     void set_needs_repaint() { m_needs_repaint = true; }
@@ -4,7 +4,9 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Debug.h>
 #include <LibCore/EventLoop.h>
+#include <LibGfx/PaintingSurface.h>
 #include <LibThreading/Thread.h>
 #include <LibWeb/HTML/RenderingThread.h>
 #include <LibWeb/HTML/TraversableNavigable.h>
@@ -68,17 +70,29 @@ void RenderingThread::rendering_thread_loop()
             break;
         }
 
-        m_skia_player->execute(*task->display_list, move(task->scroll_state_snapshot_by_display_list), task->painting_surface);
+        auto& painting_surface = *task->painting_surface;
+        Optional<Gfx::IntRect> damage_rect;
+        if (task->previous_frame_surface) {
+            auto scroll_state_snapshot = task->scroll_state_snapshot_by_display_list.get(*task->display_list).value_or({});
+            damage_rect = m_damage_tracker.compute_damage_for_frame(*task->display_list, scroll_state_snapshot, painting_surface, *task->previous_frame_surface);
+            if (damage_rect.has_value())
+                painting_surface.copy_from(*task->previous_frame_surface, *damage_rect);
+        }
+
+        auto rasterized_rect = damage_rect.value_or(painting_surface.rect());
+        dbgln_if(LIBWEB_DAMAGE_DEBUG, "RenderingThread: Rasterizing {} of {} pixels ({})", rasterized_rect.size().area(), painting_surface.rect().size().area(), rasterized_rect);
+
+        m_skia_player->execute(*task->display_list, move(task->scroll_state_snapshot_by_display_list), task->painting_surface, damage_rect);
         if (m_exit)
             break;
         task->callback();
     }
 }
 
-void RenderingThread::enqueue_rendering_task(NonnullRefPtr<Painting::DisplayList> display_list, Painting::ScrollStateSnapshotByDisplayList&& scroll_state_snapshot_by_display_list, NonnullRefPtr<Gfx::PaintingSurface> painting_surface, Function<void()>&& callback)
+void RenderingThread::enqueue_rendering_task(NonnullRefPtr<Painting::DisplayList> display_list, Painting::ScrollStateSnapshotByDisplayList&& scroll_state_snapshot_by_display_list, NonnullRefPtr<Gfx::PaintingSurface> painting_surface, RefPtr<Gfx::PaintingSurface> previous_frame_surface, Function<void()>&& callback)
 {
     Threading::MutexLocker const locker { m_rendering_task_mutex };
-    m_rendering_tasks.enqueue(Task { move(display_list), move(scroll_state_snapshot_by_display_list), move(painting_surface), move(callback) });
+    m_rendering_tasks.enqueue(Task { move(display_list), move(scroll_state_snapshot_by_display_list), move(painting_surface), move(previous_frame_surface), move(callback) });
     m_rendering_task_ready_wake_condition.signal();
 }
 
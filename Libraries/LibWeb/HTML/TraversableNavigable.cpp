@@ -21,6 +21,7 @@
 #include <LibWeb/HTML/TraversableNavigable.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/Layout/Viewport.h>
+#include <LibWeb/Loader/ResourceLoader.h>
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/Painting/PaintableBox.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
@@ -1268,6 +1269,9 @@ void TraversableNavigable::destroy_top_level_traversable()
         browsing_context->remove();
     }
 
+    // NOTE: Any prefetches started by this traversable's documents are no longer of use once it has been closed.
+    ResourceLoader::the().cancel_prefetches(page());
+
     // 4. Remove traversable from the user interface (e.g., close or hide its tab in a tabbed browser).
     page().client().page_did_close_top_level_traversable();
 
@@ -55,6 +55,7 @@ ResourceLoader::ResourceLoader(GC::Heap& heap, NonnullRefPtr<Requests::RequestCl
 {
     m_request_client->on_request_server_died = [this]() {
         m_request_client = nullptr;
+        m_active_prefetches.clear();
     };
 }
 
@@ -63,6 +64,7 @@ void ResourceLoader::set_client(NonnullRefPtr<Requests::RequestClient> request_c
     m_request_client = move(request_client);
     m_request_client->on_request_server_died = [this]() {
         m_request_client = nullptr;
+        m_active_prefetches.clear();
     };
 }
 
@@ -96,6 +98,150 @@ void ResourceLoader::preconnect(URL::URL const& url)
         m_request_client->ensure_connection(url, RequestServer::CacheLevel::CreateConnection);
 }
 
+// Prefetches yield to the page's own loads, and are only started while fewer than this many regular loads are pending.
+static constexpr int MAXIMUM_PENDING_LOADS_FOR_PREFETCH = 4;
+static constexpr size_t MAXIMUM_CONCURRENT_PREFETCHES = 2;
+static constexpr size_t MAXIMUM_QUEUED_PREFETCHES = 32;
+
+// Prefetches whose responses exceed this size are stopped, to limit the bandwidth a page may spend on speculative loads.
+static constexpr size_t MAXIMUM_PREFETCH_SIZE = 8 * MiB;
+
+void ResourceLoader::prefetch(URL::URL const& url, Page& page)
+{
+    if (!url.scheme().is_one_of("http"sv, "https"sv))
+        return;
+
+    if (ContentFilter::the().is_filtered(url)) {
+        dbgln("ResourceLoader: Refusing to prefetch '{}': \033[31;1mURL was filtered\033[0m", url);
+        return;
+    }
+
+    auto is_same_prefetch = [&](Prefetch const& prefetch) {
+        return prefetch.request.url() == url && prefetch.request.page().ptr() == &page;
+    };
+    if (m_queued_prefetches.first_matching(is_same_prefetch).has_value() || m_active_prefetches.first_matching(is_same_prefetch).has_value())
+        return;
+
+    if (m_queued_prefetches.size() >= MAXIMUM_QUEUED_PREFETCHES) {
+        dbgln("ResourceLoader: Refusing to prefetch '{}': \033[31;1mtoo many prefetches are queued\033[0m", url);
+        return;
+    }
+
+    auto request = LoadRequest::create_for_url_on_page(url, &page);
+
+    // https://wicg.github.io/nav-speculation/prefetch.html#sec-purpose-header
+    request.set_header("Sec-Purpose", "prefetch");
+    request.set_priority(RequestServer::RequestPriority::Idle);
+
+    m_queued_prefetches.append({ .request = move(request) });
+    start_queued_prefetches();
+}
+
+void ResourceLoader::cancel_prefetches(Page& page)
+{
+    m_queued_prefetches.remove_all_matching([&](Prefetch const& prefetch) {
+        return prefetch.request.page().ptr() == &page;
+    });
+
+    m_active_prefetches.remove_all_matching([&](Prefetch const& prefetch) {
+        if (prefetch.request.page().ptr() != &page)
+            return false;
+
+        prefetch.protocol_request->stop();
+        return true;
+    });
+
+    start_queued_prefetches();
+}
+
+void ResourceLoader::start_queued_prefetches()
+{
+    while (!m_queued_prefetches.is_empty()) {
+        if (m_active_prefetches.size() >= MAXIMUM_CONCURRENT_PREFETCHES || m_pending_loads >= MAXIMUM_PENDING_LOADS_FOR_PREFETCH)
+            return;
+
+        // FIXME: We could keep the prefetches queued until the client connection is re-established.
+        if (!m_request_client)
+            return;
+
+        auto prefetch = m_queued_prefetches.take_first();
+        auto const& url = prefetch.request.url().value();
+
+        HTTP::HeaderMap headers;
+        for (auto const& it : prefetch.request.headers())
+            headers.set(it.key, it.value);
+        headers.set("User-Agent", m_user_agent.to_byte_string());
+
+        auto protocol_request = m_request_client->start_request(prefetch.request.method(), url, headers, prefetch.request.body(), ProxyMappings::the().proxy_for_url(url), prefetch.request.priority());
+        if (!protocol_request) {
+            dbgln("ResourceLoader: Failed to start prefetch of '{}'", url);
+            continue;
+        }
+
+        protocol_request->on_certificate_requested = []() -> Requests::Request::CertificateAndKey {
+            return {};
+        };
+
+        auto find_prefetch = [this](Requests::Request const& protocol_request) -> Prefetch* {
+            for (auto& prefetch : m_active_prefetches) {
+                if (prefetch.protocol_request.ptr() == &protocol_request)
+                    return &prefetch;
+            }
+            return nullptr;
+        };
+
+        auto protocol_headers_received = [this, find_prefetch, &protocol_request = *protocol_request](auto const& response_headers, auto, auto const&) {
+            if (auto* prefetch = find_prefetch(protocol_request))
+                handle_network_response_headers(prefetch->request, response_headers);
+        };
+
+        // The response is only being fetched into RequestServer's HTTP cache, so its body is discarded here.
+        auto protocol_data_received = [this, find_prefetch, &protocol_request = *protocol_request](auto data) {
+            auto* prefetch = find_prefetch(protocol_request);
+            if (!prefetch)
+                return;
+
+            auto was_within_limit = prefetch->bytes_received <= MAXIMUM_PREFETCH_SIZE;
+            prefetch->bytes_received += data.size();
+
+            if (was_within_limit && prefetch->bytes_received > MAXIMUM_PREFETCH_SIZE) {
+                dbgln("ResourceLoader: Stopping prefetch of '{}': \033[31;1mresponse exceeds {} bytes\033[0m", prefetch->request.url().value(), MAXIMUM_PREFETCH_SIZE);
+
+                // The request may not be stopped from within its own callback.
+                deferred_invoke([this, protocol_request = NonnullRefPtr { protocol_request }] {
+                    protocol_request->stop();
+                    finish_prefetch(*protocol_request);
+                });
+            }
+        };
+
+        auto protocol_complete = [this, &protocol_request = *protocol_request](u64, Requests::RequestTimingInfo const&, Optional<Requests::NetworkError> const&) {
+            finish_prefetch(protocol_request);
+        };
+
+        protocol_request->set_unbuffered_request_callbacks(move(protocol_headers_received), move(protocol_data_received), move(protocol_complete));
+
+        prefetch.protocol_request = move(protocol_request);
+        m_active_prefetches.append(move(prefetch));
+    }
+}
+
+void ResourceLoader::finish_prefetch(Requests::Request& protocol_request)
+{
+    auto index = m_active_prefetches.find_first_index_if([&](Prefetch const& prefetch) {
+        return prefetch.protocol_request.ptr() == &protocol_request;
+    });
+    if (!index.has_value())
+        return;
+
+    auto prefetch = m_active_prefetches.take(*index);
+
+    // The request may still be invoking the callback which finished this prefetch, so keep it alive until then.
+    deferred_invoke([protocol_request = move(prefetch.protocol_request)] {});
+
+    start_queued_prefetches();
+}
+
 static HashMap<LoadRequest, NonnullRefPtr<Resource>> s_resource_cache;
 
 RefPtr<Resource> ResourceLoader::load_resource(Resource::Type type, LoadRequest& request)
@@ -223,7 +369,7 @@ static bool should_block_request(LoadRequest const& request)
     return false;
 }
 
-void ResourceLoader::load(LoadRequest& request, GC::Root<SuccessCallback> success_callback, GC::Root<ErrorCallback> error_callback, Optional<u32> timeout, GC::Root<TimeoutCallback> timeout_callback)
+RefPtr<Requests::Request> ResourceLoader::load(LoadRequest& request, GC::Root<SuccessCallback> success_callback, GC::Root<ErrorCallback> error_callback, Optional<u32> timeout, GC::Root<TimeoutCallback> timeout_callback)
 {
     auto const& url = request.url().value();
 
@@ -232,7 +378,7 @@ void ResourceLoader::load(LoadRequest& request, GC::Root<SuccessCallback> succes
 
     if (should_block_request(request)) {
         error_callback->function()("Request was blocked", {}, {}, {}, {}, {});
-        return;
+        return {};
     }
 
     auto respond_directory_page = [](LoadRequest const& request, URL::URL const& url, GC::Root<SuccessCallback> success_callback, GC::Root<ErrorCallback> error_callback) {
@@ -268,7 +414,7 @@ void ResourceLoader::load(LoadRequest& request, GC::Root<SuccessCallback> succes
         // About version page
         if (serialized_path == "version") {
             success_callback->function()(MUST(load_about_version_page()).bytes(), fixme_implement_timing_info, response_headers, {}, {});
-            return;
+            return {};
         }
 
         // Other about static HTML pages
@@ -280,14 +426,14 @@ void ResourceLoader::load(LoadRequest& request, GC::Root<SuccessCallback> succes
             if (!resource.is_error()) {
                 auto data = resource.value()->data();
                 success_callback->function()(data, fixme_implement_timing_info, response_headers, {}, {});
-                return;
+                return {};
             }
         }
 
         Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(m_heap, [success_callback, response_headers = move(response_headers), fixme_implement_timing_info = move(fixme_implement_timing_info)] {
             success_callback->function()(ByteString::empty().to_byte_buffer(), fixme_implement_timing_info, response_headers, {}, {});
         }));
-        return;
+        return {};
     }
 
     if (url.scheme() == "data") {
@@ -296,7 +442,7 @@ void ResourceLoader::load(LoadRequest& request, GC::Root<SuccessCallback> succes
             auto error_message = data_url_or_error.error().string_literal();
             log_failure(request, error_message);
             error_callback->function()(error_message, {}, {}, {}, {}, {});
-            return;
+            return {};
         }
         auto data_url = data_url_or_error.release_value();
 
@@ -315,7 +461,7 @@ void ResourceLoader::load(LoadRequest& request, GC::Root<SuccessCallback> succes
 
             success_callback->function()(data, fixme_implement_timing_info, response_headers, {}, {});
         }));
-        return;
+        return {};
     }
 
     if (url.scheme() == "resource") {
@@ -324,7 +470,7 @@ void ResourceLoader::load(LoadRequest& request, GC::Root<SuccessCallback> succes
             log_failure(request, resource.error());
             if (error_callback)
                 error_callback->function()(ByteString::formatted("{}", resource.error()), {}, {}, {}, {}, {});
-            return;
+            return {};
         }
 
         // When resource URI is a directory use file directory loader to generate response
@@ -332,7 +478,7 @@ void ResourceLoader::load(LoadRequest& request, GC::Root<SuccessCallback> succes
             auto url = URL::Parser::basic_parse(resource.value()->file_url());
             VERIFY(url.has_value());
             respond_directory_page(request, url.release_value(), success_callback, error_callback);
-            return;
+            return {};
         }
 
         auto data = resource.value()->data();
@@ -344,14 +490,14 @@ void ResourceLoader::load(LoadRequest& request, GC::Root<SuccessCallback> succes
         log_success(request);
         success_callback->function()(data, fixme_implement_timing_info, response_headers, {}, {});
 
-        return;
+        return {};
     }
 
     if (url.scheme() == "file") {
         auto page = request.page();
         if (!page) {
             log_failure(request, "INTERNAL ERROR: No Page for file scheme request");
-            return;
+            return {};
         }
 
         FileRequest file_request(url.file_path(), [this, success_callback, error_callback, request, respond_directory_page](ErrorOr<i32> file_or_error) {
@@ -417,7 +563,7 @@ void ResourceLoader::load(LoadRequest& request, GC::Root<SuccessCallback> succes
         if (on_load_counter_change)
             on_load_counter_change();
 
-        return;
+        return {};
     }
 
     if (url.scheme() == "http" || url.scheme() == "https") {
@@ -425,7 +571,7 @@ void ResourceLoader::load(LoadRequest& request, GC::Root<SuccessCallback> succes
         if (!protocol_request) {
             if (error_callback)
                 error_callback->function()("Failed to start network request"sv, {}, {}, {}, {}, {});
-            return;
+            return {};
         }
 
         if (timeout.has_value() && timeout.value() > 0) {
@@ -475,7 +621,7 @@ void ResourceLoader::load(LoadRequest& request, GC::Root<SuccessCallback> succes
         };
 
         protocol_request->set_buffered_request_finished_callback(move(on_buffered_request_finished));
-        return;
+        return protocol_request;
     }
 
     auto not_implemented_error = ByteString::formatted("Protocol not implemented: {}", url.scheme());
@@ -483,9 +629,10 @@ void ResourceLoader::load(LoadRequest& request, GC::Root<SuccessCallback> succes
     if (error_callback) {
         error_callback->function()(not_implemented_error, {}, {}, {}, {}, {});
     }
+    return {};
 }
 
-void ResourceLoader::load_unbuffered(LoadRequest& request, GC::Root<OnHeadersReceived> on_headers_received, GC::Root<OnDataReceived> on_data_received, GC::Root<OnComplete> on_complete)
+RefPtr<Requests::Request> ResourceLoader::load_unbuffered(LoadRequest& request, GC::Root<OnHeadersReceived> on_headers_received, GC::Root<OnDataReceived> on_data_received, GC::Root<OnComplete> on_complete)
 {
     auto const& url = request.url().value();
 
@@ -494,19 +641,19 @@ void ResourceLoader::load_unbuffered(LoadRequest& request, GC::Root<OnHeadersRec
 
     if (should_block_request(request)) {
         on_complete->function()(false, {}, "Request was blocked"sv);
-        return;
+        return {};
     }
 
     if (!url.scheme().is_one_of("http"sv, "https"sv)) {
         // FIXME: Non-network requests from fetch should not go through this path.
         on_complete->function()(false, {}, "Cannot establish connection non-network scheme"sv);
-        return;
+        return {};
     }
 
     auto protocol_request = start_network_request(request);
     if (!protocol_request) {
         on_complete->function()(false, {}, "Failed to start network request"sv);
-        return;
+        return {};
     }
 
     auto protocol_headers_received = [this, on_headers_received, request](auto const& response_headers, auto status_code, auto const& reason_phrase) {
@@ -531,6 +678,7 @@ void ResourceLoader::load_unbuffered(LoadRequest& request, GC::Root<OnHeadersRec
     };
 
     protocol_request->set_unbuffered_request_callbacks(move(protocol_headers_received), move(protocol_data_received), move(protocol_complete));
+    return protocol_request;
 }
 
 RefPtr<Requests::Request> ResourceLoader::start_network_request(LoadRequest const& request)
@@ -552,7 +700,7 @@ RefPtr<Requests::Request> ResourceLoader::start_network_request(LoadRequest cons
         return nullptr;
     }
 
-    auto protocol_request = m_request_client->start_request(request.method(), request.url().value(), headers, request.body(), proxy);
+    auto protocol_request = m_request_client->start_request(request.method(), request.url().value(), headers, request.body(), proxy, request.priority());
     if (!protocol_request) {
         log_failure(request, "Failed to initiate load"sv);
         return nullptr;
@@ -598,6 +746,8 @@ void ResourceLoader::finish_network_request(NonnullRefPtr<Requests::Request> pro
     if (on_load_counter_change)
         on_load_counter_change();
 
+    start_queued_prefetches();
+
     deferred_invoke([this, protocol_request = move(protocol_request)] {
         auto did_remove = m_active_requests.remove(protocol_request);
         VERIFY(did_remove);
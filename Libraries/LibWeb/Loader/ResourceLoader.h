@@ -33,19 +33,27 @@ public:
     using ErrorCallback = GC::Function<void(ByteString const&, Requests::RequestTimingInfo const&, Optional<u32> status_code, Optional<String> const& reason_phrase, ReadonlyBytes payload, HTTP::HeaderMap const& response_headers)>;
     using TimeoutCallback = GC::Function<void()>;
 
-    void load(LoadRequest&, GC::Root<SuccessCallback> success_callback, GC::Root<ErrorCallback> error_callback = nullptr, Optional<u32> timeout = {}, GC::Root<TimeoutCallback> timeout_callback = nullptr);
+    // For http(s) URLs, load() and load_unbuffered() return the network request that was started, so that its priority
+    // can still be changed while it is in flight. Other loads return null.
+    RefPtr<Requests::Request> load(LoadRequest&, GC::Root<SuccessCallback> success_callback, GC::Root<ErrorCallback> error_callback = nullptr, Optional<u32> timeout = {}, GC::Root<TimeoutCallback> timeout_callback = nullptr);
 
     using OnHeadersReceived = GC::Function<void(HTTP::HeaderMap const& response_headers, Optional<u32> status_code, Optional<String> const& reason_phrase)>;
     using OnDataReceived = GC::Function<void(ReadonlyBytes data)>;
     using OnComplete = GC::Function<void(bool success, Requests::RequestTimingInfo const& timing_info, Optional<StringView> error_message)>;
 
-    void load_unbuffered(LoadRequest&, GC::Root<OnHeadersReceived>, GC::Root<OnDataReceived>, GC::Root<OnComplete>);
+    RefPtr<Requests::Request> load_unbuffered(LoadRequest&, GC::Root<OnHeadersReceived>, GC::Root<OnDataReceived>, GC::Root<OnComplete>);
 
     RefPtr<Requests::RequestClient>& request_client() { return m_request_client; }
 
     void prefetch_dns(URL::URL const&);
     void preconnect(URL::URL const&);
 
+    // Fetches the given URL into RequestServer's HTTP cache, so that a likely future navigation or subresource load may
+    // be served from the cache. Prefetches are low priority: only a few are in flight at once, they are not started
+    // while the page has many loads of its own pending, and their response bodies are discarded.
+    void prefetch(URL::URL const&, Page&);
+    void cancel_prefetches(Page&);
+
     Function<void()> on_load_counter_change;
 
     int pending_loads() const { return m_pending_loads; }
@@ -81,8 +89,19 @@ private:
     void handle_network_response_headers(LoadRequest const&, HTTP::HeaderMap const&);
     void finish_network_request(NonnullRefPtr<Requests::Request>);
 
+    void start_queued_prefetches();
+    void finish_prefetch(Requests::Request&);
+
     int m_pending_loads { 0 };
 
+    struct Prefetch {
+        LoadRequest request;
+        RefPtr<Requests::Request> protocol_request;
+        size_t bytes_received { 0 };
+    };
+    Vector<Prefetch> m_queued_prefetches;
+    Vector<Prefetch> m_active_prefetches;
+
     GC::Heap& m_heap;
     RefPtr<Requests::RequestClient> m_request_client;
     HashTable<NonnullRefPtr<Requests::Request>> m_active_requests;
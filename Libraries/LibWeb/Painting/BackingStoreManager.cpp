@@ -52,6 +52,7 @@ BackingStoreManager::BackingStore BackingStoreManager::acquire_store_for_next_fr
     BackingStore backing_store;
     backing_store.bitmap_id = m_back_bitmap_id;
     backing_store.store = m_back_store;
+    backing_store.previous_frame_store = m_front_store;
     swap_back_and_front();
     return backing_store;
 }
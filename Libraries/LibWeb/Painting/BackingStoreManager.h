@@ -30,6 +30,8 @@ public:
     struct BackingStore {
         i32 bitmap_id { -1 };
         RefPtr<Gfx::PaintingSurface> store;
+        // The front store at the time of acquiring this one, which holds the previous frame if one was painted into it.
+        RefPtr<Gfx::PaintingSurface> previous_frame_store;
     };
 
     BackingStore acquire_store_for_next_frame();
@@ -16,6 +16,8 @@ struct CornerRadius {
     int horizontal_radius { 0 };
     int vertical_radius { 0 };
 
+    bool operator==(CornerRadius const&) const = default;
+
     inline operator bool() const
     {
         return horizontal_radius > 0 && vertical_radius > 0;
@@ -28,6 +30,8 @@ struct WEB_API BorderRadiusData {
 
     CornerRadius as_corner(DevicePixelConverter const& device_pixel_converter) const;
 
+    bool operator==(BorderRadiusData const&) const = default;
+
     inline operator bool() const
     {
         return horizontal_radius > 0 && vertical_radius > 0;
@@ -54,6 +58,8 @@ struct CornerRadii {
     CornerRadius bottom_right;
     CornerRadius bottom_left;
 
+    bool operator==(CornerRadii const&) const = default;
+
     inline bool has_any_radius() const
     {
         return top_left || top_right || bottom_right || bottom_left;
@@ -66,6 +72,8 @@ struct BorderRadiiData {
     BorderRadiusData bottom_right;
     BorderRadiusData bottom_left;
 
+    bool operator==(BorderRadiiData const&) const = default;
+
     inline bool has_any_radius() const
     {
         return top_left || top_right || bottom_right || bottom_left;
@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGfx/PaintingSurface.h>
+#include <LibWeb/Painting/DamageTracker.h>
+#include <LibWeb/Painting/DisplayList.h>
+
+namespace Web::Painting {
+
+using CommandListItem = DisplayList::DisplayListCommandWithScrollAndClip;
+
+static Optional<Gfx::IntRect> command_bounding_rectangle(DisplayListCommand const& command)
+{
+    return command.visit(
+        [&](auto const& command) -> Optional<Gfx::IntRect> {
+            if constexpr (requires { command.bounding_rect(); })
+                return command.bounding_rect();
+            else
+                return {};
+        });
+}
+
+static bool command_is_clip_or_mask(DisplayListCommand const& command)
+{
+    return command.visit(
+        [&](auto const& command) -> bool {
+            if constexpr (requires { command.is_clip_or_mask(); })
+                return command.is_clip_or_mask();
+            else
+                return false;
+        });
+}
+
+static int command_nesting_level_change(DisplayListCommand const& command)
+{
+    return command.visit(
+        [&](auto const& command) -> int {
+            if constexpr (requires { command.nesting_level_change; })
+                return command.nesting_level_change;
+            else
+                return 0;
+        });
+}
+
+// Surfaces and nested display lists can change what they draw without their command changing.
+static bool command_has_volatile_contents(DisplayListCommand const& command)
+{
+    return command.has<DrawPaintingSurface>() || command.has<PaintNestedDisplayList>();
+}
+
+// A command only draws if it can be added, removed or changed without affecting how any other command is drawn.
+static bool command_only_draws(DisplayListCommand const& command)
+{
+    return command_bounding_rectangle(command).has_value() && !command_is_clip_or_mask(command) && command_nesting_level_change(command) == 0;
+}
+
+static bool operator_only_draws_over_source(Gfx::CompositingAndBlendingOperator compositing_and_blending_operator)
+{
+    // Porter-Duff operators like "copy" or "clear" also change the pixels that the source doesn't cover.
+    return compositing_and_blending_operator != Gfx::CompositingAndBlendingOperator::Clear
+        && compositing_and_blending_operator != Gfx::CompositingAndBlendingOperator::Copy
+        && compositing_and_blending_operator != Gfx::CompositingAndBlendingOperator::SourceIn
+        && compositing_and_blending_operator != Gfx::CompositingAndBlendingOperator::DestinationIn
+        && compositing_and_blending_operator != Gfx::CompositingAndBlendingOperator::SourceOut
+        && compositing_and_blending_operator != Gfx::CompositingAndBlendingOperator::DestinationATop;
+}
+
+// Whether the commands after this one still draw inside of their bounding rects, in the coordinate space of the surface.
+static bool command_keeps_bounding_rects_reliable(DisplayListCommand const& command)
+{
+    return command.visit(
+        [](Translate const& command) { return command.delta.is_zero(); },
+        [](ApplyTransform const& command) { return command.matrix.is_identity(); },
+        [](PushStackingContext const& command) { return command.transform.is_identity() && operator_only_draws_over_source(command.compositing_and_blending_operator); },
+        [](ApplyCompositeAndBlendingOperator const& command) { return operator_only_draws_over_source(command.compositing_and_blending_operator); },
+        [](ApplyFilter const&) { return false; },
+        [](auto const&) { return true; });
+}
+
+static bool clip_frames_are_equal(RefPtr<ClipFrame const> const& a, RefPtr<ClipFrame const> const& b)
+{
+    if (a == b)
+        return true;
+    if (!a || !b)
+        return false;
+
+    auto const& a_clip_rects = a->clip_rects();
+    auto const& b_clip_rects = b->clip_rects();
+    if (a_clip_rects.size() != b_clip_rects.size())
+        return false;
+    for (size_t i = 0; i < a_clip_rects.size(); ++i) {
+        if (a_clip_rects[i].rect != b_clip_rects[i].rect
+            || a_clip_rects[i].corner_radii != b_clip_rects[i].corner_radii
+            || a_clip_rects[i].enclosing_scroll_frame_id != b_clip_rects[i].enclosing_scroll_frame_id)
+            return false;
+    }
+    return true;
+}
+
+static bool command_list_items_are_equal(CommandListItem const& a, CommandListItem const& b)
+{
+    if (a.scroll_frame_id != b.scroll_frame_id || !clip_frames_are_equal(a.clip_frame, b.clip_frame))
+        return false;
+
+    return a.command.visit([&](auto const& a_command) -> bool {
+        using Command = RemoveCVReference<decltype(a_command)>;
+        if (!b.command.template has<Command>())
+            return false;
+        // Commands that can't be compared are always considered to have changed.
+        if constexpr (requires { a_command == a_command; })
+            return a_command == b.command.template get<Command>();
+        else
+            return false;
+    });
+}
+
+class BoundingRectReliabilityTracker {
+public:
+    bool bounding_rects_are_reliable() const { return m_stack.last(); }
+
+    void did_walk(DisplayListCommand const& command)
+    {
+        auto nesting_level_change = command_nesting_level_change(command);
+        if (nesting_level_change > 0) {
+            m_stack.append(m_stack.last() && command_keeps_bounding_rects_reliable(command));
+            return;
+        }
+        if (nesting_level_change < 0) {
+            if (m_stack.size() > 1)
+                m_stack.take_last();
+            return;
+        }
+        if (!command_keeps_bounding_rects_reliable(command))
+            m_stack.last() = false;
+    }
+
+private:
+    Vector<bool, 32> m_stack { true };
+};
+
+Optional<Gfx::IntRect> DamageTracker::diff_against_previous_frame(DisplayList& display_list, ScrollStateSnapshot const& scroll_state) const
+{
+    auto& previous_display_list = *m_previous_display_list;
+    if (display_list.device_pixels_per_css_pixel() != previous_display_list.device_pixels_per_css_pixel())
+        return {};
+
+    // Scrolling and zooming move everything that the affected commands draw, which is usually most of the frame.
+    if (scroll_state != m_previous_scroll_state)
+        return {};
+    auto const& commands = display_list.commands();
+    if (commands[DisplayList::VISUAL_VIEWPORT_TRANSFORM_INDEX].command.get<ApplyTransform>().matrix != m_previous_visual_viewport_transform)
+        return {};
+
+    auto const& previous_commands = previous_display_list.commands();
+    auto device_pixels_per_css_pixel = display_list.device_pixels_per_css_pixel();
+
+    BoundingRectReliabilityTracker reliability_tracker;
+    Gfx::IntRect damage;
+    bool has_backdrop_filter = false;
+
+    auto damage_command = [&](CommandListItem const& item) -> bool {
+        auto bounding_rect = command_bounding_rectangle(item.command);
+        if (!bounding_rect.has_value() || !reliability_tracker.bounding_rects_are_reliable())
+            return false;
+        if (item.scroll_frame_id.has_value()) {
+            auto cumulative_offset = scroll_state.cumulative_offset_for_frame_with_id(item.scroll_frame_id.value());
+            bounding_rect->translate_by(cumulative_offset.to_type<double>().scaled(device_pixels_per_css_pixel).to_type<int>());
+        }
+        // Leave some room for anti-aliasing, and for bounding rects that were rounded down.
+        damage.unite(bounding_rect->inflated(2, 2, 2, 2));
+        return true;
+    };
+
+    auto walk_unchanged_command = [&](CommandListItem const& item) -> bool {
+        if (item.command.has<ApplyBackdropFilter>())
+            has_backdrop_filter = true;
+        if (command_has_volatile_contents(item.command) && !damage_command(item))
+            return false;
+        reliability_tracker.did_walk(item.command);
+        return true;
+    };
+
+    // Find the range of commands that differ between the two lists, by skipping the commands that they start and end with.
+    size_t common_prefix_size = 0;
+    size_t common_suffix_size = 0;
+    if (&display_list == &previous_display_list) {
+        common_prefix_size = commands.size();
+    } else {
+        auto shorter_size = min(commands.size(), previous_commands.size());
+        while (common_prefix_size < shorter_size && command_list_items_are_equal(commands[common_prefix_size], previous_commands[common_prefix_size]))
+            ++common_prefix_size;
+        while (common_suffix_size < shorter_size - common_prefix_size
+            && command_list_items_are_equal(commands[commands.size() - common_suffix_size - 1], previous_commands[previous_commands.size() - common_suffix_size - 1]))
+            ++common_suffix_size;
+    }
+
+    for (size_t index = 0; index < common_prefix_size; ++index) {
+        if (!walk_unchanged_command(commands[index]))
+            return {};
+    }
+
+    auto changed_size = commands.size() - common_prefix_size - common_suffix_size;
+    auto previous_changed_size = previous_commands.size() - common_prefix_size - common_suffix_size;
+    if (changed_size == previous_changed_size) {
+        // The commands in between correspond to each other, so only the ones that changed are damaged.
+        for (size_t index = common_prefix_size; index < common_prefix_size + changed_size; ++index) {
+            auto const& item = commands[index];
+            auto const& previous_item = previous_commands[index];
+            if (command_list_items_are_equal(item, previous_item)) {
+                if (!walk_unchanged_command(item))
+                    return {};
+                continue;
+            }
+
+            // A clip or mask that changed only affects the pixels inside of its old or its new bounding rect, but one that
+            // was added or removed affects everything that is drawn after it.
+            if (command_nesting_level_change(item.command) != 0 || command_nesting_level_change(previous_item.command) != 0)
+                return {};
+            if (command_is_clip_or_mask(item.command) != command_is_clip_or_mask(previous_item.command))
+                return {};
+            if (!damage_command(item) || !damage_command(previous_item))
+                return {};
+            if (item.command.has<ApplyBackdropFilter>() || previous_item.command.has<ApplyBackdropFilter>())
+                has_backdrop_filter = true;
+            reliability_tracker.did_walk(item.command);
+        }
+    } else {
+        // Commands were added or removed, which is only fine if they don't affect how the commands around them are drawn.
+        for (size_t index = common_prefix_size; index < common_prefix_size + changed_size; ++index) {
+            if (!command_only_draws(commands[index].command) || !damage_command(commands[index]))
+                return {};
+        }
+        for (size_t index = common_prefix_size; index < common_prefix_size + previous_changed_size; ++index) {
+            if (!command_only_draws(previous_commands[index].command) || !damage_command(previous_commands[index]))
+                return {};
+        }
+    }
+
+    for (size_t index = commands.size() - common_suffix_size; index < commands.size(); ++index) {
+        if (!walk_unchanged_command(commands[index]))
+            return {};
+    }
+
+    // Backdrop filters sample the pixels around them, so anything that changes below one can change all of its pixels.
+    if (has_backdrop_filter && !damage.is_empty())
+        return {};
+
+    return damage;
+}
+
+Optional<Gfx::IntRect> DamageTracker::compute_damage_for_frame(DisplayList& display_list, ScrollStateSnapshot const& scroll_state, Gfx::PaintingSurface& surface, Gfx::PaintingSurface const& previous_frame_surface)
+{
+    bool previous_frame_surface_is_usable = m_previous_surface.ptr() == &previous_frame_surface && previous_frame_surface.size() == surface.size();
+    m_previous_surface = surface;
+
+    if (!previous_frame_surface_is_usable) {
+        remember_frame(display_list, scroll_state);
+        return {};
+    }
+
+    auto damage = compute_damage(display_list, scroll_state);
+    if (damage.has_value())
+        damage = damage->intersected(surface.rect());
+    return damage;
+}
+
+Optional<Gfx::IntRect> DamageTracker::compute_damage(DisplayList& display_list, ScrollStateSnapshot const& scroll_state)
+{
+    Optional<Gfx::IntRect> damage;
+    if (m_previous_display_list)
+        damage = diff_against_previous_frame(display_list, scroll_state);
+
+    remember_frame(display_list, scroll_state);
+    return damage;
+}
+
+void DamageTracker::remember_frame(DisplayList& display_list, ScrollStateSnapshot const& scroll_state)
+{
+    m_previous_display_list = display_list;
+    m_previous_scroll_state = scroll_state;
+    m_previous_visual_viewport_transform = display_list.commands()[DisplayList::VISUAL_VIEWPORT_TRANSFORM_INDEX].command.get<ApplyTransform>().matrix;
+}
+
+}
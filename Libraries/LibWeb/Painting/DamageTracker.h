@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/RefPtr.h>
+#include <LibGfx/Forward.h>
+#include <LibGfx/Matrix4x4.h>
+#include <LibGfx/Rect.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/Painting/ScrollState.h>
+
+namespace Web::Painting {
+
+// Finds the part of a frame that differs from the frame painted before it, by diffing their display lists.
+//
+// Only the commands that differ between the two lists are damaged, which is usually a handful of commands around the
+// element that changed: the lists are compared from both ends, and whatever remains in between is compared command by
+// command. Commands whose bounding rects don't tell which pixels they touch (e.g. because they are drawn under a
+// transform or a filter, or change the state used to draw the commands after them) damage the whole frame instead.
+//
+// Surfaces and nested display lists can change their contents without their command changing, so they are always
+// damaged.
+class DamageTracker {
+    AK_MAKE_NONCOPYABLE(DamageTracker);
+    AK_MAKE_NONMOVABLE(DamageTracker);
+
+public:
+    DamageTracker() = default;
+
+    // Returns the part of the surface that has to be repainted, assuming that the rest of it is copied over from the
+    // previous frame's surface. Returns nothing if the whole surface has to be repainted, which is the case if the
+    // previous frame's surface is not the one that the last frame was painted into.
+    Optional<Gfx::IntRect> compute_damage_for_frame(DisplayList&, ScrollStateSnapshot const&, Gfx::PaintingSurface& surface, Gfx::PaintingSurface const& previous_frame_surface);
+
+    // Returns the part of the frame that differs from the previous frame given to this tracker, and makes this frame the
+    // previous one. Returns nothing if the whole frame has to be repainted, which is always the case for the first frame.
+    Optional<Gfx::IntRect> compute_damage(DisplayList&, ScrollStateSnapshot const&);
+
+private:
+    Optional<Gfx::IntRect> diff_against_previous_frame(DisplayList&, ScrollStateSnapshot const&) const;
+    void remember_frame(DisplayList&, ScrollStateSnapshot const&);
+
+    RefPtr<DisplayList> m_previous_display_list;
+    ScrollStateSnapshot m_previous_scroll_state;
+    Gfx::FloatMatrix4x4 m_previous_visual_viewport_transform;
+    RefPtr<Gfx::PaintingSurface> m_previous_surface;
+};
+
+}
@@ -66,14 +66,14 @@ static bool command_is_clip_or_mask(DisplayListCommand const& command)
         });
 }
 
-void DisplayListPlayer::execute(DisplayList& display_list, ScrollStateSnapshotByDisplayList&& scroll_state_snapshot_by_display_list, RefPtr<Gfx::PaintingSurface> surface)
+void DisplayListPlayer::execute(DisplayList& display_list, ScrollStateSnapshotByDisplayList&& scroll_state_snapshot_by_display_list, RefPtr<Gfx::PaintingSurface> surface, Optional<Gfx::IntRect> clip_rect)
 {
     TemporaryChange change { m_scroll_state_snapshots_by_display_list, move(scroll_state_snapshot_by_display_list) };
     if (surface) {
         surface->lock_context();
     }
     auto scroll_state_snapshot = m_scroll_state_snapshots_by_display_list.get(display_list).value_or({});
-    execute_impl(display_list, scroll_state_snapshot, surface);
+    execute_impl(display_list, scroll_state_snapshot, surface, clip_rect);
     if (surface) {
         surface->unlock_context();
     }
@@ -109,7 +109,7 @@ void DisplayListPlayer::remove_clip_frame(ClipFrame const& clip_frame)
     restore({});
 }
 
-void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface> surface)
+void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface> surface, Optional<Gfx::IntRect> clip_rect)
 {
     if (surface)
         m_surfaces.append(*surface);
@@ -125,6 +125,12 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
 
     VERIFY(!m_surfaces.is_empty());
 
+    // Commands that are entirely outside of the clip rect are skipped, as they would be fully clipped by the painter.
+    if (clip_rect.has_value()) {
+        save({});
+        add_clip_rect({ .rect = clip_rect.value() });
+    }
+
     auto translate_command_by_scroll = [&](auto& command, int scroll_frame_id) {
         auto cumulative_offset = scroll_state.cumulative_offset_for_frame_with_id(scroll_frame_id);
         auto scroll_offset = cumulative_offset.to_type<double>().scaled(device_pixels_per_css_pixel).to_type<int>();
@@ -268,6 +274,9 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
         }
     }
 
+    if (clip_rect.has_value())
+        restore({});
+
     if (surface)
         flush();
 }
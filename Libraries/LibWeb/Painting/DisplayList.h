@@ -26,11 +26,12 @@ class DisplayListPlayer {
 public:
     virtual ~DisplayListPlayer() = default;
 
-    void execute(DisplayList&, ScrollStateSnapshotByDisplayList&&, RefPtr<Gfx::PaintingSurface>);
+    // If a clip rect is given, only the pixels inside of it are painted, and the rest of the surface is left untouched.
+    void execute(DisplayList&, ScrollStateSnapshotByDisplayList&&, RefPtr<Gfx::PaintingSurface>, Optional<Gfx::IntRect> clip_rect = {});
 
 protected:
     Gfx::PaintingSurface& surface() const { return m_surfaces.last(); }
-    void execute_impl(DisplayList&, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface>);
+    void execute_impl(DisplayList&, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface>, Optional<Gfx::IntRect> clip_rect = {});
 
     ScrollStateSnapshotByDisplayList m_scroll_state_snapshots_by_display_list;
 
@@ -48,6 +48,8 @@ struct DrawGlyphRun {
     [[nodiscard]] Gfx::IntRect bounding_rect() const { return bounding_rectangle; }
     void translate_by(Gfx::IntPoint const& offset);
     void dump(StringBuilder&) const;
+
+    bool operator==(DrawGlyphRun const&) const = default;
 };
 
 struct FillRect {
@@ -57,6 +59,8 @@ struct FillRect {
     [[nodiscard]] Gfx::IntRect bounding_rect() const { return rect; }
     void translate_by(Gfx::IntPoint const& offset) { rect.translate_by(offset); }
     void dump(StringBuilder&) const;
+
+    bool operator==(FillRect const&) const = default;
 };
 
 struct DrawPaintingSurface {
@@ -68,6 +72,8 @@ struct DrawPaintingSurface {
     [[nodiscard]] Gfx::IntRect bounding_rect() const { return dst_rect; }
     void translate_by(Gfx::IntPoint const& offset) { dst_rect.translate_by(offset); }
     void dump(StringBuilder&) const;
+
+    bool operator==(DrawPaintingSurface const&) const = default;
 };
 
 struct DrawScaledImmutableBitmap {
@@ -83,12 +89,16 @@ struct DrawScaledImmutableBitmap {
         clip_rect.translate_by(offset);
     }
     void dump(StringBuilder&) const;
+
+    bool operator==(DrawScaledImmutableBitmap const&) const = default;
 };
 
 struct DrawRepeatedImmutableBitmap {
     struct Repeat {
         bool x { false };
         bool y { false };
+
+        bool operator==(Repeat const&) const = default;
     };
 
     Gfx::IntRect dst_rect;
@@ -99,24 +109,32 @@ struct DrawRepeatedImmutableBitmap {
 
     void translate_by(Gfx::IntPoint const& offset) { dst_rect.translate_by(offset); }
     void dump(StringBuilder&) const;
+
+    bool operator==(DrawRepeatedImmutableBitmap const&) const = default;
 };
 
 struct Save {
     static constexpr int nesting_level_change = 1;
 
     void dump(StringBuilder&) const;
+
+    bool operator==(Save const&) const = default;
 };
 
 struct SaveLayer {
     static constexpr int nesting_level_change = 1;
 
     void dump(StringBuilder&) const;
+
+    bool operator==(SaveLayer const&) const = default;
 };
 
 struct Restore {
     static constexpr int nesting_level_change = -1;
 
     void dump(StringBuilder&) const;
+
+    bool operator==(Restore const&) const = default;
 };
 
 struct Translate {
@@ -124,6 +142,8 @@ struct Translate {
 
     void translate_by(Gfx::IntPoint const& offset) { delta.translate_by(offset); }
     void dump(StringBuilder&) const;
+
+    bool operator==(Translate const&) const = default;
 };
 
 struct AddClipRect {
@@ -133,6 +153,8 @@ struct AddClipRect {
     bool is_clip_or_mask() const { return true; }
     void translate_by(Gfx::IntPoint const& offset) { rect.translate_by(offset); }
     void dump(StringBuilder&) const;
+
+    bool operator==(AddClipRect const&) const = default;
 };
 
 struct PushStackingContext {
@@ -157,12 +179,28 @@ struct PushStackingContext {
         }
     }
     void dump(StringBuilder&) const;
+
+    bool operator==(PushStackingContext const& other) const
+    {
+        // Paths can't be compared, so stacking contexts with a clip path are never considered equal.
+        if (clip_path.has_value() || other.clip_path.has_value())
+            return false;
+        return opacity == other.opacity
+            && compositing_and_blending_operator == other.compositing_and_blending_operator
+            && isolate == other.isolate
+            && transform == other.transform
+            && matching_pop_index == other.matching_pop_index
+            && can_aggregate_children_bounds == other.can_aggregate_children_bounds
+            && bounding_rect == other.bounding_rect;
+    }
 };
 
 struct PopStackingContext {
     static constexpr int nesting_level_change = -1;
 
     void dump(StringBuilder&) const;
+
+    bool operator==(PopStackingContext const&) const = default;
 };
 
 struct PaintLinearGradient {
@@ -176,6 +214,8 @@ struct PaintLinearGradient {
         gradient_rect.translate_by(offset);
     }
     void dump(StringBuilder&) const;
+
+    bool operator==(PaintLinearGradient const&) const = default;
 };
 
 struct PaintOuterBoxShadow {
@@ -184,6 +224,8 @@ struct PaintOuterBoxShadow {
     [[nodiscard]] Gfx::IntRect bounding_rect() const;
     void translate_by(Gfx::IntPoint const& offset);
     void dump(StringBuilder&) const;
+
+    bool operator==(PaintOuterBoxShadow const&) const = default;
 };
 
 struct PaintInnerBoxShadow {
@@ -192,6 +234,8 @@ struct PaintInnerBoxShadow {
     [[nodiscard]] Gfx::IntRect bounding_rect() const;
     void translate_by(Gfx::IntPoint const& offset);
     void dump(StringBuilder&) const;
+
+    bool operator==(PaintInnerBoxShadow const&) const = default;
 };
 
 struct PaintTextShadow {
@@ -206,6 +250,8 @@ struct PaintTextShadow {
     [[nodiscard]] Gfx::IntRect bounding_rect() const { return { draw_location.to_type<int>(), shadow_bounding_rect.size() }; }
     void translate_by(Gfx::IntPoint const& offset) { draw_location.translate_by(offset.to_type<float>()); }
     void dump(StringBuilder&) const;
+
+    bool operator==(PaintTextShadow const&) const = default;
 };
 
 struct FillRectWithRoundedCorners {
@@ -216,6 +262,8 @@ struct FillRectWithRoundedCorners {
     [[nodiscard]] Gfx::IntRect bounding_rect() const { return rect; }
     void translate_by(Gfx::IntPoint const& offset) { rect.translate_by(offset); }
     void dump(StringBuilder&) const;
+
+    bool operator==(FillRectWithRoundedCorners const&) const = default;
 };
 
 struct FillPath {
@@ -271,6 +319,8 @@ struct DrawEllipse {
         rect.translate_by(offset);
     }
     void dump(StringBuilder&) const;
+
+    bool operator==(DrawEllipse const&) const = default;
 };
 
 struct FillEllipse {
@@ -284,6 +334,8 @@ struct FillEllipse {
         rect.translate_by(offset);
     }
     void dump(StringBuilder&) const;
+
+    bool operator==(FillEllipse const&) const = default;
 };
 
 struct DrawLine {
@@ -300,6 +352,8 @@ struct DrawLine {
         to.translate_by(offset);
     }
     void dump(StringBuilder&) const;
+
+    bool operator==(DrawLine const&) const = default;
 };
 
 struct ApplyBackdropFilter {
@@ -325,6 +379,8 @@ struct DrawRect {
 
     void translate_by(Gfx::IntPoint const& offset) { rect.translate_by(offset); }
     void dump(StringBuilder&) const;
+
+    bool operator==(DrawRect const&) const = default;
 };
 
 struct PaintRadialGradient {
@@ -337,6 +393,8 @@ struct PaintRadialGradient {
 
     void translate_by(Gfx::IntPoint const& offset) { rect.translate_by(offset); }
     void dump(StringBuilder&) const;
+
+    bool operator==(PaintRadialGradient const&) const = default;
 };
 
 struct PaintConicGradient {
@@ -348,6 +406,8 @@ struct PaintConicGradient {
 
     void translate_by(Gfx::IntPoint const& offset) { rect.translate_by(offset); }
     void dump(StringBuilder&) const;
+
+    bool operator==(PaintConicGradient const&) const = default;
 };
 
 struct AddRoundedRectClip {
@@ -360,6 +420,8 @@ struct AddRoundedRectClip {
 
     void translate_by(Gfx::IntPoint const& offset) { border_rect.translate_by(offset); }
     void dump(StringBuilder&) const;
+
+    bool operator==(AddRoundedRectClip const&) const = default;
 };
 
 struct AddMask {
@@ -375,6 +437,8 @@ struct AddMask {
     }
 
     void dump(StringBuilder&) const;
+
+    bool operator==(AddMask const&) const = default;
 };
 
 struct PaintNestedDisplayList {
@@ -388,6 +452,8 @@ struct PaintNestedDisplayList {
         rect.translate_by(offset);
     }
     void dump(StringBuilder&) const;
+
+    bool operator==(PaintNestedDisplayList const&) const = default;
 };
 
 struct PaintScrollBar {
@@ -405,6 +471,17 @@ struct PaintScrollBar {
         thumb_rect.translate_by(offset);
     }
     void dump(StringBuilder&) const;
+
+    bool operator==(PaintScrollBar const& other) const
+    {
+        return scroll_frame_id == other.scroll_frame_id
+            && gutter_rect == other.gutter_rect
+            && thumb_rect == other.thumb_rect
+            && (scroll_size <=> other.scroll_size) == 0
+            && thumb_color == other.thumb_color
+            && track_color == other.track_color
+            && vertical == other.vertical;
+    }
 };
 
 struct ApplyOpacity {
@@ -413,6 +490,8 @@ struct ApplyOpacity {
 
     float opacity;
     void dump(StringBuilder&) const;
+
+    bool operator==(ApplyOpacity const&) const = default;
 };
 
 struct ApplyCompositeAndBlendingOperator {
@@ -421,6 +500,8 @@ struct ApplyCompositeAndBlendingOperator {
 
     Gfx::CompositingAndBlendingOperator compositing_and_blending_operator;
     void dump(StringBuilder&) const;
+
+    bool operator==(ApplyCompositeAndBlendingOperator const&) const = default;
 };
 
 struct ApplyFilter {
@@ -440,6 +521,8 @@ struct ApplyTransform {
         origin.translate_by(offset.to_type<float>());
     }
     void dump(StringBuilder&) const;
+
+    bool operator==(ApplyTransform const&) const = default;
 };
 
 struct ApplyMaskBitmap {
@@ -452,6 +535,8 @@ struct ApplyMaskBitmap {
         origin.translate_by(offset);
     }
     void dump(StringBuilder&) const;
+
+    bool operator==(ApplyMaskBitmap const&) const = default;
 };
 
 using DisplayListCommand = Variant<
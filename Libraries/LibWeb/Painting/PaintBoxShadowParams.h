@@ -20,6 +20,8 @@ struct PaintBoxShadowParams {
     int blur_radius;
     int spread_distance;
     Gfx::IntRect device_content_rect;
+
+    bool operator==(PaintBoxShadowParams const&) const = default;
 };
 
 }
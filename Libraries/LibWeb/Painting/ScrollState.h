@@ -29,10 +29,14 @@ public:
         return entries[id].own_offset;
     }
 
+    bool operator==(ScrollStateSnapshot const&) const = default;
+
 private:
     struct Entry {
         CSSPixelPoint cumulative_offset;
         CSSPixelPoint own_offset;
+
+        bool operator==(Entry const&) const = default;
     };
     Vector<Entry> entries;
 };
@@ -5,10 +5,12 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AtomicRefCounted.h>
 #include <AK/ByteBuffer.h>
 #include <AK/MemoryStream.h>
 #include <AK/ScopeGuard.h>
 #include <AK/StringBuilder.h>
+#include <LibCrypto/Hash/SHA2.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/BigInt.h>
@@ -19,13 +21,17 @@
 #include <LibJS/Runtime/Object.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibJS/Runtime/ValueInlines.h>
+#include <LibThreading/BackgroundAction.h>
+#include <LibWasm/AbstractMachine/ModuleCache.h>
 #include <LibWasm/AbstractMachine/Validator.h>
 #include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/Bindings/PrincipalHostDefined.h>
 #include <LibWeb/Bindings/ResponsePrototype.h>
 #include <LibWeb/ContentSecurityPolicy/BlockingAlgorithms.h>
 #include <LibWeb/Fetch/Response.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
-#include <LibWeb/Platform/EventLoopPlugin.h>
+#include <LibWeb/Page/Page.h>
 #include <LibWeb/WebAssembly/Global.h>
 #include <LibWeb/WebAssembly/Instance.h>
 #include <LibWeb/WebAssembly/Memory.h>
@@ -45,6 +51,8 @@ static GC::Ref<WebIDL::Promise> compile_potential_webassembly_response(JS::VM&,
 
 namespace Detail {
 
+using ModuleOrCompileError = ErrorOr<NonnullRefPtr<Wasm::Module>, ByteString>;
+
 HashMap<GC::Ptr<JS::Object>, WebAssemblyCache> s_caches;
 
 WebAssemblyCache& get_cache(JS::Realm& realm)
@@ -52,6 +60,42 @@ WebAssemblyCache& get_cache(JS::Realm& realm)
     return s_caches.ensure(realm.global_object());
 }
 
+static bool s_module_cache_enabled { false };
+
+// The entry of the module cache that belongs to a module that is being compiled. Its payload is the one that the page's
+// client loaded for the module before it was validated, and the one that it should store for it afterwards.
+struct ModuleCacheEntry {
+    Wasm::ModuleCache::Hash module_hash;
+    Optional<ByteBuffer> payload;
+};
+
+static Optional<ModuleCacheEntry> load_module_cache_entry(JS::Realm& realm, Wasm::ModuleCache::Hash const& module_hash)
+{
+    auto& page = Bindings::principal_host_defined_page(HTML::principal_realm(realm));
+    return ModuleCacheEntry { module_hash, page.client().page_did_request_wasm_module_cache_entry(module_hash.bytes()) };
+}
+
+static Optional<ModuleCacheEntry> load_module_cache_entry(JS::Realm& realm, ReadonlyBytes module_bytes)
+{
+    if (!s_module_cache_enabled)
+        return {};
+    return load_module_cache_entry(realm, Wasm::ModuleCache::hash_module(module_bytes));
+}
+
+static void store_module_cache_entry(JS::Realm& realm, Optional<ModuleCacheEntry> const& entry)
+{
+    if (!entry.has_value() || !entry->payload.has_value())
+        return;
+
+    auto& page = Bindings::principal_host_defined_page(HTML::principal_realm(realm));
+    page.client().page_did_store_wasm_module_cache_entry(entry->module_hash.bytes(), *entry->payload);
+}
+
+}
+
+void enable_module_cache()
+{
+    Detail::s_module_cache_enabled = true;
 }
 
 void visit_edges(JS::Object& object, JS::Cell::Visitor& visitor)
@@ -417,25 +461,168 @@ JS::ThrowCompletionOr<NonnullOwnPtr<Wasm::ModuleInstance>> instantiate_module(JS
     return instance_result.release_value();
 }
 
+// Validates a module that has just been parsed. This doesn't touch the realm or its abstract machine, so it can run off
+// the main thread. If the module cache is enabled, the module is restored from the entry's payload if it has a usable
+// one, and the entry is left with the payload to store for the module otherwise.
+static ModuleOrCompileError validate_parsed_webassembly_module(Wasm::ParseResult<NonnullRefPtr<Wasm::Module>> module_or_error, Optional<ModuleCacheEntry>& cache_entry)
+{
+    auto payload = cache_entry.has_value() ? exchange(cache_entry->payload, {}) : Optional<ByteBuffer> {};
+
+    if (module_or_error.is_error())
+        return Wasm::parse_error_to_byte_string(module_or_error.error());
+
+    auto module = module_or_error.release_value();
+    if (payload.has_value() && Wasm::ModuleCache::try_restore(*payload, module))
+        return module;
+
+    if (auto validation_result = Wasm::Validator {}.validate(module); validation_result.is_error()) {
+        module->set_validation_error(validation_result.error().error_string);
+        return validation_result.release_error().error_string;
+    }
+
+    if (cache_entry.has_value()) {
+        if (auto new_payload = Wasm::ModuleCache::create_payload(module); new_payload.is_error())
+            dbgln("Unable to create WebAssembly module cache entry: {}", new_payload.error());
+        else
+            cache_entry->payload = new_payload.release_value();
+    }
+    return module;
+}
+
+static JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> create_compiled_webassembly_module(JS::VM& vm, ModuleOrCompileError module_or_error)
+{
+    if (module_or_error.is_error())
+        return vm.throw_completion<CompileError>(module_or_error.error());
+
+    auto& cache = get_cache(*vm.current_realm());
+    auto compiled_module = make_ref_counted<CompiledWebAssemblyModule>(module_or_error.release_value());
+    cache.add_compiled_module(compiled_module);
+    return compiled_module;
+}
+
 // // https://webassembly.github.io/spec/js-api/#compile-a-webassembly-module
 // https://webassembly.github.io/content-security-policy/js-api/#compile-a-webassembly-module
 JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> compile_a_webassembly_module(JS::VM& vm, ByteBuffer data)
 {
     TRY(host_ensure_can_compile_wasm_bytes(vm));
 
+    auto& realm = *vm.current_realm();
+    auto cache_entry = load_module_cache_entry(realm, data);
+
     FixedMemoryStream stream { data.bytes() };
-    auto module_result = Wasm::Module::parse(stream);
-    if (module_result.is_error()) {
-        return vm.throw_completion<CompileError>(Wasm::parse_error_to_byte_string(module_result.error()));
+    auto module_or_error = validate_parsed_webassembly_module(Wasm::Module::parse(stream), cache_entry);
+
+    store_module_cache_entry(realm, cache_entry);
+    return create_compiled_webassembly_module(vm, move(module_or_error));
+}
+
+// The state of a module that is being compiled while its bytes arrive. Chunks are parsed on the background thread in the
+// order they arrived in, and the whole module is validated there once the last one has been parsed. If the module cache
+// is enabled, the chunks are also hashed on the main thread, which is where the module's cache entry is loaded.
+class StreamingCompilation : public AtomicRefCounted<StreamingCompilation> {
+public:
+    StreamingCompilation()
+    {
+        if (s_module_cache_enabled)
+            m_module_hash = ::Crypto::Hash::SHA256::create();
     }
 
-    auto& cache = get_cache(*vm.current_realm());
-    if (auto validation_result = cache.abstract_machine().validate(module_result.value()); validation_result.is_error()) {
-        return vm.throw_completion<CompileError>(validation_result.error().error_string);
+    // Only called on the main thread.
+    void hash(ReadonlyBytes chunk)
+    {
+        if (m_module_hash)
+            m_module_hash->update(chunk.data(), chunk.size());
     }
-    auto compiled_module = make_ref_counted<CompiledWebAssemblyModule>(module_result.release_value());
-    cache.add_compiled_module(compiled_module);
-    return compiled_module;
+
+    // Only called on the main thread, once all chunks have been hashed.
+    Optional<ModuleCacheEntry> load_module_cache_entry(JS::Realm& realm)
+    {
+        if (!m_module_hash)
+            return {};
+        return Detail::load_module_cache_entry(realm, m_module_hash->digest());
+    }
+
+    void append(ReadonlyBytes chunk)
+    {
+        if (m_parse_error.has_value())
+            return;
+        if (auto result = m_parser.append(chunk); result.is_error())
+            m_parse_error = result.error();
+    }
+
+    ModuleOrCompileError finish(Optional<ModuleCacheEntry>& cache_entry)
+    {
+        if (m_parse_error.has_value()) {
+            cache_entry.clear();
+            return Wasm::parse_error_to_byte_string(*m_parse_error);
+        }
+        return validate_parsed_webassembly_module(m_parser.finish(), cache_entry);
+    }
+
+private:
+    Wasm::StreamingModuleParser m_parser;
+    Optional<Wasm::ParseError> m_parse_error;
+    OwnPtr<::Crypto::Hash::SHA256> m_module_hash;
+};
+
+struct PendingCompilation {
+    GC::Root<WebIDL::Promise> promise;
+    HTML::Task::Source task_source;
+};
+
+// Background actions may be destroyed on the background thread, so they can't hold on to anything that lives in the
+// GC heap. Instead, they refer to the promise of their compilation by an ID.
+static HashMap<u64, PendingCompilation> s_pending_compilations;
+static u64 s_next_pending_compilation_id { 0 };
+
+struct BackgroundCompilationResult {
+    ModuleOrCompileError module_or_error;
+    Optional<ModuleCacheEntry> cache_entry;
+};
+
+static void compile_webassembly_module_in_background(JS::VM& vm, GC::Ref<WebIDL::Promise> promise, HTML::Task::Source task_source, Optional<ModuleCacheEntry> cache_entry, Function<ModuleOrCompileError(Optional<ModuleCacheEntry>&)> compile)
+{
+    auto id = s_next_pending_compilation_id++;
+    s_pending_compilations.set(id, { GC::make_root(promise), task_source });
+
+    (void)Threading::BackgroundAction<BackgroundCompilationResult>::construct(
+        [compile = move(compile), cache_entry = move(cache_entry)](auto&) mutable -> ErrorOr<BackgroundCompilationResult> {
+            auto module_or_error = compile(cache_entry);
+            return BackgroundCompilationResult { move(module_or_error), move(cache_entry) };
+        },
+        [&vm, id](BackgroundCompilationResult result) -> ErrorOr<void> {
+            auto [promise, task_source] = s_pending_compilations.take(id).release_value();
+
+            // 2. Queue a task to perform the following steps. If taskSource was provided, queue the task on that task source.
+            HTML::queue_a_task(task_source, nullptr, nullptr, GC::create_function(vm.heap(), [&vm, promise = GC::Ref { *promise }, module_or_error = move(result.module_or_error), cache_entry = move(result.cache_entry)]() mutable {
+                auto& realm = HTML::relevant_realm(*promise->promise());
+                HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+
+                store_module_cache_entry(realm, cache_entry);
+
+                // NOTE: This is the part of compiling the module that has to happen on the main thread.
+                auto compiled_module_or_error = [&]() -> JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> {
+                    TRY(host_ensure_can_compile_wasm_bytes(vm));
+                    return create_compiled_webassembly_module(vm, move(module_or_error));
+                }();
+
+                // 1. If module is error, reject promise with a CompileError exception.
+                if (compiled_module_or_error.is_error()) {
+                    WebIDL::reject_promise(realm, promise, compiled_module_or_error.error_value());
+                }
+
+                // 2. Otherwise,
+                else {
+                    // 1. Construct a WebAssembly module object from module and bytes, and let moduleObject be the result.
+                    // FIXME: Save bytes to the Module instance instead of moving into compile_a_webassembly_module
+                    auto module_object = realm.create<Module>(realm, compiled_module_or_error.release_value());
+
+                    // 2. Resolve promise with moduleObject.
+                    WebIDL::resolve_promise(realm, promise, module_object);
+                }
+            }));
+            return {};
+        });
 }
 
 JS::ThrowCompletionOr<JS::HandledByHost> host_resize_array_buffer(JS::VM& vm, JS::ArrayBuffer& buffer, size_t new_length)
@@ -718,32 +905,14 @@ GC::Ref<WebIDL::Promise> asynchronously_compile_webassembly_module(JS::VM& vm, B
     auto promise = WebIDL::create_promise(realm);
 
     // 2. Run the following steps in parallel:
-    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(vm.heap(), [&vm, &realm, bytes = move(bytes), promise, task_source]() mutable {
-        HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
-        // 1. Compile the WebAssembly module bytes and store the result as module.
-        auto module_or_error = Detail::compile_a_webassembly_module(vm, move(bytes));
-
-        // 2. Queue a task to perform the following steps. If taskSource was provided, queue the task on that task source.
-        HTML::queue_a_task(task_source, nullptr, nullptr, GC::create_function(vm.heap(), [&realm, promise, module_or_error = move(module_or_error)]() mutable {
-            HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
-            auto& realm = HTML::relevant_realm(*promise->promise());
-
-            // 1. If module is error, reject promise with a CompileError exception.
-            if (module_or_error.is_error()) {
-                WebIDL::reject_promise(realm, promise, module_or_error.error_value());
-            }
-
-            // 2. Otherwise,
-            else {
-                // 1. Construct a WebAssembly module object from module and bytes, and let moduleObject be the result.
-                // FIXME: Save bytes to the Module instance instead of moving into compile_a_webassembly_module
-                auto module_object = realm.create<Module>(realm, module_or_error.release_value());
-
-                // 2. Resolve promise with moduleObject.
-                WebIDL::resolve_promise(realm, promise, module_object);
-            }
-        }));
-    }));
+    // 1. Compile the WebAssembly module bytes and store the result as module.
+    // NOTE: Parsing and validation happen on a background thread. The rest of compiling the module needs the realm, so
+    //       it happens in the task that settles the promise.
+    auto cache_entry = Detail::load_module_cache_entry(realm, bytes);
+    Detail::compile_webassembly_module_in_background(vm, promise, task_source, move(cache_entry), [bytes = move(bytes)](auto& cache_entry) {
+        FixedMemoryStream stream { bytes.bytes() };
+        return Detail::validate_parsed_webassembly_module(Wasm::Module::parse(stream), cache_entry);
+    });
 
     // 3. Return promise.
     return promise;
@@ -909,42 +1078,58 @@ GC::Ref<WebIDL::Promise> compile_potential_webassembly_response(JS::VM& vm, GC::
         }
 
         // 8. Consume response’s body as an ArrayBuffer, and let bodyPromise be the result.
-        auto body_promise_or_error = response_object.array_buffer();
-        if (body_promise_or_error.is_error()) {
-            auto throw_completion = Bindings::exception_to_throw_completion(realm.vm(), body_promise_or_error.release_error());
-            WebIDL::reject_promise(realm, return_value, throw_completion.value());
+        // NOTE: Rather than waiting for the whole body, we hand every chunk to the background thread as it arrives, which
+        //       parses every section of the module as soon as all of its bytes are there. Consuming the body would
+        //       reject with a TypeError if it is unusable, so we do the same.
+        if (response_object.is_unusable()) {
+            WebIDL::reject_promise(realm, return_value, vm.throw_completion<JS::TypeError>("Body is unusable"sv).value());
             return JS::js_undefined();
         }
-        auto body_promise = body_promise_or_error.release_value();
+
+        auto compilation = adopt_ref(*new Detail::StreamingCompilation);
 
         // 9. Upon fulfillment of bodyPromise with value bodyArrayBuffer:
-        auto body_fulfillment_steps = GC::create_function(vm.heap(), [&vm, return_value](JS::Value body_array_buffer) -> WebIDL::ExceptionOr<JS::Value> {
+        auto process_end_of_body = GC::create_function(vm.heap(), [&vm, return_value, compilation] {
             // 1. Let stableBytes be a copy of the bytes held by the buffer bodyArrayBuffer.
-            VERIFY(body_array_buffer.is_object());
-            auto stable_bytes = WebIDL::get_buffer_source_copy(body_array_buffer.as_object());
-            if (stable_bytes.is_error()) {
-                VERIFY(stable_bytes.error().code() == ENOMEM);
-                WebIDL::reject_promise(HTML::relevant_realm(*return_value->promise()), return_value, vm.throw_completion<JS::InternalError>(vm.error_message(JS::VM::ErrorMessage::OutOfMemory)).value());
-                return JS::js_undefined();
-            }
-
             // 2. Asynchronously compile the WebAssembly module stableBytes using the networking task source and resolve returnValue with the result.
-            auto result = asynchronously_compile_webassembly_module(vm, stable_bytes.release_value(), HTML::Task::Source::Networking);
+            auto& realm = HTML::relevant_realm(*return_value->promise());
+            HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+            auto result = WebIDL::create_promise(realm);
+            auto cache_entry = compilation->load_module_cache_entry(realm);
+            Detail::compile_webassembly_module_in_background(vm, result, HTML::Task::Source::Networking, move(cache_entry), [compilation](auto& cache_entry) {
+                return compilation->finish(cache_entry);
+            });
 
             // Need to manually convert WebIDL promise to an ECMAScript value here to resolve
-            WebIDL::resolve_promise(HTML::relevant_realm(*return_value->promise()), return_value, result->promise());
+            WebIDL::resolve_promise(realm, return_value, result->promise());
+        });
 
+        auto body = response->body();
+        if (!body) {
+            process_end_of_body->function()();
             return JS::js_undefined();
+        }
+
+        auto process_body_chunk = GC::create_function(vm.heap(), [compilation](ByteBuffer chunk) {
+            compilation->hash(chunk);
+            (void)Threading::BackgroundAction<Empty>::construct(
+                [compilation, chunk = move(chunk)](auto&) -> ErrorOr<Empty> {
+                    compilation->append(chunk);
+                    return Empty {};
+                },
+                nullptr);
         });
 
         // 10. Upon rejection of bodyPromise with reason reason:
-        auto body_rejection_steps = GC::create_function(vm.heap(), [return_value](JS::Value reason) -> WebIDL::ExceptionOr<JS::Value> {
+        auto process_body_error = GC::create_function(vm.heap(), [return_value](JS::Value reason) {
+            auto& realm = HTML::relevant_realm(*return_value->promise());
+            HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+
             // 1. Reject returnValue with reason.
-            WebIDL::reject_promise(HTML::relevant_realm(*return_value->promise()), return_value, reason);
-            return JS::js_undefined();
+            WebIDL::reject_promise(realm, return_value, reason);
         });
 
-        WebIDL::react_to_promise(body_promise, body_fulfillment_steps, body_rejection_steps);
+        body->incrementally_read(process_body_chunk, process_end_of_body, process_body_error, { realm.global_object() });
 
         return JS::js_undefined();
     });
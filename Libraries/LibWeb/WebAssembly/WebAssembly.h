@@ -24,6 +24,10 @@ WEB_API void visit_edges(JS::Object&, JS::Cell::Visitor&);
 WEB_API void finalize(JS::Object&);
 WEB_API void initialize(JS::Object&, JS::Realm&);
 
+// Makes compiling a module restore its validated and compiled form from the module cache of the page's client, if a module
+// with the same bytes has been compiled before.
+WEB_API void enable_module_cache();
+
 WEB_API bool validate(JS::VM&, GC::Root<WebIDL::BufferSource>& bytes);
 WEB_API WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> compile(JS::VM&, GC::Root<WebIDL::BufferSource>& bytes);
 WEB_API WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> compile_streaming(JS::VM&, GC::Root<WebIDL::Promise> source);
@@ -333,8 +333,14 @@ ErrorOr<JS::Value, WebDriver::Error> json_deserialize(HTML::BrowsingContext cons
 {
     auto& vm = browsing_context.vm();
 
+    // NOTE: Serializing an AK::JsonValue always produces valid JSON text, but parsing it may still fail. For example, the
+    //       parser throws if the value is nested too deeply for the stack.
+    auto deserialized = JS::JSONObject::parse_json(vm, value.serialized());
+    if (deserialized.is_error())
+        return WebDriver::Error::from_code(ErrorCode::InvalidArgument, "Could not deserialize the JSON value"sv);
+
     SeenMap seen;
-    return internal_json_deserialize(browsing_context, JS::JSONObject::parse_json_value(vm, value), seen);
+    return internal_json_deserialize(browsing_context, deserialized.value(), seen);
 }
 
 }
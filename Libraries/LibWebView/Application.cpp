@@ -14,6 +14,7 @@
 #include <LibDevTools/DevToolsServer.h>
 #include <LibFileSystem/FileSystem.h>
 #include <LibImageDecoderClient/Client.h>
+#include <LibWasm/AbstractMachine/ModuleCache.h>
 #include <LibWeb/CSS/PropertyID.h>
 #include <LibWeb/Loader/UserAgent.h>
 #include <LibWebView/Application.h>
@@ -119,6 +120,9 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     bool enable_idl_tracing = false;
     bool disable_http_cache = false;
     bool enable_http_disk_cache = false;
+    bool enable_wasm_module_cache = false;
+    Optional<u64> http_disk_cache_size_limit;
+    Optional<u64> http_memory_cache_size_limit;
     bool disable_content_filter = false;
     bool enable_autoplay = false;
     bool expose_internals_object = false;
@@ -168,6 +172,9 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     args_parser.add_option(enable_idl_tracing, "Enable IDL tracing", "enable-idl-tracing");
     args_parser.add_option(disable_http_cache, "Disable HTTP cache", "disable-http-cache");
     args_parser.add_option(enable_http_disk_cache, "Enable HTTP disk cache", "enable-http-disk-cache");
+    args_parser.add_option(http_disk_cache_size_limit, "Maximum size of the HTTP disk cache (default: 1024)", "http-disk-cache-size-limit", 0, "MiB");
+    args_parser.add_option(http_memory_cache_size_limit, "Maximum size of the in-memory tier of the HTTP disk cache (default: 32)", "http-memory-cache-size-limit", 0, "MiB");
+    args_parser.add_option(enable_wasm_module_cache, "Enable WebAssembly module disk cache", "enable-wasm-module-cache");
     args_parser.add_option(disable_content_filter, "Disable content filter", "disable-content-filter");
     args_parser.add_option(enable_autoplay, "Enable multimedia autoplay", "enable-autoplay");
     args_parser.add_option(expose_internals_object, "Expose internals object", "expose-internals-object");
@@ -261,6 +268,8 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     m_request_server_options = {
         .certificates = move(certificates),
         .enable_http_disk_cache = enable_http_disk_cache ? EnableHTTPDiskCache::Yes : EnableHTTPDiskCache::No,
+        .http_disk_cache_size_limit_in_mib = http_disk_cache_size_limit,
+        .http_memory_cache_size_limit_in_mib = http_memory_cache_size_limit,
     };
 
     m_web_content_options = {
@@ -272,6 +281,7 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
         .disable_site_isolation = disable_site_isolation ? DisableSiteIsolation::Yes : DisableSiteIsolation::No,
         .enable_idl_tracing = enable_idl_tracing ? EnableIDLTracing::Yes : EnableIDLTracing::No,
         .enable_http_cache = disable_http_cache ? EnableHTTPCache::No : EnableHTTPCache::Yes,
+        .enable_wasm_module_cache = enable_wasm_module_cache ? EnableWasmModuleCache::Yes : EnableWasmModuleCache::No,
         .expose_internals_object = expose_internals_object ? ExposeInternalsObject::Yes : ExposeInternalsObject::No,
         .force_cpu_painting = force_cpu_painting ? ForceCPUPainting::Yes : ForceCPUPainting::No,
         .force_fontconfig = force_fontconfig ? ForceFontconfig::Yes : ForceFontconfig::No,
@@ -370,6 +380,15 @@ ErrorOr<void> Application::launch_services()
         m_storage_jar = StorageJar::create();
     }
 
+    if (m_web_content_options.enable_wasm_module_cache == EnableWasmModuleCache::Yes) {
+        auto directory = LexicalPath::join(Core::StandardPaths::cache_directory(), "Ladybird"sv, "WebAssembly"sv);
+
+        if (auto module_cache = Wasm::ModuleCache::create(move(directory)); module_cache.is_error())
+            warnln("Unable to create WebAssembly module cache: {}", module_cache.error());
+        else
+            m_wasm_module_cache = module_cache.release_value();
+    }
+
     // No need to monitor the system time zone if the TZ environment variable is set, as it overrides system preferences.
     if (!Core::Environment::has("TZ"sv)) {
         if (auto time_zone_watcher = Core::TimeZoneWatcher::create(); time_zone_watcher.is_error()) {
@@ -823,6 +842,20 @@ void Application::initialize_actions()
             warnln("\033[33;1mDumped GC-graph into {}\033[0m", gc_graph_path);
         }
     }));
+    m_debug_menu->add_action(Action::create("Dump Heap Snapshot"sv, ActionID::DumpHeapSnapshot, [this]() {
+        if (auto view = active_web_view(); view.has_value()) {
+            auto heap_snapshot_path = view->dump_heap_snapshot();
+            warnln("\033[33;1mDumped heap snapshot into {}\033[0m", heap_snapshot_path);
+        }
+    }));
+    m_profile_allocations_action = Action::create_checkable("Profile Allocations"sv, ActionID::ProfileAllocations, check(m_profile_allocations_action, "allocation-profiling"sv));
+    m_debug_menu->add_action(*m_profile_allocations_action);
+    m_debug_menu->add_action(Action::create("Dump Allocation Profile"sv, ActionID::DumpAllocationProfile, [this]() {
+        if (auto view = active_web_view(); view.has_value()) {
+            auto allocation_profile_path = view->dump_allocation_profile();
+            warnln("\033[33;1mDumped allocation profile into {}\033[0m", allocation_profile_path);
+        }
+    }));
     m_debug_menu->add_separator();
 
     m_show_line_box_borders_action = Action::create_checkable("Show Line Box Borders"sv, ActionID::ShowLineBoxBorders, check(m_show_line_box_borders_action, "set-line-box-borders"sv));
@@ -876,6 +909,7 @@ void Application::apply_view_options(Badge<ViewImplementation>, ViewImplementati
     view.set_preferred_contrast(m_contrast);
     view.set_preferred_motion(m_motion);
 
+    view.debug_request("allocation-profiling"sv, m_profile_allocations_action->checked() ? "on"sv : "off"sv);
     view.debug_request("set-line-box-borders"sv, m_show_line_box_borders_action->checked() ? "on"sv : "off"sv);
     view.debug_request("scripting"sv, m_enable_scripting_action->checked() ? "on"sv : "off"sv);
     view.debug_request("content-filtering"sv, m_enable_content_filtering_action->checked() ? "on"sv : "off"sv);
@@ -19,6 +19,7 @@
 #include <LibMain/Main.h>
 #include <LibRequests/RequestClient.h>
 #include <LibURL/URL.h>
+#include <LibWasm/Forward.h>
 #include <LibWeb/CSS/PreferredColorScheme.h>
 #include <LibWeb/CSS/PreferredContrast.h>
 #include <LibWeb/CSS/PreferredMotion.h>
@@ -57,6 +58,10 @@ public:
     static CookieJar& cookie_jar() { return *the().m_cookie_jar; }
     static StorageJar& storage_jar() { return *the().m_storage_jar; }
 
+    // This is only set if the WebAssembly module cache is enabled. WebContent processes store and load its entries
+    // through us, so that they never get to see its secret.
+    static Wasm::ModuleCache* wasm_module_cache() { return the().m_wasm_module_cache.ptr(); }
+
     static ProcessManager& process_manager() { return *the().m_process_manager; }
 
     ErrorOr<NonnullRefPtr<WebContentClient>> launch_web_content_process(ViewImplementation&);
@@ -188,6 +193,7 @@ private:
     RefPtr<Database::Database> m_database;
     OwnPtr<CookieJar> m_cookie_jar;
     OwnPtr<StorageJar> m_storage_jar;
+    OwnPtr<Wasm::ModuleCache> m_wasm_module_cache;
 
     OwnPtr<Core::TimeZoneWatcher> m_time_zone_watcher;
 
@@ -219,6 +225,7 @@ private:
     RefPtr<Action> m_toggle_devtools_action;
 
     RefPtr<Menu> m_debug_menu;
+    RefPtr<Action> m_profile_allocations_action;
     RefPtr<Action> m_show_line_box_borders_action;
     RefPtr<Action> m_enable_scripting_action;
     RefPtr<Action> m_enable_content_filtering_action;
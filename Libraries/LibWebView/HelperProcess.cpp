@@ -112,6 +112,8 @@ static ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_web_content_proc
         arguments.append("--enable-idl-tracing"sv);
     if (web_content_options.enable_http_cache == WebView::EnableHTTPCache::Yes)
         arguments.append("--enable-http-cache"sv);
+    if (web_content_options.enable_wasm_module_cache == WebView::EnableWasmModuleCache::Yes)
+        arguments.append("--enable-wasm-module-cache"sv);
     if (web_content_options.expose_internals_object == WebView::ExposeInternalsObject::Yes)
         arguments.append("--expose-internals-object"sv);
     if (web_content_options.force_cpu_painting == WebView::ForceCPUPainting::Yes)
@@ -215,6 +217,10 @@ ErrorOr<NonnullRefPtr<Requests::RequestClient>> launch_request_server_process()
 
     if (request_server_options.enable_http_disk_cache == EnableHTTPDiskCache::Yes)
         arguments.append("--enable-http-disk-cache"sv);
+    if (auto size_limit = request_server_options.http_disk_cache_size_limit_in_mib; size_limit.has_value())
+        arguments.append(ByteString::formatted("--http-disk-cache-size-limit={}", *size_limit));
+    if (auto size_limit = request_server_options.http_memory_cache_size_limit_in_mib; size_limit.has_value())
+        arguments.append(ByteString::formatted("--http-memory-cache-size-limit={}", *size_limit));
 
     if (auto server = mach_server_name(); server.has_value()) {
         arguments.append("--mach-server-name"sv);
@@ -79,6 +79,9 @@ enum class ActionID {
     DumpCookies,
     DumpLocalStorage,
     DumpGCGraph,
+    DumpHeapSnapshot,
+    ProfileAllocations,
+    DumpAllocationProfile,
     ShowLineBoxBorders,
     CollectGarbage,
     ClearCache,
@@ -100,6 +100,8 @@ enum class EnableHTTPDiskCache {
 struct RequestServerOptions {
     Vector<ByteString> certificates;
     EnableHTTPDiskCache enable_http_disk_cache { EnableHTTPDiskCache::No };
+    Optional<u64> http_disk_cache_size_limit_in_mib;
+    Optional<u64> http_memory_cache_size_limit_in_mib;
 };
 
 enum class IsLayoutTestMode {
@@ -122,6 +124,11 @@ enum class EnableHTTPCache {
     Yes,
 };
 
+enum class EnableWasmModuleCache {
+    No,
+    Yes,
+};
+
 enum class DisableSiteIsolation {
     No,
     Yes,
@@ -162,6 +169,7 @@ struct WebContentOptions {
     DisableSiteIsolation disable_site_isolation { DisableSiteIsolation::No };
     EnableIDLTracing enable_idl_tracing { EnableIDLTracing::No };
     EnableHTTPCache enable_http_cache { EnableHTTPCache::No };
+    EnableWasmModuleCache enable_wasm_module_cache { EnableWasmModuleCache::No };
     ExposeInternalsObject expose_internals_object { ExposeInternalsObject::No };
     ForceCPUPainting force_cpu_painting { ForceCPUPainting::No };
     ForceFontconfig force_fontconfig { ForceFontconfig::No };
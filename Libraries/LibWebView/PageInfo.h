@@ -16,6 +16,8 @@ enum class PageInfoType {
     PaintTree = 1 << 3,
     GCGraph = 1 << 4,
     StackingContextTree = 1 << 5,
+    HeapSnapshot = 1 << 6,
+    AllocationProfile = 1 << 7,
 };
 
 AK_ENUM_BITWISE_OPERATORS(PageInfoType);
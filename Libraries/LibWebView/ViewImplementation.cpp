@@ -8,6 +8,7 @@
 #include <AK/String.h>
 #include <AK/TemporaryChange.h>
 #include <AK/Time.h>
+#include <LibCore/AnonymousBuffer.h>
 #include <LibCore/StandardPaths.h>
 #include <LibCore/Timer.h>
 #include <LibGfx/ImageFormats/PNGWriter.h>
@@ -764,28 +765,47 @@ NonnullRefPtr<Core::Promise<String>> ViewImplementation::request_internal_page_i
     return promise;
 }
 
-void ViewImplementation::did_receive_internal_page_info(Badge<WebContentClient>, PageInfoType, String const& info)
+void ViewImplementation::did_receive_internal_page_info(Badge<WebContentClient>, PageInfoType, Core::AnonymousBuffer const& info)
 {
     VERIFY(m_pending_info_request);
 
-    m_pending_info_request->resolve(String { info });
+    auto info_string = String::from_utf8(StringView { info.data<u8>(), info.size() });
+    if (info_string.is_error())
+        m_pending_info_request->reject(info_string.release_error());
+    else
+        m_pending_info_request->resolve(info_string.release_value());
     m_pending_info_request = nullptr;
 }
 
-ErrorOr<LexicalPath> ViewImplementation::dump_gc_graph()
+ErrorOr<LexicalPath> ViewImplementation::dump_internal_page_info(PageInfoType type, StringView file_name_format)
 {
-    auto promise = request_internal_page_info(PageInfoType::GCGraph);
-    auto gc_graph_json = TRY(promise->await());
+    auto promise = request_internal_page_info(type);
+    auto info = TRY(promise->await());
 
     LexicalPath path { Core::StandardPaths::tempfile_directory() };
-    path = path.append(TRY(AK::UnixDateTime::now().to_string("gc-graph-%Y-%m-%d-%H-%M-%S.json"sv)));
+    path = path.append(TRY(AK::UnixDateTime::now().to_string(file_name_format)));
 
     auto dump_file = TRY(Core::File::open(path.string(), Core::File::OpenMode::Write));
-    TRY(dump_file->write_until_depleted(gc_graph_json.bytes()));
+    TRY(dump_file->write_until_depleted(info.bytes()));
 
     return path;
 }
 
+ErrorOr<LexicalPath> ViewImplementation::dump_gc_graph()
+{
+    return dump_internal_page_info(PageInfoType::GCGraph, "gc-graph-%Y-%m-%d-%H-%M-%S.json"sv);
+}
+
+ErrorOr<LexicalPath> ViewImplementation::dump_heap_snapshot()
+{
+    return dump_internal_page_info(PageInfoType::HeapSnapshot, "heap-snapshot-%Y-%m-%d-%H-%M-%S.txt"sv);
+}
+
+ErrorOr<LexicalPath> ViewImplementation::dump_allocation_profile()
+{
+    return dump_internal_page_info(PageInfoType::AllocationProfile, "allocation-profile-%Y-%m-%d-%H-%M-%S.txt"sv);
+}
+
 void ViewImplementation::set_user_style_sheet(String const& source)
 {
     client().async_set_user_style(page_id(), source);
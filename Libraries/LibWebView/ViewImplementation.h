@@ -155,9 +155,11 @@ public:
     virtual void did_receive_screenshot(Badge<WebContentClient>, Gfx::ShareableBitmap const&);
 
     NonnullRefPtr<Core::Promise<String>> request_internal_page_info(PageInfoType);
-    void did_receive_internal_page_info(Badge<WebContentClient>, PageInfoType, String const&);
+    void did_receive_internal_page_info(Badge<WebContentClient>, PageInfoType, Core::AnonymousBuffer const&);
 
     ErrorOr<LexicalPath> dump_gc_graph();
+    ErrorOr<LexicalPath> dump_heap_snapshot();
+    ErrorOr<LexicalPath> dump_allocation_profile();
 
     void set_user_style_sheet(String const& source);
     // Load Native.css as the User style sheet, which attempts to make WebView content look as close to
@@ -264,6 +266,8 @@ protected:
     };
     void handle_web_content_process_crash(LoadErrorPage = LoadErrorPage::Yes);
 
+    ErrorOr<LexicalPath> dump_internal_page_info(PageInfoType, StringView file_name_format);
+
     virtual void default_zoom_level_factor_changed() override;
     virtual void languages_changed() override;
     virtual void autoplay_settings_changed() override;
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibURL/Site.h>
 #include <LibWeb/Cookie/ParsedCookie.h>
 #include <LibWebView/Application.h>
 #include <LibWebView/CookieJar.h>
@@ -384,7 +385,7 @@ void WebContentClient::did_take_screenshot(u64 page_id, Gfx::ShareableBitmap scr
         view->did_receive_screenshot({}, screenshot);
 }
 
-void WebContentClient::did_get_internal_page_info(u64 page_id, WebView::PageInfoType type, String info)
+void WebContentClient::did_get_internal_page_info(u64 page_id, WebView::PageInfoType type, Core::AnonymousBuffer info)
 {
     if (auto view = view_for_page_id(page_id); view.has_value())
         view->did_receive_internal_page_info({}, type, info);
@@ -535,6 +536,43 @@ void WebContentClient::did_clear_storage(Web::StorageAPI::StorageEndpointType st
     Application::storage_jar().clear_storage_key(storage_endpoint, storage_key);
 }
 
+// Entries are partitioned by the top-level site of the page that compiled the module. That site is taken from what we
+// know about the page, rather than from anything that the WebContent process tells us.
+Optional<Wasm::ModuleCache::Key> WebContentClient::wasm_module_cache_key(u64 page_id, ByteBuffer const& module_hash)
+{
+    if (!Application::wasm_module_cache() || module_hash.size() != Wasm::ModuleCache::Hash::Size)
+        return {};
+
+    auto view = view_for_page_id(page_id);
+    if (!view.has_value())
+        return {};
+
+    auto origin = view->url().origin();
+    if (origin.is_opaque())
+        return {};
+
+    Wasm::ModuleCache::Hash hash;
+    module_hash.bytes().copy_to({ hash.data, sizeof(hash.data) });
+    return Wasm::ModuleCache::key_for(URL::Site::obtain(origin).serialize(), hash);
+}
+
+Messages::WebContentClient::DidRequestWasmModuleCacheEntryResponse WebContentClient::did_request_wasm_module_cache_entry(u64 page_id, ByteBuffer module_hash)
+{
+    auto key = wasm_module_cache_key(page_id, module_hash);
+    if (!key.has_value())
+        return Optional<ByteBuffer> {};
+    return Application::wasm_module_cache()->load(*key);
+}
+
+void WebContentClient::did_store_wasm_module_cache_entry(u64 page_id, ByteBuffer module_hash, ByteBuffer payload)
+{
+    auto key = wasm_module_cache_key(page_id, module_hash);
+    if (!key.has_value())
+        return;
+    if (auto result = Application::wasm_module_cache()->store(*key, payload); result.is_error())
+        dbgln("Unable to store WebAssembly module in the cache: {}", result.error());
+}
+
 Messages::WebContentClient::DidRequestNewWebViewResponse WebContentClient::did_request_new_web_view(u64 page_id, Web::HTML::ActivateTab activate_tab, Web::HTML::WebViewHints hints, Optional<u64> page_index)
 {
     if (auto view = view_for_page_id(page_id); view.has_value()) {
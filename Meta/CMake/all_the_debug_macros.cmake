@@ -31,10 +31,12 @@ set(IMAGE_DECODER_DEBUG ON)
 set(IMAGE_LOADER_DEBUG ON)
 set(JOB_DEBUG ON)
 set(JS_BYTECODE_DEBUG ON)
+set(JS_JIT_DEBUG ON)
 set(JS_MODULE_DEBUG ON)
 set(LEXER_DEBUG ON)
 set(LIBWEB_CSS_ANIMATION_DEBUG ON)
 set(LIBWEB_CSS_DEBUG ON)
+set(LIBWEB_DAMAGE_DEBUG ON)
 set(LIBWEB_WASM_DEBUG ON)
 set(LINE_EDITOR_DEBUG ON)
 set(LZW_DEBUG ON)
@@ -70,6 +72,8 @@ set(VPX_DEBUG ON)
 set(WASI_DEBUG ON)
 set(WASI_FINE_GRAINED_DEBUG ON)
 set(WASM_BINPARSER_DEBUG ON)
+set(WASM_JIT_DEBUG ON)
+set(WASM_MODULE_CACHE_DEBUG ON)
 set(WASM_TRACE_DEBUG ON)
 set(WASM_VALIDATOR_DEBUG ON)
 set(WEBDRIVER_DEBUG ON)
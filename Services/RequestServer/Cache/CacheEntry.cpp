@@ -20,11 +20,6 @@
 
 namespace RequestServer {
 
-static LexicalPath path_for_cache_key(LexicalPath const& cache_directory, u64 cache_key)
-{
-    return cache_directory.append(MUST(String::formatted("{:016x}", cache_key)));
-}
-
 ErrorOr<CacheHeader> CacheHeader::read_from_stream(Stream& stream)
 {
     CacheHeader header;
@@ -83,6 +78,7 @@ void CacheEntry::remove()
 {
     (void)FileSystem::remove(m_path.string(), FileSystem::RecursionMode::Disallowed);
     m_index.remove_entry(m_cache_key);
+    m_disk_cache.memory_cache().remove_entry(m_cache_key);
 }
 
 void CacheEntry::close_and_destory_cache_entry()
@@ -98,6 +94,7 @@ ErrorOr<NonnullOwnPtr<CacheEntryWriter>> CacheEntryWriter::create(DiskCache& dis
     auto file = TRY(Core::OutputBufferedFile::create(move(unbuffered_file)));
 
     CacheHeader cache_header;
+    HTTP::HeaderMap stored_headers;
 
     auto result = [&]() -> ErrorOr<void> {
         StringBuilder builder;
@@ -111,6 +108,8 @@ ErrorOr<NonnullOwnPtr<CacheEntryWriter>> CacheEntryWriter::create(DiskCache& dis
             TRY(header_serializer.add("name"sv, header.name));
             TRY(header_serializer.add("value"sv, header.value));
             TRY(header_serializer.finish());
+
+            stored_headers.set(header.name, header.value);
         }
 
         TRY(headers_serializer.finish());
@@ -140,14 +139,16 @@ ErrorOr<NonnullOwnPtr<CacheEntryWriter>> CacheEntryWriter::create(DiskCache& dis
         return result.release_error();
     }
 
-    return adopt_own(*new CacheEntryWriter { disk_cache, index, cache_key, move(url), path, move(file), cache_header, request_time });
+    return adopt_own(*new CacheEntryWriter { disk_cache, index, cache_key, move(url), path, move(file), cache_header, move(reason_phrase), move(stored_headers), request_time });
 }
 
-CacheEntryWriter::CacheEntryWriter(DiskCache& disk_cache, CacheIndex& index, u64 cache_key, String url, LexicalPath path, NonnullOwnPtr<Core::OutputBufferedFile> file, CacheHeader cache_header, UnixDateTime request_time)
+CacheEntryWriter::CacheEntryWriter(DiskCache& disk_cache, CacheIndex& index, u64 cache_key, String url, LexicalPath path, NonnullOwnPtr<Core::OutputBufferedFile> file, CacheHeader cache_header, Optional<String> reason_phrase, HTTP::HeaderMap stored_headers, UnixDateTime request_time)
     : CacheEntry(disk_cache, index, cache_key, move(url), move(path), cache_header)
     , m_file(move(file))
     , m_request_time(request_time)
     , m_response_time(UnixDateTime::now())
+    , m_reason_phrase(move(reason_phrase))
+    , m_stored_headers(move(stored_headers))
 {
 }
 
@@ -169,6 +170,13 @@ ErrorOr<void> CacheEntryWriter::write_data(ReadonlyBytes data)
 
     m_cache_footer.data_size += data.size();
 
+    if (m_is_memory_cacheable) {
+        if (m_cache_footer.data_size > MemoryCache::MAXIMUM_ENTRY_DATA_SIZE || m_memory_cache_data.try_append(data).is_error()) {
+            m_is_memory_cacheable = false;
+            m_memory_cache_data.clear();
+        }
+    }
+
     // FIXME: Update the crc.
 
     dbgln("\033[36;1mSaved {} bytes for\033[0m {}", data.size(), m_url);
@@ -191,10 +199,23 @@ ErrorOr<void> CacheEntryWriter::flush()
 
     m_index.create_entry(m_cache_key, m_url, m_cache_footer.data_size, m_request_time, m_response_time);
 
+    if (m_is_memory_cacheable) {
+        auto memory_cache_entry = MemoryCacheEntry::create(m_cache_header.status_code, move(m_reason_phrase), move(m_stored_headers), move(m_memory_cache_data), m_request_time, m_response_time);
+        m_disk_cache.memory_cache().create_entry(m_cache_key, move(memory_cache_entry));
+    }
+
     dbgln("\033[34;1mFinished caching\033[0m {} ({} bytes)", m_url, m_cache_footer.data_size);
     return {};
 }
 
+void CacheEntryWriter::discard()
+{
+    dbgln("\033[33;1mDiscarding incomplete cache entry for\033[0m {}", m_url);
+
+    remove();
+    close_and_destory_cache_entry();
+}
+
 ErrorOr<NonnullOwnPtr<CacheEntryReader>> CacheEntryReader::create(DiskCache& disk_cache, CacheIndex& index, u64 cache_key, u64 data_size)
 {
     auto path = path_for_cache_key(disk_cache.cache_directory(), cache_key);
@@ -261,6 +282,16 @@ ErrorOr<NonnullOwnPtr<CacheEntryReader>> CacheEntryReader::create(DiskCache& dis
     return adopt_own(*new CacheEntryReader { disk_cache, index, cache_key, move(url), move(path), move(file), fd, cache_header, move(reason_phrase), move(headers), data_offset, data_size });
 }
 
+NonnullOwnPtr<CacheEntryReader> CacheEntryReader::create_from_memory_cache(DiskCache& disk_cache, CacheIndex& index, u64 cache_key, String url, NonnullRefPtr<MemoryCacheEntry> memory_cache_entry)
+{
+    auto path = path_for_cache_key(disk_cache.cache_directory(), cache_key);
+
+    CacheHeader cache_header;
+    cache_header.status_code = memory_cache_entry->status_code();
+
+    return adopt_own(*new CacheEntryReader { disk_cache, index, cache_key, move(url), move(path), cache_header, move(memory_cache_entry) });
+}
+
 CacheEntryReader::CacheEntryReader(DiskCache& disk_cache, CacheIndex& index, u64 cache_key, String url, LexicalPath path, NonnullOwnPtr<Core::File> file, int fd, CacheHeader cache_header, Optional<String> reason_phrase, HTTP::HeaderMap header_map, u64 data_offset, u64 data_size)
     : CacheEntry(disk_cache, index, cache_key, move(url), move(path), cache_header)
     , m_file(move(file))
@@ -272,6 +303,15 @@ CacheEntryReader::CacheEntryReader(DiskCache& disk_cache, CacheIndex& index, u64
 {
 }
 
+CacheEntryReader::CacheEntryReader(DiskCache& disk_cache, CacheIndex& index, u64 cache_key, String url, LexicalPath path, CacheHeader cache_header, NonnullRefPtr<MemoryCacheEntry> memory_cache_entry)
+    : CacheEntry(disk_cache, index, cache_key, move(url), move(path), cache_header)
+    , m_memory_cache_entry(memory_cache_entry)
+    , m_reason_phrase(memory_cache_entry->reason_phrase())
+    , m_headers(memory_cache_entry->headers())
+    , m_data_size(memory_cache_entry->data().size())
+{
+}
+
 void CacheEntryReader::pipe_to(int pipe_fd, Function<void(u64)> on_complete, Function<void(u64)> on_error)
 {
     VERIFY(m_pipe_fd == -1);
@@ -285,6 +325,17 @@ void CacheEntryReader::pipe_to(int pipe_fd, Function<void(u64)> on_complete, Fun
         return;
     }
 
+#if defined(AK_OS_LINUX)
+    // Each transfer moves at most the pipe's capacity before we must wait for the client to drain it. For large entries,
+    // grow the pipe to reduce the number of round trips through the event loop. This is only a hint; the kernel may
+    // refuse or clamp the requested size.
+    static constexpr size_t default_pipe_capacity = 64 * KiB;
+    static constexpr size_t maximum_pipe_capacity = 1 * MiB;
+
+    if (m_data_size > default_pipe_capacity)
+        (void)Core::System::fcntl(m_pipe_fd, F_SETPIPE_SZ, static_cast<int>(min(m_data_size, maximum_pipe_capacity)));
+#endif
+
     m_pipe_write_notifier = Core::Notifier::construct(m_pipe_fd, Core::NotificationType::Write);
     m_pipe_write_notifier->set_enabled(false);
 
@@ -303,7 +354,11 @@ void CacheEntryReader::pipe_without_blocking()
         return;
     }
 
-    auto result = Core::System::transfer_file_through_pipe(m_fd, m_pipe_fd, m_data_offset + m_bytes_piped, m_data_size - m_bytes_piped);
+    auto result = [&]() -> ErrorOr<size_t> {
+        if (m_memory_cache_entry)
+            return static_cast<size_t>(TRY(Core::System::write(m_pipe_fd, m_memory_cache_entry->data().slice(m_bytes_piped))));
+        return Core::System::transfer_file_through_pipe(m_fd, m_pipe_fd, m_data_offset + m_bytes_piped, m_data_size - m_bytes_piped);
+    }();
 
     if (result.is_error()) {
         if (result.error().code() != EAGAIN && result.error().code() != EWOULDBLOCK)
@@ -333,7 +388,12 @@ void CacheEntryReader::pipe_complete()
         if (m_on_pipe_error)
             m_on_pipe_error(m_bytes_piped);
     } else {
-        m_index.update_last_access_time(m_cache_key);
+        if (!m_memory_cache_entry) {
+            m_index.update_last_access_time(m_cache_key);
+        } else if (auto now = UnixDateTime::now(); m_memory_cache_entry->should_update_index_access_time(now)) {
+            m_index.update_last_access_time(m_cache_key);
+            m_memory_cache_entry->did_update_index_access_time(now);
+        }
 
         if (m_on_pipe_complete)
             m_on_pipe_complete(m_bytes_piped);
@@ -358,6 +418,10 @@ void CacheEntryReader::pipe_error(Error error)
 
 ErrorOr<void> CacheEntryReader::read_and_validate_footer()
 {
+    // Memory cache entries are only created once their disk cache entry has been completely written.
+    if (m_memory_cache_entry)
+        return {};
+
     TRY(m_file->seek(m_data_offset + m_data_size, SeekMode::SetPosition));
     m_cache_footer = TRY(m_file->read_value<CacheFooter>());
 
@@ -13,6 +13,7 @@
 #include <AK/Types.h>
 #include <LibCore/File.h>
 #include <LibHTTP/HeaderMap.h>
+#include <RequestServer/Cache/MemoryCache.h>
 #include <RequestServer/Forward.h>
 
 namespace RequestServer {
@@ -57,6 +58,8 @@ public:
 
     void remove();
 
+    u64 cache_key() const { return m_cache_key; }
+
     void mark_for_deletion(Badge<DiskCache>) { m_marked_for_deletion = true; }
 
 protected:
@@ -86,18 +89,28 @@ public:
     ErrorOr<void> write_data(ReadonlyBytes);
     ErrorOr<void> flush();
 
+    // Removes a partially written entry, e.g. for a request which was stopped before the full response was received.
+    void discard();
+
 private:
-    CacheEntryWriter(DiskCache&, CacheIndex&, u64 cache_key, String url, LexicalPath, NonnullOwnPtr<Core::OutputBufferedFile>, CacheHeader, UnixDateTime request_time);
+    CacheEntryWriter(DiskCache&, CacheIndex&, u64 cache_key, String url, LexicalPath, NonnullOwnPtr<Core::OutputBufferedFile>, CacheHeader, Optional<String> reason_phrase, HTTP::HeaderMap stored_headers, UnixDateTime request_time);
 
     NonnullOwnPtr<Core::OutputBufferedFile> m_file;
 
     UnixDateTime m_request_time;
     UnixDateTime m_response_time;
+
+    // A copy of the response, which is written through to the memory cache if the entry turns out to be small enough.
+    Optional<String> m_reason_phrase;
+    HTTP::HeaderMap m_stored_headers;
+    ByteBuffer m_memory_cache_data;
+    bool m_is_memory_cacheable { true };
 };
 
 class CacheEntryReader : public CacheEntry {
 public:
     static ErrorOr<NonnullOwnPtr<CacheEntryReader>> create(DiskCache&, CacheIndex&, u64 cache_key, u64 data_size);
+    static NonnullOwnPtr<CacheEntryReader> create_from_memory_cache(DiskCache&, CacheIndex&, u64 cache_key, String url, NonnullRefPtr<MemoryCacheEntry>);
     virtual ~CacheEntryReader() override = default;
 
     void pipe_to(int pipe_fd, Function<void(u64 bytes_piped)> on_complete, Function<void(u64 bytes_piped)> on_error);
@@ -108,6 +121,7 @@ public:
 
 private:
     CacheEntryReader(DiskCache&, CacheIndex&, u64 cache_key, String url, LexicalPath, NonnullOwnPtr<Core::File>, int fd, CacheHeader, Optional<String> reason_phrase, HTTP::HeaderMap, u64 data_offset, u64 data_size);
+    CacheEntryReader(DiskCache&, CacheIndex&, u64 cache_key, String url, LexicalPath, CacheHeader, NonnullRefPtr<MemoryCacheEntry>);
 
     void pipe_without_blocking();
     void pipe_complete();
@@ -115,9 +129,12 @@ private:
 
     ErrorOr<void> read_and_validate_footer();
 
-    NonnullOwnPtr<Core::File> m_file;
+    OwnPtr<Core::File> m_file;
     int m_fd { -1 };
 
+    // Set if this entry is being served from the memory cache, in which case there is no open file.
+    RefPtr<MemoryCacheEntry> m_memory_cache_entry;
+
     RefPtr<Core::Notifier> m_pipe_write_notifier;
     int m_pipe_fd { -1 };
 
@@ -22,19 +22,33 @@ ErrorOr<CacheIndex> CacheIndex::create(Database::Database& database)
         );)#"sv));
     database.execute_statement(create_table, {});
 
+    // Eviction walks the index in order of last access time. Index that column, so that finding the oldest entries
+    // does not require sorting the entire table.
+    auto create_last_access_time_index = TRY(database.prepare_statement("CREATE INDEX IF NOT EXISTS CacheIndexLastAccessTime ON CacheIndex(last_access_time);"sv));
+    database.execute_statement(create_last_access_time_index, {});
+
     Statements statements {};
     statements.insert_entry = TRY(database.prepare_statement("INSERT OR REPLACE INTO CacheIndex VALUES (?, ?, ?, ?, ?, ?);"sv));
     statements.remove_entry = TRY(database.prepare_statement("DELETE FROM CacheIndex WHERE cache_key = ?;"sv));
     statements.remove_all_entries = TRY(database.prepare_statement("DELETE FROM CacheIndex;"sv));
     statements.select_entry = TRY(database.prepare_statement("SELECT * FROM CacheIndex WHERE cache_key = ?;"sv));
     statements.update_last_access_time = TRY(database.prepare_statement("UPDATE CacheIndex SET last_access_time = ? WHERE cache_key = ?;"sv));
+    statements.select_total_data_size = TRY(database.prepare_statement("SELECT SUM(data_size) FROM CacheIndex;"sv));
+    statements.select_least_recently_accessed_entries = TRY(database.prepare_statement("SELECT cache_key, data_size FROM CacheIndex ORDER BY last_access_time ASC LIMIT ? OFFSET ?;"sv));
+    statements.select_all_cache_keys = TRY(database.prepare_statement("SELECT cache_key FROM CacheIndex;"sv));
+
+    u64 total_data_size = 0;
+    database.execute_statement(statements.select_total_data_size, [&](auto statement_id) {
+        total_data_size = database.result_column<u64>(statement_id, 0);
+    });
 
-    return CacheIndex { database, statements };
+    return CacheIndex { database, statements, total_data_size };
 }
 
-CacheIndex::CacheIndex(Database::Database& database, Statements statements)
+CacheIndex::CacheIndex(Database::Database& database, Statements statements, u64 total_data_size)
     : m_database(database)
     , m_statements(statements)
+    , m_total_data_size(total_data_size)
 {
 }
 
@@ -51,12 +65,20 @@ void CacheIndex::create_entry(u64 cache_key, String url, u64 data_size, UnixDate
         .last_access_time = now,
     };
 
+    // The insertion below may replace an existing entry, so make sure we don't account for its size twice.
+    if (auto existing_entry = find_entry(cache_key); existing_entry.has_value())
+        m_total_data_size -= min(existing_entry->data_size, m_total_data_size);
+    m_total_data_size += data_size;
+
     m_database.execute_statement(m_statements.insert_entry, {}, entry.cache_key, entry.url, entry.data_size, entry.request_time, entry.response_time, entry.last_access_time);
     m_entries.set(cache_key, move(entry));
 }
 
 void CacheIndex::remove_entry(u64 cache_key)
 {
+    if (auto entry = find_entry(cache_key); entry.has_value())
+        m_total_data_size -= min(entry->data_size, m_total_data_size);
+
     m_database.execute_statement(m_statements.remove_entry, {}, cache_key);
     m_entries.remove(cache_key);
 }
@@ -65,6 +87,8 @@ void CacheIndex::remove_all_entries()
 {
     m_database.execute_statement(m_statements.remove_all_entries, {});
     m_entries.clear();
+
+    m_total_data_size = 0;
 }
 
 void CacheIndex::update_last_access_time(u64 cache_key)
@@ -103,4 +127,32 @@ Optional<CacheIndex::Entry&> CacheIndex::find_entry(u64 cache_key)
     return m_entries.get(cache_key);
 }
 
+Vector<CacheIndex::EvictionCandidate> CacheIndex::least_recently_accessed_entries(size_t count, size_t offset)
+{
+    Vector<EvictionCandidate> entries;
+    entries.ensure_capacity(count);
+
+    m_database.execute_statement(
+        m_statements.select_least_recently_accessed_entries, [&](auto statement_id) {
+            auto cache_key = m_database.result_column<u64>(statement_id, 0);
+            auto data_size = m_database.result_column<u64>(statement_id, 1);
+
+            entries.append({ cache_key, data_size });
+        },
+        count, offset);
+
+    return entries;
+}
+
+Vector<u64> CacheIndex::all_cache_keys()
+{
+    Vector<u64> cache_keys;
+
+    m_database.execute_statement(m_statements.select_all_cache_keys, [&](auto statement_id) {
+        cache_keys.append(m_database.result_column<u64>(statement_id, 0));
+    });
+
+    return cache_keys;
+}
+
 }
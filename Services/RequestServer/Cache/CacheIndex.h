@@ -10,6 +10,7 @@
 #include <AK/HashMap.h>
 #include <AK/Time.h>
 #include <AK/Types.h>
+#include <AK/Vector.h>
 #include <LibDatabase/Database.h>
 
 namespace RequestServer {
@@ -29,6 +30,11 @@ class CacheIndex {
     };
 
 public:
+    struct EvictionCandidate {
+        u64 cache_key { 0 };
+        u64 data_size { 0 };
+    };
+
     static ErrorOr<CacheIndex> create(Database::Database&);
 
     void create_entry(u64 cache_key, String url, u64 data_size, UnixDateTime request_time, UnixDateTime response_time);
@@ -39,6 +45,12 @@ public:
 
     void update_last_access_time(u64 cache_key);
 
+    // Returns up to `count` entries, ordered from least to most recently accessed, skipping the first `offset` entries.
+    Vector<EvictionCandidate> least_recently_accessed_entries(size_t count, size_t offset = 0);
+    Vector<u64> all_cache_keys();
+
+    u64 total_data_size() const { return m_total_data_size; }
+
 private:
     struct Statements {
         Database::StatementID insert_entry { 0 };
@@ -46,14 +58,19 @@ private:
         Database::StatementID remove_all_entries { 0 };
         Database::StatementID select_entry { 0 };
         Database::StatementID update_last_access_time { 0 };
+        Database::StatementID select_total_data_size { 0 };
+        Database::StatementID select_least_recently_accessed_entries { 0 };
+        Database::StatementID select_all_cache_keys { 0 };
     };
 
-    CacheIndex(Database::Database&, Statements);
+    CacheIndex(Database::Database&, Statements, u64 total_data_size);
 
     Database::Database& m_database;
     Statements m_statements;
 
     HashMap<u32, Entry> m_entries;
+
+    u64 m_total_data_size { 0 };
 };
 
 }
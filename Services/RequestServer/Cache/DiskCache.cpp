@@ -4,9 +4,11 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Debug.h>
 #include <LibCore/DirIterator.h>
 #include <LibCore/StandardPaths.h>
 #include <LibFileSystem/FileSystem.h>
+#include <LibThreading/BackgroundAction.h>
 #include <LibURL/URL.h>
 #include <RequestServer/Cache/DiskCache.h>
 #include <RequestServer/Cache/Utilities.h>
@@ -15,24 +17,49 @@ namespace RequestServer {
 
 static constexpr auto INDEX_DATABASE = "INDEX"sv;
 
-ErrorOr<DiskCache> DiskCache::create()
+// Once the cache grows beyond its maximum size, we evict entries until it is back under this percentage of the maximum
+// size. This leaves some headroom, so that we are not running an eviction for every newly cached response.
+static constexpr u64 EVICTION_TARGET_PERCENTAGE = 90;
+
+// The number of eviction candidates read from the index at a time.
+static constexpr size_t EVICTION_BATCH_SIZE = 64;
+
+ErrorOr<DiskCache> DiskCache::create(u64 maximum_size, size_t maximum_memory_cache_size)
 {
     auto cache_directory = LexicalPath::join(Core::StandardPaths::cache_directory(), "Ladybird"sv, "Cache"sv);
+    return create(move(cache_directory), maximum_size, maximum_memory_cache_size);
+}
 
+ErrorOr<DiskCache> DiskCache::create(LexicalPath cache_directory, u64 maximum_size, size_t maximum_memory_cache_size)
+{
     auto database = TRY(Database::Database::create(cache_directory.string(), INDEX_DATABASE));
     auto index = TRY(CacheIndex::create(database));
 
-    return DiskCache { move(database), move(cache_directory), move(index) };
+    return DiskCache { move(database), move(cache_directory), move(index), maximum_size, maximum_memory_cache_size };
 }
 
-DiskCache::DiskCache(NonnullRefPtr<Database::Database> database, LexicalPath cache_directory, CacheIndex index)
+DiskCache::DiskCache(NonnullRefPtr<Database::Database> database, LexicalPath cache_directory, CacheIndex index, u64 maximum_size, size_t maximum_memory_cache_size)
     : m_database(move(database))
     , m_cache_directory(move(cache_directory))
     , m_index(move(index))
+    , m_memory_cache(maximum_memory_cache_size)
+    , m_maximum_size(maximum_size)
+{
+}
+
+DiskCache::RequestType DiskCache::request_type_from_headers(HTTP::HeaderMap const& headers)
 {
+    // https://wicg.github.io/nav-speculation/prefetch.html#sec-purpose-header
+    if (auto purpose = headers.get("Sec-Purpose"); purpose.has_value() && purpose->contains("prefetch"sv))
+        return RequestType::Prefetch;
+
+    if (auto mode = headers.get("Sec-Fetch-Mode"); mode.has_value() && *mode == "navigate"sv)
+        return RequestType::Navigation;
+
+    return RequestType::Normal;
 }
 
-Optional<CacheEntryWriter&> DiskCache::create_entry(URL::URL const& url, StringView method, u32 status_code, Optional<String> reason_phrase, HTTP::HeaderMap const& headers, UnixDateTime request_time)
+Optional<CacheEntryWriter&> DiskCache::create_entry(URL::URL const& url, StringView method, u32 status_code, Optional<String> reason_phrase, HTTP::HeaderMap const& headers, UnixDateTime request_time, RequestType request_type)
 {
     if (!is_cacheable(method, status_code, headers))
         return {};
@@ -43,6 +70,14 @@ Optional<CacheEntryWriter&> DiskCache::create_entry(URL::URL const& url, StringV
     auto serialized_url = serialize_url_for_cache_storage(url);
     auto cache_key = create_cache_key(serialized_url, method);
 
+    // An evicted file for this cache key is still waiting to be removed. Creating the entry now would have the new file
+    // removed from under us.
+    if (m_pending_removals.contains(cache_key))
+        return {};
+
+    // The response being written will replace any response we have stored for this cache key.
+    m_memory_cache.remove_entry(cache_key);
+
     auto cache_entry = CacheEntryWriter::create(*this, m_index, cache_key, move(serialized_url), status_code, move(reason_phrase), headers, request_time);
     if (cache_entry.is_error()) {
         dbgln("\033[31;1mUnable to create cache entry for\033[0m {}: {}", url, cache_entry.error());
@@ -51,20 +86,57 @@ Optional<CacheEntryWriter&> DiskCache::create_entry(URL::URL const& url, StringV
 
     dbgln("\033[32;1mCreated disk cache entry for\033[0m {}", url);
 
+    if (request_type == RequestType::Prefetch) {
+        m_prefetched_cache_keys.set(cache_key);
+        ++m_statistics.prefetched_entries;
+    } else {
+        m_prefetched_cache_keys.remove(cache_key);
+    }
+
     auto address = reinterpret_cast<FlatPtr>(cache_entry.value().ptr());
     m_open_cache_entries.set(address, cache_entry.release_value());
 
     return static_cast<CacheEntryWriter&>(**m_open_cache_entries.get(address));
 }
 
-Optional<CacheEntryReader&> DiskCache::open_entry(URL::URL const& url, StringView method)
+Optional<CacheEntryReader&> DiskCache::open_entry(URL::URL const& url, StringView method, RequestType request_type)
 {
     auto serialized_url = serialize_url_for_cache_storage(url);
     auto cache_key = create_cache_key(serialized_url, method);
 
+    if (request_type == RequestType::Prefetch)
+        ++m_statistics.prefetch_requests;
+
+    if (auto memory_cache_entry = m_memory_cache.find_entry(cache_key)) {
+        auto freshness_lifetime = calculate_freshness_lifetime(memory_cache_entry->headers());
+        auto current_age = calculate_age(memory_cache_entry->headers(), memory_cache_entry->request_time(), memory_cache_entry->response_time());
+
+        if (is_response_fresh(freshness_lifetime, current_age)) {
+            dbgln("\033[32;1mOpened memory cache entry for\033[0m {} (lifetime={}s age={}s) ({} bytes)", url, freshness_lifetime.to_seconds(), current_age.to_seconds(), memory_cache_entry->data().size());
+
+            ++m_statistics.memory_cache_hits;
+            did_hit_cache_entry(cache_key, request_type);
+            log_hit_rates();
+
+            auto cache_entry = CacheEntryReader::create_from_memory_cache(*this, m_index, cache_key, move(serialized_url), memory_cache_entry.release_nonnull());
+
+            auto address = reinterpret_cast<FlatPtr>(cache_entry.ptr());
+            m_open_cache_entries.set(address, move(cache_entry));
+
+            return static_cast<CacheEntryReader&>(**m_open_cache_entries.get(address));
+        }
+
+        // The disk cache entry has the same age, so it will be found to have expired below as well.
+        m_memory_cache.remove_entry(cache_key);
+    }
+
     auto index_entry = m_index.find_entry(cache_key);
     if (!index_entry.has_value()) {
         dbgln("\033[35;1mNo disk cache entry for\033[0m {}", url);
+
+        ++m_statistics.cache_misses;
+        log_hit_rates();
+
         return {};
     }
 
@@ -81,9 +153,17 @@ Optional<CacheEntryReader&> DiskCache::open_entry(URL::URL const& url, StringVie
     if (!is_response_fresh(freshness_lifetime, current_age)) {
         dbgln("\033[33;1mCache entry expired for\033[0m {} (lifetime={}s age={}s)", url, freshness_lifetime.to_seconds(), current_age.to_seconds());
         cache_entry.value()->remove();
+
+        ++m_statistics.cache_misses;
+        log_hit_rates();
+
         return {};
     }
 
+    ++m_statistics.disk_cache_hits;
+    did_hit_cache_entry(cache_key, request_type);
+    log_hit_rates();
+
     dbgln("\033[32;1mOpened disk cache entry for\033[0m {} (lifetime={}s age={}s) ({} bytes)", url, freshness_lifetime.to_seconds(), current_age.to_seconds(), index_entry->data_size);
 
     auto address = reinterpret_cast<FlatPtr>(cache_entry.value().ptr());
@@ -98,6 +178,8 @@ void DiskCache::clear_cache()
         cache_entry->mark_for_deletion({});
 
     m_index.remove_all_entries();
+    m_memory_cache.remove_all_entries();
+    m_prefetched_cache_keys.clear();
 
     Core::DirIterator it { m_cache_directory.string(), Core::DirIterator::SkipDots };
     size_t cache_entries { 0 };
@@ -118,6 +200,176 @@ void DiskCache::cache_entry_closed(Badge<CacheEntry>, CacheEntry const& cache_en
 {
     auto address = reinterpret_cast<FlatPtr>(&cache_entry);
     m_open_cache_entries.remove(address);
+
+    evict_entries_if_needed();
+}
+
+void DiskCache::remove_orphaned_files()
+{
+    // Note: We make a deep copy of the cache directory, as the string will be destroyed on the background thread.
+    ByteString cache_directory { m_cache_directory.string().view() };
+
+    (void)Threading::BackgroundAction<Vector<u64>>::construct(
+        [cache_directory = move(cache_directory)](auto&) -> ErrorOr<Vector<u64>> {
+            Vector<u64> cache_keys;
+
+            Core::DirIterator it { cache_directory, Core::DirIterator::SkipDots };
+            while (it.has_next()) {
+                if (auto cache_key = cache_key_from_path(LexicalPath { it.next_path() }); cache_key.has_value())
+                    cache_keys.append(*cache_key);
+            }
+
+            return cache_keys;
+        },
+        [this](Vector<u64> cache_keys) -> ErrorOr<void> {
+            HashTable<u64> known_cache_keys;
+
+            for (auto cache_key : m_index.all_cache_keys())
+                known_cache_keys.set(cache_key);
+            for (auto const& [_, cache_entry] : m_open_cache_entries)
+                known_cache_keys.set(cache_entry->cache_key());
+
+            cache_keys.remove_all_matching([&](u64 cache_key) {
+                return known_cache_keys.contains(cache_key) || m_pending_removals.contains(cache_key);
+            });
+
+            if (cache_keys.is_empty())
+                return {};
+
+            dbgln("\033[33;1mRemoving {} orphaned disk cache files\033[0m", cache_keys.size());
+            m_statistics.removed_orphaned_files += cache_keys.size();
+
+            remove_files_in_background(move(cache_keys));
+            return {};
+        });
+}
+
+void DiskCache::evict_entries_if_needed()
+{
+    if (m_index.total_data_size() <= m_maximum_size)
+        return;
+
+    // Split the maximum size into whole hundreds and a remainder, so that small limits don't truncate the target size to
+    // zero, and large ones can't overflow.
+    auto target_size = (m_maximum_size / 100 * EVICTION_TARGET_PERCENTAGE) + (m_maximum_size % 100 * EVICTION_TARGET_PERCENTAGE / 100);
+
+    // Entries which are currently being read or written cannot be evicted.
+    HashTable<u64> open_cache_keys;
+    for (auto const& [_, cache_entry] : m_open_cache_entries)
+        open_cache_keys.set(cache_entry->cache_key());
+
+    Vector<u64> evicted_cache_keys;
+    u64 evicted_bytes = 0;
+
+    // Candidates are fetched from the index in small batches, so that an eviction run only visits as many entries as it
+    // needs to free up space, rather than the entire index. Evicted entries are removed from the index as we go, so the
+    // next batch only has to skip past the open entries we have encountered so far.
+    size_t skipped_entries = 0;
+
+    // FIXME: Consider weighting the access time by each entry's freshness lifetime, so that entries which would soon
+    //        expire anyways are evicted first.
+    while (m_index.total_data_size() > target_size) {
+        auto candidates = m_index.least_recently_accessed_entries(EVICTION_BATCH_SIZE, skipped_entries);
+        if (candidates.is_empty())
+            break;
+
+        for (auto const& candidate : candidates) {
+            if (m_index.total_data_size() <= target_size)
+                break;
+
+            if (open_cache_keys.contains(candidate.cache_key)) {
+                ++skipped_entries;
+                continue;
+            }
+
+            m_index.remove_entry(candidate.cache_key);
+            m_memory_cache.remove_entry(candidate.cache_key);
+            m_prefetched_cache_keys.remove(candidate.cache_key);
+
+            evicted_cache_keys.append(candidate.cache_key);
+            evicted_bytes += candidate.data_size;
+        }
+    }
+
+    if (evicted_cache_keys.is_empty())
+        return;
+
+    ++m_statistics.eviction_runs;
+    m_statistics.evicted_entries += evicted_cache_keys.size();
+    m_statistics.evicted_bytes += evicted_bytes;
+
+    dbgln("\033[33;1mEvicting {} disk cache entries\033[0m ({} bytes), cache size is now {} of {} bytes", evicted_cache_keys.size(), evicted_bytes, m_index.total_data_size(), m_maximum_size);
+    dbgln("Disk cache statistics: {} eviction runs, {} entries evicted, {} bytes evicted", m_statistics.eviction_runs, m_statistics.evicted_entries, m_statistics.evicted_bytes);
+
+    remove_files_in_background(move(evicted_cache_keys));
+}
+
+void DiskCache::log_hit_rates() const
+{
+    // This is called for every cache lookup, so only log the hit rates when debugging the cache.
+    if constexpr (!HTTP_CACHE_DEBUG)
+        return;
+
+    auto total = m_statistics.memory_cache_hits + m_statistics.disk_cache_hits + m_statistics.cache_misses;
+    if (total == 0)
+        return;
+
+    auto percentage = [&](u64 count) { return static_cast<double>(count) * 100.0 / static_cast<double>(total); };
+
+    dbgln("Cache hit rates: memory={:.1}% disk={:.1}% miss={:.1}% ({} requests, memory cache size is {} of {} bytes)",
+        percentage(m_statistics.memory_cache_hits),
+        percentage(m_statistics.disk_cache_hits),
+        percentage(m_statistics.cache_misses),
+        total,
+        m_memory_cache.size(),
+        m_memory_cache.maximum_size());
+
+    if (m_statistics.prefetch_requests != 0) {
+        dbgln("Prefetch statistics: {} requests, {} entries prefetched, {} hits on prefetched entries ({} navigations)",
+            m_statistics.prefetch_requests,
+            m_statistics.prefetched_entries,
+            m_statistics.prefetch_hits,
+            m_statistics.navigation_prefetch_hits);
+    }
+}
+
+void DiskCache::did_hit_cache_entry(u64 cache_key, RequestType request_type)
+{
+    if (request_type == RequestType::Prefetch)
+        return;
+
+    // Only the first use of a prefetched entry is attributed to the prefetch.
+    if (!m_prefetched_cache_keys.remove(cache_key))
+        return;
+
+    ++m_statistics.prefetch_hits;
+    if (request_type == RequestType::Navigation)
+        ++m_statistics.navigation_prefetch_hits;
+}
+
+void DiskCache::remove_files_in_background(Vector<u64> cache_keys)
+{
+    Vector<ByteString> paths;
+    paths.ensure_capacity(cache_keys.size());
+
+    for (auto cache_key : cache_keys) {
+        m_pending_removals.set(cache_key);
+        paths.unchecked_append(path_for_cache_key(m_cache_directory, cache_key).string());
+    }
+
+    // Removing large files may block for a significant amount of time, so we do so off the main thread. The index has
+    // already been updated at this point, so these files are no longer reachable.
+    (void)Threading::BackgroundAction<size_t>::construct(
+        [paths = move(paths)](auto&) -> ErrorOr<size_t> {
+            for (auto const& path : paths)
+                (void)FileSystem::remove(path, FileSystem::RecursionMode::Disallowed);
+            return paths.size();
+        },
+        [this, cache_keys = move(cache_keys)](size_t) -> ErrorOr<void> {
+            for (auto cache_key : cache_keys)
+                m_pending_removals.remove(cache_key);
+            return {};
+        });
 }
 
 }
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/Error.h>
+#include <AK/HashTable.h>
 #include <AK/LexicalPath.h>
 #include <AK/Optional.h>
 #include <AK/StringView.h>
@@ -17,30 +18,84 @@
 #include <LibURL/Forward.h>
 #include <RequestServer/Cache/CacheEntry.h>
 #include <RequestServer/Cache/CacheIndex.h>
+#include <RequestServer/Cache/MemoryCache.h>
 
 namespace RequestServer {
 
 class DiskCache {
 public:
-    static ErrorOr<DiskCache> create();
+    static constexpr u64 DEFAULT_MAXIMUM_SIZE = 1 * GiB;
 
-    Optional<CacheEntryWriter&> create_entry(URL::URL const&, StringView method, u32 status_code, Optional<String> reason_phrase, HTTP::HeaderMap const&, UnixDateTime request_time);
-    Optional<CacheEntryReader&> open_entry(URL::URL const&, StringView method);
+    // The kind of request on whose behalf an entry is created or opened. Entries created for prefetch requests are
+    // tracked, so that we may report how many later requests were actually served from prefetched responses.
+    enum class RequestType {
+        Normal,
+        Navigation,
+        Prefetch,
+    };
+    static RequestType request_type_from_headers(HTTP::HeaderMap const&);
+
+    struct Statistics {
+        u64 eviction_runs { 0 };
+        u64 evicted_entries { 0 };
+        u64 evicted_bytes { 0 };
+        u64 removed_orphaned_files { 0 };
+
+        u64 memory_cache_hits { 0 };
+        u64 disk_cache_hits { 0 };
+        u64 cache_misses { 0 };
+
+        u64 prefetch_requests { 0 };
+        u64 prefetched_entries { 0 };
+        u64 prefetch_hits { 0 };
+        u64 navigation_prefetch_hits { 0 };
+    };
+
+    static ErrorOr<DiskCache> create(u64 maximum_size = DEFAULT_MAXIMUM_SIZE, size_t maximum_memory_cache_size = MemoryCache::DEFAULT_MAXIMUM_SIZE);
+    static ErrorOr<DiskCache> create(LexicalPath cache_directory, u64 maximum_size = DEFAULT_MAXIMUM_SIZE, size_t maximum_memory_cache_size = MemoryCache::DEFAULT_MAXIMUM_SIZE);
+
+    Optional<CacheEntryWriter&> create_entry(URL::URL const&, StringView method, u32 status_code, Optional<String> reason_phrase, HTTP::HeaderMap const&, UnixDateTime request_time, RequestType = RequestType::Normal);
+    Optional<CacheEntryReader&> open_entry(URL::URL const&, StringView method, RequestType = RequestType::Normal);
     void clear_cache();
 
+    // Removes files in the cache directory which are not tracked by the index (e.g. entries which were still being
+    // written when RequestServer exited). The directory is scanned and the files are removed on a background thread.
+    void remove_orphaned_files();
+
     LexicalPath const& cache_directory() { return m_cache_directory; }
+    MemoryCache& memory_cache() { return m_memory_cache; }
+
+    u64 size() const { return m_index.total_data_size(); }
+    u64 maximum_size() const { return m_maximum_size; }
+    Statistics const& statistics() const { return m_statistics; }
 
     void cache_entry_closed(Badge<CacheEntry>, CacheEntry const&);
 
 private:
-    DiskCache(NonnullRefPtr<Database::Database>, LexicalPath cache_directory, CacheIndex);
+    DiskCache(NonnullRefPtr<Database::Database>, LexicalPath cache_directory, CacheIndex, u64 maximum_size, size_t maximum_memory_cache_size);
+
+    void evict_entries_if_needed();
+    void log_hit_rates() const;
+    void did_hit_cache_entry(u64 cache_key, RequestType);
+    void remove_files_in_background(Vector<u64> cache_keys);
 
     NonnullRefPtr<Database::Database> m_database;
 
     HashMap<FlatPtr, NonnullOwnPtr<CacheEntry>> m_open_cache_entries;
 
+    // Cache keys whose files are queued for removal on the background thread. New entries may not be created for these
+    // keys until their removal has completed.
+    HashTable<u64> m_pending_removals;
+
+    // Cache keys of entries which were created by a prefetch request, and have not yet been used by any other request.
+    HashTable<u64> m_prefetched_cache_keys;
+
     LexicalPath m_cache_directory;
     CacheIndex m_index;
+    MemoryCache m_memory_cache;
+
+    u64 m_maximum_size { DEFAULT_MAXIMUM_SIZE };
+    Statistics m_statistics;
 };
 
 }
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <RequestServer/Cache/MemoryCache.h>
+
+namespace RequestServer {
+
+NonnullRefPtr<MemoryCacheEntry> MemoryCacheEntry::create(u32 status_code, Optional<String> reason_phrase, HTTP::HeaderMap headers, ByteBuffer data, UnixDateTime request_time, UnixDateTime response_time)
+{
+    return adopt_ref(*new MemoryCacheEntry { status_code, move(reason_phrase), move(headers), move(data), request_time, response_time });
+}
+
+MemoryCacheEntry::MemoryCacheEntry(u32 status_code, Optional<String> reason_phrase, HTTP::HeaderMap headers, ByteBuffer data, UnixDateTime request_time, UnixDateTime response_time)
+    : m_status_code(status_code)
+    , m_reason_phrase(move(reason_phrase))
+    , m_headers(move(headers))
+    , m_data(move(data))
+    , m_request_time(request_time)
+    , m_response_time(response_time)
+    , m_last_index_update_time(UnixDateTime::now())
+{
+}
+
+size_t MemoryCacheEntry::memory_usage() const
+{
+    size_t usage = sizeof(*this) + m_data.size();
+
+    if (m_reason_phrase.has_value())
+        usage += m_reason_phrase->byte_count();
+    for (auto const& header : m_headers.headers())
+        usage += header.name.length() + header.value.length();
+
+    return usage;
+}
+
+MemoryCache::MemoryCache(size_t maximum_size)
+    : m_maximum_size(maximum_size)
+{
+}
+
+void MemoryCache::create_entry(u64 cache_key, NonnullRefPtr<MemoryCacheEntry> entry)
+{
+    remove_entry(cache_key);
+
+    auto memory_usage = entry->memory_usage();
+    if (memory_usage > m_maximum_size)
+        return;
+
+    m_entries.set(cache_key, move(entry));
+    m_size += memory_usage;
+
+    evict_entries_if_needed();
+}
+
+RefPtr<MemoryCacheEntry> MemoryCache::find_entry(u64 cache_key)
+{
+    auto entry = m_entries.take(cache_key);
+    if (!entry.has_value())
+        return {};
+
+    // Re-insert the entry to mark it as the most recently used entry.
+    m_entries.set(cache_key, *entry);
+    return entry.release_value();
+}
+
+void MemoryCache::remove_entry(u64 cache_key)
+{
+    if (auto entry = m_entries.take(cache_key); entry.has_value())
+        m_size -= (*entry)->memory_usage();
+}
+
+void MemoryCache::remove_all_entries()
+{
+    m_entries.clear();
+    m_size = 0;
+}
+
+void MemoryCache::evict_entries_if_needed()
+{
+    while (m_size > m_maximum_size && !m_entries.is_empty()) {
+        auto entry = m_entries.take_first();
+        m_size -= entry->memory_usage();
+    }
+}
+
+}
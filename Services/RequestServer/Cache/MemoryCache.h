@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/HashMap.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Optional.h>
+#include <AK/RefCounted.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <AK/Types.h>
+#include <LibHTTP/HeaderMap.h>
+
+namespace RequestServer {
+
+class MemoryCacheEntry : public RefCounted<MemoryCacheEntry> {
+public:
+    static NonnullRefPtr<MemoryCacheEntry> create(u32 status_code, Optional<String> reason_phrase, HTTP::HeaderMap headers, ByteBuffer data, UnixDateTime request_time, UnixDateTime response_time);
+
+    u32 status_code() const { return m_status_code; }
+    Optional<String> const& reason_phrase() const { return m_reason_phrase; }
+    HTTP::HeaderMap const& headers() const { return m_headers; }
+    ReadonlyBytes data() const { return m_data; }
+
+    UnixDateTime request_time() const { return m_request_time; }
+    UnixDateTime response_time() const { return m_response_time; }
+
+    // Memory cache hits do not update the index's last access time on every hit, to avoid writing to the database for
+    // every request of a hot resource. Instead, the index is updated at most once per this interval.
+    static constexpr auto INDEX_UPDATE_INTERVAL = AK::Duration::from_seconds(60);
+
+    bool should_update_index_access_time(UnixDateTime now) const { return now - m_last_index_update_time >= INDEX_UPDATE_INTERVAL; }
+    void did_update_index_access_time(UnixDateTime now) { m_last_index_update_time = now; }
+
+    size_t memory_usage() const;
+
+private:
+    MemoryCacheEntry(u32 status_code, Optional<String> reason_phrase, HTTP::HeaderMap headers, ByteBuffer data, UnixDateTime request_time, UnixDateTime response_time);
+
+    u32 m_status_code { 0 };
+    Optional<String> m_reason_phrase;
+    HTTP::HeaderMap m_headers;
+    ByteBuffer m_data;
+
+    UnixDateTime m_request_time;
+    UnixDateTime m_response_time;
+    UnixDateTime m_last_index_update_time;
+};
+
+// The memory cache is a small tier in front of the disk cache. It holds complete copies of small responses, so that hits
+// for frequently requested resources (favicons, small scripts and style sheets, etc.) are served without touching the
+// index database or the file system. Entries are written through to the memory cache once they have been successfully
+// written to disk, and the least recently used entries are evicted once the memory budget is exceeded.
+class MemoryCache {
+public:
+    static constexpr size_t DEFAULT_MAXIMUM_SIZE = 32 * MiB;
+    static constexpr size_t MAXIMUM_ENTRY_DATA_SIZE = 64 * KiB;
+
+    explicit MemoryCache(size_t maximum_size = DEFAULT_MAXIMUM_SIZE);
+
+    void create_entry(u64 cache_key, NonnullRefPtr<MemoryCacheEntry>);
+    RefPtr<MemoryCacheEntry> find_entry(u64 cache_key);
+    void remove_entry(u64 cache_key);
+    void remove_all_entries();
+
+    size_t size() const { return m_size; }
+    size_t maximum_size() const { return m_maximum_size; }
+
+private:
+    void evict_entries_if_needed();
+
+    // Entries are ordered from least to most recently used.
+    OrderedHashMap<u64, NonnullRefPtr<MemoryCacheEntry>> m_entries;
+
+    size_t m_size { 0 };
+    size_t m_maximum_size { DEFAULT_MAXIMUM_SIZE };
+};
+
+}
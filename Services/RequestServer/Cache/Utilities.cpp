@@ -70,6 +70,19 @@ u64 create_cache_key(StringView url, StringView method)
     return result;
 }
 
+LexicalPath path_for_cache_key(LexicalPath const& cache_directory, u64 cache_key)
+{
+    return cache_directory.append(MUST(String::formatted("{:016x}", cache_key)));
+}
+
+Optional<u64> cache_key_from_path(LexicalPath const& path)
+{
+    auto title = path.title();
+    if (title.length() != 16)
+        return {};
+    return title.to_number<u64>(TrimWhitespace::No, 16);
+}
+
 // https://httpwg.org/specs/rfc9111.html#response.cacheability
 bool is_cacheable(StringView method, u32 status_code, HTTP::HeaderMap const& headers)
 {
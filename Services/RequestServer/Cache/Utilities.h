@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/LexicalPath.h>
 #include <AK/StringView.h>
 #include <AK/Time.h>
 #include <AK/Types.h>
@@ -16,6 +17,8 @@ namespace RequestServer {
 
 String serialize_url_for_cache_storage(URL::URL const&);
 u64 create_cache_key(StringView url, StringView method);
+LexicalPath path_for_cache_key(LexicalPath const& cache_directory, u64 cache_key);
+Optional<u64> cache_key_from_path(LexicalPath const&);
 
 bool is_cacheable(StringView method, u32 status_code, HTTP::HeaderMap const&);
 bool is_header_exempted_from_storage(StringView name);
@@ -136,6 +136,7 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
     size_t bytes_transferred_to_client { 0 };
 
     Optional<CacheEntryWriter&> cache_entry;
+    DiskCache::RequestType cache_request_type { DiskCache::RequestType::Normal };
     UnixDateTime request_start_time;
 
     ActiveRequest(ConnectionFromClient& client, CURLM* multi, CURL* easy, i32 request_id, int writer_fd)
@@ -252,8 +253,14 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
         for (auto* string_list : curl_string_lists)
             curl_slist_free_all(string_list);
 
-        if (cache_entry.has_value())
-            (void)cache_entry->flush();
+        // A request which is destroyed before it is done fetching has been stopped by the client. Its response is
+        // incomplete, and must not be served from the cache.
+        if (cache_entry.has_value()) {
+            if (done_fetching)
+                (void)cache_entry->flush();
+            else
+                cache_entry->discard();
+        }
     }
 
     void flush_headers_if_needed()
@@ -268,7 +275,7 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
         client->async_headers_became_available(request_id, headers, *http_status_code, reason_phrase);
 
         if (g_disk_cache.has_value())
-            cache_entry = g_disk_cache->create_entry(url, method, *http_status_code, reason_phrase, headers, request_start_time);
+            cache_entry = g_disk_cache->create_entry(url, method, *http_status_code, reason_phrase, headers, request_start_time, cache_request_type);
     }
 
     long acquire_http_status_code() const
@@ -389,6 +396,14 @@ int ConnectionFromClient::on_timeout_callback(void*, long timeout_ms, void* user
 
 ConnectionFromClient::ConnectionFromClient(NonnullOwnPtr<IPC::Transport> transport)
     : IPC::ConnectionFromClient<RequestClientEndpoint, RequestServerEndpoint>(*this, move(transport), s_client_ids.allocate())
+    , m_request_scheduler([this](i32 request_id) {
+        auto request = m_active_requests.get(request_id);
+        if (!request.has_value())
+            return;
+
+        auto result = curl_multi_add_handle(m_curl_multi, (*request)->easy);
+        VERIFY(result == CURLM_OK);
+    })
     , m_resolver(default_resolver())
 {
     s_connections.set(client_id(), *this);
@@ -530,22 +545,24 @@ void ConnectionFromClient::set_use_system_dns()
 }
 
 #ifdef AK_OS_WINDOWS
-void ConnectionFromClient::start_request(i32, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData)
+void ConnectionFromClient::start_request(i32, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData, RequestPriority)
 {
     VERIFY(0 && "RequestServer::ConnectionFromClient::start_request is not implemented");
 }
 
-void ConnectionFromClient::issue_network_request(i32, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData, Optional<ResumeRequestForFailedCacheEntry>)
+void ConnectionFromClient::issue_network_request(i32, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData, RequestPriority, Optional<ResumeRequestForFailedCacheEntry>)
 {
     VERIFY(0 && "RequestServer::ConnectionFromClient::issue_network_request is not implemented");
 }
 #else
-void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL::URL url, HTTP::HeaderMap request_headers, ByteBuffer request_body, Core::ProxyData proxy_data)
+void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL::URL url, HTTP::HeaderMap request_headers, ByteBuffer request_body, Core::ProxyData proxy_data, RequestPriority priority)
 {
     dbgln_if(REQUESTSERVER_DEBUG, "RequestServer: start_request({}, {})", request_id, url);
 
     if (g_disk_cache.has_value()) {
-        if (auto cache_entry = g_disk_cache->open_entry(url, method); cache_entry.has_value()) {
+        auto request_type = DiskCache::request_type_from_headers(request_headers);
+
+        if (auto cache_entry = g_disk_cache->open_entry(url, method, request_type); cache_entry.has_value()) {
             auto fds = MUST(Core::System::pipe2(O_NONBLOCK));
             auto writer_fd = fds[1];
             auto reader_fd = fds[0];
@@ -560,24 +577,24 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
                     async_request_finished(request_id, bytes_sent, {}, {});
                     MUST(Core::System::close(writer_fd));
                 },
-                [this, request_id, writer_fd, method = move(method), url = move(url), request_headers = move(request_headers), request_body = move(request_body), proxy_data](auto bytes_sent) mutable {
+                [this, request_id, writer_fd, method = move(method), url = move(url), request_headers = move(request_headers), request_body = move(request_body), proxy_data, priority](auto bytes_sent) mutable {
                     // FIXME: We should really also have a way to validate the data once CacheEntry is storing its crc.
                     ResumeRequestForFailedCacheEntry resume_request {
                         .start_offset = bytes_sent,
                         .writer_fd = writer_fd,
                     };
 
-                    issue_network_request(request_id, move(method), move(url), move(request_headers), move(request_body), proxy_data, resume_request);
+                    issue_network_request(request_id, move(method), move(url), move(request_headers), move(request_body), proxy_data, priority, resume_request);
                 });
 
             return;
         }
     }
 
-    issue_network_request(request_id, move(method), move(url), move(request_headers), move(request_body), proxy_data);
+    issue_network_request(request_id, move(method), move(url), move(request_headers), move(request_body), proxy_data, priority);
 }
 
-void ConnectionFromClient::issue_network_request(i32 request_id, ByteString method, URL::URL url, HTTP::HeaderMap request_headers, ByteBuffer request_body, Core::ProxyData proxy_data, Optional<ResumeRequestForFailedCacheEntry> resume_request)
+void ConnectionFromClient::issue_network_request(i32 request_id, ByteString method, URL::URL url, HTTP::HeaderMap request_headers, ByteBuffer request_body, Core::ProxyData proxy_data, RequestPriority priority, Optional<ResumeRequestForFailedCacheEntry> resume_request)
 {
     auto host = url.serialized_host().to_byte_string();
 
@@ -590,7 +607,7 @@ void ConnectionFromClient::issue_network_request(i32 request_id, ByteString meth
             if (resume_request.has_value())
                 MUST(Core::System::close(resume_request->writer_fd));
         })
-        .when_resolved([this, request_id, host = move(host), url = move(url), method = move(method), request_body = move(request_body), request_headers = move(request_headers), proxy_data, resume_request](auto const& dns_result) mutable {
+        .when_resolved([this, request_id, host = move(host), url = move(url), method = move(method), request_body = move(request_body), request_headers = move(request_headers), proxy_data, priority, resume_request](auto const& dns_result) mutable {
             if (dns_result->is_empty() || !dns_result->has_cached_addresses()) {
                 dbgln("StartRequest: DNS lookup failed for '{}'", host);
                 // FIXME: Implement timing info for DNS lookup failure.
@@ -627,6 +644,7 @@ void ConnectionFromClient::issue_network_request(i32 request_id, ByteString meth
             auto request = make<ActiveRequest>(*this, m_curl_multi, easy, request_id, writer_fd);
             request->url = url;
             request->method = method;
+            request->cache_request_type = DiskCache::request_type_from_headers(request_headers);
 
             auto set_option = [easy](auto option, auto value) {
                 auto result = curl_easy_setopt(easy, option, value);
@@ -644,6 +662,7 @@ void ConnectionFromClient::issue_network_request(i32 request_id, ByteString meth
             set_option(CURLOPT_PORT, url.port_or_default());
             set_option(CURLOPT_CONNECTTIMEOUT, s_connect_timeout_seconds);
             set_option(CURLOPT_PIPEWAIT, 1L);
+            set_option(CURLOPT_STREAM_WEIGHT, RequestScheduler::http2_stream_weight(priority));
             set_option(CURLOPT_ALTSVC, m_alt_svc_cache_path.characters());
 
             set_option(CURLOPT_CUSTOMREQUEST, method.characters());
@@ -713,10 +732,9 @@ void ConnectionFromClient::issue_network_request(i32 request_id, ByteString meth
             } else
                 VERIFY_NOT_REACHED();
 
-            auto result = curl_multi_add_handle(m_curl_multi, easy);
-            VERIFY(result == CURLM_OK);
-
+            // The transfer is added to the curl multi handle once the scheduler allows it to begin.
             m_active_requests.set(request_id, move(request));
+            m_request_scheduler.schedule_transfer(request_id, move(host), priority);
         });
 }
 #endif
@@ -869,7 +887,10 @@ void ConnectionFromClient::check_active_requests()
             async_request_finished(request->request_id, request->downloaded_so_far, timing_info, network_error);
         }
 
+        auto request_id = request->request_id;
         request->notify_about_fetching_completion();
+
+        m_request_scheduler.transfer_finished(request_id);
     }
 }
 
@@ -881,9 +902,26 @@ Messages::RequestServer::StopRequestResponse ConnectionFromClient::stop_request(
         return false;
     }
 
+    m_request_scheduler.transfer_finished(request_id);
     return true;
 }
 
+void ConnectionFromClient::set_request_priority(i32 request_id, RequestPriority priority)
+{
+    // Requests which are served from the cache, or which are still waiting on DNS resolution, are not yet active.
+    auto request = m_active_requests.get(request_id);
+    if (!request.has_value())
+        return;
+
+    // Note: If the transfer is already in progress, curl sends the new weight to the server along with the next HTTP/2
+    //       frame of the stream.
+    auto result = curl_easy_setopt((*request)->easy, CURLOPT_STREAM_WEIGHT, RequestScheduler::http2_stream_weight(priority));
+    if (result != CURLE_OK)
+        dbgln("SetRequestPriority: Failed to set curl option: {}", curl_easy_strerror(result));
+
+    m_request_scheduler.set_priority(request_id, priority);
+}
+
 Messages::RequestServer::SetCertificateResponse ConnectionFromClient::set_certificate(i32 request_id, ByteString certificate, ByteString key)
 {
     (void)request_id;
@@ -11,6 +11,7 @@
 #include <LibIPC/ConnectionFromClient.h>
 #include <LibWebSocket/WebSocket.h>
 #include <RequestServer/RequestClientEndpoint.h>
+#include <RequestServer/RequestScheduler.h>
 #include <RequestServer/RequestServerEndpoint.h>
 
 namespace RequestServer {
@@ -44,8 +45,9 @@ private:
     virtual Messages::RequestServer::IsSupportedProtocolResponse is_supported_protocol(ByteString) override;
     virtual void set_dns_server(ByteString host_or_address, u16 port, bool use_tls, bool validate_dnssec_locally) override;
     virtual void set_use_system_dns() override;
-    virtual void start_request(i32 request_id, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData) override;
+    virtual void start_request(i32 request_id, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData, RequestPriority) override;
     virtual Messages::RequestServer::StopRequestResponse stop_request(i32) override;
+    virtual void set_request_priority(i32 request_id, RequestPriority) override;
     virtual Messages::RequestServer::SetCertificateResponse set_certificate(i32, ByteString, ByteString) override;
     virtual void ensure_connection(URL::URL url, ::RequestServer::CacheLevel cache_level) override;
 
@@ -60,7 +62,7 @@ private:
         size_t start_offset { 0 };
         int writer_fd { 0 };
     };
-    void issue_network_request(i32 request_id, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData, Optional<ResumeRequestForFailedCacheEntry> = {});
+    void issue_network_request(i32 request_id, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData, RequestPriority, Optional<ResumeRequestForFailedCacheEntry> = {});
 
     HashMap<i32, RefPtr<WebSocket::WebSocket>> m_websockets;
 
@@ -75,6 +77,7 @@ private:
     static size_t on_data_received(void* buffer, size_t size, size_t nmemb, void* user_data);
 
     HashMap<i32, NonnullOwnPtr<ActiveRequest>> m_active_requests;
+    RequestScheduler m_request_scheduler;
 
     void check_active_requests();
     void* m_curl_multi { nullptr };
@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Types.h>
+
+namespace RequestServer {
+
+// The priority of a request, relative to the other requests made by the same client.
+enum class RequestPriority : u8 {
+    Idle,   // Speculative loads, e.g. prefetches.
+    Low,    // Loads which do not block rendering, e.g. images and media.
+    Medium, // The default priority.
+    High,   // Loads which block rendering, e.g. documents, style sheets, and parser-blocking scripts.
+};
+
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/QuickSort.h>
+#include <AK/Vector.h>
+#include <RequestServer/RequestScheduler.h>
+
+namespace RequestServer {
+
+static constexpr bool is_delayable(RequestPriority priority)
+{
+    return priority <= RequestPriority::Low;
+}
+
+RequestScheduler::RequestScheduler(Function<void(i32 request_id)> start_transfer)
+    : m_start_transfer(move(start_transfer))
+{
+}
+
+void RequestScheduler::schedule_transfer(i32 request_id, ByteString host, RequestPriority priority)
+{
+    m_transfers.set(request_id, { .host = move(host), .priority = priority, .sequence_number = m_next_sequence_number++ });
+    start_queued_transfers();
+}
+
+void RequestScheduler::set_priority(i32 request_id, RequestPriority priority)
+{
+    auto transfer = m_transfers.get(request_id);
+    if (!transfer.has_value() || transfer->priority == priority)
+        return;
+
+    transfer->priority = priority;
+    start_queued_transfers();
+}
+
+void RequestScheduler::transfer_finished(i32 request_id)
+{
+    if (m_transfers.remove(request_id))
+        start_queued_transfers();
+}
+
+// https://httpwg.org/specs/rfc7540.html#StreamPriority
+long RequestScheduler::http2_stream_weight(RequestPriority priority)
+{
+    switch (priority) {
+    case RequestPriority::Idle:
+        return 1;
+    case RequestPriority::Low:
+        return 32;
+    case RequestPriority::Medium:
+        return 128;
+    case RequestPriority::High:
+        return 256;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+void RequestScheduler::start_queued_transfers()
+{
+    struct HostState {
+        size_t running_delayable_transfers { 0 };
+        bool has_running_high_priority_transfer { false };
+    };
+    HashMap<ByteString, HostState> hosts;
+
+    Vector<i32> queued_request_ids;
+
+    for (auto const& [request_id, transfer] : m_transfers) {
+        if (!transfer.is_running) {
+            queued_request_ids.append(request_id);
+            continue;
+        }
+
+        auto& host = hosts.ensure(transfer.host);
+        if (is_delayable(transfer.priority))
+            ++host.running_delayable_transfers;
+        else if (transfer.priority == RequestPriority::High)
+            host.has_running_high_priority_transfer = true;
+    }
+
+    if (queued_request_ids.is_empty())
+        return;
+
+    // Transfers are started in order of priority, and then in the order in which they were scheduled.
+    quick_sort(queued_request_ids, [&](i32 a, i32 b) {
+        auto const& transfer_a = *m_transfers.get(a);
+        auto const& transfer_b = *m_transfers.get(b);
+
+        if (transfer_a.priority != transfer_b.priority)
+            return transfer_a.priority > transfer_b.priority;
+        return transfer_a.sequence_number < transfer_b.sequence_number;
+    });
+
+    Vector<i32> request_ids_to_start;
+
+    for (auto request_id : queued_request_ids) {
+        auto& transfer = *m_transfers.get(request_id);
+        auto& host = hosts.ensure(transfer.host);
+
+        if (is_delayable(transfer.priority)) {
+            auto limit = host.has_running_high_priority_transfer ? MAXIMUM_DELAYABLE_TRANSFERS_PER_HOST_WHILE_BLOCKED : MAXIMUM_DELAYABLE_TRANSFERS_PER_HOST;
+            if (host.running_delayable_transfers >= limit)
+                continue;
+
+            ++host.running_delayable_transfers;
+        } else if (transfer.priority == RequestPriority::High) {
+            host.has_running_high_priority_transfer = true;
+        }
+
+        transfer.is_running = true;
+        request_ids_to_start.append(request_id);
+    }
+
+    for (auto request_id : request_ids_to_start)
+        m_start_transfer(request_id);
+}
+
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/Function.h>
+#include <AK/HashMap.h>
+#include <AK/Types.h>
+#include <RequestServer/RequestPriority.h>
+
+namespace RequestServer {
+
+// The request scheduler decides when the network transfer of each request may begin. Transfers of medium and high
+// priority are started immediately. Transfers of low and idle priority (e.g. images and prefetches) are limited per
+// host, so that a page with hundreds of images does not delay the style sheets and scripts which block rendering. This
+// limit is tightened further while a high priority transfer to the same host is in flight.
+class RequestScheduler {
+public:
+    static constexpr size_t MAXIMUM_DELAYABLE_TRANSFERS_PER_HOST = 6;
+    static constexpr size_t MAXIMUM_DELAYABLE_TRANSFERS_PER_HOST_WHILE_BLOCKED = 1;
+
+    explicit RequestScheduler(Function<void(i32 request_id)> start_transfer);
+
+    void schedule_transfer(i32 request_id, ByteString host, RequestPriority);
+    void set_priority(i32 request_id, RequestPriority);
+    void transfer_finished(i32 request_id);
+
+    static long http2_stream_weight(RequestPriority);
+
+private:
+    struct Transfer {
+        ByteString host;
+        RequestPriority priority { RequestPriority::Medium };
+        u64 sequence_number { 0 };
+        bool is_running { false };
+    };
+
+    void start_queued_transfers();
+
+    Function<void(i32 request_id)> m_start_transfer;
+
+    HashMap<i32, Transfer> m_transfers;
+    u64 m_next_sequence_number { 0 };
+};
+
+}
@@ -10,7 +10,9 @@
  */
 
 #include <AK/JsonObject.h>
+#include <AK/MemoryStream.h>
 #include <AK/QuickSort.h>
+#include <LibCore/AnonymousBuffer.h>
 #include <LibCore/EventLoop.h>
 #include <LibGC/Heap.h>
 #include <LibGfx/Bitmap.h>
@@ -377,6 +379,15 @@ void ConnectionFromClient::debug_request(u64 page_id, ByteString request, ByteSt
         return;
     }
 
+    if (request == "allocation-profiling") {
+        auto& heap = Web::Bindings::main_thread_vm().heap();
+        if (argument != "on")
+            (void)heap.stop_allocation_profiling();
+        else if (!heap.is_allocation_profiling())
+            heap.start_allocation_profiling();
+        return;
+    }
+
     if (request == "set-line-box-borders") {
         bool state = argument == "on";
         auto traversable = page->page().top_level_traversable();
@@ -1003,11 +1014,50 @@ static void append_gc_graph(StringBuilder& builder)
     gc_graph.serialize(builder);
 }
 
+static void append_heap_snapshot(StringBuilder& builder)
+{
+    AllocatingMemoryStream stream;
+    MUST(Web::Bindings::main_thread_vm().heap().write_heap_snapshot(stream));
+    auto buffer = MUST(stream.read_until_eof());
+    builder.append(StringView { buffer });
+}
+
+static void append_allocation_profile(StringBuilder& builder)
+{
+    auto const* profiler = Web::Bindings::main_thread_vm().heap().allocation_profiler();
+    if (!profiler) {
+        builder.append("(allocation profiling is not enabled)\n"sv);
+        return;
+    }
+
+    AllocatingMemoryStream stream;
+    MUST(profiler->write_report(stream));
+    auto buffer = MUST(stream.read_until_eof());
+    builder.append(StringView { buffer });
+}
+
+// NOTE: Heap snapshots and GC graphs of large pages easily exceed what fits into a single IPC message, so the info is
+//       sent in an anonymous buffer instead.
+static Core::AnonymousBuffer page_info_buffer(StringView info)
+{
+    if (info.is_empty())
+        return {};
+
+    auto buffer_or_error = Core::AnonymousBuffer::create_with_size(info.length());
+    if (buffer_or_error.is_error()) {
+        dbgln("Failed to allocate a buffer for {} bytes of page info: {}", info.length(), buffer_or_error.error());
+        return {};
+    }
+    auto buffer = buffer_or_error.release_value();
+    info.bytes().copy_to({ buffer.data<u8>(), buffer.size() });
+    return buffer;
+}
+
 void ConnectionFromClient::request_internal_page_info(u64 page_id, WebView::PageInfoType type)
 {
     auto page = this->page(page_id);
     if (!page.has_value()) {
-        async_did_get_internal_page_info(page_id, type, "(no page)"_string);
+        async_did_get_internal_page_info(page_id, type, page_info_buffer("(no page)"sv));
         return;
     }
 
@@ -1041,7 +1091,19 @@ void ConnectionFromClient::request_internal_page_info(u64 page_id, WebView::Page
         append_gc_graph(builder);
     }
 
-    async_did_get_internal_page_info(page_id, type, MUST(builder.to_string()));
+    if (has_flag(type, WebView::PageInfoType::HeapSnapshot)) {
+        if (!builder.is_empty())
+            builder.append("\n"sv);
+        append_heap_snapshot(builder);
+    }
+
+    if (has_flag(type, WebView::PageInfoType::AllocationProfile)) {
+        if (!builder.is_empty())
+            builder.append("\n"sv);
+        append_allocation_profile(builder);
+    }
+
+    async_did_get_internal_page_info(page_id, type, page_info_buffer(builder.string_view()));
 }
 
 Messages::WebContentServer::GetSelectedTextResponse ConnectionFromClient::get_selected_text(u64 page_id)
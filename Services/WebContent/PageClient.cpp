@@ -574,6 +574,21 @@ void PageClient::page_did_clear_storage(Web::StorageAPI::StorageEndpointType sto
     }
 }
 
+Optional<ByteBuffer> PageClient::page_did_request_wasm_module_cache_entry(ReadonlyBytes module_hash)
+{
+    auto response = client().send_sync_but_allow_failure<Messages::WebContentClient::DidRequestWasmModuleCacheEntry>(m_id, MUST(ByteBuffer::copy(module_hash)));
+    if (!response) {
+        dbgln("WebContent client disconnected during DidRequestWasmModuleCacheEntry. Exiting peacefully.");
+        exit(0);
+    }
+    return response->take_payload();
+}
+
+void PageClient::page_did_store_wasm_module_cache_entry(ReadonlyBytes module_hash, ReadonlyBytes payload)
+{
+    client().async_did_store_wasm_module_cache_entry(m_id, MUST(ByteBuffer::copy(module_hash)), MUST(ByteBuffer::copy(payload)));
+}
+
 void PageClient::page_did_update_resource_count(i32 count_waiting)
 {
     client().async_did_update_resource_count(m_id, count_waiting);
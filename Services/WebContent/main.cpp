@@ -30,6 +30,7 @@
 #include <LibWeb/Painting/PaintableBox.h>
 #include <LibWeb/Platform/AudioCodecPluginAgnostic.h>
 #include <LibWeb/Platform/EventLoopPluginSerenity.h>
+#include <LibWeb/WebAssembly/WebAssembly.h>
 #include <LibWeb/WebIDL/Tracing.h>
 #include <LibWebView/Plugins/FontPlugin.h>
 #include <LibWebView/Plugins/ImageCodecPlugin.h>
@@ -102,9 +103,11 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     bool disable_site_isolation = false;
     bool enable_idl_tracing = false;
     bool enable_http_cache = false;
+    bool enable_wasm_module_cache = false;
     bool force_cpu_painting = false;
     bool force_fontconfig = false;
     bool collect_garbage_on_every_allocation = false;
+    size_t gc_marking_helper_threads = 0;
     bool is_headless = false;
     bool disable_scrollbar_painting = false;
     StringView echo_server_port_string_view {};
@@ -125,9 +128,11 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.add_option(disable_site_isolation, "Disable site isolation", "disable-site-isolation");
     args_parser.add_option(enable_idl_tracing, "Enable IDL tracing", "enable-idl-tracing");
     args_parser.add_option(enable_http_cache, "Enable HTTP cache", "enable-http-cache");
+    args_parser.add_option(enable_wasm_module_cache, "Enable WebAssembly module disk cache", "enable-wasm-module-cache");
     args_parser.add_option(force_cpu_painting, "Force CPU painting", "force-cpu-painting");
     args_parser.add_option(force_fontconfig, "Force using fontconfig for font loading", "force-fontconfig");
     args_parser.add_option(collect_garbage_on_every_allocation, "Collect garbage after every JS heap allocation", "collect-garbage-on-every-allocation");
+    args_parser.add_option(gc_marking_helper_threads, "Number of helper threads that mark the JS heap in parallel", "gc-marking-helper-threads", 0, "count");
     args_parser.add_option(disable_scrollbar_painting, "Don't paint horizontal or vertical viewport scrollbars", "disable-scrollbar-painting");
     args_parser.add_option(echo_server_port_string_view, "Echo server port used in test internals", "echo-server-port", 0, "echo_server_port");
     args_parser.add_option(is_headless, "Report that the browser is running in headless mode", "headless");
@@ -172,6 +177,9 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
         Web::Fetch::Fetching::set_http_cache_enabled(true);
     }
 
+    if (enable_wasm_module_cache)
+        Web::WebAssembly::enable_module_cache();
+
     Web::Painting::set_paint_viewport_scrollbars(!disable_scrollbar_painting);
 
     if (!echo_server_port_string_view.is_empty()) {
@@ -203,6 +211,8 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
 
     if (collect_garbage_on_every_allocation)
         Web::Bindings::main_thread_vm().heap().set_should_collect_on_every_allocation(true);
+    if (gc_marking_helper_threads > 0)
+        Web::Bindings::main_thread_vm().heap().set_marking_helper_thread_count(gc_marking_helper_threads);
 
     TRY(initialize_resource_loader(Web::Bindings::main_thread_vm().heap(), request_server_socket));
 
@@ -63,6 +63,41 @@ TEST_CASE(zero_fill_new_elements_on_growth)
     EXPECT_EQ(buffer.span(), (Array<u8, 10> { 2, 2, 2, 2, 2, 2, 2, 2, 0, 0 }));
 }
 
+TEST_CASE(unowned_storage)
+{
+    Array<u8, 64> storage {};
+    storage.fill(7);
+
+    auto buffer = ByteBuffer::create_unowned(storage.span());
+    EXPECT(buffer.is_empty());
+    EXPECT(!buffer.is_inline());
+    EXPECT_EQ(buffer.capacity(), 64u);
+
+    buffer.append("abc"sv.bytes());
+    EXPECT_EQ(buffer.data(), storage.data());
+    EXPECT_EQ(storage[0], 'a');
+    EXPECT_EQ(storage[3], 7);
+
+    // Shrinking doesn't move the data into the inline buffer, and growing past the storage fails instead of reallocating.
+    buffer.trim(1, false);
+    EXPECT_EQ(buffer.data(), storage.data());
+    EXPECT(buffer.try_resize(65).is_error());
+    EXPECT_EQ(buffer.data(), storage.data());
+
+    auto moved = move(buffer);
+    EXPECT_EQ(moved.data(), storage.data());
+    EXPECT(buffer.is_inline());
+
+    // Copies own their data.
+    auto copy = moved;
+    EXPECT_NE(copy.data(), storage.data());
+    EXPECT_EQ(copy.bytes(), moved.bytes());
+
+    moved.clear();
+    EXPECT(moved.is_inline());
+    EXPECT_EQ(storage[0], 'a');
+}
+
 BENCHMARK_CASE(append)
 {
     ByteBuffer bb;
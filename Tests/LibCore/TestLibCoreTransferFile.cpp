@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ByteBuffer.h>
+#include <AK/Time.h>
+#include <LibCore/ElapsedTimer.h>
+#include <LibCore/System.h>
+#include <LibTest/TestCase.h>
+#include <fcntl.h>
+#include <sys/resource.h>
+
+struct TransferResult {
+    size_t bytes_transferred { 0 };
+    u32 checksum { 0 };
+};
+
+static int create_file_with_contents(size_t size)
+{
+    char pattern[] = "/tmp/TestLibCoreTransferFile.XXXXXX";
+    auto fd = MUST(Core::System::mkstemp(pattern));
+    MUST(Core::System::unlink({ pattern, sizeof(pattern) - 1 }));
+
+    auto buffer = MUST(ByteBuffer::create_uninitialized(64 * KiB));
+    for (size_t i = 0; i < buffer.size(); ++i)
+        buffer[i] = static_cast<u8>(i * 31);
+
+    for (size_t written = 0; written < size;) {
+        auto chunk = buffer.bytes().trim(size - written);
+        written += MUST(Core::System::write(fd, chunk));
+    }
+
+    return fd;
+}
+
+static u32 checksum_bytes(u32 checksum, ReadonlyBytes bytes)
+{
+    for (auto byte : bytes)
+        checksum = (checksum * 33) ^ byte;
+    return checksum;
+}
+
+// Transfers the given range of the file through a non-blocking pipe, draining the pipe on the same thread in the same
+// manner that RequestServer's client would.
+static TransferResult transfer_file(int source_fd, size_t offset, size_t length)
+{
+    auto fds = MUST(Core::System::pipe2(O_NONBLOCK));
+    auto buffer = MUST(ByteBuffer::create_uninitialized(64 * KiB));
+
+    TransferResult result;
+
+    while (result.bytes_transferred < length) {
+        auto transferred = Core::System::transfer_file_through_pipe(source_fd, fds[1], offset + result.bytes_transferred, length - result.bytes_transferred);
+
+        if (transferred.is_error()) {
+            if (transferred.error().code() != EAGAIN && transferred.error().code() != EWOULDBLOCK) {
+                FAIL(transferred.release_error());
+                break;
+            }
+        } else {
+            result.bytes_transferred += transferred.value();
+        }
+
+        while (true) {
+            auto bytes_read = Core::System::read(fds[0], buffer);
+            if (bytes_read.is_error() || bytes_read.value() == 0)
+                break;
+
+            result.checksum = checksum_bytes(result.checksum, buffer.bytes().trim(bytes_read.value()));
+        }
+    }
+
+    MUST(Core::System::close(fds[0]));
+    MUST(Core::System::close(fds[1]));
+
+    return result;
+}
+
+static AK::Duration cpu_time()
+{
+    rusage usage {};
+    getrusage(RUSAGE_SELF, &usage);
+
+    return AK::Duration::from_timeval(usage.ru_utime) + AK::Duration::from_timeval(usage.ru_stime);
+}
+
+TEST_CASE(transfer_file_through_pipe)
+{
+    static constexpr size_t file_size = 1 * MiB + 123;
+    auto fd = create_file_with_contents(file_size);
+
+    auto contents = TRY_OR_FAIL(ByteBuffer::create_uninitialized(file_size));
+    TRY_OR_FAIL(Core::System::lseek(fd, 0, SEEK_SET));
+    for (size_t offset = 0; offset < file_size;)
+        offset += TRY_OR_FAIL(Core::System::read(fd, contents.bytes().slice(offset)));
+
+    auto test_range = [&](size_t offset, size_t length) {
+        auto result = transfer_file(fd, offset, length);
+        EXPECT_EQ(result.bytes_transferred, length);
+        EXPECT_EQ(result.checksum, checksum_bytes(0, contents.bytes().slice(offset, length)));
+    };
+
+    test_range(0, file_size);
+    test_range(17, file_size - 17);
+    test_range(PAGE_SIZE + 1, 1000);
+    test_range(file_size, 0);
+
+    TRY_OR_FAIL(Core::System::close(fd));
+}
+
+BENCHMARK_CASE(transfer_100_mib_file_through_pipe)
+{
+    static constexpr size_t file_size = 100 * MiB;
+    auto fd = create_file_with_contents(file_size);
+
+    auto cpu_time_before = cpu_time();
+    auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+
+    auto result = transfer_file(fd, 0, file_size);
+    EXPECT_EQ(result.bytes_transferred, file_size);
+
+    auto elapsed = timer.elapsed_time();
+    auto cpu_time_used = cpu_time() - cpu_time_before;
+
+    auto megabytes_per_second = static_cast<double>(file_size) / static_cast<double>(MiB) / (static_cast<double>(elapsed.to_microseconds()) / 1'000'000.0);
+    outln("Transferred {} MiB in {}ms ({:.1} MiB/s), CPU time {}ms", file_size / MiB, elapsed.to_milliseconds(), megabytes_per_second, cpu_time_used.to_milliseconds());
+
+    TRY_OR_FAIL(Core::System::close(fd));
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibTest/TestCase.h>
+
+#include <AK/Format.h>
+#include <AK/QuickSort.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibGC/Heap.h>
+
+// Counts how many cells of its kind have been destroyed, which tells a test what a collection freed.
+class CountedCell final : public GC::Cell {
+    GC_CELL(CountedCell, GC::Cell);
+
+public:
+    static inline size_t s_destroyed_count { 0 };
+
+    virtual ~CountedCell() override { ++s_destroyed_count; }
+
+private:
+    CountedCell() = default;
+};
+
+// NOTE: Tests create their garbage in NEVER_INLINE functions like this one, so that pointers to the new cells don't
+//       linger in the test's own stack frame, where conservative stack scanning would keep them alive.
+NEVER_INLINE static inline void allocate_garbage(GC::Heap& heap, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+        (void)heap.allocate<CountedCell>();
+}
+
+// Collects the pause times of a benchmark, and prints their distribution.
+class PauseTimes {
+public:
+    template<typename Callback>
+    void measure(Callback callback)
+    {
+        auto start = MonotonicTime::now();
+        callback();
+        m_pause_times_in_microseconds.append((MonotonicTime::now() - start).to_microseconds());
+    }
+
+    void print(StringView description)
+    {
+        VERIFY(!m_pause_times_in_microseconds.is_empty());
+        quick_sort(m_pause_times_in_microseconds);
+        auto percentile = [&](size_t percent) {
+            return m_pause_times_in_microseconds[(m_pause_times_in_microseconds.size() - 1) * percent / 100];
+        };
+        outln("{}: p50={}us p90={}us p99={}us max={}us", description,
+            percentile(50), percentile(90), percentile(99), m_pause_times_in_microseconds.last());
+    }
+
+private:
+    Vector<i64> m_pause_times_in_microseconds;
+};
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include "TestGCCommon.h"
+
+#include <LibGC/Root.h>
+
+namespace {
+
+class ParentCell : public GC::Cell {
+    GC_CELL(ParentCell, GC::Cell);
+
+public:
+    GC::Ptr<GC::Cell> child() const { return m_child; }
+
+    // NOTE: This doesn't use a write barrier, which minor collections have to cope with.
+    void set_child(GC::Ptr<GC::Cell> child) { m_child = child; }
+
+protected:
+    ParentCell() = default;
+
+    virtual void visit_edges(Visitor& visitor) override
+    {
+        Base::visit_edges(visitor);
+        visitor.visit(m_child);
+    }
+
+    GC::Ptr<GC::Cell> m_child;
+};
+
+class ParentCellWithWriteBarriers final : public ParentCell {
+    GC_CELL(ParentCellWithWriteBarriers, ParentCell);
+    GC_DECLARE_WRITE_BARRIERS(ParentCellWithWriteBarriers);
+
+public:
+    void set_child(GC::Ptr<GC::Cell> child)
+    {
+        m_child = child;
+        write_barrier();
+    }
+
+private:
+    ParentCellWithWriteBarriers() = default;
+};
+
+class ParentCellWithoutWriteBarriers final : public ParentCell {
+    GC_CELL(ParentCellWithoutWriteBarriers, ParentCell);
+
+private:
+    ParentCellWithoutWriteBarriers() = default;
+};
+
+template<typename Parent>
+NEVER_INLINE void give_new_child(GC::Heap& heap, Parent& parent)
+{
+    parent.set_child(heap.allocate<CountedCell>());
+}
+
+NEVER_INLINE bool child_is_marked(ParentCell const& parent)
+{
+    return parent.child()->is_marked();
+}
+
+constexpr auto collect_young_generation = GC::Heap::CollectionType::CollectYoungGeneration;
+constexpr auto collect_garbage = GC::Heap::CollectionType::CollectGarbage;
+
+}
+
+TEST_CASE(minor_collection_keeps_cells_stored_with_a_write_barrier)
+{
+    GC::Heap heap(nullptr, [](auto&) { });
+    CountedCell::s_destroyed_count = 0;
+
+    auto parent = GC::make_root(heap.allocate<ParentCellWithWriteBarriers>());
+    heap.collect_garbage(collect_young_generation);
+    EXPECT(parent->is_marked());
+    EXPECT(!parent->is_remembered());
+
+    give_new_child(heap, *parent);
+    EXPECT(parent->is_remembered());
+    heap.collect_garbage(collect_young_generation);
+    EXPECT_EQ(CountedCell::s_destroyed_count, 0u);
+    EXPECT(parent->child());
+}
+
+TEST_CASE(old_cells_pointing_to_cells_without_write_barriers_stay_remembered)
+{
+    GC::Heap heap(nullptr, [](auto&) { });
+    CountedCell::s_destroyed_count = 0;
+
+    auto parent = GC::make_root(heap.allocate<ParentCellWithWriteBarriers>());
+    heap.collect_garbage(collect_young_generation);
+    give_new_child(heap, *parent);
+
+    // The child doesn't have write barriers, so it never becomes old, and every minor collection has to find it again.
+    for (size_t i = 0; i < 3; ++i) {
+        heap.collect_garbage(collect_young_generation);
+        EXPECT(parent->is_remembered());
+        EXPECT(!child_is_marked(*parent));
+        EXPECT_EQ(CountedCell::s_destroyed_count, 0u);
+    }
+
+    // Which also means that a minor collection can free it.
+    parent->set_child(nullptr);
+    heap.collect_garbage(collect_young_generation);
+    EXPECT_EQ(CountedCell::s_destroyed_count, 1u);
+    EXPECT(!parent->is_remembered());
+}
+
+TEST_CASE(cells_without_write_barriers_never_become_old)
+{
+    GC::Heap heap(nullptr, [](auto&) { });
+    CountedCell::s_destroyed_count = 0;
+
+    auto parent = GC::make_root(heap.allocate<ParentCellWithoutWriteBarriers>());
+    heap.collect_garbage(collect_young_generation);
+    EXPECT(!parent->is_marked());
+
+    give_new_child(heap, *parent);
+    heap.collect_garbage(collect_young_generation);
+    EXPECT_EQ(CountedCell::s_destroyed_count, 0u);
+
+    parent->set_child(nullptr);
+    heap.collect_garbage(collect_young_generation);
+    EXPECT_EQ(CountedCell::s_destroyed_count, 1u);
+}
+
+TEST_CASE(minor_collection_frees_unreachable_young_cells)
+{
+    GC::Heap heap(nullptr, [](auto&) { });
+    CountedCell::s_destroyed_count = 0;
+
+    allocate_garbage(heap, 1000);
+    heap.collect_garbage(collect_young_generation);
+
+    // Conservative stack scanning may find a few stale pointers, but nothing else refers to these cells.
+    EXPECT(CountedCell::s_destroyed_count > 900);
+}
+
+BENCHMARK_CASE(pause_times_of_minor_and_full_collections)
+{
+    static constexpr size_t old_cell_count = 200'000;
+    static constexpr size_t young_cells_per_cycle = 50'000;
+    static constexpr size_t cycle_count = 50;
+
+    for (auto collection_type : { collect_young_generation, collect_garbage }) {
+        GC::Heap heap(nullptr, [](auto&) { });
+
+        // A large, long-lived object graph, like the DOM and the JS objects of a loaded page.
+        auto list_head = GC::make_root(heap.allocate<ParentCellWithWriteBarriers>());
+        GC::Ptr<ParentCellWithWriteBarriers> list_tail = list_head.ptr();
+        for (size_t i = 0; i < old_cell_count; ++i) {
+            auto cell = heap.allocate<ParentCellWithWriteBarriers>();
+            list_tail->set_child(cell);
+            list_tail = cell;
+        }
+        heap.collect_garbage(collect_garbage);
+
+        PauseTimes pause_times;
+        for (size_t cycle = 0; cycle < cycle_count; ++cycle) {
+            allocate_garbage(heap, young_cells_per_cycle);
+            // Every cycle, one old cell starts referring to a young one.
+            give_new_child(heap, *list_tail);
+
+            pause_times.measure([&] { heap.collect_garbage(collection_type); });
+        }
+        pause_times.print(collection_type == collect_young_generation ? "Minor collections"sv : "Full collections"sv);
+    }
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/MemoryStream.h>
+#include <LibGC/Heap.h>
+#include <LibGC/Root.h>
+#include <LibTest/TestCase.h>
+
+namespace {
+
+class LeafCell final : public GC::Cell {
+    GC_CELL(LeafCell, GC::Cell);
+
+private:
+    LeafCell() = default;
+};
+
+class ParentCell final : public GC::Cell {
+    GC_CELL(ParentCell, GC::Cell);
+
+public:
+    void set_child(GC::Ptr<GC::Cell> child) { m_child = child; }
+
+private:
+    ParentCell() = default;
+
+    virtual void visit_edges(Visitor& visitor) override
+    {
+        Base::visit_edges(visitor);
+        visitor.visit(m_child);
+    }
+
+    GC::Ptr<GC::Cell> m_child;
+};
+
+ByteString write_snapshot(GC::Heap& heap)
+{
+    AllocatingMemoryStream stream;
+    MUST(heap.write_heap_snapshot(stream));
+    auto buffer = MUST(stream.read_until_eof());
+    return ByteString { buffer.bytes() };
+}
+
+}
+
+TEST_CASE(snapshot_contains_cells_edges_and_roots)
+{
+    GC::Heap heap(nullptr, [](auto&) { });
+
+    auto parent = heap.allocate<ParentCell>();
+    auto leaf = heap.allocate<LeafCell>();
+    parent->set_child(leaf);
+    auto root = GC::make_root(parent);
+
+    auto lines = write_snapshot(heap).split('\n');
+    EXPECT_EQ(lines.first(), "heap-snapshot 1"sv);
+
+    auto parent_address = ByteString::formatted("{:x}", bit_cast<FlatPtr>(parent.ptr()));
+    auto leaf_address = ByteString::formatted("{:x}", bit_cast<FlatPtr>(leaf.ptr()));
+
+    HashMap<ByteString, ByteString> class_names;
+    Optional<ByteString> parent_line;
+    bool parent_is_rooted = false;
+    for (auto const& line : lines) {
+        auto parts = line.split(' ');
+        if (parts[0] == "class"sv)
+            class_names.set(parts[1], parts[2]);
+        else if (parts[0] == "root"sv && parts[1] == parent_address)
+            parent_is_rooted = true;
+        else if (parts[0] == "cell"sv && parts[1] == parent_address)
+            parent_line = line;
+    }
+
+    EXPECT(parent_is_rooted);
+    VERIFY(parent_line.has_value());
+    auto parts = parent_line->split(' ');
+    EXPECT_EQ(class_names.get(parts[2]), "ParentCell"sv);
+    EXPECT(parts[3].to_number<size_t>().value() >= sizeof(ParentCell));
+    EXPECT(parts.contains_slow(leaf_address));
+}
+
+TEST_CASE(allocation_profiler_attributes_samples_to_the_reported_stack)
+{
+    GC::Heap heap(nullptr, [](auto&) { });
+    String stack;
+    heap.set_allocation_stack_provider([&] { return stack; });
+
+    heap.start_allocation_profiling(1);
+    stack = "    at leaves\n"_string;
+    for (size_t i = 0; i < 30; ++i)
+        (void)heap.allocate<LeafCell>();
+    stack = "    at parents\n"_string;
+    for (size_t i = 0; i < 10; ++i)
+        (void)heap.allocate<ParentCell>();
+    auto profiler = heap.stop_allocation_profiling();
+
+    EXPECT(!heap.is_allocation_profiling());
+    EXPECT_EQ(profiler->sample_count(), 40u);
+
+    auto sites = profiler->allocation_sites();
+    EXPECT_EQ(sites.size(), 2u);
+    EXPECT_EQ(sites[0].class_name, "LeafCell"sv);
+    EXPECT_EQ(sites[0].stack, "    at leaves\n"sv);
+    EXPECT_EQ(sites[0].sample_count, 30u);
+    EXPECT_EQ(sites[1].class_name, "ParentCell"sv);
+    EXPECT_EQ(sites[1].sample_count, 10u);
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include "TestGCCommon.h"
+
+#include <LibGC/Root.h>
+
+TEST_CASE(explicit_collection_sweeps_every_dead_cell)
+{
+    GC::Heap heap(nullptr, [](auto&) { });
+    CountedCell::s_destroyed_count = 0;
+
+    allocate_garbage(heap, 1000);
+    heap.collect_garbage();
+    EXPECT(CountedCell::s_destroyed_count > 900);
+}
+
+TEST_CASE(allocation_sweeps_only_as_many_blocks_as_it_needs)
+{
+    GC::Heap heap(nullptr, [](auto&) { });
+    allocate_garbage(heap, 1000);
+    CountedCell::s_destroyed_count = 0;
+
+    // This collection is triggered by the allocation, and leaves the garbage to be swept on demand. The allocation
+    // itself only needs one block to be swept.
+    heap.set_should_collect_on_every_allocation(true);
+    auto cell = GC::make_root(heap.allocate<CountedCell>());
+    heap.set_should_collect_on_every_allocation(false);
+    EXPECT(CountedCell::s_destroyed_count > 0);
+    EXPECT(CountedCell::s_destroyed_count < 500);
+
+    heap.finish_sweeping();
+    EXPECT(CountedCell::s_destroyed_count > 900);
+}
+
+TEST_CASE(next_collection_sweeps_what_allocation_left_behind)
+{
+    GC::Heap heap(nullptr, [](auto&) { });
+    allocate_garbage(heap, 1000);
+    CountedCell::s_destroyed_count = 0;
+
+    heap.set_should_collect_on_every_allocation(true);
+    auto cell = GC::make_root(heap.allocate<CountedCell>());
+    heap.set_should_collect_on_every_allocation(false);
+
+    heap.collect_garbage();
+    EXPECT(CountedCell::s_destroyed_count > 900);
+    EXPECT_EQ(cell->state(), GC::Cell::State::Live);
+}
+
+BENCHMARK_CASE(pause_times_of_eager_and_lazy_sweeping)
+{
+    static constexpr size_t garbage_per_cycle = 200'000;
+    static constexpr size_t cycle_count = 20;
+
+    for (bool lazy_sweeping : { false, true }) {
+        GC::Heap heap(nullptr, [](auto&) { });
+        heap.set_lazy_sweeping_enabled(lazy_sweeping);
+
+        PauseTimes pause_times;
+        for (size_t cycle = 0; cycle < cycle_count; ++cycle) {
+            allocate_garbage(heap, garbage_per_cycle);
+
+            // Only the collection that the next allocation triggers is timed, including the sweeping it has to do.
+            heap.set_should_collect_on_every_allocation(true);
+            pause_times.measure([&] { (void)heap.allocate<CountedCell>(); });
+            heap.set_should_collect_on_every_allocation(false);
+        }
+        pause_times.print(lazy_sweeping ? "Lazy sweeping"sv : "Eager sweeping"sv);
+    }
+}
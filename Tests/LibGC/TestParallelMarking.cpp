@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include "TestGCCommon.h"
+
+#include <LibGC/Root.h>
+
+namespace {
+
+// A node of a complete tree, which gives the markers plenty of work to share.
+class TreeNode final : public GC::Cell {
+    GC_CELL(TreeNode, GC::Cell);
+
+public:
+    static constexpr size_t fan_out = 4;
+
+    static inline Atomic<size_t> s_destroyed_count { 0 };
+
+    virtual ~TreeNode() override { ++s_destroyed_count; }
+
+    static GC::Ref<TreeNode> create_tree(GC::Heap& heap, size_t depth)
+    {
+        auto node = heap.allocate<TreeNode>();
+        if (depth > 0) {
+            for (auto& child : node->m_children)
+                child = create_tree(heap, depth - 1);
+        }
+        return node;
+    }
+
+    static constexpr size_t node_count(size_t depth)
+    {
+        size_t count = 1;
+        size_t level_size = 1;
+        for (size_t i = 0; i < depth; ++i) {
+            level_size *= fan_out;
+            count += level_size;
+        }
+        return count;
+    }
+
+private:
+    TreeNode() = default;
+
+    virtual void visit_edges(Visitor& visitor) override
+    {
+        Base::visit_edges(visitor);
+        for (auto& child : m_children)
+            visitor.visit(child);
+    }
+
+    AK::Array<GC::Ptr<TreeNode>, fan_out> m_children;
+};
+
+NEVER_INLINE void allocate_garbage_tree(GC::Heap& heap, size_t depth)
+{
+    (void)TreeNode::create_tree(heap, depth);
+}
+
+}
+
+TEST_CASE(parallel_marking_keeps_every_reachable_cell)
+{
+    static constexpr size_t depth = 7;
+
+    GC::Heap heap(nullptr, [](auto&) { });
+    heap.set_marking_helper_thread_count(3);
+    EXPECT_EQ(heap.marking_helper_thread_count(), 3u);
+
+    auto tree = GC::make_root(TreeNode::create_tree(heap, depth));
+    heap.collect_garbage();
+    TreeNode::s_destroyed_count = 0;
+
+    allocate_garbage_tree(heap, depth);
+    for (size_t i = 0; i < 5; ++i)
+        heap.collect_garbage();
+
+    // Every node of the garbage tree is collected (save for a few that the conservative stack scan may find), while
+    // every node of the rooted tree survives.
+    EXPECT(TreeNode::s_destroyed_count > TreeNode::node_count(depth) - 10);
+    EXPECT(TreeNode::s_destroyed_count <= TreeNode::node_count(depth));
+}
+
+BENCHMARK_CASE(pause_times_of_single_threaded_and_parallel_marking)
+{
+    static constexpr size_t depth = 9;
+    static constexpr size_t collection_count = 20;
+
+    for (size_t helper_thread_count : { 0, 3 }) {
+        GC::Heap heap(nullptr, [](auto&) { });
+        heap.set_marking_helper_thread_count(helper_thread_count);
+        auto tree = GC::make_root(TreeNode::create_tree(heap, depth));
+
+        PauseTimes pause_times;
+        for (size_t i = 0; i < collection_count; ++i)
+            pause_times.measure([&] { heap.collect_garbage(); });
+        pause_times.print(ByteString::formatted("{} marking thread(s)", helper_thread_count + 1));
+    }
+}
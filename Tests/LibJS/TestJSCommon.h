@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibTest/TestCase.h>
+
+#include <AK/ByteString.h>
+#include <AK/String.h>
+#include <AK/StringBuilder.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Runtime/ValueInlines.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Script.h>
+
+static inline JS::Value run_script(JS::Realm& realm, StringView source)
+{
+    auto script = MUST(JS::Script::parse(source, realm, "test.js"sv));
+    return MUST(realm.vm().bytecode_interpreter().run(*script));
+}
+
+// Benchmark sources spell their loop bound as ITERATION_COUNT, so that tests can run them with fewer iterations.
+static inline ByteString with_iteration_count(StringView source, size_t iteration_count)
+{
+    return source.replace("ITERATION_COUNT"sv, ByteString::number(iteration_count), ReplaceMode::FirstOnly);
+}
+
+// A JSON array of flat records, like the responses of a typical web API. The strings contain escape sequences.
+static inline String records_payload(size_t record_count)
+{
+    StringBuilder builder;
+    builder.append('[');
+    for (size_t i = 0; i < record_count; ++i) {
+        if (i != 0)
+            builder.append(',');
+        builder.appendff(R"({{"id":{},"name":"record \"{}\"","score":{}.5,"active":{},"tags":["a","b\n"],"parent":null}})",
+            i, i, i % 1000, i % 2 == 0 ? "true"sv : "false"sv);
+    }
+    builder.append(']');
+    return builder.to_string_without_validation();
+}
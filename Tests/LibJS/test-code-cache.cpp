@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include "TestJSCommon.h"
+
+#include <LibJS/CodeCache.h>
+#include <LibJS/Runtime/GlobalObject.h>
+
+// Pads the given source with a trailing comment, such that it is large enough to be cached.
+static ByteString cacheable_source(StringView source)
+{
+    return ByteString::formatted("{}\n//{}", source, ByteString::repeated('x', JS::CodeCache::MINIMUM_SOURCE_LENGTH));
+}
+
+TEST_CASE(reuses_program_of_identical_source)
+{
+    auto vm = JS::VM::create();
+    auto execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *execution_context->realm;
+
+    auto source = cacheable_source("1 + 2;"sv);
+
+    auto first = MUST(JS::Script::parse(source, realm, "test.js"sv));
+    auto second = MUST(JS::Script::parse(source, realm, "test.js"sv));
+    EXPECT_EQ(&first->parse_node(), &second->parse_node());
+
+    // Sources from a different file, or at a different line offset, produce different source positions.
+    auto other_file = MUST(JS::Script::parse(source, realm, "other.js"sv));
+    EXPECT_NE(&first->parse_node(), &other_file->parse_node());
+
+    auto other_line = MUST(JS::Script::parse(source, realm, "test.js"sv, nullptr, 10));
+    EXPECT_NE(&first->parse_node(), &other_line->parse_node());
+
+    EXPECT_EQ(vm->code_cache().statistics().hits, 1u);
+}
+
+TEST_CASE(does_not_cache_small_or_invalid_sources)
+{
+    auto vm = JS::VM::create();
+    auto execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *execution_context->realm;
+
+    auto first = MUST(JS::Script::parse("1 + 2;"sv, realm));
+    auto second = MUST(JS::Script::parse("1 + 2;"sv, realm));
+    EXPECT_NE(&first->parse_node(), &second->parse_node());
+
+    auto invalid_source = cacheable_source("1 +;"sv);
+    EXPECT(JS::Script::parse(invalid_source, realm).is_error());
+    EXPECT(JS::Script::parse(invalid_source, realm).is_error());
+
+    EXPECT_EQ(vm->code_cache().size(), 0u);
+}
+
+TEST_CASE(evicts_least_recently_used_programs)
+{
+    auto vm = JS::VM::create();
+    auto execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *execution_context->realm;
+
+    auto source1 = cacheable_source("1;"sv);
+    auto source2 = cacheable_source("2;"sv);
+    auto source3 = cacheable_source("3;"sv);
+
+    // The budget covers the retained ASTs and executables of two programs, not just their sources.
+    JS::CodeCache code_cache { 2 * JS::CodeCache::estimated_size_of(source1.length()) + 100 };
+
+    auto add = [&](StringView source) {
+        auto script = MUST(JS::Script::parse(source, realm));
+        code_cache.add(source, {}, JS::Program::Type::Script, 1, const_cast<JS::Program&>(script->parse_node()));
+    };
+
+    add(source1);
+    add(source2);
+    EXPECT(code_cache.find(source1, {}, JS::Program::Type::Script, 1));
+
+    add(source3);
+    EXPECT(code_cache.find(source1, {}, JS::Program::Type::Script, 1));
+    EXPECT(!code_cache.find(source2, {}, JS::Program::Type::Script, 1));
+    EXPECT(code_cache.find(source3, {}, JS::Program::Type::Script, 1));
+    EXPECT_EQ(code_cache.statistics().evicted_programs, 1u);
+    EXPECT_EQ(code_cache.size(), 2 * JS::CodeCache::estimated_size_of(source1.length()));
+}
+
+TEST_CASE(shares_executables_between_realms)
+{
+    auto vm = JS::VM::create();
+    auto source = cacheable_source("let value = 'shared'; function get_value() { return value; } get_value();"sv);
+
+    auto first_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto first_result = run_script(*first_execution_context->realm, source);
+    EXPECT_EQ(first_result.as_string().utf8_string(), "shared"sv);
+
+    // Lay out the second realm's global bindings differently, so that a global variable cache populated by the first
+    // realm would resolve to the wrong binding if it were considered valid here.
+    auto second_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    (void)run_script(*second_execution_context->realm, "let unrelated = 'unrelated';"sv);
+
+    auto second_result = run_script(*second_execution_context->realm, source);
+    EXPECT_EQ(second_result.as_string().utf8_string(), "shared"sv);
+    EXPECT_EQ(vm->code_cache().statistics().hits, 1u);
+}
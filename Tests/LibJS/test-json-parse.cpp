@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include "TestJSCommon.h"
+
+#include <AK/Time.h>
+#include <LibJS/Runtime/Array.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/JSONObject.h>
+#include <sys/resource.h>
+
+static long peak_rss_in_kib()
+{
+    struct rusage usage {};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+TEST_CASE(objects_with_the_same_keys_share_their_shape)
+{
+    auto vm = JS::VM::create();
+    auto execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+
+    auto value = MUST(JS::JSONObject::parse_json(*vm, R"([{"a":1,"b":2},{"a":3,"b":4},{"b":5,"a":6},{"a":7,"a":8}])"sv));
+    auto& array = value.as_object();
+    auto element = [&](u32 index) -> JS::Object& { return MUST(array.get(index)).as_object(); };
+
+    EXPECT_EQ(&element(0).shape(), &element(1).shape());
+    EXPECT_NE(&element(0).shape(), &element(2).shape());
+    EXPECT_EQ(MUST(element(1).get("b"_utf16_fly_string)).as_double(), 4.0);
+    EXPECT_EQ(element(3).shape().property_count(), 1u);
+    EXPECT_EQ(MUST(element(3).get("a"_utf16_fly_string)).as_double(), 8.0);
+}
+
+TEST_CASE(malformed_json_throws)
+{
+    auto vm = JS::VM::create();
+    auto execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+
+    for (auto text : { ""sv, "["sv, "[1,]"sv, R"({"a" 1})"sv, R"("\u00")"sv, "tru"sv, "1 2"sv })
+        EXPECT(JS::JSONObject::parse_json(*vm, text).is_throw_completion());
+}
+
+BENCHMARK_CASE(parse_multi_megabyte_payload)
+{
+    auto vm = JS::VM::create();
+    auto execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+
+    auto payload = records_payload(50'000);
+    static constexpr size_t iteration_count = 10;
+
+    auto rss_before = peak_rss_in_kib();
+    auto start = MonotonicTime::now();
+    for (size_t i = 0; i < iteration_count; ++i) {
+        auto value = MUST(JS::JSONObject::parse_json(*vm, payload));
+        EXPECT(value.is_object());
+    }
+    auto elapsed = MonotonicTime::now() - start;
+    outln("{} bytes x {} in {} ms, peak RSS {} KiB (+{} KiB)", payload.bytes().size(), iteration_count,
+        elapsed.to_milliseconds(), peak_rss_in_kib(), peak_rss_in_kib() - rss_before);
+}
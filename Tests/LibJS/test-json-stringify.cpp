@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include "TestJSCommon.h"
+
+#include <AK/Time.h>
+#include <LibGC/RootVector.h>
+#include <LibJS/Runtime/Array.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/JSONObject.h>
+
+// A replacer array that lists every key of the records keeps the output the same, but takes the generic path.
+static JS::Value replacer_with_every_key(JS::VM& vm)
+{
+    GC::RootVector<JS::Value> keys { vm.heap() };
+    for (auto key : { "id"sv, "name"sv, "score"sv, "active"sv, "tags"sv, "parent"sv })
+        keys.append(JS::PrimitiveString::create(vm, key));
+    return JS::Array::create_from(*vm.current_realm(), keys);
+}
+
+TEST_CASE(fast_path_matches_generic_path)
+{
+    auto vm = JS::VM::create();
+    auto execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+
+    auto value = MUST(JS::JSONObject::parse_json(*vm, records_payload(100)));
+    auto replacer = replacer_with_every_key(*vm);
+
+    for (auto space : { JS::js_undefined(), JS::Value(4) }) {
+        auto fast = MUST(JS::JSONObject::stringify_impl(*vm, value, JS::js_undefined(), space));
+        auto generic = MUST(JS::JSONObject::stringify_impl(*vm, value, replacer, space));
+        EXPECT_EQ(fast, generic);
+    }
+}
+
+BENCHMARK_CASE(stringify_plain_records)
+{
+    auto vm = JS::VM::create();
+    auto execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+
+    auto value = MUST(JS::JSONObject::parse_json(*vm, records_payload(20'000)));
+    auto replacer = replacer_with_every_key(*vm);
+    static constexpr size_t iteration_count = 20;
+
+    auto measure = [&](StringView name, JS::Value replacer) {
+        auto start = MonotonicTime::now();
+        size_t length = 0;
+        for (size_t i = 0; i < iteration_count; ++i)
+            length = MUST(JS::JSONObject::stringify_impl(*vm, value, replacer, JS::js_undefined()))->bytes().size();
+        outln("{}: {} bytes x {} in {} ms", name, length, iteration_count, (MonotonicTime::now() - start).to_milliseconds());
+    };
+
+    measure("Fast path"sv, JS::js_undefined());
+    measure("Generic path"sv, replacer);
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include "TestJSCommon.h"
+
+#include <AK/Time.h>
+#include <LibJS/Runtime/GlobalObject.h>
+
+TEST_CASE(objects_created_by_the_same_literal_share_their_shape)
+{
+    auto vm = JS::VM::create();
+    auto execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *execution_context->realm;
+
+    auto value = run_script(realm, "const make = i => ({ a: i, b: i + 1, c: i + 2 }); [make(1), make(2), make(3)]"sv);
+    auto& array = value.as_object();
+    auto element = [&](u32 index) -> JS::Object& { return MUST(array.get(index)).as_object(); };
+
+    EXPECT_EQ(&element(0).shape(), &element(1).shape());
+    EXPECT_EQ(&element(1).shape(), &element(2).shape());
+    EXPECT_EQ(MUST(element(2).get("c"_utf16_fly_string)).as_double(), 5.0);
+}
+
+BENCHMARK_CASE(create_object_literals)
+{
+    auto vm = JS::VM::create();
+    auto execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *execution_context->realm;
+
+    // NOTE: A computed key that isn't a string literal makes a literal define its properties one by one.
+    auto measure = [&](StringView name, StringView key) {
+        auto source = ByteString::formatted(R"({{
+            let objects = [];
+            for (let i = 0; i < 2000000; ++i)
+                objects[i % 1000] = {{ id: i, name: "n", x: i, y: i, z: i, {}: i, active: true, parent: null }};
+        }})",
+            key);
+        auto start = MonotonicTime::now();
+        (void)run_script(realm, source);
+        outln("{}: {} ms", name, (MonotonicTime::now() - start).to_milliseconds());
+    };
+
+    measure("One step"sv, "w"sv);
+    measure("Property by property"sv, "[\"w\" + \"\"]"sv);
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include "TestJSCommon.h"
+
+#include <AK/Time.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/PrimitiveString.h>
+
+// A large text where the literal the patterns start with is rare, so most of the time is spent looking for it.
+static constexpr auto make_text_source = R"(
+    var text = "";
+    for (let i = 0; i < ITERATION_COUNT; ++i)
+        text += "Lorem ipsum dolor sit amet, consectetur adipiscing elit " + (i % 100 === 0 ? "TODO(" + i + ") " : "") + "été\n";
+)"sv;
+
+TEST_CASE(literal_prefixed_patterns_match_every_occurrence)
+{
+    auto vm = JS::VM::create();
+    auto execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *execution_context->realm;
+
+    run_script(realm, with_iteration_count(make_text_source, 1000));
+
+    auto replaced = run_script(realm, R"(text.replace(/TODO\((\d+)\)/g, "DONE[$1]").split("DONE[").length)"sv);
+    EXPECT_EQ(replaced.as_i32(), 11);
+
+    auto replaced_without_prefilter = run_script(realm, R"(text.replace(/(?:TODO)\((\d+)\)/gi, "DONE[$1]").split("DONE[").length)"sv);
+    EXPECT_EQ(replaced_without_prefilter.as_i32(), 11);
+
+    auto lines = run_script(realm, R"(text.split(/\n/).length)"sv);
+    EXPECT_EQ(lines.as_i32(), 1001);
+
+    auto overlapping = run_script(realm, R"("aaaa".replace(/aa/g, "b"))"sv);
+    EXPECT_EQ(overlapping.as_string().utf8_string_view(), "bb"sv);
+
+    auto wide = run_script(realm, R"("été été".match(/ét/g).length)"sv);
+    EXPECT_EQ(wide.as_i32(), 2);
+
+    auto last_index = run_script(realm, R"({
+        const re = /ipsum/g;
+        re.lastIndex = text.length - 10;
+        [re.test(text), re.lastIndex].join();
+    })"sv);
+    EXPECT_EQ(last_index.as_string().utf8_string_view(), "false,0"sv);
+}
+
+BENCHMARK_CASE(replace_and_split_on_large_text)
+{
+    auto vm = JS::VM::create();
+    auto execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *execution_context->realm;
+
+    run_script(realm, with_iteration_count(make_text_source, 200'000));
+
+    auto measure = [&](StringView name, StringView source) {
+        auto start = MonotonicTime::now();
+        auto value = run_script(realm, source);
+        outln("{}: {} in {} ms", name, value.to_string_without_side_effects(), (MonotonicTime::now() - start).to_milliseconds());
+    };
+
+    measure("replace() with a literal prefix"sv, R"(text.replace(/TODO\((\d+)\)/g, "DONE[$1]").length)"sv);
+    measure("replace() of a plain literal"sv, R"(text.replace(/adipiscing/g, "x").length)"sv);
+    measure("split() on a literal"sv, R"(text.split(/elit /).length)"sv);
+    measure("split() on newlines"sv, R"(text.split(/\n/).length)"sv);
+}
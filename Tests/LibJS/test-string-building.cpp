@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include "TestJSCommon.h"
+
+#include <AK/Time.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/PrimitiveString.h>
+
+// Renders a list of records with a template literal, the way templating code does.
+static constexpr auto render_template_source = R"({
+    let html = "";
+    for (let i = 0; i < ITERATION_COUNT; ++i)
+        html += `<li class="${i % 2 ? "odd" : "even"}"><a href="/item/${i}">Item ${i}</a></li>\n`;
+    html;
+})"sv;
+
+// Builds CSV text one field at a time, checking the length of the output as it goes.
+static constexpr auto build_csv_source = R"({
+    let csv = "";
+    for (let i = 0; i < ITERATION_COUNT; ++i) {
+        csv += i;
+        csv += ",";
+        csv += "name " + i;
+        csv += ",";
+        csv += i * 0.5;
+        csv += "\n";
+        if (csv.length > 1e9)
+            break;
+    }
+    csv;
+})"sv;
+
+TEST_CASE(built_strings_match_joined_arrays)
+{
+    auto vm = JS::VM::create();
+    auto execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *execution_context->realm;
+
+    auto html = run_script(realm, with_iteration_count(render_template_source, 100));
+    auto expected_html = run_script(realm, R"(
+        Array.from({ length: 100 }, (_, i) => `<li class="${i % 2 ? "odd" : "even"}"><a href="/item/${i}">Item ${i}</a></li>\n`).join(""))"sv);
+    EXPECT_EQ(html.as_string().utf8_string_view(), expected_html.as_string().utf8_string_view());
+
+    auto csv = run_script(realm, with_iteration_count(build_csv_source, 100));
+    auto expected_csv = run_script(realm, R"(
+        Array.from({ length: 100 }, (_, i) => `${i},name ${i},${i * 0.5}\n`).join(""))"sv);
+    EXPECT_EQ(csv.as_string().utf8_string_view(), expected_csv.as_string().utf8_string_view());
+}
+
+BENCHMARK_CASE(build_strings)
+{
+    auto vm = JS::VM::create();
+    auto execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *execution_context->realm;
+
+    auto measure = [&](StringView name, StringView source) {
+        auto start = MonotonicTime::now();
+        auto value = run_script(realm, with_iteration_count(source, 200'000));
+        auto length = value.as_string().length_in_utf16_code_units();
+        outln("{}: {} code units in {} ms", name, length, (MonotonicTime::now() - start).to_milliseconds());
+    };
+
+    measure("Template rendering"sv, render_template_source);
+    measure("CSV building"sv, build_csv_source);
+}
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h> // import first, to prevent warning of VERIFY* redefinition
+
+#include <AK/StringBuilder.h>
+#include <AK/Time.h>
+#include <AK/Utf16String.h>
+#include <LibRegex/Regex.h>
+
+static constexpr auto interpreter_only = static_cast<ECMAScriptFlags>(regex::AllFlags::Internal_DisableCompiledMatcher);
+
+static void expect_same_result_as_interpreter(StringView pattern, StringView subject, ECMAScriptFlags flags = ECMAScriptFlags::Default)
+{
+    Regex<ECMA262> re(pattern, flags);
+    EXPECT_EQ(re.parser_result.error, regex::Error::NoError);
+
+    auto check = [&](RegexStringView view) {
+        auto compiled = re.match(view);
+        auto interpreted = re.match(view, interpreter_only);
+
+        EXPECT_EQ(compiled.success, interpreted.success);
+        EXPECT_EQ(compiled.count, interpreted.count);
+        if (compiled.success != interpreted.success || compiled.count != interpreted.count) {
+            warnln("Pattern /{}/ on '{}'", pattern, subject);
+            return;
+        }
+
+        for (size_t i = 0; i < compiled.matches.size(); ++i) {
+            EXPECT_EQ(compiled.matches[i].view.to_byte_string(), interpreted.matches[i].view.to_byte_string());
+            EXPECT_EQ(compiled.matches[i].global_offset, interpreted.matches[i].global_offset);
+        }
+        for (size_t i = 0; i < compiled.capture_group_matches.size(); ++i) {
+            for (size_t j = 0; j < compiled.capture_group_matches[i].size(); ++j) {
+                auto const& compiled_group = compiled.capture_group_matches[i][j];
+                auto const& interpreted_group = interpreted.capture_group_matches[i][j];
+                EXPECT_EQ(compiled_group.view.is_null(), interpreted_group.view.is_null());
+                if (!compiled_group.view.is_null() && !interpreted_group.view.is_null())
+                    EXPECT_EQ(compiled_group.view.to_byte_string(), interpreted_group.view.to_byte_string());
+            }
+        }
+    };
+
+    check(subject);
+
+    auto utf16_subject = Utf16String::from_utf8(subject);
+    check(utf16_subject.utf16_view());
+}
+
+TEST_CASE(compiled_matcher_agrees_with_interpreter)
+{
+    struct {
+        StringView pattern;
+        Vector<StringView> subjects;
+        ECMAScriptFlags flags { ECMAScriptFlags::Default };
+    } tests[] = {
+        { "hello"sv, { "hello"sv, "say hello world"sv, "help"sv, ""sv } },
+        { "^[\\w.+-]+@[\\w-]+\\.[\\w.]+$"sv, { "someone@example.com"sv, "first.last+tag@sub.example.co.uk"sv, "not an email"sv, "a@b"sv } },
+        { "https?://([^/\\s]+)(/[^\\s]*)?"sv, { "see https://ladybird.org/news for details"sv, "http://a"sv, "ftp://nope"sv } },
+        { "(\\d{4})-(\\d{2})-(\\d{2})"sv, { "released on 2024-07-01."sv, "24-07-01"sv, "2024-7-1"sv } },
+        { "(?<year>\\d{4})-(?<month>\\d\\d)"sv, { "2025-10"sv, "year 1999-12!"sv } },
+        { "^(\\w+)\\s+\\[(\\w+)\\]\\s+(.*)$"sv, { "12:00:01 [INFO] Server started"sv, "garbage"sv } },
+        { "[A-Za-z_$][\\w$]*"sv, { "  let $value_2 = 3"sv, "123"sv } },
+        { "\"[^\"]*\""sv, { "key: \"value\", other: \"x\""sv, "\"unterminated"sv } },
+        { "<(\\w+)[^>]*>(.*?)</\\1>"sv, { "<b class=x>bold</b>"sv } },
+        { "([a-z-]+)\\s*:\\s*([^;]+);"sv, { "color: red; margin : 0 auto;"sv, "color red"sv } },
+        { "a.*b"sv, { "aXXXbYYYb"sv, "a\nb"sv, "ab"sv, "aaaa"sv } },
+        { "a.*b"sv, { "a\nb"sv }, ECMAScriptFlags::SingleLine },
+        { "^\\d+$"sv, { "12345"sv, "123a45"sv, "one\n23"sv } },
+        { "^\\d+$"sv, { "one\n23\nthree"sv }, ECMAScriptFlags::Multiline },
+        { "\\bcat\\b"sv, { "concatenate"sv, "the cat sat"sv, "cat"sv } },
+        { "\\Bcat\\B"sv, { "concatenate"sv, "the cat sat"sv } },
+        { "(ab|cd|ef)+g"sv, { "xxababcdefg"sv, "abab"sv } },
+        { "x{2,4}y"sv, { "xy"sv, "xxy"sv, "xxxxxy"sv } },
+        { "(a|ab)(c|bcd)(d*)"sv, { "abcd"sv } },
+        { "(a*)*b"sv, { "aaaaaaaaaaaaaaaaaaaaaaaac"sv, "aab"sv } },
+        { "(?:(a)|b)+"sv, { "ab"sv, "ba"sv } },
+        { "[^a-z]+"sv, { "abc123DEF"sv, "\xc3\xa9t\xc3\xa9"sv } },
+        { "\\s+$"sv, { "trailing   "sv, "none"sv } },
+        { "a+?b"sv, { "aaab"sv } },
+        { "caf\xc3\xa9"sv, { "un caf\xc3\xa9"sv } },
+    };
+
+    for (auto& test : tests) {
+        for (auto subject : test.subjects)
+            expect_same_result_as_interpreter(test.pattern, subject, test.flags);
+    }
+}
+
+TEST_CASE(compiled_matcher_leaves_lookaround_to_interpreter)
+{
+    Regex<ECMA262> re("foo(?=bar)"sv);
+    EXPECT(re.match("foobar"sv).success);
+    EXPECT(!re.match("foobaz"sv).success);
+
+    Regex<ECMA262> insensitive("hello"sv, ECMAScriptFlags::Insensitive);
+    EXPECT(insensitive.match("HeLLo"sv).success);
+}
+
+BENCHMARK_CASE(compiled_matcher_real_world_patterns)
+{
+    StringBuilder builder;
+    for (size_t i = 0; i < 20'000; ++i)
+        builder.appendff("2025-01-{:02} 12:{:02}:00 [INFO] user{}@example.com requested \"/api/items/{}\" in {}ms\n", i % 28 + 1, i % 60, i, i, i % 500);
+    auto log = builder.to_byte_string();
+
+    auto measure = [&](StringView name, StringView pattern) {
+        Regex<ECMA262> re(pattern, ECMAScriptFlags::Global);
+        auto run = [&](StringView tier, ECMAScriptFlags options) {
+            re.start_offset = 0;
+            auto start = MonotonicTime::now();
+            auto result = re.match(log.view(), options);
+            outln("{} ({}): {} matches in {} ms", name, tier, result.count, (MonotonicTime::now() - start).to_milliseconds());
+        };
+        run("compiled"sv, ECMAScriptFlags::Default);
+        run("interpreter"sv, interpreter_only);
+    };
+
+    measure("Email addresses"sv, "[\\w.+-]+@[\\w-]+\\.[\\w.]+"sv);
+    measure("Quoted paths"sv, "\"([^\"]*)\""sv);
+    measure("ISO dates"sv, "(\\d{4})-(\\d{2})-(\\d{2})"sv);
+    measure("Durations"sv, "\\b\\d+ms\\b"sv);
+    measure("Log levels"sv, "\\[(\\w+)\\]"sv);
+}
@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Hex.h>
+#include <AK/LexicalPath.h>
+#include <AK/MemoryStream.h>
+#include <LibCore/File.h>
+#include <LibCore/System.h>
+#include <LibFileSystem/FileSystem.h>
+#include <LibFileSystem/TempFile.h>
+#include <LibTest/TestCase.h>
+#include <LibWasm/AbstractMachine/AbstractMachine.h>
+#include <LibWasm/AbstractMachine/ModuleCache.h>
+#include <LibWasm/AbstractMachine/Validator.h>
+#include <LibWasm/Types.h>
+
+// Libraries/LibWasm/Tests/Benchmarks/fib.wasm, which exports a recursive "run" function. Its body contains both calls and
+// an if/else, so its compiled form has extra instructions as well as structured ones.
+static constexpr Array<u8, 61> fib_module_bytes {
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x06, 0x01, 0x60,
+    0x01, 0x7f, 0x01, 0x7f, 0x03, 0x02, 0x01, 0x00, 0x07, 0x07, 0x01, 0x03,
+    0x72, 0x75, 0x6e, 0x00, 0x00, 0x0a, 0x1e, 0x01, 0x1c, 0x00, 0x20, 0x00,
+    0x41, 0x02, 0x49, 0x04, 0x7f, 0x20, 0x00, 0x05, 0x20, 0x00, 0x41, 0x01,
+    0x6b, 0x10, 0x00, 0x20, 0x00, 0x41, 0x02, 0x6b, 0x10, 0x00, 0x6a, 0x0b,
+    0x0b
+};
+
+static NonnullRefPtr<Wasm::Module> parse_module()
+{
+    FixedMemoryStream stream { fib_module_bytes.span() };
+    auto module = Wasm::Module::parse(stream);
+    VERIFY(!module.is_error());
+    return module.release_value();
+}
+
+static NonnullRefPtr<Wasm::Module> parse_and_validate_module()
+{
+    auto module = parse_module();
+    VERIFY(!Wasm::Validator {}.validate(module).is_error());
+    return module;
+}
+
+static Wasm::Expression const& function_body(Wasm::Module const& module)
+{
+    return module.code_section().functions().first().func().body();
+}
+
+static i32 run(Wasm::Module const& module, i32 argument)
+{
+    Wasm::AbstractMachine machine;
+    auto instance = MUST(machine.instantiate(module, {}));
+    auto address = instance->exports().first().value().get<Wasm::FunctionAddress>();
+
+    auto result = machine.invoke(address, { Wasm::Value { argument } });
+    VERIFY(!result.is_trap());
+    return result.values().first().to<i32>();
+}
+
+static ByteString entry_path(FileSystem::TempFile const& directory, Wasm::ModuleCache::Key const& key)
+{
+    return LexicalPath::join(directory.path(), encode_hex(key.bytes())).string();
+}
+
+static void rewrite_entry(FileSystem::TempFile const& directory, Wasm::ModuleCache::Key const& key, Function<void(ByteBuffer&)> change)
+{
+    auto path = entry_path(directory, key);
+    auto contents = MUST(MUST(Core::File::open(path, Core::File::OpenMode::Read))->read_until_eof());
+    change(contents);
+    MUST(MUST(Core::File::open(path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate))->write_until_depleted(contents));
+}
+
+static void copy_entry(ByteString const& source_path, ByteString const& destination_path)
+{
+    auto contents = MUST(MUST(Core::File::open(source_path, Core::File::OpenMode::Read))->read_until_eof());
+    MUST(MUST(Core::File::open(destination_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate))->write_until_depleted(contents));
+}
+
+static void set_last_use(FileSystem::TempFile const& directory, Wasm::ModuleCache::Key const& key, time_t seconds)
+{
+    struct timespec times[2] = { { seconds, 0 }, { seconds, 0 } };
+    MUST(Core::System::utimensat(AT_FDCWD, entry_path(directory, key), times, 0));
+}
+
+static constexpr auto partition = "https://example.com"sv;
+
+static Wasm::ModuleCache::Key fib_module_key()
+{
+    return Wasm::ModuleCache::key_for(partition, Wasm::ModuleCache::hash_module(fib_module_bytes.span()));
+}
+
+static Wasm::ModuleCache::Key key_for(StringView module)
+{
+    return Wasm::ModuleCache::key_for(partition, Wasm::ModuleCache::hash_module(module.bytes()));
+}
+
+static ErrorOr<void> store_module(Wasm::ModuleCache const& cache, Wasm::ModuleCache::Key const& key)
+{
+    auto payload = TRY(Wasm::ModuleCache::create_payload(parse_and_validate_module()));
+    return cache.store(key, payload);
+}
+
+static void expect_not_restored(ReadonlyBytes payload)
+{
+    auto module = parse_module();
+    EXPECT(!Wasm::ModuleCache::try_restore(payload, module));
+    EXPECT_EQ(module->validation_status(), Wasm::Module::ValidationStatus::Unchecked);
+    EXPECT(!function_body(module).stack_usage_hint().has_value());
+    EXPECT(function_body(module).compiled_instructions.dispatches.is_empty());
+}
+
+TEST_CASE(restored_module_matches_validated_module)
+{
+    auto directory = TRY_OR_FAIL(FileSystem::TempFile::create_temp_directory());
+    auto cache = TRY_OR_FAIL(Wasm::ModuleCache::create(LexicalPath { directory->path().to_byte_string() }));
+    auto key = fib_module_key();
+
+    auto validated = parse_and_validate_module();
+    TRY_OR_FAIL(cache->store(key, TRY_OR_FAIL(Wasm::ModuleCache::create_payload(validated))));
+
+    auto payload = cache->load(key);
+    EXPECT(payload.has_value());
+
+    auto restored = parse_module();
+    EXPECT(Wasm::ModuleCache::try_restore(*payload, restored));
+    EXPECT_EQ(restored->validation_status(), Wasm::Module::ValidationStatus::Valid);
+
+    auto const& validated_body = function_body(validated);
+    auto const& restored_body = function_body(restored);
+    EXPECT_EQ(restored_body.stack_usage_hint(), validated_body.stack_usage_hint());
+    EXPECT_EQ(restored_body.frame_usage_hint(), validated_body.frame_usage_hint());
+
+    auto const& validated_dispatches = validated_body.compiled_instructions.dispatches;
+    auto const& restored_dispatches = restored_body.compiled_instructions.dispatches;
+    EXPECT_EQ(restored_dispatches.size(), validated_dispatches.size());
+    EXPECT_EQ(restored_body.compiled_instructions.extra_instruction_storage.size(), validated_body.compiled_instructions.extra_instruction_storage.size());
+    for (size_t i = 0; i < min(restored_dispatches.size(), validated_dispatches.size()); ++i) {
+        EXPECT_EQ(restored_dispatches[i].instruction->opcode(), validated_dispatches[i].instruction->opcode());
+        EXPECT_EQ(restored_dispatches[i].sources_and_destination, validated_dispatches[i].sources_and_destination);
+    }
+
+    EXPECT_EQ(run(restored, 20), 6765);
+    EXPECT_EQ(run(restored, 20), run(validated, 20));
+}
+
+TEST_CASE(missing_entry_is_not_loaded)
+{
+    auto directory = TRY_OR_FAIL(FileSystem::TempFile::create_temp_directory());
+    auto cache = TRY_OR_FAIL(Wasm::ModuleCache::create(LexicalPath { directory->path().to_byte_string() }));
+
+    EXPECT(!cache->load(fib_module_key()).has_value());
+}
+
+TEST_CASE(malformed_payload_is_not_restored)
+{
+    auto payload = TRY_OR_FAIL(Wasm::ModuleCache::create_payload(parse_and_validate_module()));
+
+    auto truncated_payload = TRY_OR_FAIL(ByteBuffer::copy(payload));
+    truncated_payload.resize(payload.size() - 1);
+    expect_not_restored(truncated_payload);
+
+    auto extended_payload = TRY_OR_FAIL(ByteBuffer::copy(payload));
+    TRY_OR_FAIL(extended_payload.try_append(0));
+    expect_not_restored(extended_payload);
+
+    expect_not_restored({});
+}
+
+TEST_CASE(corrupted_entry_is_not_loaded)
+{
+    auto directory = TRY_OR_FAIL(FileSystem::TempFile::create_temp_directory());
+    auto cache = TRY_OR_FAIL(Wasm::ModuleCache::create(LexicalPath { directory->path().to_byte_string() }));
+    auto key = fib_module_key();
+
+    TRY_OR_FAIL(store_module(*cache, key));
+
+    // Every byte of the payload is covered by the MAC, including the dispatches at its end.
+    rewrite_entry(*directory, key, [](auto& contents) { contents.bytes().last() ^= 1; });
+    EXPECT(!cache->load(key).has_value());
+
+    TRY_OR_FAIL(store_module(*cache, key));
+
+    rewrite_entry(*directory, key, [](auto& contents) { contents.bytes()[sizeof(Wasm::ModuleCacheHeader)] ^= 1; });
+    EXPECT(!cache->load(key).has_value());
+}
+
+TEST_CASE(truncated_entry_is_not_loaded)
+{
+    auto directory = TRY_OR_FAIL(FileSystem::TempFile::create_temp_directory());
+    auto cache = TRY_OR_FAIL(Wasm::ModuleCache::create(LexicalPath { directory->path().to_byte_string() }));
+    auto key = fib_module_key();
+
+    TRY_OR_FAIL(store_module(*cache, key));
+    rewrite_entry(*directory, key, [](auto& contents) { contents.resize(contents.size() - 1); });
+    EXPECT(!cache->load(key).has_value());
+
+    TRY_OR_FAIL(store_module(*cache, key));
+    rewrite_entry(*directory, key, [](auto& contents) { contents.resize(sizeof(Wasm::ModuleCacheHeader) / 2); });
+    EXPECT(!cache->load(key).has_value());
+}
+
+TEST_CASE(entry_is_not_loaded_under_another_key)
+{
+    auto directory = TRY_OR_FAIL(FileSystem::TempFile::create_temp_directory());
+    auto cache = TRY_OR_FAIL(Wasm::ModuleCache::create(LexicalPath { directory->path().to_byte_string() }));
+    auto key = fib_module_key();
+    auto other_key = key_for("another module"sv);
+
+    TRY_OR_FAIL(store_module(*cache, key));
+    copy_entry(entry_path(*directory, key), entry_path(*directory, other_key));
+
+    EXPECT(!cache->load(other_key).has_value());
+}
+
+TEST_CASE(entries_are_partitioned)
+{
+    auto directory = TRY_OR_FAIL(FileSystem::TempFile::create_temp_directory());
+    auto cache = TRY_OR_FAIL(Wasm::ModuleCache::create(LexicalPath { directory->path().to_byte_string() }));
+    auto module_hash = Wasm::ModuleCache::hash_module(fib_module_bytes.span());
+    auto key = Wasm::ModuleCache::key_for("https://a.example"sv, module_hash);
+    auto other_key = Wasm::ModuleCache::key_for("https://b.example"sv, module_hash);
+    EXPECT_NE(key, other_key);
+
+    TRY_OR_FAIL(store_module(*cache, key));
+    EXPECT(cache->load(key).has_value());
+    EXPECT(!cache->load(other_key).has_value());
+
+    // An entry that is moved into another partition is rejected as well.
+    copy_entry(entry_path(*directory, key), entry_path(*directory, other_key));
+    EXPECT(!cache->load(other_key).has_value());
+}
+
+TEST_CASE(entry_written_with_another_secret_is_not_loaded)
+{
+    auto directory = TRY_OR_FAIL(FileSystem::TempFile::create_temp_directory());
+    auto other_directory = TRY_OR_FAIL(FileSystem::TempFile::create_temp_directory());
+    auto cache = TRY_OR_FAIL(Wasm::ModuleCache::create(LexicalPath { directory->path().to_byte_string() }));
+    auto other_cache = TRY_OR_FAIL(Wasm::ModuleCache::create(LexicalPath { other_directory->path().to_byte_string() }));
+    auto key = fib_module_key();
+
+    TRY_OR_FAIL(store_module(*other_cache, key));
+    copy_entry(entry_path(*other_directory, key), entry_path(*directory, key));
+
+    EXPECT(!cache->load(key).has_value());
+
+    // A cache that is created for an existing directory uses the secret that it was created with.
+    auto reopened_cache = TRY_OR_FAIL(Wasm::ModuleCache::create(LexicalPath { other_directory->path().to_byte_string() }));
+    EXPECT(reopened_cache->load(key).has_value());
+}
+
+TEST_CASE(least_recently_used_entries_are_evicted)
+{
+    auto directory = TRY_OR_FAIL(FileSystem::TempFile::create_temp_directory());
+    auto first_key = key_for("first"sv);
+    auto second_key = key_for("second"sv);
+    auto third_key = key_for("third"sv);
+
+    // Entries of the same module all have the same size, so we can make room for exactly two of them.
+    u64 entry_size = 0;
+    {
+        auto cache = TRY_OR_FAIL(Wasm::ModuleCache::create(LexicalPath { directory->path().to_byte_string() }));
+        TRY_OR_FAIL(store_module(*cache, first_key));
+        entry_size = MUST(Core::System::stat(entry_path(*directory, first_key))).st_size;
+    }
+
+    auto cache = TRY_OR_FAIL(Wasm::ModuleCache::create(LexicalPath { directory->path().to_byte_string() }, entry_size * 2));
+    TRY_OR_FAIL(store_module(*cache, second_key));
+    EXPECT(FileSystem::exists(entry_path(*directory, first_key)));
+    EXPECT(FileSystem::exists(entry_path(*directory, second_key)));
+
+    set_last_use(*directory, first_key, 1000);
+    set_last_use(*directory, second_key, 2000);
+
+    // Loading the first entry makes it the most recently used one, so the second one is evicted instead.
+    EXPECT(cache->load(first_key).has_value());
+
+    TRY_OR_FAIL(store_module(*cache, third_key));
+    EXPECT(FileSystem::exists(entry_path(*directory, first_key)));
+    EXPECT(!FileSystem::exists(entry_path(*directory, second_key)));
+    EXPECT(FileSystem::exists(entry_path(*directory, third_key)));
+
+    // The secret is never evicted.
+    EXPECT(FileSystem::exists(LexicalPath::join(directory->path(), "secret"sv).string()));
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/MemoryStream.h>
+#include <LibTest/TestCase.h>
+#include <LibWasm/AbstractMachine/Validator.h>
+#include <LibWasm/Types.h>
+
+// Enough functions for their bodies to be validated on multiple threads.
+static constexpr size_t function_count = 200;
+
+// Bodies of functions of type [] -> [i32], without any locals. The first one returns `i32.const 0`, the second one runs
+// `i32.add` on an empty stack and the last one returns `i64.const 0`.
+static Vector<u8> const valid_body { 0x00, 0x41, 0x00, 0x0b };
+static Vector<u8> const underflowing_body { 0x00, 0x6a, 0x0b };
+static Vector<u8> const mismatched_result_body { 0x00, 0x42, 0x00, 0x0b };
+
+// Makes the body take long to validate before running into its error, by prepending `i32.const 0` and `drop` pairs.
+static Vector<u8> with_valid_prefix(Vector<u8> const& body)
+{
+    Vector<u8> result;
+    result.append(body[0]);
+    for (size_t i = 0; i < 20000; ++i) {
+        result.append(0x41);
+        result.append(0x00);
+        result.append(0x1a);
+    }
+    result.append(body.data() + 1, body.size() - 1);
+    return result;
+}
+
+static void append_leb128(Vector<u8>& bytes, u32 value)
+{
+    do {
+        u8 byte = value & 0x7f;
+        value >>= 7;
+        bytes.append(value != 0 ? byte | 0x80 : byte);
+    } while (value != 0);
+}
+
+static void append_section(Vector<u8>& bytes, u8 id, Vector<u8> const& contents)
+{
+    bytes.append(id);
+    append_leb128(bytes, contents.size());
+    bytes.extend(contents);
+}
+
+static NonnullRefPtr<Wasm::Module> module_with_bodies(Vector<Vector<u8>> const& bodies)
+{
+    Vector<u8> bytes { 0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00 };
+    append_section(bytes, 1, { 0x01, 0x60, 0x00, 0x01, 0x7f });
+
+    Vector<u8> functions;
+    append_leb128(functions, bodies.size());
+    for (size_t i = 0; i < bodies.size(); ++i)
+        functions.append(0x00);
+    append_section(bytes, 3, functions);
+
+    Vector<u8> code;
+    append_leb128(code, bodies.size());
+    for (auto const& body : bodies) {
+        append_leb128(code, body.size());
+        code.extend(body);
+    }
+    append_section(bytes, 10, code);
+
+    FixedMemoryStream stream { bytes.span() };
+    auto module = Wasm::Module::parse(stream);
+    VERIFY(!module.is_error());
+    return module.release_value();
+}
+
+static Vector<Vector<u8>> valid_bodies()
+{
+    Vector<Vector<u8>> bodies;
+    for (size_t i = 0; i < function_count; ++i)
+        bodies.append(valid_body);
+    return bodies;
+}
+
+static ByteString validation_error(Vector<Vector<u8>> const& bodies)
+{
+    auto module = module_with_bodies(bodies);
+    auto result = Wasm::Validator {}.validate(module);
+    VERIFY(result.is_error());
+    return result.release_error().error_string;
+}
+
+TEST_CASE(many_valid_functions)
+{
+    auto module = module_with_bodies(valid_bodies());
+    EXPECT(!Wasm::Validator {}.validate(module).is_error());
+    EXPECT_EQ(module->validation_status(), Wasm::Module::ValidationStatus::Valid);
+}
+
+TEST_CASE(first_invalid_function_is_reported)
+{
+    // Modules this small are validated on a single thread.
+    auto mismatched_result_error = validation_error({ mismatched_result_body });
+    auto underflow_error = validation_error({ underflowing_body });
+    EXPECT_NE(mismatched_result_error, underflow_error);
+
+    // The first invalid function takes much longer to validate than the one after it, so other threads are likely to
+    // run into the later error first.
+    auto bodies = valid_bodies();
+    bodies[function_count - 50] = with_valid_prefix(mismatched_result_body);
+    bodies[function_count - 20] = underflowing_body;
+
+    for (size_t i = 0; i < 20; ++i)
+        EXPECT_EQ(validation_error(bodies), mismatched_result_error);
+
+    // Without the earlier invalid function, the later one is reported.
+    bodies[function_count - 50] = valid_body;
+    EXPECT_EQ(validation_error(bodies), underflow_error);
+}
@@ -13,6 +13,8 @@
 
 TEST_ROOT("Libraries/LibWasm/Tests");
 
+TESTJS_PROGRAM_FLAG(enable_wasm_jit, "Compile hot functions to native code", "wasm-jit", 0);
+
 TESTJS_GLOBAL_FUNCTION(read_binary_wasm_file, readBinaryWasmFile)
 {
     auto& realm = *vm.current_realm();
@@ -48,6 +50,7 @@ public:
         : JS::Object(ConstructWithPrototypeTag::Tag, prototype)
     {
         m_machine.enable_instruction_count_limit();
+        Wasm::g_jit_enabled = enable_wasm_jit;
     }
 
     static Wasm::AbstractMachine& machine() { return m_machine; }
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGfx/Filter.h>
+#include <LibGfx/Matrix4x4.h>
+#include <LibTest/TestCase.h>
+#include <LibWeb/Painting/DamageTracker.h>
+#include <LibWeb/Painting/DisplayList.h>
+#include <LibWeb/Painting/DisplayListRecorder.h>
+
+using namespace Web::Painting;
+
+using PaintFunction = Function<void(DisplayListRecorder&)>;
+
+static Gfx::IntRect const first_rect { 10, 10, 50, 50 };
+static Gfx::IntRect const second_rect { 200, 100, 30, 40 };
+
+static NonnullRefPtr<DisplayList> record(PaintFunction const& paint)
+{
+    auto display_list = DisplayList::create(1);
+    {
+        DisplayListRecorder recorder { *display_list };
+        paint(recorder);
+    }
+    return display_list;
+}
+
+// Returns the damage of the second frame, relative to the first one.
+static Optional<Gfx::IntRect> damage_between(PaintFunction const& paint_first_frame, PaintFunction const& paint_second_frame)
+{
+    DamageTracker tracker;
+    auto first_frame = record(paint_first_frame);
+    auto second_frame = record(paint_second_frame);
+
+    VERIFY(!tracker.compute_damage(*first_frame, {}).has_value());
+    return tracker.compute_damage(*second_frame, {});
+}
+
+// The damage includes a few pixels around every damaged command, for anti-aliasing.
+static Gfx::IntRect damaged(Gfx::IntRect const& rect)
+{
+    return rect.inflated(2, 2, 2, 2);
+}
+
+static void paint_two_rects(DisplayListRecorder& recorder, Gfx::IntRect const& rect, Color color)
+{
+    recorder.fill_rect(first_rect, Color::Red);
+    recorder.fill_rect(rect, color);
+}
+
+TEST_CASE(first_frame_is_fully_repainted)
+{
+    DamageTracker tracker;
+    auto frame = record([](auto& recorder) { paint_two_rects(recorder, second_rect, Color::Blue); });
+
+    EXPECT(!tracker.compute_damage(*frame, {}).has_value());
+}
+
+TEST_CASE(unchanged_frame_has_no_damage)
+{
+    auto damage = damage_between(
+        [](auto& recorder) { paint_two_rects(recorder, second_rect, Color::Blue); },
+        [](auto& recorder) { paint_two_rects(recorder, second_rect, Color::Blue); });
+    EXPECT(damage.has_value());
+    EXPECT(damage->is_empty());
+
+    // The same display list is painted again if nothing was recorded since the last frame, and only the visual viewport
+    // transform may have changed in between. Changing it moves everything.
+    DamageTracker tracker;
+    auto frame = record([](auto& recorder) { paint_two_rects(recorder, second_rect, Color::Blue); });
+    (void)tracker.compute_damage(*frame, {});
+    damage = tracker.compute_damage(*frame, {});
+    EXPECT(damage.has_value());
+    EXPECT(damage->is_empty());
+
+    frame->set_visual_viewport_transform(Gfx::translation_matrix(Gfx::FloatVector3 { 10, 0, 0 }));
+    EXPECT(!tracker.compute_damage(*frame, {}).has_value());
+}
+
+TEST_CASE(changed_command_damages_only_its_rect)
+{
+    auto damage = damage_between(
+        [](auto& recorder) { paint_two_rects(recorder, second_rect, Color::Blue); },
+        [](auto& recorder) { paint_two_rects(recorder, second_rect, Color::Green); });
+    EXPECT_EQ(damage, damaged(second_rect));
+}
+
+TEST_CASE(moved_command_damages_its_old_and_new_rect)
+{
+    auto moved_rect = second_rect.translated(100, 0);
+    auto damage = damage_between(
+        [](auto& recorder) { paint_two_rects(recorder, second_rect, Color::Blue); },
+        [&](auto& recorder) { paint_two_rects(recorder, moved_rect, Color::Blue); });
+    EXPECT_EQ(damage, damaged(second_rect).united(damaged(moved_rect)));
+}
+
+TEST_CASE(added_command_damages_only_its_rect)
+{
+    auto damage = damage_between(
+        [](auto& recorder) { recorder.fill_rect(first_rect, Color::Red); },
+        [](auto& recorder) { paint_two_rects(recorder, second_rect, Color::Blue); });
+    EXPECT_EQ(damage, damaged(second_rect));
+}
+
+TEST_CASE(removed_command_damages_only_its_rect)
+{
+    auto damage = damage_between(
+        [](auto& recorder) { paint_two_rects(recorder, second_rect, Color::Blue); },
+        [](auto& recorder) { recorder.fill_rect(first_rect, Color::Red); });
+    EXPECT_EQ(damage, damaged(second_rect));
+}
+
+TEST_CASE(changed_clip_damages_its_old_and_new_rect)
+{
+    auto paint_clipped_rect = [](DisplayListRecorder& recorder, Gfx::IntRect const& clip_rect) {
+        recorder.save();
+        recorder.add_clip_rect(clip_rect);
+        recorder.fill_rect(first_rect.united(second_rect), Color::Blue);
+        recorder.restore();
+    };
+
+    auto damage = damage_between(
+        [&](auto& recorder) { paint_clipped_rect(recorder, first_rect); },
+        [&](auto& recorder) { paint_clipped_rect(recorder, second_rect); });
+    EXPECT_EQ(damage, damaged(first_rect).united(damaged(second_rect)));
+}
+
+TEST_CASE(added_clip_repaints_everything)
+{
+    auto damage = damage_between(
+        [](auto& recorder) { paint_two_rects(recorder, second_rect, Color::Blue); },
+        [](auto& recorder) {
+            recorder.save();
+            recorder.add_clip_rect(second_rect);
+            paint_two_rects(recorder, second_rect, Color::Blue);
+            recorder.restore();
+        });
+    EXPECT(!damage.has_value());
+}
+
+TEST_CASE(changes_under_a_transform_repaint_everything)
+{
+    auto paint_transformed_rect = [](DisplayListRecorder& recorder, Color color) {
+        recorder.save();
+        recorder.apply_transform({}, Gfx::scale_matrix(Gfx::FloatVector3 { 2, 2, 1 }));
+        recorder.fill_rect(second_rect, color);
+        recorder.restore();
+    };
+
+    auto damage = damage_between(
+        [&](auto& recorder) { paint_transformed_rect(recorder, Color::Blue); },
+        [&](auto& recorder) { paint_transformed_rect(recorder, Color::Green); });
+    EXPECT(!damage.has_value());
+
+    // Changes after the transform has been restored are drawn where their bounding rects say.
+    damage = damage_between(
+        [&](auto& recorder) {
+            paint_transformed_rect(recorder, Color::Blue);
+            recorder.fill_rect(first_rect, Color::Blue);
+        },
+        [&](auto& recorder) {
+            paint_transformed_rect(recorder, Color::Blue);
+            recorder.fill_rect(first_rect, Color::Green);
+        });
+    EXPECT_EQ(damage, damaged(first_rect));
+}
+
+TEST_CASE(changes_under_a_translation_repaint_everything)
+{
+    auto damage = damage_between(
+        [](auto& recorder) {
+            recorder.translate({ 10, 0 });
+            paint_two_rects(recorder, second_rect, Color::Blue);
+        },
+        [](auto& recorder) {
+            recorder.translate({ 10, 0 });
+            paint_two_rects(recorder, second_rect, Color::Green);
+        });
+    EXPECT(!damage.has_value());
+}
+
+TEST_CASE(changes_below_a_backdrop_filter_repaint_everything)
+{
+    auto paint_with_backdrop_filter = [](DisplayListRecorder& recorder, Color color) {
+        recorder.fill_rect(first_rect, color);
+        recorder.apply_backdrop_filter(second_rect, {}, Gfx::Filter::blur(4, 4));
+    };
+
+    auto damage = damage_between(
+        [&](auto& recorder) { paint_with_backdrop_filter(recorder, Color::Blue); },
+        [&](auto& recorder) { paint_with_backdrop_filter(recorder, Color::Green); });
+    EXPECT(!damage.has_value());
+}
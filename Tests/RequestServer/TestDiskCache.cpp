@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ByteBuffer.h>
+#include <AK/LexicalPath.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/System.h>
+#include <LibDatabase/Database.h>
+#include <LibFileSystem/TempFile.h>
+#include <LibHTTP/HeaderMap.h>
+#include <LibTest/TestCase.h>
+#include <LibURL/Parser.h>
+#include <LibURL/URL.h>
+#include <RequestServer/Cache/CacheIndex.h>
+#include <RequestServer/Cache/DiskCache.h>
+
+static void wait_for_next_access_time()
+{
+    // Access times are stored with millisecond precision. Make sure consecutive entries are ordered deterministically.
+    MUST(Core::System::sleep_ms(2));
+}
+
+static URL::URL parse_url(StringView url)
+{
+    auto parsed_url = URL::Parser::basic_parse(url);
+    VERIFY(parsed_url.has_value());
+    return parsed_url.release_value();
+}
+
+static void write_entry(RequestServer::DiskCache& disk_cache, StringView url, size_t size, RequestServer::DiskCache::RequestType request_type = RequestServer::DiskCache::RequestType::Normal)
+{
+    HTTP::HeaderMap headers;
+    headers.set("Cache-Control", "max-age=3600");
+
+    auto entry = disk_cache.create_entry(parse_url(url), "GET"sv, 200, {}, headers, UnixDateTime::now(), request_type);
+    VERIFY(entry.has_value());
+
+    auto data = MUST(ByteBuffer::create_zeroed(size));
+    MUST(entry->write_data(data));
+    MUST(entry->flush());
+}
+
+TEST_CASE(cache_index_orders_entries_by_last_access_time)
+{
+    auto directory = TRY_OR_FAIL(FileSystem::TempFile::create_temp_directory());
+    auto database = TRY_OR_FAIL(Database::Database::create(directory->path().to_byte_string(), "INDEX"sv));
+    auto index = TRY_OR_FAIL(RequestServer::CacheIndex::create(database));
+
+    for (u64 cache_key = 1; cache_key <= 4; ++cache_key) {
+        index.create_entry(cache_key, "https://ladybird.org/"_string, cache_key * 100, UnixDateTime::now(), UnixDateTime::now());
+        wait_for_next_access_time();
+    }
+
+    EXPECT_EQ(index.total_data_size(), 1000u);
+
+    // Touching the oldest entry moves it to the back of the eviction order.
+    index.update_last_access_time(1);
+
+    auto entries = index.least_recently_accessed_entries(10);
+    EXPECT_EQ(entries.size(), 4u);
+    EXPECT_EQ(entries[0].cache_key, 2u);
+    EXPECT_EQ(entries[0].data_size, 200u);
+    EXPECT_EQ(entries[1].cache_key, 3u);
+    EXPECT_EQ(entries[2].cache_key, 4u);
+    EXPECT_EQ(entries[3].cache_key, 1u);
+
+    entries = index.least_recently_accessed_entries(2, 1);
+    EXPECT_EQ(entries.size(), 2u);
+    EXPECT_EQ(entries[0].cache_key, 3u);
+    EXPECT_EQ(entries[1].cache_key, 4u);
+
+    index.remove_entry(3);
+    EXPECT_EQ(index.total_data_size(), 700u);
+
+    entries = index.least_recently_accessed_entries(10);
+    EXPECT_EQ(entries.size(), 3u);
+    EXPECT_EQ(entries[1].cache_key, 4u);
+}
+
+TEST_CASE(disk_cache_evicts_least_recently_used_entries)
+{
+    Core::EventLoop event_loop;
+
+    auto directory = TRY_OR_FAIL(FileSystem::TempFile::create_temp_directory());
+    auto disk_cache = TRY_OR_FAIL(RequestServer::DiskCache::create(LexicalPath { directory->path().to_byte_string() }, 1000));
+
+    write_entry(disk_cache, "https://ladybird.org/1"sv, 300);
+    wait_for_next_access_time();
+    write_entry(disk_cache, "https://ladybird.org/2"sv, 300);
+    wait_for_next_access_time();
+    write_entry(disk_cache, "https://ladybird.org/3"sv, 300);
+    wait_for_next_access_time();
+
+    EXPECT_EQ(disk_cache.size(), 900u);
+    EXPECT_EQ(disk_cache.statistics().eviction_runs, 0u);
+
+    // Exceeding the maximum size evicts the oldest entries until the cache is back under 90% of the maximum size.
+    write_entry(disk_cache, "https://ladybird.org/4"sv, 300);
+
+    EXPECT_EQ(disk_cache.size(), 900u);
+    EXPECT_EQ(disk_cache.statistics().eviction_runs, 1u);
+    EXPECT_EQ(disk_cache.statistics().evicted_entries, 1u);
+    EXPECT_EQ(disk_cache.statistics().evicted_bytes, 300u);
+
+    EXPECT(!disk_cache.open_entry(parse_url("https://ladybird.org/1"sv), "GET"sv).has_value());
+}
+
+TEST_CASE(disk_cache_eviction_target_is_exact_for_small_limits)
+{
+    Core::EventLoop event_loop;
+
+    auto directory = TRY_OR_FAIL(FileSystem::TempFile::create_temp_directory());
+    auto disk_cache = TRY_OR_FAIL(RequestServer::DiskCache::create(LexicalPath { directory->path().to_byte_string() }, 50));
+
+    write_entry(disk_cache, "https://ladybird.org/1"sv, 20);
+    wait_for_next_access_time();
+    write_entry(disk_cache, "https://ladybird.org/2"sv, 20);
+    wait_for_next_access_time();
+
+    // The target size is 45 bytes, so evicting the oldest entry is enough.
+    write_entry(disk_cache, "https://ladybird.org/3"sv, 20);
+
+    EXPECT_EQ(disk_cache.statistics().evicted_entries, 1u);
+    EXPECT_EQ(disk_cache.size(), 40u);
+    EXPECT(disk_cache.open_entry(parse_url("https://ladybird.org/3"sv), "GET"sv).has_value());
+}
+
+TEST_CASE(disk_cache_eviction_spans_multiple_index_batches)
+{
+    Core::EventLoop event_loop;
+
+    auto directory = TRY_OR_FAIL(FileSystem::TempFile::create_temp_directory());
+    auto disk_cache = TRY_OR_FAIL(RequestServer::DiskCache::create(LexicalPath { directory->path().to_byte_string() }, 200 * 10));
+
+    // Many small entries followed by a single large one, so that a single eviction run has to walk past more entries
+    // than are read from the index at once.
+    for (size_t i = 0; i < 200; ++i)
+        write_entry(disk_cache, ByteString::formatted("https://ladybird.org/{}", i), 10);
+
+    EXPECT_EQ(disk_cache.size(), 2000u);
+    wait_for_next_access_time();
+
+    write_entry(disk_cache, "https://ladybird.org/large"sv, 1500);
+
+    EXPECT_EQ(disk_cache.statistics().eviction_runs, 1u);
+    EXPECT_EQ(disk_cache.statistics().evicted_entries, 170u);
+    EXPECT_EQ(disk_cache.size(), 1800u);
+}
+
+TEST_CASE(disk_cache_counts_memory_and_disk_hits)
+{
+    Core::EventLoop event_loop;
+
+    auto directory = TRY_OR_FAIL(FileSystem::TempFile::create_temp_directory());
+    auto disk_cache = TRY_OR_FAIL(RequestServer::DiskCache::create(LexicalPath { directory->path().to_byte_string() }));
+
+    auto url = parse_url("https://ladybird.org/favicon.ico"sv);
+    write_entry(disk_cache, "https://ladybird.org/favicon.ico"sv, 100);
+
+    // Small responses are written through to the memory cache.
+    EXPECT(disk_cache.memory_cache().size() > 0);
+    EXPECT(disk_cache.open_entry(url, "GET"sv).has_value());
+    EXPECT_EQ(disk_cache.statistics().memory_cache_hits, 1u);
+    EXPECT_EQ(disk_cache.statistics().disk_cache_hits, 0u);
+
+    disk_cache.memory_cache().remove_all_entries();
+    EXPECT(disk_cache.open_entry(url, "GET"sv).has_value());
+    EXPECT_EQ(disk_cache.statistics().memory_cache_hits, 1u);
+    EXPECT_EQ(disk_cache.statistics().disk_cache_hits, 1u);
+
+    EXPECT(!disk_cache.open_entry(parse_url("https://ladybird.org/missing"sv), "GET"sv).has_value());
+    EXPECT_EQ(disk_cache.statistics().cache_misses, 1u);
+}
+
+TEST_CASE(request_type_from_headers)
+{
+    using RequestType = RequestServer::DiskCache::RequestType;
+
+    auto request_type = [](Vector<HTTP::Header> headers) {
+        return RequestServer::DiskCache::request_type_from_headers(HTTP::HeaderMap { move(headers) });
+    };
+
+    EXPECT_EQ(request_type({}), RequestType::Normal);
+    EXPECT_EQ(request_type({ { "Sec-Fetch-Mode", "cors" } }), RequestType::Normal);
+    EXPECT_EQ(request_type({ { "Sec-Fetch-Mode", "navigate" } }), RequestType::Navigation);
+    EXPECT_EQ(request_type({ { "Sec-Purpose", "prefetch" } }), RequestType::Prefetch);
+    EXPECT_EQ(request_type({ { "Sec-Purpose", "prefetch;anonymous-client-ip" } }), RequestType::Prefetch);
+    EXPECT_EQ(request_type({ { "Sec-Purpose", "prefetch" }, { "Sec-Fetch-Mode", "navigate" } }), RequestType::Prefetch);
+}
+
+TEST_CASE(disk_cache_counts_prefetch_hits)
+{
+    using RequestType = RequestServer::DiskCache::RequestType;
+
+    Core::EventLoop event_loop;
+
+    auto directory = TRY_OR_FAIL(FileSystem::TempFile::create_temp_directory());
+    auto disk_cache = TRY_OR_FAIL(RequestServer::DiskCache::create(LexicalPath { directory->path().to_byte_string() }));
+
+    auto prefetched_url = parse_url("https://ladybird.org/prefetched"sv);
+    auto navigated_url = parse_url("https://ladybird.org/navigated"sv);
+
+    // Prefetch requests are counted, but do not count as hits on prefetched entries themselves.
+    EXPECT(!disk_cache.open_entry(prefetched_url, "GET"sv, RequestType::Prefetch).has_value());
+    write_entry(disk_cache, "https://ladybird.org/prefetched"sv, 100, RequestType::Prefetch);
+    EXPECT(disk_cache.open_entry(prefetched_url, "GET"sv, RequestType::Prefetch).has_value());
+
+    EXPECT_EQ(disk_cache.statistics().prefetch_requests, 2u);
+    EXPECT_EQ(disk_cache.statistics().prefetched_entries, 1u);
+    EXPECT_EQ(disk_cache.statistics().prefetch_hits, 0u);
+
+    // Only the first later use of a prefetched entry is attributed to the prefetch.
+    EXPECT(disk_cache.open_entry(prefetched_url, "GET"sv).has_value());
+    EXPECT(disk_cache.open_entry(prefetched_url, "GET"sv).has_value());
+
+    EXPECT_EQ(disk_cache.statistics().prefetch_hits, 1u);
+    EXPECT_EQ(disk_cache.statistics().navigation_prefetch_hits, 0u);
+
+    write_entry(disk_cache, "https://ladybird.org/navigated"sv, 100, RequestType::Prefetch);
+    EXPECT(disk_cache.open_entry(navigated_url, "GET"sv, RequestType::Navigation).has_value());
+
+    EXPECT_EQ(disk_cache.statistics().prefetched_entries, 2u);
+    EXPECT_EQ(disk_cache.statistics().prefetch_hits, 2u);
+    EXPECT_EQ(disk_cache.statistics().navigation_prefetch_hits, 1u);
+}
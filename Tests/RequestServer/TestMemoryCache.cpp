@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ByteBuffer.h>
+#include <LibTest/TestCase.h>
+#include <RequestServer/Cache/MemoryCache.h>
+
+static NonnullRefPtr<RequestServer::MemoryCacheEntry> create_entry(size_t data_size)
+{
+    auto data = MUST(ByteBuffer::create_zeroed(data_size));
+    return RequestServer::MemoryCacheEntry::create(200, {}, {}, move(data), UnixDateTime::now(), UnixDateTime::now());
+}
+
+TEST_CASE(find_entry)
+{
+    RequestServer::MemoryCache cache;
+
+    auto entry = create_entry(100);
+    cache.create_entry(1, entry);
+
+    EXPECT_EQ(cache.find_entry(1), entry);
+    EXPECT_EQ(cache.find_entry(2), nullptr);
+    EXPECT_EQ(cache.size(), entry->memory_usage());
+
+    cache.remove_entry(1);
+    EXPECT_EQ(cache.find_entry(1), nullptr);
+    EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST_CASE(replace_entry)
+{
+    RequestServer::MemoryCache cache;
+
+    cache.create_entry(1, create_entry(100));
+
+    auto entry = create_entry(200);
+    cache.create_entry(1, entry);
+
+    EXPECT_EQ(cache.find_entry(1), entry);
+    EXPECT_EQ(cache.size(), entry->memory_usage());
+}
+
+TEST_CASE(evict_least_recently_used_entries)
+{
+    auto entry_size = create_entry(100)->memory_usage();
+    RequestServer::MemoryCache cache { entry_size * 3 };
+
+    cache.create_entry(1, create_entry(100));
+    cache.create_entry(2, create_entry(100));
+    cache.create_entry(3, create_entry(100));
+    EXPECT_EQ(cache.size(), entry_size * 3);
+
+    // Looking up the oldest entry makes it the most recently used entry.
+    EXPECT_NE(cache.find_entry(1), nullptr);
+
+    cache.create_entry(4, create_entry(100));
+    EXPECT_EQ(cache.size(), entry_size * 3);
+
+    EXPECT_NE(cache.find_entry(1), nullptr);
+    EXPECT_EQ(cache.find_entry(2), nullptr);
+    EXPECT_NE(cache.find_entry(3), nullptr);
+    EXPECT_NE(cache.find_entry(4), nullptr);
+}
+
+TEST_CASE(entries_larger_than_the_cache_are_not_stored)
+{
+    auto entry_size = create_entry(100)->memory_usage();
+    RequestServer::MemoryCache cache { entry_size };
+
+    cache.create_entry(1, create_entry(100));
+    cache.create_entry(2, create_entry(200));
+
+    EXPECT_NE(cache.find_entry(1), nullptr);
+    EXPECT_EQ(cache.find_entry(2), nullptr);
+    EXPECT_EQ(cache.size(), entry_size);
+}
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Vector.h>
+#include <LibTest/TestCase.h>
+#include <RequestServer/RequestScheduler.h>
+
+using RequestServer::RequestPriority;
+using RequestServer::RequestScheduler;
+
+static constexpr auto DELAYABLE_LIMIT = RequestScheduler::MAXIMUM_DELAYABLE_TRANSFERS_PER_HOST;
+
+TEST_CASE(medium_and_high_priority_transfers_start_immediately)
+{
+    Vector<i32> started;
+    RequestScheduler scheduler { [&](i32 request_id) { started.append(request_id); } };
+
+    for (i32 request_id = 0; request_id < 20; ++request_id)
+        scheduler.schedule_transfer(request_id, "ladybird.org", request_id % 2 == 0 ? RequestPriority::Medium : RequestPriority::High);
+
+    EXPECT_EQ(started.size(), 20u);
+}
+
+TEST_CASE(delayable_transfers_are_limited_per_host)
+{
+    Vector<i32> started;
+    RequestScheduler scheduler { [&](i32 request_id) { started.append(request_id); } };
+
+    for (i32 request_id = 0; request_id < static_cast<i32>(DELAYABLE_LIMIT) + 2; ++request_id)
+        scheduler.schedule_transfer(request_id, "ladybird.org", RequestPriority::Low);
+
+    EXPECT_EQ(started.size(), DELAYABLE_LIMIT);
+
+    // Other hosts have their own limit.
+    scheduler.schedule_transfer(100, "example.com", RequestPriority::Idle);
+    EXPECT_EQ(started.size(), DELAYABLE_LIMIT + 1);
+    EXPECT_EQ(started.last(), 100);
+
+    // Finishing a transfer starts the next queued transfer for its host.
+    scheduler.transfer_finished(0);
+    EXPECT_EQ(started.size(), DELAYABLE_LIMIT + 2);
+    EXPECT_EQ(started.last(), static_cast<i32>(DELAYABLE_LIMIT));
+
+    // Finishing an unknown transfer does nothing.
+    scheduler.transfer_finished(1000);
+    EXPECT_EQ(started.size(), DELAYABLE_LIMIT + 2);
+}
+
+TEST_CASE(delayable_transfers_are_blocked_by_high_priority_transfers)
+{
+    Vector<i32> started;
+    RequestScheduler scheduler { [&](i32 request_id) { started.append(request_id); } };
+
+    scheduler.schedule_transfer(0, "ladybird.org", RequestPriority::High);
+
+    for (i32 request_id = 1; request_id <= 3; ++request_id)
+        scheduler.schedule_transfer(request_id, "ladybird.org", RequestPriority::Low);
+
+    EXPECT_EQ(started, (Vector<i32> { 0, 1 }));
+
+    // A high priority transfer to another host does not block this host.
+    scheduler.schedule_transfer(10, "example.com", RequestPriority::High);
+    scheduler.schedule_transfer(11, "example.com", RequestPriority::Low);
+    scheduler.schedule_transfer(12, "example.com", RequestPriority::Low);
+    EXPECT_EQ(started, (Vector<i32> { 0, 1, 10, 11 }));
+
+    // Once the high priority transfer has finished, the remaining transfers start up to the regular limit.
+    scheduler.transfer_finished(0);
+    EXPECT_EQ(started, (Vector<i32> { 0, 1, 10, 11, 2, 3 }));
+}
+
+TEST_CASE(queued_transfers_start_in_order_of_priority)
+{
+    Vector<i32> started;
+    RequestScheduler scheduler { [&](i32 request_id) { started.append(request_id); } };
+
+    for (i32 request_id = 0; request_id < static_cast<i32>(DELAYABLE_LIMIT); ++request_id)
+        scheduler.schedule_transfer(request_id, "ladybird.org", RequestPriority::Low);
+
+    scheduler.schedule_transfer(100, "ladybird.org", RequestPriority::Idle);
+    scheduler.schedule_transfer(101, "ladybird.org", RequestPriority::Low);
+    scheduler.schedule_transfer(102, "ladybird.org", RequestPriority::Idle);
+    scheduler.schedule_transfer(103, "ladybird.org", RequestPriority::Low);
+    EXPECT_EQ(started.size(), DELAYABLE_LIMIT);
+
+    for (i32 request_id = 0; request_id < 4; ++request_id)
+        scheduler.transfer_finished(request_id);
+
+    EXPECT_EQ(started.size(), DELAYABLE_LIMIT + 4);
+    EXPECT_EQ(started[DELAYABLE_LIMIT + 0], 101);
+    EXPECT_EQ(started[DELAYABLE_LIMIT + 1], 103);
+    EXPECT_EQ(started[DELAYABLE_LIMIT + 2], 100);
+    EXPECT_EQ(started[DELAYABLE_LIMIT + 3], 102);
+}
+
+TEST_CASE(raised_transfers_start_before_their_peers)
+{
+    Vector<i32> started;
+    RequestScheduler scheduler { [&](i32 request_id) { started.append(request_id); } };
+
+    for (i32 request_id = 0; request_id < static_cast<i32>(DELAYABLE_LIMIT); ++request_id)
+        scheduler.schedule_transfer(request_id, "ladybird.org", RequestPriority::Low);
+
+    scheduler.schedule_transfer(100, "ladybird.org", RequestPriority::Low);
+    scheduler.schedule_transfer(101, "ladybird.org", RequestPriority::Idle);
+    scheduler.schedule_transfer(102, "ladybird.org", RequestPriority::Idle);
+    scheduler.schedule_transfer(103, "ladybird.org", RequestPriority::Low);
+    EXPECT_EQ(started.size(), DELAYABLE_LIMIT);
+
+    // Raising a queued transfer above the delayable priorities starts it right away, e.g. an image that scrolled into view.
+    scheduler.set_priority(103, RequestPriority::High);
+    EXPECT_EQ(started.size(), DELAYABLE_LIMIT + 1);
+    EXPECT_EQ(started.last(), 103);
+
+    // A transfer that is raised while it is still delayable moves ahead of the transfers it was queued behind.
+    scheduler.set_priority(102, RequestPriority::Low);
+    scheduler.transfer_finished(103);
+    for (i32 request_id = 0; request_id < 3; ++request_id)
+        scheduler.transfer_finished(request_id);
+
+    EXPECT_EQ(started.size(), DELAYABLE_LIMIT + 4);
+    EXPECT_EQ(started[DELAYABLE_LIMIT + 1], 100);
+    EXPECT_EQ(started[DELAYABLE_LIMIT + 2], 102);
+    EXPECT_EQ(started[DELAYABLE_LIMIT + 3], 101);
+
+    // Changing the priority of an unknown transfer does nothing.
+    scheduler.set_priority(1000, RequestPriority::High);
+    EXPECT_EQ(started.size(), DELAYABLE_LIMIT + 4);
+}
+
+TEST_CASE(http2_stream_weight)
+{
+    EXPECT(RequestScheduler::http2_stream_weight(RequestPriority::Idle) < RequestScheduler::http2_stream_weight(RequestPriority::Low));
+    EXPECT(RequestScheduler::http2_stream_weight(RequestPriority::Low) < RequestScheduler::http2_stream_weight(RequestPriority::Medium));
+    EXPECT(RequestScheduler::http2_stream_weight(RequestPriority::Medium) < RequestScheduler::http2_stream_weight(RequestPriority::High));
+
+    // RFC 7540 stream weights are between 1 and 256 inclusive.
+    EXPECT_EQ(RequestScheduler::http2_stream_weight(RequestPriority::Idle), 1);
+    EXPECT_EQ(RequestScheduler::http2_stream_weight(RequestPriority::High), 256);
+}
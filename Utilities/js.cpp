@@ -7,16 +7,18 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/JsonValue.h>
 #include <AK/NeverDestroyed.h>
 #include <AK/Platform.h>
 #include <AK/StringBuilder.h>
 #include <LibCore/ArgsParser.h>
 #include <LibCore/ConfigFile.h>
+#include <LibCore/ElapsedTimer.h>
+#include <LibCore/File.h>
 #include <LibCore/StandardPaths.h>
 #include <LibJS/Bytecode/BasicBlock.h>
 #include <LibJS/Bytecode/Generator.h>
 #include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/CodeCache.h>
 #include <LibJS/Console.h>
 #include <LibJS/Contrib/Test262/GlobalObject.h>
 #include <LibJS/Parser.h>
@@ -288,11 +290,7 @@ static JS::ThrowCompletionOr<JS::Value> load_json_impl(JS::VM& vm)
     if (file_contents_or_error.is_error())
         return vm.throw_completion<JS::Error>(TRY_OR_THROW_OOM(vm, String::formatted("Failed to read '{}': {}", filename, file_contents_or_error.error())));
 
-    auto json = JsonValue::from_string(file_contents_or_error.value());
-    if (json.is_error())
-        return vm.throw_completion<JS::SyntaxError>(JS::ErrorType::JsonMalformed);
-
-    return JS::JSONObject::parse_json_value(vm, json.value());
+    return JS::JSONObject::parse_json(vm, file_contents_or_error.value());
 }
 
 void ReplObject::initialize(JS::Realm& realm)
@@ -813,9 +811,14 @@ static ErrorOr<int> run_repl(bool gc_on_every_allocation, bool syntax_highlight)
 ErrorOr<int> ladybird_main(Main::Arguments arguments)
 {
     bool gc_on_every_allocation = false;
+    size_t gc_marking_helper_threads = 0;
     bool disable_syntax_highlight = false;
     bool disable_debug_printing = false;
     bool use_test262_global = false;
+    size_t startup_benchmark_iterations = 0;
+    StringView heap_snapshot_path;
+    bool allocation_profile = false;
+    size_t allocation_profile_interval = GC::AllocationProfiler::default_sampling_interval_in_bytes;
     StringView evaluate_script;
     Vector<StringView> script_paths;
 
@@ -823,16 +826,24 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.set_general_help("This is a JavaScript interpreter.");
     args_parser.add_option(s_dump_ast, "Dump the AST", "dump-ast", 'A');
     args_parser.add_option(JS::Bytecode::g_dump_bytecode, "Dump the bytecode", "dump-bytecode", 'd');
+    args_parser.add_option(JS::Bytecode::g_jit_enabled, "Compile hot code with the baseline JIT", "jit");
+    args_parser.add_option(JS::Bytecode::g_collect_inline_cache_statistics, "Report the state of every property inline cache, and which ones miss most often", "inline-cache-statistics", {});
     args_parser.add_option(s_as_module, "Treat as module", "as-module", 'm');
     args_parser.add_option(s_print_last_result, "Print last result", "print-last-result", 'l');
     args_parser.add_option(s_strip_ansi, "Disable ANSI colors", "disable-ansi-colors", 'i');
     args_parser.add_option(s_disable_source_location_hints, "Disable source location hints", "disable-source-location-hints", 'h');
     args_parser.add_option(gc_on_every_allocation, "GC on every allocation", "gc-on-every-allocation", 'g');
+    args_parser.add_option(gc_marking_helper_threads, "Number of helper threads that mark the heap in parallel", "gc-marking-helper-threads", {}, "count");
     args_parser.add_option(s_raw_strings, "Display strings without quotes or escape sequences", "raw-strings", 'r');
     args_parser.add_option(disable_syntax_highlight, "Disable live syntax highlighting", "no-syntax-highlight", 's');
     args_parser.add_option(disable_debug_printing, "Disable debug output", "disable-debug-output", {});
     args_parser.add_option(evaluate_script, "Evaluate argument as a script", "evaluate", 'c', "script");
     args_parser.add_option(use_test262_global, "Use test262 global ($262)", "use-test262-global", {});
+    args_parser.add_option(startup_benchmark_iterations, "Run the script again in N fresh realms, reporting the time taken by each run", "startup-benchmark", {}, "N");
+    args_parser.add_option(JS::g_collect_lazy_function_parsing_statistics, "Report how many functions were parsed lazily, how many of them were never fully parsed, and what that saved", "lazy-parsing-statistics", {});
+    args_parser.add_option(heap_snapshot_path, "Write a snapshot of the heap to the given file after running the script", "heap-snapshot", {}, "path");
+    args_parser.add_option(allocation_profile, "Sample allocations while running the script, and report where they came from", "allocation-profile", {});
+    args_parser.add_option(allocation_profile_interval, "Sample one allocation every N bytes when profiling allocations", "allocation-profile-interval", {}, "N");
     args_parser.add_positional_argument(script_paths, "Path to script files", "scripts", Core::ArgsParser::Required::No);
     args_parser.parse(arguments);
 
@@ -844,6 +855,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     g_vm_storage.get() = JS::VM::create();
     g_vm = g_vm_storage->ptr();
     g_vm->set_dynamic_imports_allowed(true);
+    g_vm->heap().set_marking_helper_thread_count(gc_marking_helper_threads);
 
     if (!disable_debug_printing) {
         // NOTE: These will print out both warnings when using something like Promise.reject().catch(...) -
@@ -917,8 +929,66 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
 
         // We resolve modules as if it is the first file
 
+        if (allocation_profile)
+            g_vm->heap().start_allocation_profiling(allocation_profile_interval);
+
         if (!TRY(parse_and_run(realm, builder.string_view(), source_name)))
             return 1;
+
+        if (auto profiler = g_vm->heap().stop_allocation_profiling()) {
+            auto stderr_stream = TRY(Core::File::standard_error());
+            TRY(profiler->write_report(*stderr_stream));
+        }
+
+        if (!heap_snapshot_path.is_empty()) {
+            auto file = TRY(Core::File::open(heap_snapshot_path, Core::File::OpenMode::Write));
+            auto output = TRY(Core::OutputBufferedFile::create(move(file)));
+            TRY(g_vm->heap().write_heap_snapshot(*output));
+            TRY(output->flush_buffer());
+        }
+
+        // Each run after the first may reuse the parsed program and bytecode of the first run through the code cache,
+        // so comparing the first run against these shows the time saved on warm startup.
+        for (size_t iteration = 0; iteration < startup_benchmark_iterations; ++iteration) {
+            auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+
+            auto execution_context = JS::create_simple_execution_context<ScriptObject>(*g_vm);
+            auto success = TRY(parse_and_run(*execution_context->realm, builder.string_view(), source_name));
+            g_vm->pop_execution_context();
+
+            if (!success)
+                return 1;
+            warnln("Startup run {}: {}us", iteration + 1, timer.elapsed_time().to_microseconds());
+        }
+
+        if (startup_benchmark_iterations > 0) {
+            auto const& statistics = g_vm->code_cache().statistics();
+            warnln("Code cache: {} hits, {} misses, ~{} bytes retained", statistics.hits, statistics.misses, g_vm->code_cache().size());
+        }
+
+        if (JS::Bytecode::g_collect_inline_cache_statistics)
+            g_vm->bytecode_interpreter().dump_inline_cache_statistics();
+
+        if (JS::g_collect_lazy_function_parsing_statistics) {
+            auto const& statistics = JS::Parser::lazy_function_parsing_statistics();
+            warnln("Lazy parsing: {} functions ({} code units) parsed lazily, discarding {} bytes of AST", statistics.lazily_parsed_functions, statistics.lazily_parsed_source_length, statistics.discarded_ast_size);
+            warnln("Lazy parsing: {} functions ({} code units) fully parsed on first use, taking {}us and creating {} bytes of AST", statistics.reparsed_functions, statistics.reparsed_source_length, statistics.time_spent_reparsing.to_microseconds(), statistics.reparsed_ast_size);
+            warnln("Lazy parsing: {} nested function bodies ({} code units) skipped while doing so, saving ~{}us and {} bytes of AST not created", statistics.skipped_functions, statistics.skipped_source_length, statistics.time_saved_by_skipping.to_microseconds(), statistics.skipped_ast_size);
+            warnln("Lazy parsing: {} functions ({} code units) never fully parsed, saving {} bytes of AST", statistics.lazily_parsed_functions - statistics.reparsed_functions, statistics.lazily_parsed_source_length - statistics.reparsed_source_length, statistics.discarded_ast_size - min(statistics.discarded_ast_size, statistics.reparsed_ast_size));
+
+            // NOTE: Counting the AST nodes would add to both parse times.
+            JS::g_collect_lazy_function_parsing_statistics = false;
+
+            auto time_parse = [&](bool lazy_function_parsing) {
+                auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+                auto parser = JS::Parser(JS::Lexer(builder.string_view(), source_name), s_as_module ? JS::Program::Type::Module : JS::Program::Type::Script);
+                if (lazy_function_parsing)
+                    parser.enable_lazy_function_parsing();
+                (void)parser.parse_program();
+                return timer.elapsed_time().to_microseconds();
+            };
+            warnln("Lazy parsing: parsing the source takes {}us eagerly, {}us lazily", time_parse(false), time_parse(true));
+        }
     }
 
     return s_exit_code;
@@ -324,6 +324,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     parser.add_option(attempt_instantiate, "Attempt to instantiate the module", "instantiate", 'i');
     parser.add_option(exported_function_to_execute, "Attempt to execute the named exported function from the module (implies -i)", "execute", 'e', "name");
     parser.add_option(export_all_imports, "Export noop functions corresponding to imports", "export-noop");
+    parser.add_option(Wasm::g_jit_enabled, "Compile hot functions to native code", "jit");
 #if !defined(AK_OS_WINDOWS)
     parser.add_option(wasi, "Enable WASI", "wasi", 'w');
 #endif